@@ -26,7 +26,8 @@
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
-#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh, MatVisitorSubMesh
+#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh
+#include "pylith/topology/MatAssemblyMap.hh" // USES MatAssemblyMap
 #include "pylith/topology/Stratum.hh" // USES Stratum
 
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
@@ -107,12 +108,20 @@ pylith::bc::AbsorbingDampers::initialize(const topology::Mesh& mesh,
   const int numQuadPts = _quadrature->numQuadPts();
   const int spaceDim = cellGeometry.spaceDim();
   const int fiberDim = numQuadPts * spaceDim;
+  const int operatorSize = numBasis * numBasis * spaceDim;
+  const int operatorLumpedSize = numBasis * spaceDim;
+  const scalar_array& quadWts = _quadrature->quadWts();
+  assert(quadWts.size() == size_t(numQuadPts));
 
   delete _parameters;
   _parameters = new topology::Fields(*_boundaryMesh);
   assert(_parameters);
   _parameters->add("damping constants", "damping_constants", topology::FieldBase::FACES_FIELD, fiberDim);
   _parameters->get("damping constants").allocate();
+  _parameters->add("damping operator", "damping_operator", topology::FieldBase::FACES_FIELD, operatorSize);
+  _parameters->get("damping operator").allocate();
+  _parameters->add("damping operator lumped", "damping_operator_lumped", topology::FieldBase::FACES_FIELD, operatorLumpedSize);
+  _parameters->get("damping operator lumped").allocate();
 
   // Containers for orientation information
   const int orientationSize = spaceDim * spaceDim;
@@ -143,6 +152,10 @@ pylith::bc::AbsorbingDampers::initialize(const topology::Mesh& mesh,
   topology::Field& dampingConsts = _parameters->get("damping constants");
   topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
 
+  // Integrated damping operators (consistent and lumped) for current cell
+  topology::VecVisitorMesh operatorVisitor(_parameters->get("damping operator"));
+  topology::VecVisitorMesh operatorLumpedVisitor(_parameters->get("damping operator lumped"));
+
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
@@ -161,6 +174,8 @@ pylith::bc::AbsorbingDampers::initialize(const topology::Mesh& mesh,
   topology::CoordsVisitor::optimizeClosure(dmSubMesh);
 
   PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
+  PetscScalar* operatorArray = operatorVisitor.localArray();
+  PetscScalar* operatorLumpedArray = operatorLumpedVisitor.localArray();
 
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
@@ -216,6 +231,43 @@ pylith::bc::AbsorbingDampers::initialize(const topology::Mesh& mesh,
         dampingConstsArray[doff+iQuad*spaceDim+iDim] = fabs(dampingConstsArray[doff+iQuad*spaceDim+iDim]);
       } // for
     } // for
+
+    // Integrate damping operators over the cell. They depend only on
+    // the geometry and damping constants, so the residual and
+    // Jacobian reduce to gathering, scaling, and scattering values.
+    const PetscInt ooff = operatorVisitor.sectionOffset(c);
+    const PetscInt loff = operatorLumpedVisitor.sectionOffset(c);
+    assert(operatorSize == operatorVisitor.sectionDof(c));
+    assert(operatorLumpedSize == operatorLumpedVisitor.sectionDof(c));
+    for (int i=0; i < operatorSize; ++i) {
+      operatorArray[ooff+i] = 0.0;
+    } // for
+    for (int i=0; i < operatorLumpedSize; ++i) {
+      operatorLumpedArray[loff+i] = 0.0;
+    } // for
+
+    const scalar_array& basis = _quadrature->basis();
+    const scalar_array& quadJacobianDet = _quadrature->jacobianDet();
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar wt = quadWts[iQuad] * quadJacobianDet[iQuad];
+      const int iQ = iQuad * numBasis;
+      PylithScalar valJ = 0.0;
+      for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+        valJ += basis[iQ+jBasis];
+      } // for
+      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+        const PylithScalar valI = wt*basis[iQ+iBasis];
+        for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+          const PylithScalar valIJ = valI * basis[iQ+jBasis];
+          for (int iDim=0; iDim < spaceDim; ++iDim) {
+            operatorArray[ooff+(iBasis*numBasis+jBasis)*spaceDim+iDim] += valIJ * dampingConstsArray[doff+iQuad*spaceDim+iDim];
+          } // for
+        } // for
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+          operatorLumpedArray[loff+iBasis*spaceDim+iDim] += valI * valJ * dampingConstsArray[doff+iQuad*spaceDim+iDim];
+        } // for
+      } // for
+    } // for
   } // for
 
   _db->close();
@@ -241,17 +293,13 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
   const int setupEvent = _logger->eventId("AdIR setup");
   const int computeEvent = _logger->eventId("AdIR compute");
 #if defined(DETAILED_EVENT_LOGGING)
-  const int geometryEvent = _logger->eventId("AdIR geometry");
   const int restrictEvent = _logger->eventId("AdIR restrict");
   const int updateEvent = _logger->eventId("AdIR update");
 #endif
 
   _logger->eventBegin(setupEvent);
 
-  // Get cell geometry information that doesn't depend on cell
-  const int numQuadPts = _quadrature->numQuadPts();
-  const scalar_array& quadWts = _quadrature->quadWts();
-  assert(quadWts.size() == size_t(numQuadPts));
+  // Get cell information that doesn't depend on cell
   const int numBasis = _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
 
@@ -259,9 +307,9 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
   _initCellVector();
 
   // Get sections
-  topology::Field& dampingConsts = _parameters->get("damping constants");
-  topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
-  PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
+  topology::Field& dampingOperator = _parameters->get("damping operator");
+  topology::VecVisitorMesh operatorVisitor(dampingOperator);
+  PetscScalar* operatorArray = operatorVisitor.localArray();
 
   // Get subsections
   const PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
@@ -276,9 +324,6 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
   } // if
   scalar_array velocityCell(numBasis*spaceDim);
   
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmSubMesh);
-
   // Get 'surface' cells (1 dimension lower than top-level cells)
   topology::Stratum cellsStratum(dmSubMesh, topology::Stratum::HEIGHT, 1);
   const PetscInt cStart = cellsStratum.begin();
@@ -290,15 +335,7 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
 #endif
 
   for (PetscInt c = cStart; c < cEnd; ++c) {
-    // Get geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
-    coordsVisitor.getClosure(&coordsCell, c);
-    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
-
 #if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
     _logger->eventBegin(restrictEvent);
 #endif
 
@@ -308,30 +345,20 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
     // Restrict input fields to cell
     _velocityVisitor->getClosure(&velocityCell, c);
 
-    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
-    assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
+    const PetscInt ooff = operatorVisitor.sectionOffset(c);
+    assert(numBasis*numBasis*spaceDim == operatorVisitor.sectionDof(c));
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(restrictEvent);
     _logger->eventBegin(computeEvent);
 #endif
 
-    // Get cell geometry information that depends on cell
-    const scalar_array& basis = _quadrature->basis();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-
-    // Compute action for absorbing bc terms
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
-
-      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
-        const PylithScalar valI = wt*basis[iQuad*numBasis+iBasis];
-        for (int jBasis=0; jBasis < numBasis; ++jBasis) {
-          const PylithScalar valIJ = valI * basis[iQuad*numBasis+jBasis];
-          for (int iDim=0; iDim < spaceDim; ++iDim)
-            _cellVector[iBasis*spaceDim+iDim] -= 
-              dampingConstsArray[doff+iQuad*spaceDim+iDim] *
-              valIJ * velocityCell[jBasis*spaceDim+iDim];
+    // Compute action for absorbing bc terms using precomputed operator
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+        const PetscInt iO = ooff + (iBasis*numBasis+jBasis)*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+          _cellVector[iBasis*spaceDim+iDim] -= operatorArray[iO+iDim] * velocityCell[jBasis*spaceDim+iDim];
         } // for
       } // for
     } // for
@@ -339,7 +366,7 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
     _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
 
 #if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(1+numBasis*(1+numBasis*(3*spaceDim))));
+    PetscLogFlops(numBasis*numBasis*spaceDim*2);
     _logger->eventEnd(computeEvent);
     _logger->eventBegin(updateEvent);
 #endif
@@ -350,7 +377,7 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
   } // for
 
 #if !defined(DETAILED_EVENT_LOGGING)
-  PetscLogFlops((cEnd-cStart)*numQuadPts*(1+numBasis*(1+numBasis*(3*spaceDim))));
+  PetscLogFlops((cEnd-cStart)*numBasis*numBasis*spaceDim*2);
   _logger->eventEnd(computeEvent);
 #endif
 
@@ -375,19 +402,16 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
   const int setupEvent = _logger->eventId("AdIR setup");
   const int computeEvent = _logger->eventId("AdIR compute");
 #if defined(DETAILED_EVENT_LOGGING)
-  const int geometryEvent = _logger->eventId("AdIR geometry");
   const int restrictEvent = _logger->eventId("AdIR restrict");
   const int updateEvent = _logger->eventId("AdIR update");
 #endif
 
   _logger->eventBegin(setupEvent);
 
-  // Get cell geometry information that doesn't depend on cell
-  const int numQuadPts = _quadrature->numQuadPts();
-  const scalar_array& quadWts = _quadrature->quadWts();
-  assert(quadWts.size() == size_t(numQuadPts));
+  // Get cell information that doesn't depend on cell
   const int numBasis = _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
+  const int cellVectorSize = numBasis*spaceDim;
 
   // Allocate vectors for cell values.
   _initCellVector();
@@ -399,9 +423,9 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
   const PetscInt cEnd = cellsStratum.end();
 
   // Get sections
-  topology::Field& dampingConsts = _parameters->get("damping constants");
-  topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
-  PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
+  topology::Field& dampingOperator = _parameters->get("damping operator lumped");
+  topology::VecVisitorMesh operatorVisitor(dampingOperator);
+  PetscScalar* operatorArray = operatorVisitor.localArray();
 
   // Get subsections
   // Use _cellVector for cell values.
@@ -414,66 +438,36 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
   } // if
   scalar_array velocityCell(numBasis*spaceDim);
 
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmSubMesh);
-
   _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
 #endif
 
   for (PetscInt c=cStart; c < cEnd; ++c) {
-    // Get geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
-    coordsVisitor.getClosure(&coordsCell, c);
-    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
-
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
     _logger->eventBegin(restrictEvent);
 #endif
 
-    // Reset element vector to zero
-    _resetCellVector();
-
     // Restrict input fields to cell
     _velocityVisitor->getClosure(&velocityCell, c);
 
-    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
-    assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
+    const PetscInt ooff = operatorVisitor.sectionOffset(c);
+    assert(cellVectorSize == operatorVisitor.sectionDof(c));
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(restrictEvent);
     _logger->eventBegin(computeEvent);
 #endif
 
-    // Get cell geometry information that depends on cell
-    const scalar_array& basis = _quadrature->basis();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-
-    // Compute action for absorbing bc terms
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
-      const int iQ = iQuad * numBasis;
-      PylithScalar valJ = 0.0;
-      for (int jBasis = 0; jBasis < numBasis; ++jBasis)
-        valJ += basis[iQ + jBasis];
-      valJ *= wt;
-      for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
-        const PylithScalar valIJ = basis[iQ + iBasis] * valJ;
-        for (int iDim = 0; iDim < spaceDim; ++iDim)
-          _cellVector[iBasis*spaceDim+iDim] -= 
-            dampingConstsArray[doff+iQuad*spaceDim+iDim] *
-            valIJ * velocityCell[iBasis*spaceDim+iDim];
-      } // for
+    // Compute action for absorbing bc terms using precomputed operator
+    for (int i=0; i < cellVectorSize; ++i) {
+      _cellVector[i] = -operatorArray[ooff+i] * velocityCell[i];
     } // for
 
     _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
 
 #if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(1+numBasis+numBasis*(1+spaceDim*3)));
+    PetscLogFlops(cellVectorSize*2);
     _logger->eventEnd(computeEvent);
     _logger->eventBegin(updateEvent);
 #endif
@@ -484,7 +478,7 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
   } // for
 
 #if !defined(DETAILED_EVENT_LOGGING)
-  PetscLogFlops((cEnd-cStart)*numQuadPts*(1+numBasis+numBasis*(1+spaceDim*3)));
+  PetscLogFlops((cEnd-cStart)*cellVectorSize*2);
   _logger->eventEnd(computeEvent);
 #endif
 
@@ -502,6 +496,7 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
 
   assert(_quadrature);
   assert(_boundaryMesh);
+  assert(_parameters);
   assert(_logger);
   assert(jacobian);
   assert(fields);
@@ -509,17 +504,13 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
   const int setupEvent = _logger->eventId("AdIJ setup");
   const int computeEvent = _logger->eventId("AdIJ compute");
 #if defined(DETAILED_EVENT_LOGGING)
-  const int geometryEvent = _logger->eventId("AdIJ geometry");
   const int restrictEvent = _logger->eventId("AdIJ restrict");
   const int updateEvent = _logger->eventId("AdIJ update");
 #endif
 
   _logger->eventBegin(setupEvent);
 
-  // Get cell geometry information that doesn't depend on cell
-  const int numQuadPts = _quadrature->numQuadPts();
-  const scalar_array& quadWts = _quadrature->quadWts();
-  assert(quadWts.size() == size_t(numQuadPts));
+  // Get cell information that doesn't depend on cell
   const int numBasis = _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
 
@@ -530,49 +521,43 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
   const PetscInt cEnd = cellsStratum.end();
 
   // Get sections
-  topology::Field& dampingConsts = _parameters->get("damping constants");
-  topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
-  PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
+  topology::Field& dampingOperator = _parameters->get("damping operator");
+  topology::VecVisitorMesh operatorVisitor(dampingOperator);
+  PetscScalar* operatorArray = operatorVisitor.localArray();
 
-  // Get sparse matrix
+  // Get sparse matrix and map from cell matrices to matrix storage.
   const topology::Field& solution = fields->solution();
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  if (!_jacobianMatVisitor) {
+  if (!_jacobianMap) {
+    _jacobianMap = new topology::MatAssemblyMap;assert(_jacobianMap);
+  } // if
+  if (!_jacobianMap->isCurrent(jacobianMat)) {
     assert(_submeshIS);
-    _jacobianMatVisitor = new topology::MatVisitorSubMesh(jacobianMat, solution, *_submeshIS);assert(_jacobianMatVisitor);
+    _jacobianMap->setup(jacobianMat, solution, *_submeshIS, cStart, cEnd);
   } // if
 
   // Get parameters used in integration.
   const PylithScalar dt = _dt;
   assert(dt > 0);
+  const PylithScalar scale = 1.0 / (2.0 * dt);
 
   // Allocate matrix for cell values.
   _initCellMatrix();
 
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmSubMesh);
-
   _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
 #endif
 
+  _jacobianMap->beginAssembly();
   for(PetscInt c = cStart; c < cEnd; ++c) {
-    // Compute geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
-    coordsVisitor.getClosure(&coordsCell, c);
-    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
-
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
     _logger->eventBegin(restrictEvent);
 #endif
 
-    // Get damping constants
-    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
-    assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
+    // Get damping operator
+    const PetscInt ooff = operatorVisitor.sectionOffset(c);
+    assert(numBasis*numBasis*spaceDim == operatorVisitor.sectionDof(c));
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(restrictEvent);
@@ -582,42 +567,34 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
     // Reset element vector to zero
     _resetCellMatrix();
 
-    // Get cell geometry information that depends on cell
-    const scalar_array& basis = _quadrature->basis();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-
-    // Compute Jacobian for absorbing bc terms
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar wt = 
-        quadWts[iQuad] * jacobianDet[iQuad] / (2.0 * dt);
-      for (int iBasis=0, iQ=iQuad*numBasis; iBasis < numBasis; ++iBasis) {
-        const PylithScalar valI = wt*basis[iQ+iBasis];
-        for (int jBasis=0; jBasis < numBasis; ++jBasis) {
-          const PylithScalar valIJ = valI * basis[iQ+jBasis];
-          for (int iDim=0; iDim < spaceDim; ++iDim) {
-            const int iBlock = (iBasis*spaceDim + iDim) * (numBasis*spaceDim);
-            const int jBlock = (jBasis*spaceDim + iDim);
-            _cellMatrix[iBlock+jBlock] += valIJ * dampingConstsArray[doff+iQuad*spaceDim+iDim];
-          } // for
+    // Compute Jacobian for absorbing bc terms using precomputed operator
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+        const PetscInt iO = ooff + (iBasis*numBasis+jBasis)*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+          const int iBlock = (iBasis*spaceDim + iDim) * (numBasis*spaceDim);
+          const int jBlock = (jBasis*spaceDim + iDim);
+          _cellMatrix[iBlock+jBlock] = scale * operatorArray[iO+iDim];
         } // for
       } // for
     } // for
 #if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(3+numBasis*(1+numBasis*(1+2*spaceDim))));
+    PetscLogFlops(numBasis*numBasis*spaceDim);
     _logger->eventEnd(computeEvent);
     _logger->eventBegin(updateEvent);
 #endif
     
     // Assemble cell contribution into PETSc Matrix
-    _jacobianMatVisitor->setClosure(&_cellMatrix[0], _cellMatrix.size(), c, ADD_VALUES);
+    _jacobianMap->addClosure(&_cellMatrix[0], _cellMatrix.size(), c-cStart);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(updateEvent);
 #endif
   } // for
+  _jacobianMap->endAssembly();
 
 #if !defined(DETAILED_EVENT_LOGGING)
-  PetscLogFlops((cEnd-cStart)*numQuadPts*(3+numBasis*(1+numBasis*(1+2*spaceDim))));
+  PetscLogFlops((cEnd-cStart)*numBasis*numBasis*spaceDim);
   _logger->eventEnd(computeEvent);
 #endif
 
@@ -637,6 +614,7 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
 
   assert(_quadrature);
   assert(_boundaryMesh);
+  assert(_parameters);
   assert(_logger);
   assert(jacobian);
   assert(fields);
@@ -644,19 +622,16 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
   const int setupEvent = _logger->eventId("AdIJ setup");
   const int computeEvent = _logger->eventId("AdIJ compute");
 #if defined(DETAILED_EVENT_LOGGING)
-  const int geometryEvent = _logger->eventId("AdIJ geometry");
   const int restrictEvent = _logger->eventId("AdIJ restrict");
   const int updateEvent = _logger->eventId("AdIJ update");
 #endif
 
   _logger->eventBegin(setupEvent);
 
-  // Get cell geometry information that doesn't depend on cell
-  const int numQuadPts = _quadrature->numQuadPts();
-  const scalar_array& quadWts = _quadrature->quadWts();
-  assert(quadWts.size() == size_t(numQuadPts));
+  // Get cell information that doesn't depend on cell
   const int numBasis = _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
+  const int cellVectorSize = numBasis*spaceDim;
 
   // Get 'surface' cells (1 dimension lower than top-level cells)
   const PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
@@ -667,78 +642,50 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
   // Get parameters used in integration.
   const PylithScalar dt = _dt;
   assert(dt > 0);
+  const PylithScalar scale = 1.0 / (2.0 * dt);
 
   // Allocate matrix for cell values.
   _initCellMatrix();
   _initCellVector();
 
   // Get sections
-  topology::Field& dampingConsts = _parameters->get("damping constants");
-  topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
-  PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
+  topology::Field& dampingOperator = _parameters->get("damping operator lumped");
+  topology::VecVisitorMesh operatorVisitor(dampingOperator);
+  PetscScalar* operatorArray = operatorVisitor.localArray();
 
-  if (!_jacobianMatVisitor) {
+  if (!_jacobianVecVisitor) {
     assert(_submeshIS);
     _jacobianVecVisitor = new topology::VecVisitorSubMesh(*jacobian, *_submeshIS);assert(_jacobianVecVisitor);
   } // if
   
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmSubMesh);
-
   _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
 #endif
 
   for(PetscInt c = cStart; c < cEnd; ++c) {
-    // Compute geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
-    coordsVisitor.getClosure(&coordsCell, c);
-    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
-
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
     _logger->eventBegin(restrictEvent);
 #endif
 
-    // Get damping constants
-    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
-    assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
+    // Get damping operator
+    const PetscInt ooff = operatorVisitor.sectionOffset(c);
+    assert(cellVectorSize == operatorVisitor.sectionDof(c));
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(restrictEvent);
     _logger->eventBegin(computeEvent);
 #endif
 
-    // Reset element vector to zero
-    _resetCellVector();
-
-    // Get cell geometry information that depends on cell
-    const scalar_array& basis = _quadrature->basis();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-
-    // Compute Jacobian for absorbing bc terms
-    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] / (2.0 * dt);
-      const int iQ = iQuad * numBasis;
-      PylithScalar valJ = 0.0;
-      for (int jBasis = 0; jBasis < numBasis; ++jBasis)
-        valJ += basis[iQ + jBasis];
-      valJ *= wt;
-      for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
-        const PylithScalar valIJ = basis[iQ + iBasis] * valJ;
-        for (int iDim = 0; iDim < spaceDim; ++iDim)
-          _cellVector[iBasis * spaceDim + iDim] += valIJ
-              * dampingConstsArray[doff+iQuad * spaceDim + iDim];
-      } // for
+    // Compute Jacobian for absorbing bc terms using precomputed operator
+    for (int i=0; i < cellVectorSize; ++i) {
+      _cellVector[i] = scale * operatorArray[ooff+i];
     } // for
 
     _jacobianVecVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
 
 #if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(4+numBasis+numBasis*(1+spaceDim*2)));
+    PetscLogFlops(cellVectorSize);
     _logger->eventEnd(computeEvent);
     _logger->eventBegin(updateEvent);
 #endif
@@ -748,7 +695,7 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
   } // for
 
 #if !defined(DETAILED_EVENT_LOGGING)
-  PetscLogFlops((cEnd-cStart)*numQuadPts*(4+numBasis+numBasis*(1+spaceDim*2)));
+  PetscLogFlops((cEnd-cStart)*cellVectorSize);
   _logger->eventEnd(computeEvent);
 #endif
 
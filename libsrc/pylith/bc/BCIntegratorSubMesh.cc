@@ -24,7 +24,8 @@
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Stratum.hh" // USES Stratum
-#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh, MatVisitorSubMesh
+#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh
+#include "pylith/topology/MatAssemblyMap.hh" // USES MatAssemblyMap
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 
@@ -34,7 +35,7 @@ pylith::bc::BCIntegratorSubMesh::BCIntegratorSubMesh(void) :
   _boundaryMesh(0),
   _submeshIS(0),
   _residualVisitor(0),
-  _jacobianMatVisitor(0),
+  _jacobianMap(0),
   _jacobianVecVisitor(0),
   _parameters(0)
 { // constructor
@@ -60,7 +61,7 @@ pylith::bc::BCIntegratorSubMesh::deallocate(void)
   delete _boundaryMesh; _boundaryMesh = 0;
 
   delete _residualVisitor; _residualVisitor = 0;
-  delete _jacobianMatVisitor; _jacobianMatVisitor = 0;
+  delete _jacobianMap; _jacobianMap = 0;
   delete _jacobianVecVisitor; _jacobianVecVisitor = 0;
   delete _submeshIS; _submeshIS = 0; // Must destroy visitors first
 
@@ -87,7 +87,7 @@ protected :
   topology::Mesh* _boundaryMesh; ///< Boundary mesh.
   topology::SubMeshIS* _submeshIS; ///< Cache index set for submesh.
   topology::VecVisitorSubMesh* _residualVisitor; ///< Cache residual field visitor.
-  topology::MatVisitorSubMesh* _jacobianMatVisitor; ///< Cache jacobian  matrix visitor.
+  topology::MatAssemblyMap* _jacobianMap; ///< Cache map for adding cell matrices to Jacobian.
   topology::VecVisitorSubMesh* _jacobianVecVisitor; ///< Cache jacobian field visitor.
 
   /// Parameters for boundary condition.
@@ -29,6 +29,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
@@ -84,6 +85,8 @@ pylith::bc::Neumann::initialize(const topology::Mesh& mesh,
   const PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
   topology::CoordsVisitor::optimizeClosure(dmSubMesh);
 
+  _calcBasisWeights();
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -100,16 +103,13 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
   assert(_boundaryMesh);
   assert(_parameters);
 
-  // Get cell geometry information that doesn't depend on cell
+  // Get cell information that doesn't depend on cell
   const int numQuadPts = _quadrature->numQuadPts();
-  const scalar_array& quadWts = _quadrature->quadWts();
-  assert(quadWts.size() == size_t(numQuadPts));
   const int numBasis = _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
 
   // Allocate vectors for cell values.
   _initCellVector();
-  scalar_array tractionsCell(numQuadPts*spaceDim);
 
   // Get cell information
   PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
@@ -123,19 +123,17 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
   topology::VecVisitorMesh valueVisitor(valueField);
   PetscScalar* valueArray = valueVisitor.localArray();
 
-  // Get subsections
-  topology::SubMeshIS submeshIS(*_boundaryMesh);
-  topology::VecVisitorSubMesh residualVisitor(residual, submeshIS);
-  submeshIS.deallocate();
+  topology::VecVisitorMesh weightsVisitor(_parameters->get("basis weights"));
+  PetscScalar* weightsArray = weightsVisitor.localArray();
 
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmSubMesh);
+  // Get subsections
+  assert(_submeshIS);
+  if (!_residualVisitor) {
+    _residualVisitor = new topology::VecVisitorSubMesh(residual, *_submeshIS);assert(_residualVisitor);
+  } // if
 
   // Loop over faces and integrate contribution from each face
   for(PetscInt c = cStart; c < cEnd; ++c) {
-    coordsVisitor.getClosure(&coordsCell, c);
-    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
-
     // Reset element vector to zero
     _resetCellVector();
 
@@ -143,28 +141,23 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
     const PetscInt voff = valueVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == valueVisitor.sectionDof(c));
 
-    // Get cell geometry information that depends on cell
-    const scalar_array& basis = _quadrature->basis();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
+    const PetscInt woff = weightsVisitor.sectionOffset(c);
+    assert(numQuadPts*numBasis == weightsVisitor.sectionDof(c));
 
-    // Compute action for traction bc terms
+    // Compute action for traction bc terms using precomputed weights
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
       for (int iBasis=0; iBasis < numBasis; ++iBasis) {
-        const PylithScalar valI = wt*basis[iQuad*numBasis+iBasis];
-        for (int jBasis=0; jBasis < numBasis; ++jBasis) {
-          const PylithScalar valIJ = valI * basis[iQuad*numBasis+jBasis];
-          for (int iDim=0; iDim < spaceDim; ++iDim)
-            _cellVector[iBasis*spaceDim+iDim] += valueArray[voff+iQuad*spaceDim+iDim] * valIJ;
-        } // for
+        const PylithScalar wt = weightsArray[woff+iQuad*numBasis+iBasis];
+        for (int iDim=0; iDim < spaceDim; ++iDim)
+          _cellVector[iBasis*spaceDim+iDim] += valueArray[voff+iQuad*spaceDim+iDim] * wt;
       } // for
     } // for
 
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
-
-    PetscLogFlops(numQuadPts*(1+numBasis*(1+numBasis*(1+2*spaceDim))));
+    _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
   } // for
 
+  PetscLogFlops((cEnd-cStart)*numQuadPts*numBasis*spaceDim*2);
+
   PYLITH_METHOD_END;
 } // integrateResidual
 
@@ -405,10 +398,9 @@ pylith::bc::Neumann::_queryDB(const char* name,
   const int numQuadPts = _quadrature->numQuadPts();
   const int spaceDim = _quadrature->spaceDim();
   
-  // Containers for database query results and quadrature coordinates in
-  // reference geometry.
-  scalar_array valuesCell(numQuadPts*querySize);
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
+  // Container for quadrature coordinates of all cells.
+  const int numCells = cEnd - cStart;
+  scalar_array quadPtsAll(numCells*numQuadPts*spaceDim);
 
   // Get sections.
   topology::Field& valueField = _parameters->get(name);
@@ -428,39 +420,45 @@ pylith::bc::Neumann::_queryDB(const char* name,
   // Compute quadrature information
   _quadrature->initializeGeometry();
 
-  // Loop over cells in boundary mesh and perform queries.
+  // Loop over cells in boundary mesh and gather quadrature points.
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
     coordsVisitor.getClosure(&coordsCell, c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
     const scalar_array& quadPtsNondim = _quadrature->quadPts();
-    quadPtsGlobal = quadPtsNondim;
-    _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-    
-    valuesCell = 0.0;
-    for (int iQuad=0, iSpace=0; iQuad < numQuadPts; ++iQuad, iSpace+=spaceDim) {
-      const int err = db->query(&valuesCell[iQuad*querySize], querySize,
-                                &quadPtsGlobal[iSpace], spaceDim, cs);
-      
-      if (err) {
-        std::ostringstream msg;
-        msg << "Could not find values at (";
-        for (int i=0; i < spaceDim; ++i)
-          msg << " " << quadPtsGlobal[i+iSpace];
-        msg << ") for traction boundary condition '" << _label
-            << "' using spatial database '" << db->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
+    assert(quadPtsNondim.size() == size_t(numQuadPts*spaceDim));
+    const int qoff = (c-cStart)*numQuadPts*spaceDim;
+    for (int i=0; i < numQuadPts*spaceDim; ++i) {
+      quadPtsAll[qoff+i] = quadPtsNondim[i];
     } // for
-    _normalizer->nondimensionalize(&valuesCell[0], valuesCell.size(), scale);
+  } // for
 
-    // Update section
+  // Query database at all quadrature points.
+  utils::BatchQuery query;
+  query.points(quadPtsAll, spaceDim, lengthScale);
+  scalar_array valuesAll;
+  const int errPoint = query.query(&valuesAll, querySize, db, cs);
+  if (errPoint >= 0) {
+    const PylithScalar* xyz = query.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find values at (";
+    for (int i=0; i < spaceDim; ++i)
+      msg << " " << xyz[i];
+    msg << ") for traction boundary condition '" << _label
+        << "' using spatial database '" << db->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _normalizer->nondimensionalize(&valuesAll[0], valuesAll.size(), scale);
+
+  // Update section
+  for(PetscInt c = cStart; c < cEnd; ++c) {
     const PetscInt voff = valueVisitor.sectionOffset(c);
     const PetscInt vdof = valueVisitor.sectionDof(c);
     assert(numQuadPts*querySize == vdof);
+    const int qoff = (c-cStart)*numQuadPts*querySize;
     for(PetscInt d = 0; d < vdof; ++d)
-      valueArray[voff+d] = valuesCell[d];
+      valueArray[voff+d] = valuesAll[qoff+d];
   } // for
 
   PYLITH_METHOD_END;
@@ -593,6 +591,66 @@ void
   PYLITH_METHOD_END;
 } // paramsLocalToGlobal
 
+// ----------------------------------------------------------------------
+// Integrate basis functions over each boundary cell.
+void
+pylith::bc::Neumann::_calcBasisWeights(void)
+{ // _calcBasisWeights
+  PYLITH_METHOD_BEGIN;
+
+  assert(_boundaryMesh);
+  assert(_parameters);
+  assert(_quadrature);
+
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const scalar_array& quadWts = _quadrature->quadWts();
+  assert(quadWts.size() == size_t(numQuadPts));
+  const int fiberDim = numQuadPts*numBasis;
+
+  // Get 'surface' cells (1 dimension lower than top-level cells)
+  PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
+  topology::Stratum cellsStratum(dmSubMesh, topology::Stratum::HEIGHT, 1);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  _parameters->add("basis weights", "basis_weights", topology::FieldBase::FACES_FIELD, fiberDim);
+  topology::Field& weights = _parameters->get("basis weights");
+  weights.allocate();
+  weights.zeroAll();
+  topology::VecVisitorMesh weightsVisitor(weights);
+  PetscScalar* weightsArray = weightsVisitor.localArray();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
+  topology::CoordsVisitor coordsVisitor(dmSubMesh);
+
+  for(PetscInt c = cStart; c < cEnd; ++c) {
+    coordsVisitor.getClosure(&coordsCell, c);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
+
+    const scalar_array& basis = _quadrature->basis();
+    const scalar_array& jacobianDet = _quadrature->jacobianDet();
+
+    const PetscInt woff = weightsVisitor.sectionOffset(c);
+    assert(fiberDim == weightsVisitor.sectionDof(c));
+
+    // w_i = wt * N_i * sum_j N_j
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
+      PylithScalar valJ = 0.0;
+      for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+	valJ += basis[iQuad*numBasis+jBasis];
+      } // for
+      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+	weightsArray[woff+iQuad*numBasis+iBasis] = wt * basis[iQuad*numBasis+iBasis] * valJ;
+      } // for
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _calcBasisWeights
+
 // ----------------------------------------------------------------------
 // Calculate temporal and spatial variation of value over the list of Submesh.
 void
@@ -121,6 +121,13 @@ protected :
    */
   void _paramsLocalToGlobal(const PylithScalar upDir[3]);
 
+  /** Integrate basis functions over each boundary cell. The weights
+   * combine the quadrature weights, the cell area, and the basis
+   * functions, so integrating the tractions only requires scaling
+   * the tractions at the quadrature points.
+   */
+  void _calcBasisWeights(void);
+
   /** Calculate spatial and temporal variation of value over the list
    *  of submesh.
    *
@@ -26,6 +26,7 @@
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
@@ -239,7 +240,6 @@ pylith::bc::TimeDependentPoints::_queryDB(const char* name,
   const spatialdata::units::Nondimensional& normalizer = _getNormalizer();
   const PylithScalar lengthScale = normalizer.lengthScale();
 
-  scalar_array coordsVertex(spaceDim);
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
   topology::CoordsVisitor coordsVisitor(dmMesh);
   PetscScalar *coordArray = coordsVisitor.localArray();
@@ -248,33 +248,38 @@ pylith::bc::TimeDependentPoints::_queryDB(const char* name,
   topology::VecVisitorMesh parametersVisitor(parametersField);
   PetscScalar* parametersArray = parametersVisitor.localArray();
 
-  scalar_array valueVertex(querySize);
+  // Gather coordinates of vertices for batch query.
   const int numPoints = _points.size();
+  scalar_array coordsPoints(numPoints*spaceDim);
   for (int iPoint=0; iPoint < numPoints; ++iPoint) {
-    // Get dimensionalized coordinates of vertex
     const int coff = coordsVisitor.sectionOffset(_points[iPoint]);
     assert(spaceDim == coordsVisitor.sectionDof(_points[iPoint]));
     for (PetscInt d = 0; d < spaceDim; ++d) {
-      coordsVertex[d] = coordArray[coff+d];
+      coordsPoints[iPoint*spaceDim+d] = coordArray[coff+d];
     } // for
-    normalizer.dimensionalize(&coordsVertex[0], coordsVertex.size(), lengthScale);
-
-    int err = db->query(&valueVertex[0], valueVertex.size(), &coordsVertex[0], coordsVertex.size(), cs);
-    if (err) {
-      std::ostringstream msg;
-      msg << "Error querying for '" << name << "' at (";
-      for (int i=0; i < spaceDim; ++i)
-        msg << "  " << coordsVertex[i];
-      msg << ") using spatial database '" << db->label() << "'.";
-      throw std::runtime_error(msg.str());
-    } // if
-    normalizer.nondimensionalize(&valueVertex[0], valueVertex.size(), scale);
+  } // for
 
-    // Update section
+  utils::BatchQuery query;
+  query.points(coordsPoints, spaceDim, lengthScale);
+  scalar_array valuesPoints;
+  const int errPoint = query.query(&valuesPoints, querySize, db, cs);
+  if (errPoint >= 0) {
+    const PylithScalar* xyz = query.point(errPoint);
+    std::ostringstream msg;
+    msg << "Error querying for '" << name << "' at (";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") using spatial database '" << db->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  normalizer.nondimensionalize(&valuesPoints[0], valuesPoints.size(), scale);
+
+  // Update section
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
     const PetscInt off = parametersVisitor.sectionOffset(_points[iPoint]);
     assert(querySize == parametersVisitor.sectionDof(_points[iPoint]));
     for(int i = 0; i < querySize; ++i) {
-      parametersArray[off+i] = valueVertex[i];
+      parametersArray[off+i] = valuesPoints[iPoint*querySize+i];
     } // for
   } // for
 
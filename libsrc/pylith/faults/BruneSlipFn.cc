@@ -310,6 +310,96 @@ pylith::faults::BruneSlipFn::slip(topology::Field* slip,
   PYLITH_METHOD_END;
 } // slip
 
+// ----------------------------------------------------------------------
+// Add slip at time t at points.
+void
+pylith::faults::BruneSlipFn::_slipPoints(topology::Field* const slipField,
+					 const PylithInt* points,
+					 const int numPoints,
+					 const PylithScalar t)
+{ // _slipPoints
+  PYLITH_METHOD_BEGIN;
+
+  assert(slipField);
+  assert(_parameters);
+  assert(!numPoints || points);
+
+  // Get sections
+  const topology::Field& finalSlip = _parameters->get("final slip");
+  topology::VecVisitorMesh finalSlipVisitor(finalSlip);
+  const PetscScalar* finalSlipArray = finalSlipVisitor.localArray();
+
+  const topology::Field& slipTime = _parameters->get("slip time");
+  topology::VecVisitorMesh slipTimeVisitor(slipTime);
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  const topology::Field& riseTime = _parameters->get("rise time");
+  topology::VecVisitorMesh riseTimeVisitor(riseTime);
+  const PetscScalar* riseTimeArray = riseTimeVisitor.localArray();
+
+  topology::VecVisitorMesh slipVisitor(*slipField);
+  PetscScalar* slipArray = slipVisitor.localArray();
+
+  const int spaceDim = _slipVertex.size();
+  for (int i=0; i < numPoints; ++i) {
+    const PetscInt v = points[i];
+    const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    const PetscInt rtoff = riseTimeVisitor.sectionOffset(v);
+    const PetscInt soff = slipVisitor.sectionOffset(v);
+
+    assert(spaceDim == finalSlipVisitor.sectionDof(v));
+    assert(1 == slipTimeVisitor.sectionDof(v));
+    assert(1 == riseTimeVisitor.sectionDof(v));
+    assert(spaceDim == slipVisitor.sectionDof(v));
+
+    PylithScalar finalSlipMag = 0.0;
+    for (int d=0; d < spaceDim; ++d)
+      finalSlipMag += finalSlipArray[fsoff+d]*finalSlipArray[fsoff+d];
+    finalSlipMag = sqrt(finalSlipMag);
+
+    const PylithScalar slip = _slipFn(t-slipTimeArray[stoff], finalSlipMag, riseTimeArray[rtoff]);
+    const PylithScalar scale = finalSlipMag > 0.0 ? slip / finalSlipMag : 0.0;
+    
+    // Update field
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      slipArray[soff+d] += finalSlipArray[fsoff+d] * scale;
+    } // for
+  } // for
+
+  PetscLogFlops(numPoints * (2+8 + 3*spaceDim));
+
+  PYLITH_METHOD_END;
+} // _slipPoints
+
+// ----------------------------------------------------------------------
+// Get duration of slip at points.
+void
+pylith::faults::BruneSlipFn::_slipDuration(PylithScalar* const duration,
+					   const PylithInt* points,
+					   const int numPoints)
+{ // _slipDuration
+  PYLITH_METHOD_BEGIN;
+
+  assert(_parameters);
+  assert(!numPoints || (duration && points));
+
+  const topology::Field& riseTime = _parameters->get("rise time");
+  topology::VecVisitorMesh riseTimeVisitor(riseTime);
+  const PetscScalar* riseTimeArray = riseTimeVisitor.localArray();
+
+  // Slip approaches final slip exponentially. After 45 time constants
+  // (tau = 0.21081916*riseTime), 1 - exp(-t/tau)*(1+t/tau) rounds to
+  // 1.0, so slip equals final slip to machine precision.
+  for (int i=0; i < numPoints; ++i) {
+    const PetscInt rtoff = riseTimeVisitor.sectionOffset(points[i]);
+    assert(1 == riseTimeVisitor.sectionDof(points[i]));
+    duration[i] = 45.0*0.21081916*riseTimeArray[rtoff];
+  } // for
+
+  PYLITH_METHOD_END;
+} // _slipDuration
+
 // ----------------------------------------------------------------------
 // Get final slip.
 const pylith::topology::Field&
@@ -110,6 +110,32 @@ public :
    */
   const topology::Field& slipTime(void);
 
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Add slip at time t at points.
+   *
+   * @param slipField Slip field over fault surface.
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   * @param t Time t.
+   */
+  void _slipPoints(topology::Field* const slipField,
+		   const PylithInt* points,
+		   const int numPoints,
+		   const PylithScalar t);
+
+  /** Get duration of slip (time from slip initiation after which slip
+   * is constant) at points.
+   *
+   * @param duration Array of durations [output].
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   */
+  void _slipDuration(PylithScalar* const duration,
+		     const PylithInt* points,
+		     const int numPoints);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -260,6 +260,56 @@ pylith::faults::ConstRateSlipFn::slip(topology::Field* slip,
   PYLITH_METHOD_END;
 } // slip
 
+// ----------------------------------------------------------------------
+// Add slip at time t at points.
+void
+pylith::faults::ConstRateSlipFn::_slipPoints(topology::Field* const slipField,
+					     const PylithInt* points,
+					     const int numPoints,
+					     const PylithScalar t)
+{ // _slipPoints
+  PYLITH_METHOD_BEGIN;
+
+  assert(slipField);
+  assert(_parameters);
+  assert(!numPoints || points);
+
+  // Get sections
+  const topology::Field& slipRate = _parameters->get("slip rate");
+  topology::VecVisitorMesh slipRateVisitor(slipRate);
+  const PetscScalar* slipRateArray = slipRateVisitor.localArray();
+
+  const topology::Field& slipTime = _parameters->get("slip time");
+  topology::VecVisitorMesh slipTimeVisitor(slipTime);
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  topology::VecVisitorMesh slipVisitor(*slipField);
+  PetscScalar* slipArray = slipVisitor.localArray();
+
+  const int spaceDim = _slipRateVertex.size();
+  for (int i=0; i < numPoints; ++i) {
+    const PetscInt v = points[i];
+    const PetscInt sroff = slipRateVisitor.sectionOffset(v);
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    const PetscInt soff = slipVisitor.sectionOffset(v);
+
+    assert(spaceDim == slipRateVisitor.sectionDof(v));
+    assert(1 == slipTimeVisitor.sectionDof(v));
+    assert(spaceDim == slipVisitor.sectionDof(v));
+
+    const PylithScalar relTime = t - slipTimeArray[stoff];
+    if (relTime > 0.0) {
+      for(PetscInt d = 0; d < spaceDim; ++d) {
+        slipArray[soff+d] += slipRateArray[sroff+d] * relTime; // Convert slip rate to slip
+      } // for
+    } // if
+  } // for
+
+  PetscLogFlops(numPoints * (1 + spaceDim));
+
+  PYLITH_METHOD_END;
+} // _slipPoints
+
 // ----------------------------------------------------------------------
 // Get final slip.
 const pylith::topology::Field&
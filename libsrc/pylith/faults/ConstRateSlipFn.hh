@@ -102,6 +102,21 @@ public :
    */
   const topology::Field& slipTime(void);
 
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Add slip at time t at points.
+   *
+   * @param slipField Slip field over fault surface.
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   * @param t Time t.
+   */
+  void _slipPoints(topology::Field* const slipField,
+		   const PylithInt* points,
+		   const int numPoints,
+		   const PylithScalar t);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
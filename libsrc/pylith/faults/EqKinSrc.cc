@@ -105,6 +105,30 @@ pylith::faults::EqKinSrc::slip(topology::Field* const slipField,
   PYLITH_METHOD_END;
 } // slip
 
+// ----------------------------------------------------------------------
+// Add slip on fault surface at time t using active set.
+void
+pylith::faults::EqKinSrc::slipActive(topology::Field* const slipField,
+				     topology::Field* const slipFinished,
+				     const PylithScalar t)
+{ // slipActive
+  PYLITH_METHOD_BEGIN;
+
+  assert(_slipfn);
+  _slipfn->slipActive(slipField, slipFinished, t);
+
+  PYLITH_METHOD_END;
+} // slipActive
+
+// ----------------------------------------------------------------------
+// Reset active set of slip time function.
+void
+pylith::faults::EqKinSrc::resetActiveSet(void)
+{ // resetActiveSet
+  assert(_slipfn);
+  _slipfn->resetActiveSet();
+} // resetActiveSet
+
 // ----------------------------------------------------------------------
 // Get final slip.
 const pylith::topology::Field&
@@ -90,6 +90,20 @@ public :
   void slip(topology::Field* const slipField,
 	    const PylithScalar t);
 
+  /** Add slip on fault surface at time t, computing slip only where
+   * slip has started but not finished.
+   *
+   * @param slipField Slip field over fault mesh.
+   * @param slipFinished Slip where slip has finished.
+   * @param t Time t.
+   */
+  void slipActive(topology::Field* const slipField,
+		  topology::Field* const slipFinished,
+		  const PylithScalar t);
+
+  /// Reset active set of slip time function.
+  void resetActiveSet(void);
+
   /** Get final slip.
    *
    * @returns Final slip.
@@ -66,10 +66,15 @@ pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
     _zeroToleranceNormal(1.0e-10),
     _tractPerturbation(0),
     _friction(0),
-    _jacobian(0),
-    _ksp(0),
-    _openFreeSurf(true)
+    _openFreeSurf(true),
+    _sensitivityDirectSolve(false)
 { // constructor
+    for (int iSide=0; iSide < 2; ++iSide) {
+        _jacobian[iSide] = 0;
+        _ksp[iSide] = 0;
+        _jacobianDomain[iSide] = 0;
+        _jacobianDomainState[iSide] = 0;
+    } // for
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -90,8 +95,12 @@ void pylith::faults::FaultCohesiveDyn::deallocate(void)
     _tractPerturbation = 0; // :TODO: Use shared pointer
     _friction = 0; // :TODO: Use shared pointer
 
-    delete _jacobian; _jacobian = 0;
-    PetscErrorCode err = KSPDestroy(&_ksp); PYLITH_CHECK_ERROR(err);
+    for (int iSide=0; iSide < 2; ++iSide) {
+        delete _jacobian[iSide]; _jacobian[iSide] = 0;
+        PetscErrorCode err = KSPDestroy(&_ksp[iSide]); PYLITH_CHECK_ERROR(err);
+        _jacobianDomain[iSide] = 0;
+        _jacobianDomainState[iSide] = 0;
+    } // for
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -151,6 +160,14 @@ pylith::faults::FaultCohesiveDyn::openFreeSurf(const bool value)
     _openFreeSurf = value;
 } // openFreeSurf
 
+// ----------------------------------------------------------------------
+// Set flag for using direct solver for sensitivity problem.
+void
+pylith::faults::FaultCohesiveDyn::sensitivityDirectSolve(const bool value)
+{ // sensitivityDirectSolve
+    _sensitivityDirectSolve = value;
+} // sensitivityDirectSolve
+
 // ----------------------------------------------------------------------
 // Initialize fault. Determine orientation and setup boundary
 void
@@ -749,14 +766,14 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     bool negativeSideFlag = true;
     _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
     _sensitivityReformResidual(negativeSideFlag);
-    _sensitivitySolve();
+    _sensitivitySolve(negativeSideFlag);
     _sensitivityUpdateSoln(negativeSideFlag);
 
     // Solve sensitivity problem for positive side of the fault.
     negativeSideFlag = false;
     _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
     _sensitivityReformResidual(negativeSideFlag);
-    _sensitivitySolve();
+    _sensitivitySolve(negativeSideFlag);
     _sensitivityUpdateSoln(negativeSideFlag);
 
     // Step 4: Update Lagrange multipliers and displacement fields based
@@ -1049,16 +1066,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 { // adjustSolnLumped
     PYLITH_METHOD_BEGIN;
 
-    /// Member prototype for _constrainSolnSpaceXD()
-    typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
-        (scalar_array*,
-        const PylithScalar,
-        const scalar_array&,
-        const scalar_array&,
-        const scalar_array&,
-        const PylithScalar,
-        const bool);
-
     assert(fields);
     assert(_quadrature);
 
@@ -1070,6 +1077,8 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     //            S = C_ki (A_i^{-1} + A_j^{-1}) C_ki^T
     //
     //   * Adjust Lagrange multipliers to match friction criterion
+    //     (done for all vertices at once using the batch interface of
+    //     the friction model)
     //
     //   * DOF k: Adjust displacement increment (solution) to create slip
     //     consistent with Lagrange multiplier constraints
@@ -1089,23 +1098,13 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     // Get cell information and setup storage for cell data
     const int spaceDim = _quadrature->spaceDim();
 
-    // Allocate arrays for vertex values
-    scalar_array tractionTpdtVertex(spaceDim);
-    scalar_array lagrangeTpdtVertex(spaceDim);
-    scalar_array dTractionTpdtVertex(spaceDim);
-    scalar_array dLagrangeTpdtVertex(spaceDim);
-
     // Update time step in friction (can vary).
     _friction->timeStep(_dt);
 
     // Get section information
-    scalar_array slipVertex(spaceDim);
-    scalar_array dispRelVertex(spaceDim);
     topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
     PetscScalar* dispRelArray = dispRelVisitor.localArray();
 
-    scalar_array slipRateVertex(spaceDim);
-
     topology::VecVisitorMesh areaVisitor(_fields->get("area"));
     const PetscScalar* areaArray = areaVisitor.localArray();
 
@@ -1115,9 +1114,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     topology::VecVisitorMesh dispTVisitor(fields->get("disp(t)"));
     const PetscScalar* dispTArray = dispTVisitor.localArray();
 
-    scalar_array dispIncrVertexN(spaceDim);
-    scalar_array dispIncrVertexP(spaceDim);
-    scalar_array lagrangeTIncrVertex(spaceDim);
     topology::VecVisitorMesh dispTIncrVisitor(fields->get("dispIncr(t->t+dt)"));
     PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
 
@@ -1132,24 +1128,30 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
     PetscSection solnGlobalSection = fields->get("dispIncr(t->t+dt)").globalSection(); assert(solnGlobalSection);
 
-    constrainSolnSpace_fn_type constrainSolnSpaceFn;
-    switch (spaceDim) { // switch
-    case 1:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D;
-        break;
-    case 2:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D;
-        break;
-    case 3:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D;
-        break;
-    default:
-        assert(0);
-        throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::adjustSolnLumped.");
-    } // switch
+    // Allocate arrays for values at the (unclamped) vertices, so that
+    // friction can be evaluated for all vertices at once.
+    const int numVertices = _cohesiveVertices.size();
+    int numBatch = 0;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        if (_cohesiveVertices[iVertex].lagrange >= 0) {
+            ++numBatch;
+        } // if
+    } // for
+    int_array batchVertices(numBatch);
+    int_array faultVertices(numBatch);
+    scalar_array slipBatch(numBatch*spaceDim);
+    scalar_array slipRateBatch(numBatch*spaceDim);
+    scalar_array tractionTpdtBatch(numBatch*spaceDim);
+    scalar_array dTractionTpdtBatch(numBatch*spaceDim);
+    scalar_array jacobianShearBatch(numBatch);
+    scalar_array lagrangeTIncrBatch(numBatch*spaceDim);
+    scalar_array dispIncrBatchN(numBatch*spaceDim);
+    scalar_array dispIncrBatchP(numBatch*spaceDim);
+    scalar_array dLagrangeTpdtVertex(spaceDim);
+
+    // Slip rate is not used in the lumped solution (no iteration for
+    // friction).
+    slipRateBatch = 0.0;
 
     _logger->eventEnd(setupEvent);
 
@@ -1157,9 +1159,9 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
-    const int numVertices = _cohesiveVertices.size();
-    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    // Compute increment in Lagrange multipliers and corresponding
+    // slip and traction in the fault coordinate system.
+    for (int iVertex=0, iBatch=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
         const int v_negative = _cohesiveVertices[iVertex].negative;
@@ -1196,9 +1198,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
         assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
 
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
         // Get relative displacement at fault vertex.
         const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
         assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
@@ -1218,6 +1217,12 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         _logger->eventBegin(computeEvent);
 #endif
 
+        PylithScalar* lagrangeTIncrVertex = &lagrangeTIncrBatch[iBatch*spaceDim];
+        PylithScalar* dispIncrVertexN = &dispIncrBatchN[iBatch*spaceDim];
+        PylithScalar* dispIncrVertexP = &dispIncrBatchP[iBatch*spaceDim];
+        PylithScalar* slipVertex = &slipBatch[iBatch*spaceDim];
+        PylithScalar* tractionTpdtVertex = &tractionTpdtBatch[iBatch*spaceDim];
+
         // Adjust solution as in prescribed rupture, updating the Lagrange
         // multipliers and the corresponding displacment increments.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
@@ -1230,12 +1235,11 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
             dispIncrVertexP[iDim] = -areaVertex / jacobianArray[jpoff+iDim]*lagrangeTIncrVertex[iDim];
         } // for
 
-        // Compute slip, slip rate, and Lagrange multiplier at time t+dt
-        // in fault coordinate system.
-        slipVertex = 0.0;
-        slipRateVertex = 0.0;
-        tractionTpdtVertex = 0.0;
+        // Compute slip and Lagrange multiplier at time t+dt in fault
+        // coordinate system.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
+            slipVertex[iDim] = 0.0;
+            tractionTpdtVertex[iDim] = 0.0;
             for (int jDim=0; jDim < spaceDim; ++jDim) {
                 slipVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * dispRelArray[droff+jDim];
                 tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + lagrangeTIncrVertex[jDim]);
@@ -1243,17 +1247,58 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         } // for
           // Jacobian is diagonal and isotropic, so it is invariant with
           // respect to rotation and contains one unique term.
-        const PylithScalar jacobianShearVertex = -1.0 / (areaVertex * (1.0 / jacobianArray[jnoff+0] + 1.0 / jacobianArray[jpoff+0]));
+        jacobianShearBatch[iBatch] = -1.0 / (areaVertex * (1.0 / jacobianArray[jnoff+0] + 1.0 / jacobianArray[jpoff+0]));
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+        batchVertices[iBatch] = iVertex;
+        faultVertices[iBatch] = v_fault;
+        ++iBatch;
 
-        // Use fault constitutive model to compute traction associated with
-        // friction.
-        dTractionTpdtVertex = 0.0;
+#if defined(DETAILED_EVENT_LOGGING)
+        _logger->eventEnd(computeEvent);
+#endif
+    } // for
 
-        const bool iterating = false; // No iteration for friction in lumped soln
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventBegin(computeEvent);
+#endif
+
+    // Use fault constitutive model to compute traction associated with
+    // friction.
+    const bool iterating = false; // No iteration for friction in lumped soln
+    _constrainSolnSpaceBatch(&dTractionTpdtBatch, t, faultVertices, slipBatch, slipRateBatch, tractionTpdtBatch, jacobianShearBatch, iterating);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(computeEvent);
+#endif
+
+    PetscErrorCode err = 0;
+    for (int iBatch=0; iBatch < numBatch; ++iBatch) {
+        const int iVertex = batchVertices[iBatch];
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+#if defined(DETAILED_EVENT_LOGGING)
+        _logger->eventBegin(restrictEvent);
+#endif
+
+        const PetscInt jnoff = jacobianVisitor.sectionOffset(v_negative);
+        const PetscInt jpoff = jacobianVisitor.sectionOffset(v_positive);
+        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
+        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+        const PetscScalar areaVertex = areaArray[areaVisitor.sectionOffset(v_fault)];
+        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+
+#if defined(DETAILED_EVENT_LOGGING)
+        _logger->eventEnd(restrictEvent);
+        _logger->eventBegin(computeEvent);
+#endif
+
+        PylithScalar* lagrangeTIncrVertex = &lagrangeTIncrBatch[iBatch*spaceDim];
+        PylithScalar* dispIncrVertexN = &dispIncrBatchN[iBatch*spaceDim];
+        PylithScalar* dispIncrVertexP = &dispIncrBatchP[iBatch*spaceDim];
+        const PylithScalar* dTractionTpdtVertex = &dTractionTpdtBatch[iBatch*spaceDim];
 
         // Rotate traction back to global coordinate system.
         dLagrangeTpdtVertex = 0.0;
@@ -1263,40 +1308,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
             } // for
         } // for
 
-#if 0 // debugging
-        std::cout << "dispIncrP: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << dispIncrVertexP[iDim];
-        std::cout << ", dispIncrN: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << dispIncrVertexN[iDim];
-        std::cout << ", slipVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << slipVertex[iDim];
-        std::cout << ", slipRateVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << slipRateVertex[iDim];
-        std::cout << ", orientationVertex: ";
-        for (int iDim=0; iDim < spaceDim*spaceDim; ++iDim)
-            std::cout << "  " << orientationArray[ooff+iDim];
-        std::cout << ", tractionVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << tractionTpdtVertex[iDim];
-        std::cout << ", lagrangeTVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << lagrangeTVertex[iDim];
-        std::cout << ", lagrangeTIncrVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << lagrangeTIncrVertex[iDim];
-        std::cout << ", dTractionTpdtVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << dTractionTpdtVertex[iDim];
-        std::cout << ", dLagrangeTpdtVertex: ";
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            std::cout << "  " << dLagrangeTpdtVertex[iDim];
-        std::cout << std::endl;
-#endif
-
         // Compute change in displacement.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             assert(jacobianArray[jpoff+iDim] > 0.0);
@@ -1348,9 +1359,9 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         _logger->eventEnd(updateEvent);
 #endif
     } // for
-    PetscLogFlops(numVertices*spaceDim*(17 + // adjust solve
-                                        9 + // updates
-                                        spaceDim*9));
+    PetscLogFlops(numBatch*spaceDim*(17 + // adjust solve
+                                     9 + // updates
+                                     spaceDim*9));
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -1656,35 +1667,45 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySetup(const topology::Jacobian& ja
     topology::Field& dLagrange = _fields->get("sensitivity dLagrange");
     dLagrange.zeroAll();
 
-    // Setup Jacobian sparse matrix for sensitivity solve.
-    if (!_jacobian) {
-        _jacobian = new topology::Jacobian(solution, jacobian.matrixType());
-    } // if
-    assert(_jacobian);
-    _jacobian->zero();
-
-    // Setup PETSc KSP linear solver.
-    if (!_ksp) {
-        PetscErrorCode err = 0;
-        err = KSPCreate(_faultMesh->comm(), &_ksp); PYLITH_CHECK_ERROR(err);
-        err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE); PYLITH_CHECK_ERROR(err);
-        PylithScalar rtol = 0.0;
-        PylithScalar atol = 0.0;
-        PylithScalar dtol = 0.0;
-        int maxIters = 0;
-        err = KSPGetTolerances(_ksp, &rtol, &atol, &dtol, &maxIters); PYLITH_CHECK_ERROR(err);
-        rtol = 1.0e-3*_zeroTolerance;
-        atol = 1.0e-5*_zeroTolerance;
-        err = KSPSetTolerances(_ksp, rtol, atol, dtol, maxIters); PYLITH_CHECK_ERROR(err);
-
-        PC pc;
-        err = KSPGetPC(_ksp, &pc); PYLITH_CHECK_ERROR(err);
-        err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
-        err = KSPSetType(_ksp, KSPGMRES); PYLITH_CHECK_ERROR(err);
-
-        err = KSPAppendOptionsPrefix(_ksp, "friction_"); PYLITH_CHECK_ERROR(err);
-        err = KSPSetFromOptions(_ksp); PYLITH_CHECK_ERROR(err);
-    } // if
+    // Setup Jacobian sparse matrices and PETSc KSP linear solvers for
+    // sensitivity solves on negative and positive sides of the fault.
+    PetscErrorCode err = 0;
+    for (int iSide=0; iSide < 2; ++iSide) {
+        if (!_jacobian[iSide]) {
+            _jacobian[iSide] = new topology::Jacobian(solution, jacobian.matrixType());
+            _jacobianDomain[iSide] = 0;
+            _jacobianDomainState[iSide] = 0;
+        } // if
+        assert(_jacobian[iSide]);
+
+        if (!_ksp[iSide]) {
+            err = KSPCreate(_faultMesh->comm(), &_ksp[iSide]); PYLITH_CHECK_ERROR(err);
+            err = KSPSetInitialGuessNonzero(_ksp[iSide], PETSC_FALSE); PYLITH_CHECK_ERROR(err);
+            PylithScalar rtol = 0.0;
+            PylithScalar atol = 0.0;
+            PylithScalar dtol = 0.0;
+            int maxIters = 0;
+            err = KSPGetTolerances(_ksp[iSide], &rtol, &atol, &dtol, &maxIters); PYLITH_CHECK_ERROR(err);
+            rtol = 1.0e-3*_zeroTolerance;
+            atol = 1.0e-5*_zeroTolerance;
+            err = KSPSetTolerances(_ksp[iSide], rtol, atol, dtol, maxIters); PYLITH_CHECK_ERROR(err);
+
+            PC pc;
+            err = KSPGetPC(_ksp[iSide], &pc); PYLITH_CHECK_ERROR(err);
+            if (_sensitivityDirectSolve) {
+                PetscMPIInt commSize = 1;
+                err = MPI_Comm_size(_faultMesh->comm(), &commSize); PYLITH_CHECK_ERROR(err);
+                err = KSPSetType(_ksp[iSide], KSPPREONLY); PYLITH_CHECK_ERROR(err);
+                err = PCSetType(pc, (1 == commSize) ? PCLU : PCREDUNDANT); PYLITH_CHECK_ERROR(err);
+            } else {
+                err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
+                err = KSPSetType(_ksp[iSide], KSPGMRES); PYLITH_CHECK_ERROR(err);
+            } // if/else
+
+            err = KSPAppendOptionsPrefix(_ksp[iSide], "friction_"); PYLITH_CHECK_ERROR(err);
+            err = KSPSetFromOptions(_ksp[iSide]); PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
 
     PYLITH_METHOD_END;
 } // _sensitivitySetup
@@ -1701,13 +1722,25 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     assert(_quadrature);
     assert(_fields);
 
+    const int iSide = (negativeSide) ? 0 : 1;
+    assert(_jacobian[iSide]);
+    assert(_ksp[iSide]);
+
+    // Sensitivity matrix depends only on the Jacobian for the entire
+    // domain, so skip the update if the Jacobian has not changed.
+    PetscErrorCode err = 0;
+    const PetscMat jacobianDomainMatrix = jacobian.matrix(); assert(jacobianDomainMatrix);
+    PetscObjectState jacobianDomainState = 0;
+    err = PetscObjectStateGet((PetscObject) jacobianDomainMatrix, &jacobianDomainState); PYLITH_CHECK_ERROR(err);
+    if (jacobianDomainMatrix == _jacobianDomain[iSide] && jacobianDomainState == _jacobianDomainState[iSide]) {
+        PYLITH_METHOD_END;
+    } // if
+
     const int numBasis = _quadrature->numBasis();
     const int spaceDim = _quadrature->spaceDim();
     const int subnrows = numBasis*spaceDim;
     const int submatrixSize = subnrows * subnrows;
 
-    PetscErrorCode err = 0;
-
     // Get solution field
     const topology::Field& solutionDomain = fields.solution();
     PetscSection solutionDomainSection = solutionDomain.localSection(); assert(solutionDomainSection);
@@ -1726,7 +1759,6 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
 
     // Visitor for Jacobian matrix associated with domain.
     scalar_array jacobianSubCell(submatrixSize);
-    const PetscMat jacobianDomainMatrix = jacobian.matrix(); assert(jacobianDomainMatrix);
 
     // Get fault mesh
     PetscDM faultDMMesh = _faultMesh->dmMesh(); assert(faultDMMesh);
@@ -1735,10 +1767,10 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     PetscSection solutionFaultSection = _fields->get("sensitivity solution").localSection(); assert(solutionFaultSection);
     PetscVec solutionFaultVec = _fields->get("sensitivity solution").localVector(); assert(solutionFaultVec);
     PetscSection solutionFaultGlobalSection = _fields->get("sensitivity solution").globalSection(); assert(solutionFaultGlobalSection);
-    assert(_jacobian);
-    const PetscMat jacobianFaultMatrix = _jacobian->matrix(); assert(jacobianFaultMatrix);
+    _jacobian[iSide]->zero();
+    const PetscMat jacobianFaultMatrix = _jacobian[iSide]->matrix(); assert(jacobianFaultMatrix);
 
-    const int iCone = (negativeSide) ? 0 : 1;
+    const int iCone = iSide;
 
     PetscIS* cellsIS = (numCohesiveCells > 0) ? new PetscIS[numCohesiveCells] : 0;
     int_array indicesGlobal(subnrows);
@@ -1828,13 +1860,19 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     err = MatDestroySubMatrices(numCohesiveCells, &submatrices); PYLITH_CHECK_ERROR(err);
     delete[] cellsIS; cellsIS = 0;
 
-    _jacobian->assemble("final_assembly");
+    _jacobian[iSide]->assemble("final_assembly");
+
+    // Preconditioner (or factorization) is rebuilt only when operators
+    // are reset.
+    err = KSPSetOperators(_ksp[iSide], jacobianFaultMatrix, jacobianFaultMatrix); PYLITH_CHECK_ERROR(err);
+    _jacobianDomain[iSide] = jacobianDomainMatrix;
+    _jacobianDomainState[iSide] = jacobianDomainState;
 
 #if 0 // DEBUGGING
       //std::cout << "DOMAIN JACOBIAN" << std::endl;
       //jacobian.view();
     std::cout << "SENSITIVITY JACOBIAN" << std::endl;
-    _jacobian->view();
+    _jacobian[iSide]->view();
 #endif
 
     PYLITH_METHOD_END;
@@ -1932,13 +1970,13 @@ pylith::faults::FaultCohesiveDyn::_sensitivityReformResidual(const bool negative
 // ----------------------------------------------------------------------
 // Solve sensitivity problem.
 void
-pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
+pylith::faults::FaultCohesiveDyn::_sensitivitySolve(const bool negativeSide)
 { // _sensitivitySolve
     PYLITH_METHOD_BEGIN;
 
+    const int iSide = (negativeSide) ? 0 : 1;
     assert(_fields);
-    assert(_jacobian);
-    assert(_ksp);
+    assert(_ksp[iSide]);
 
     topology::Field& residual = _fields->get("sensitivity residual");
     topology::Field& solution = _fields->get("sensitivity solution");
@@ -1950,12 +1988,9 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
     residual.scatterLocalToGlobal();
 
     PetscErrorCode err = 0;
-    const PetscMat jacobianMat = _jacobian->matrix();
-    err = KSPSetOperators(_ksp, jacobianMat, jacobianMat); PYLITH_CHECK_ERROR(err);
-
     const PetscVec residualVec = residual.globalVector();
     const PetscVec solutionVec = solution.globalVector();
-    err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+    err = KSPSolve(_ksp[iSide], residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
 
     // Update section view of field.
     solution.scatterGlobalToLocal();
@@ -2463,5 +2498,183 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
     PetscLogFlops(22);
 } // _constrainSolnSpace3D
 
+// ----------------------------------------------------------------------
+// Constrain solution space for a batch of fault vertices.
+void
+pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceBatch(scalar_array* dTractionTpdt,
+                                                           const PylithScalar t,
+                                                           const int_array& faultVertices,
+                                                           const scalar_array& slip,
+                                                           const scalar_array& slipRate,
+                                                           const scalar_array& tractionTpdt,
+                                                           const scalar_array& jacobianShear,
+                                                           const bool iterating)
+{ // _constrainSolnSpaceBatch
+    PYLITH_METHOD_BEGIN;
+
+    assert(dTractionTpdt);
+    assert(_quadrature);
+    assert(_friction);
+
+    const int spaceDim = _quadrature->spaceDim();
+    const int numVertices = faultVertices.size();
+    assert(slip.size() == size_t(numVertices*spaceDim));
+    assert(slipRate.size() == size_t(numVertices*spaceDim));
+    assert(tractionTpdt.size() == size_t(numVertices*spaceDim));
+    assert(jacobianShear.size() == size_t(numVertices));
+    assert(dTractionTpdt->size() == size_t(numVertices*spaceDim));
+
+    *dTractionTpdt = 0.0;
+    if (!numVertices) {
+        PYLITH_METHOD_END;
+    } // if
+
+    switch (spaceDim) { // switch
+    case 1:
+        for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+            if (fabs(slip[iVertex]) >= _zeroTolerance) {
+                // if tension, then traction is zero.
+                (*dTractionTpdt)[iVertex] = -tractionTpdt[iVertex];
+            } // if
+        } // for
+        PetscLogFlops(numVertices*2);
+        PYLITH_METHOD_END;
+    case 2:
+    case 3:
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::_constrainSolnSpaceBatch.");
+    } // switch
+
+    // Magnitudes of shear slip, slip rate, and traction, and normal
+    // traction at each vertex.
+    const int indexN = spaceDim - 1;
+    scalar_array slipMag(numVertices);
+    scalar_array slipRateMag(numVertices);
+    scalar_array slipMag0(numVertices);
+    scalar_array tractionNormal(numVertices);
+    scalar_array tractionShearMag(numVertices);
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        PylithScalar slipMag2 = 0.0;
+        PylithScalar slipRateMag2 = 0.0;
+        PylithScalar slipMag02 = 0.0;
+        PylithScalar tractionShearMag2 = 0.0;
+        for (int iDim=0; iDim < indexN; ++iDim) {
+            const PylithScalar slipValue = slip[iVertex*spaceDim+iDim];
+            const PylithScalar slipRateValue = slipRate[iVertex*spaceDim+iDim];
+            const PylithScalar slip0Value = slipValue - slipRateValue*_dt;
+            const PylithScalar tractionValue = tractionTpdt[iVertex*spaceDim+iDim];
+            slipMag2 += slipValue*slipValue;
+            slipRateMag2 += slipRateValue*slipRateValue;
+            slipMag02 += slip0Value*slip0Value;
+            tractionShearMag2 += tractionValue*tractionValue;
+        } // for
+        slipMag[iVertex] = sqrt(slipMag2);
+        slipRateMag[iVertex] = sqrt(slipRateMag2);
+        slipMag0[iVertex] = sqrt(slipMag02);
+        tractionShearMag[iVertex] = sqrt(tractionShearMag2);
+        tractionNormal[iVertex] = tractionTpdt[iVertex*spaceDim+indexN];
+    } // for
+
+    // Compute friction at all vertices.
+    _friction->retrievePropsStateVarsBatch(&faultVertices[0], numVertices);
+    scalar_array frictionStress(numVertices);
+    _friction->calcFrictionBatch(&frictionStress[0], t, &slipMag[0], &slipRateMag[0], &tractionNormal[0], numVertices);
+
+    // Classify vertices: tension (traction is zero), sliding (traction
+    // is limited by friction, possibly with Newton iterations), or
+    // sticking (no changes to solution).
+    int_array sliding(numVertices);
+    int_array newton(numVertices);
+    int numNewton = 0;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        sliding[iVertex] = 0;
+        newton[iVertex] = 0;
+        if (fabs(slip[iVertex*spaceDim+indexN]) < _zeroToleranceNormal && tractionNormal[iVertex] < -_zeroTolerance) {
+            // if in compression and no opening
+            if ((tractionShearMag[iVertex] > frictionStress[iVertex] || (iterating && slipRateMag[iVertex] > 0.0)) &&
+                tractionShearMag[iVertex] > 0.0) {
+                // traction is limited by friction, so have sliding OR
+                // friction exceeds traction due to overshoot in slip
+                sliding[iVertex] = 1;
+                if (0.0 != jacobianShear[iVertex]) {
+                    assert(jacobianShear[iVertex] < 0.0);
+                    newton[iVertex] = 1;
+                    ++numNewton;
+                } // if
+            } else if (iterating && tractionShearMag[iVertex] <= frictionStress[iVertex]) {
+                assert(0.0 == slipRateMag[iVertex]);
+            } // if/else
+        } else {
+            // if in tension, then traction is zero.
+            for (int iDim=0; iDim < spaceDim; ++iDim) {
+                (*dTractionTpdt)[iVertex*spaceDim+iDim] = -tractionTpdt[iVertex*spaceDim+iDim];
+            } // for
+        } // if/else
+    } // for
+
+    // Use Newton to get better update at sliding vertices. Friction
+    // is evaluated for the entire batch, and only vertices that have
+    // not converged are updated.
+    if (numNewton > 0) {
+        const int maxiter = 32;
+        scalar_array slipMagCur(slipMag);
+        scalar_array slipRateMagCur(slipRateMag);
+        scalar_array tractionShearMagCur(tractionShearMag);
+        scalar_array frictionDeriv(numVertices);
+        scalar_array frictionStressCur(numVertices);
+        for (int iter=0; iter < maxiter && numNewton > 0; ++iter) {
+            _friction->calcFrictionDerivBatch(&frictionDeriv[0], t, &slipMagCur[0], &slipRateMagCur[0], &tractionNormal[0], numVertices);
+            for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+                if (!newton[iVertex]) {
+                    continue;
+                } // if
+                const PylithScalar slipMagPrev = slipMagCur[iVertex];
+                const PylithScalar tractionResidual = tractionShearMagCur[iVertex] - frictionStress[iVertex];
+                const PylithScalar jacobianResidual = jacobianShear[iVertex] - frictionDeriv[iVertex];
+                if (slipMagPrev > 0.0) {
+                    // Use Newton (in log slip space) to get better update in slip & traction.
+                    // D_{i+1} = exp(ln(D_i) - (T-T_f)/(D_i * (jacobian - frictionDeriv))
+                    slipMagCur[iVertex] = exp(log(slipMagPrev) - tractionResidual / (slipMagPrev * jacobianResidual));
+                } else {
+                    // Use Newton (in linear slip space) to get better update in slip & traction.
+                    // D_{i+1} = D_i - (T-T_f)/(jacobian - frictionDeriv)
+                    slipMagCur[iVertex] = slipMagPrev - tractionResidual / jacobianResidual;
+                } // if/else
+                tractionShearMagCur[iVertex] += (slipMagCur[iVertex] - slipMagPrev) * jacobianShear[iVertex];
+                slipRateMagCur[iVertex] = (slipMagCur[iVertex] - slipMag0[iVertex]) / _dt;
+            } // for
+            _friction->calcFrictionBatch(&frictionStressCur[0], t, &slipMagCur[0], &slipRateMagCur[0], &tractionNormal[0], numVertices);
+            for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+                if (!newton[iVertex]) {
+                    continue;
+                } // if
+                frictionStress[iVertex] = frictionStressCur[iVertex];
+                if (fabs(tractionShearMagCur[iVertex] - frictionStress[iVertex]) < _zeroTolerance) {
+                    newton[iVertex] = 0;
+                    --numNewton;
+                } // if
+            } // for
+        } // for
+    } // if
+
+    // Update traction increment based on value required to stick
+    // versus friction.
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        if (!sliding[iVertex]) {
+            continue;
+        } // if
+        const PylithScalar scale = -(tractionShearMag[iVertex] - frictionStress[iVertex]) / tractionShearMag[iVertex];
+        for (int iDim=0; iDim < indexN; ++iDim) {
+            (*dTractionTpdt)[iVertex*spaceDim+iDim] = scale * tractionTpdt[iVertex*spaceDim+iDim];
+        } // for
+    } // for
+
+    PetscLogFlops(numVertices*(4 + 8*indexN));
+
+    PYLITH_METHOD_END;
+} // _constrainSolnSpaceBatch
+
 
 // End of file
@@ -31,6 +31,8 @@
 #include "pylith/friction/frictionfwd.hh" // HOLDSA Friction model
 #include "pylith/utils/petscfwd.h" // HASA PetscKSP
 
+#include <petscsys.h> // HASA PetscObjectState
+
 // FaultCohesiveDyn -----------------------------------------------------
 /**
  * @brief C++ implementation for a fault surface with spontaneous
@@ -89,6 +91,14 @@ public :
    */
   void openFreeSurf(const bool value);
 
+  /** Set flag for using a direct solver (LU) for the sensitivity
+   * problem. This is efficient for small fault meshes. PETSc options
+   * with the prefix 'friction_' override this setting.
+   *
+   * @param value True if using direct solver, false otherwise.
+   */
+  void sensitivityDirectSolve(const bool value);
+
   /** Initialize fault. Determine orientation and setup boundary
    * condition parameters.
    *
@@ -180,7 +190,9 @@ private :
    */
   void _sensitivitySetup(const topology::Jacobian& jacobian);
 
-  /** Update the Jacobian values for the sensitivity solve.
+  /** Update the Jacobian values for the sensitivity solve. The values
+   * are extracted from the Jacobian for the entire domain only if it
+   * has changed since the last update for this side of the fault.
    *
    * @param negativeSide True if solving sensitivity problem for
    * negative side of the fault, false if solving sensitivity problem
@@ -200,8 +212,13 @@ private :
    */
   void _sensitivityReformResidual(const bool negativeSide);
 
-  /// Solve sensitivity problem.
-  void _sensitivitySolve(void);
+  /** Solve sensitivity problem.
+   *
+   * @param negativeSide True if solving sensitivity problem for
+   * negative side of the fault, false if solving sensitivity problem
+   * for positive side of the fault.
+   */
+  void _sensitivitySolve(const bool negativeSide);
 
   /** Update the solution (displacement increment) values based on
    * the sensitivity solve.
@@ -282,6 +299,37 @@ private :
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
+  /** Constrain solution space for a batch of fault vertices.
+   *
+   * Friction is evaluated for all vertices in the batch at once using
+   * the friction model's batch interface, and the Newton iterations
+   * for sliding vertices are done as masked iterations over the
+   * batch. The result matches that of calling _constrainSolnSpace1D(),
+   * _constrainSolnSpace2D(), or _constrainSolnSpace3D() for each
+   * vertex.
+   *
+   * Arrays of vector values are ordered by vertex and then by
+   * component in the fault coordinate system.
+   *
+   * @param dTractionTpdt Adjustment to fault traction [output].
+   * @param t Current time.
+   * @param faultVertices Fault vertices in batch.
+   * @param slip Slip at fault vertices.
+   * @param slipRate Slip rate at fault vertices.
+   * @param tractionTpdt Fault traction at fault vertices.
+   * @param jacobianShear Derivative of shear traction with respect to
+   * slip (elasticity) at fault vertices.
+   * @param iterating True if iterating on solution.
+   */
+  void _constrainSolnSpaceBatch(scalar_array* dTractionTpdt,
+				const PylithScalar t,
+				const int_array& faultVertices,
+				const scalar_array& slip,
+				const scalar_array& slipRate,
+				const scalar_array& tractionTpdt,
+				const scalar_array& jacobianShear,
+				const bool iterating =true);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -297,10 +345,23 @@ private :
   /// To identify constitutive model
   friction::FrictionModel* _friction;
 
-  /// Sparse matrix for sensitivity solve.
-  topology::Jacobian* _jacobian;
+  /// Sparse matrices for sensitivity solve (negative and positive
+  /// sides of the fault).
+  topology::Jacobian* _jacobian[2];
+
+  /// PETSc KSP linear solvers for sensitivity problem (negative and
+  /// positive sides of the fault).
+  PetscKSP _ksp[2];
+
+  /// Jacobian matrix for entire domain from which sensitivity matrices
+  /// were extracted.
+  PetscMat _jacobianDomain[2];
+
+  /// State of Jacobian matrix for entire domain when sensitivity
+  /// matrices were extracted.
+  PetscObjectState _jacobianDomainState[2];
 
-  PetscKSP _ksp; ///< PETSc KSP linear solver for sensitivity problem.
+  bool _sensitivityDirectSolve; ///< Use direct solver for sensitivity problem.
 
   /// Flag to control whether to continue to impose initial tractions
   /// on the fault surface when it opens. If it is a frictional
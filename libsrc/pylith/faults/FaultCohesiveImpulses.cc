@@ -189,6 +189,86 @@ pylith::faults::FaultCohesiveImpulses::integrateResidual(const topology::Field&
   PYLITH_METHOD_END;
 } // integrateResidual
 
+// ----------------------------------------------------------------------
+// Compute sensitivities of an observation to the impulses from the
+// solution of the adjoint problem.
+void
+pylith::faults::FaultCohesiveImpulses::adjointSensitivities(PylithScalar* values,
+							    const int numValues,
+							    const topology::Field& adjoint)
+{ // adjointSensitivities
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+  assert(_faultMesh);
+  assert(_quadrature);
+  assert(numValues > 0 ? 0 != values : true);
+
+  const int spaceDim = _quadrature->spaceDim();
+
+  scalar_array valuesLocal(numValues);
+  valuesLocal = 0.0;
+
+  // Impulses are only setup if amplitudes are specified.
+  if (_dbImpulseAmp) {
+    topology::VecVisitorMesh amplitudeVisitor(_fields->get("impulse amplitude"));
+    const PetscScalar* amplitudeArray = amplitudeVisitor.localArray();
+
+    topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
+    const PetscScalar* orientationArray = orientationVisitor.localArray();
+
+    topology::VecVisitorMesh adjointVisitor(adjoint);
+    const PetscScalar* adjointArray = adjointVisitor.localArray();
+
+    // Contribution of impulse to residual at Lagrange vertex is
+    // area * amplitude * direction of impulse in global coordinate
+    // system.
+    const srcs_type::const_iterator impulsePointsEnd = _impulsePoints.end();
+    for (srcs_type::const_iterator piter=_impulsePoints.begin(); piter != impulsePointsEnd; ++piter) {
+      const int impulse = piter->first;
+      assert(impulse >= 0 && impulse < numValues);
+      const int iVertex = piter->second.indexCohesive;
+      const int indexDOF = piter->second.indexDOF;
+      assert(indexDOF >= 0 && indexDOF < spaceDim);
+      const int v_fault = _cohesiveVertices[iVertex].fault;
+      const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+
+      // Skip clamped vertices
+      if (e_lagrange < 0) {
+	continue;
+      } // if
+
+      const PetscInt aoff = amplitudeVisitor.sectionOffset(v_fault);
+      assert(1 == amplitudeVisitor.sectionDof(v_fault));
+
+      const PetscInt aroff = areaVisitor.sectionOffset(v_fault);
+      assert(1 == areaVisitor.sectionDof(v_fault));
+
+      const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+      assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
+
+      const PetscInt loff = adjointVisitor.sectionOffset(e_lagrange);
+      assert(spaceDim == adjointVisitor.sectionDof(e_lagrange));
+
+      PylithScalar value = 0.0;
+      for (int d=0; d < spaceDim; ++d) {
+	value += orientationArray[ooff+indexDOF*spaceDim+d] * adjointArray[loff+d];
+      } // for
+      valuesLocal[impulse] = areaArray[aroff] * amplitudeArray[aoff] * value;
+    } // for
+    PetscLogFlops(_impulsePoints.size()*(2+2*spaceDim));
+  } // if
+
+  // Each impulse is associated with a single process.
+  MPI_Comm comm = _faultMesh->comm();
+  PetscErrorCode err = MPI_Allreduce(numValues > 0 ? &valuesLocal[0] : 0, values, numValues, MPIU_SCALAR, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // adjointSensitivities
+
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
 const pylith::topology::Field&
@@ -110,6 +110,23 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Compute sensitivities of an observation to the impulses from
+   * the solution of the adjoint problem.
+   *
+   * The adjoint problem uses the transpose of the interpolation
+   * operator for the observation as the source term. The sensitivity
+   * to an impulse is the inner product of the adjoint solution with
+   * the contribution of the impulse to the residual, which is nonzero
+   * only for the Lagrange multiplier constraint of the impulse.
+   *
+   * @param values Array of sensitivities for all impulses (output).
+   * @param numValues Size of array (total number of impulses).
+   * @param adjoint Solution of adjoint problem.
+   */
+  void adjointSensitivities(PylithScalar* values,
+			    const int numValues,
+			    const topology::Field& adjoint);
+
   /** Get vertex field associated with integrator.
    *
    * @param name Name of cell field.
@@ -49,7 +49,8 @@
 
 // ----------------------------------------------------------------------
 // Default constructor.
-pylith::faults::FaultCohesiveKin::FaultCohesiveKin(void)
+pylith::faults::FaultCohesiveKin::FaultCohesiveKin(void) :
+  _tSlip(0.0)
 { // constructor
 } // constructor
 
@@ -114,6 +115,15 @@ pylith::faults::FaultCohesiveKin::initialize(const topology::Mesh& mesh,
     src->initialize(*_faultMesh, *_normalizer);
   } // for
 
+  // Allocate field for slip at vertices where slip has finished in
+  // all sources (in fault coordinate system).
+  assert(_fields);
+  _fields->add("slip finished", "slip_finished");
+  topology::Field& slipFinished = _fields->get("slip finished");
+  slipFinished.cloneSection(_fields->get("relative disp"));
+  slipFinished.zeroAll();
+  _tSlip = 0.0;
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -135,14 +145,28 @@ pylith::faults::FaultCohesiveKin::integrateResidual(const topology::Field& resid
   _logger->eventBegin(setupEvent);
 
   topology::Field& dispRel = _fields->get("relative disp");
-  dispRel.zeroAll();
-  // Compute slip field at current time step
+  topology::Field& slipFinished = _fields->get("slip finished");
   const srcs_type::const_iterator srcsEnd = _eqSrcs.end();
+
+  // Slip is only computed at vertices where slip is active, so
+  // restart if time goes backwards.
+  if (t < _tSlip) {
+    slipFinished.zeroAll();
+    for (srcs_type::iterator s_iter = _eqSrcs.begin(); s_iter != srcsEnd; ++s_iter) {
+      assert(s_iter->second);
+      s_iter->second->resetActiveSet();
+    } // for
+  } // if
+  _tSlip = t;
+
+  // Compute slip field at current time step, starting from slip at
+  // vertices where slip has finished in all sources.
+  PetscErrorCode err = VecCopy(slipFinished.localVector(), dispRel.localVector());PYLITH_CHECK_ERROR(err);
   for (srcs_type::iterator s_iter = _eqSrcs.begin(); s_iter != srcsEnd; ++s_iter) {
     EqKinSrc* src = s_iter->second;
     assert(src);
     if (t >= src->originTime())
-      src->slip(&dispRel, t);
+      src->slipActive(&dispRel, &slipFinished, t);
   } // for
 
   // Transform slip from local (fault) coordinate system to relative
@@ -105,6 +105,9 @@ private :
 
   srcs_type _eqSrcs; ///< Array of kinematic earthquake sources.
 
+  /// Time of most recent update of slip from earthquake sources.
+  PylithScalar _tSlip;
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
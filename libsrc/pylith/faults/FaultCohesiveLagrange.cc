@@ -29,6 +29,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/MatAssemblyMap.hh" // USES MatAssemblyMap
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/topology/VisitorSubMesh.hh" // USES SubMeshIS
@@ -57,7 +58,10 @@
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
-    _cohesiveIS(0)
+    _cohesiveIS(0),
+    _constraintSectionId(0),
+    _constraintMap(0),
+    _constraintPCType(PC_DIAGONAL)
 { // constructor
     _useLagrangeConstraints = true;
 } // constructor
@@ -78,10 +82,46 @@ pylith::faults::FaultCohesiveLagrange::deallocate(void)
 
     FaultCohesive::deallocate();
     delete _cohesiveIS; _cohesiveIS = 0;
+    _constraintIndices.resize(0);
+    _constraintValues.resize(0);
+    _constraintSectionId = 0;
+    delete _constraintMap; _constraintMap = 0;
 
     PYLITH_METHOD_END;
 } // deallocate
 
+// ----------------------------------------------------------------------
+// Set approximation of [K]^(-1) used in custom preconditioner.
+void
+pylith::faults::FaultCohesiveLagrange::constraintPCType(const char* value)
+{ // constraintPCType
+    PYLITH_METHOD_BEGIN;
+
+    assert(value);
+    if (0 == strcasecmp(value, "diagonal")) {
+        _constraintPCType = PC_DIAGONAL;
+    } else if (0 == strcasecmp(value, "vertex_block")) {
+        _constraintPCType = PC_VERTEX_BLOCK;
+    } else if (0 == strcasecmp(value, "fault_diagonal")) {
+        _constraintPCType = PC_FAULT_DIAGONAL;
+    } else {
+        std::ostringstream msg;
+        msg << "Unknown type of custom preconditioner '" << value << "' for fault '" << label() << "'. "
+            << "Valid types are 'diagonal', 'vertex_block', and 'fault_diagonal'.";
+        throw std::runtime_error(msg.str());
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // constraintPCType
+
+// ----------------------------------------------------------------------
+// Get approximation of [K]^(-1) used in custom preconditioner.
+pylith::faults::FaultCohesiveLagrange::ConstraintPCEnum
+pylith::faults::FaultCohesiveLagrange::constraintPCType(void) const
+{ // constraintPCType
+    return _constraintPCType;
+} // constraintPCType
+
 // ----------------------------------------------------------------------
 // Initialize fault. Determine orientation and setup boundary
 void
@@ -155,6 +195,12 @@ pylith::faults::FaultCohesiveLagrange::initialize(const topology::Mesh& mesh,
     // Compute tributary area for each vertex in fault mesh.
     _calcArea();
 
+    // Constraint block depends on area.
+    _constraintIndices.resize(0);
+    _constraintValues.resize(0);
+    _constraintSectionId = 0;
+    delete _constraintMap; _constraintMap = 0;
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -370,139 +416,60 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
     const int setupEvent = _logger->eventId("FaIJ setup");
     const int computeEvent = _logger->eventId("FaIJ compute");
 #if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaIJ geometry");
-    const int restrictEvent = _logger->eventId("FaIJ restrict");
     const int updateEvent = _logger->eventId("FaIJ update");
 #endif
 
     _logger->eventBegin(setupEvent);
 
     // Add constraint information to Jacobian matrix; Entries are
-    // associated with vertices ik, jk, ki, and kj.
+    // associated with vertices ik, jk, ki, and kj. The entries depend
+    // only on the fault geometry, so the indices and values are
+    // computed once and added directly into the storage of the
+    // matrix when the Jacobian is reformed.
+    PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
+    PetscObjectId solnGlobalSectionId = 0;
+    PetscErrorCode err = PetscObjectGetId((PetscObject) solnGlobalSection, &solnGlobalSectionId); PYLITH_CHECK_ERROR(err);
+    if (solnGlobalSectionId != _constraintSectionId) {
+        _setupConstraintBlock(*fields);
+        delete _constraintMap; _constraintMap = 0;
+    } // if
 
     // Get cell geometry information that doesn't depend on cell
     const int spaceDim = _quadrature->spaceDim();
+    const int numIndices = 3*spaceDim;
+    const int numValues = numIndices*numIndices;
+    const int numConstraints = _constraintIndices.size() / numIndices;
+    assert(numConstraints*numValues == int(_constraintValues.size()));
 
-    // Get fields.
-    topology::Field& area = _fields->get("area");
-    topology::VecVisitorMesh areaVisitor(area);
-    const PetscScalar* areaArray = areaVisitor.localArray();
-
-    PetscSection solnSection = fields->solution().localSection(); assert(solnSection);
-    PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
-
-    // Get fault information
-    PetscDM dmMesh = fields->mesh().dmMesh(); assert(dmMesh);
-
-    // Allocate vectors for vertex values
-    scalar_array jacobianVertex(spaceDim*spaceDim);
-    int_array indicesL(spaceDim);
-    int_array indicesN(spaceDim);
-    int_array indicesP(spaceDim);
-    int_array indicesRel(spaceDim);
-    for (int i=0; i < spaceDim; ++i) {
-        indicesRel[i] = i;
-    } // for
-
-    // Get sparse matrix
+    // Get sparse matrix and map from constraint block to matrix storage.
     const PetscMat jacobianMatrix = jacobian->matrix(); assert(jacobianMatrix);
+    if (!_constraintMap) {
+        _constraintMap = new topology::MatAssemblyMap; assert(_constraintMap);
+    } // if
+    if (!_constraintMap->isCurrent(jacobianMatrix)) {
+        _constraintMap->setup(jacobianMatrix, numConstraints > 0 ? &_constraintIndices[0] : NULL, numConstraints, numIndices);
+    } // if
 
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
-    const int numVertices = _cohesiveVertices.size();
-    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges.
-            continue;
-        } // if
-
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt gloff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
-        if (gloff < 0)
-            continue;
-
-        PetscInt gnoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
-        gnoff = gnoff < 0 ? -(gnoff+1) : gnoff;
-
-        PetscInt gpoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
-        gpoff = gpoff < 0 ? -(gpoff+1) : gpoff;
-
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
-
-        // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-
-        // Set global order indices
-        indicesL = indicesRel + gloff;
-        indicesN = indicesRel + gnoff;
-        indicesP = indicesRel + gpoff;
-        PetscInt cdof;
-        err = PetscSectionGetConstraintDof(solnSection, v_negative, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
-        err = PetscSectionGetConstraintDof(solnSection, v_positive, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
-
+    _constraintMap->beginAssembly();
+    for (int iConstraint=0; iConstraint < numConstraints; ++iConstraint) {
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
         _logger->eventBegin(updateEvent);
 #endif
 
-        // Set diagonal entries of Jacobian at positive vertex to area
-        // associated with vertex.
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            jacobianVertex[iDim*spaceDim+iDim] = areaArray[aoff];
-
-        // Values at positive vertex, entry L,P in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesP.size(), &indicesP[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at positive vertex, entry P,L in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesP.size(), &indicesP[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at negative vertex, entry L,N in Jacobian
-        jacobianVertex *= -1.0;
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesN.size(), &indicesN[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at negative vertex, entry N,L in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesN.size(), &indicesN[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at Lagrange vertex, entry L,L in Jacobian
-        // We must have entries on the diagonal.
-        jacobianVertex = 0.0;
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+        // Entries L,P, L,N, L,L, P,L, and N,L in Jacobian. We must have
+        // entries on the diagonal.
+        _constraintMap->addClosure(&_constraintValues[iConstraint*numValues], numValues, iConstraint);
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(updateEvent);
 #endif
-
     } // for
-    PetscLogFlops(numVertices*spaceDim*2);
+    _constraintMap->endAssembly();
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -583,7 +550,6 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
         _logger->eventEnd(updateEvent);
 #endif
     } // for
-    PetscLogFlops(0);
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -624,6 +590,16 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
      *
      * Because we use quadrature points located at the vertices,
      * L_{ii} = area, L_{ij} = 0 if i != j
+     *
+     * With PC_VERTEX_BLOCK we replace 1.0/Kn_{kk} and 1.0/Kp_{kk} with
+     * the inverses of the spaceDim x spaceDim vertex blocks of [Kn] and
+     * [Kp], so Pmat is block diagonal.
+     *
+     * With PC_FAULT_DIAGONAL we rotate the vertex blocks into the fault
+     * coordinate system, [Kn'] = [R] [Kn] [R]^T, use the diagonal of
+     * [Kn'] and [Kp'], and rotate the result back to the global
+     * coordinate system, so the normal and tangential stiffness are
+     * approximated separately.
      */
 
     const int setupEvent = _logger->eventId("FaPr setup");
@@ -641,9 +617,10 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     // Allocate vectors for vertex values
     scalar_array jacobianVertexP(spaceDim*spaceDim);
     scalar_array jacobianVertexN(spaceDim*spaceDim);
-    scalar_array jacobianInvVertexP(spaceDim);
-    scalar_array jacobianInvVertexN(spaceDim);
-    scalar_array precondVertexL(spaceDim);
+    scalar_array jacobianInvVertexP(spaceDim*spaceDim);
+    scalar_array jacobianInvVertexN(spaceDim*spaceDim);
+    scalar_array precondVertexL(spaceDim*spaceDim);
+    int_array indicesL(spaceDim);
     int_array indicesN(spaceDim);
     int_array indicesP(spaceDim);
     int_array indicesRel(spaceDim);
@@ -656,6 +633,10 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     topology::VecVisitorMesh areaVisitor(area);
     const PetscScalar* areaArray = areaVisitor.localArray();
 
+    topology::Field& orientation = _fields->get("orientation");
+    topology::VecVisitorMesh orientationVisitor(orientation);
+    const PetscScalar* orientationArray = orientationVisitor.localArray();
+
     PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
 
     PetscDM lagrangeDM = fields->solution().subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
@@ -716,39 +697,76 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
         _logger->eventBegin(computeEvent);
 #endif
 
-        // Compute inverse of Jacobian diagonals
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            jacobianInvVertexN[iDim] = 1.0/jacobianVertexN[iDim*spaceDim+iDim];
-            jacobianInvVertexP[iDim] = 1.0/jacobianVertexP[iDim*spaceDim+iDim];
-        } // for
+        // Compute approximate inverse of Jacobian vertex blocks
+        jacobianInvVertexN = 0.0;
+        jacobianInvVertexP = 0.0;
+        if (PC_VERTEX_BLOCK == _constraintPCType) {
+            _invertVertexBlock(&jacobianInvVertexN, jacobianVertexN, spaceDim);
+            _invertVertexBlock(&jacobianInvVertexP, jacobianVertexP, spaceDim);
+        } else if (PC_FAULT_DIAGONAL == _constraintPCType) {
+            const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+            assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
+            const PetscScalar* orientationVertex = &orientationArray[ooff];
+
+            // Kn'_{ii} = R_{ij} Kn_{jk} R_{ik}
+            // Kn^(-1)_{jk} = R_{ij} (1.0/Kn'_{ii}) R_{ik}
+            for (int iDim=0; iDim < spaceDim; ++iDim) {
+                PylithScalar jacobianFaultN = 0.0;
+                PylithScalar jacobianFaultP = 0.0;
+                for (int jDim=0; jDim < spaceDim; ++jDim) {
+                    for (int kDim=0; kDim < spaceDim; ++kDim) {
+                        const PylithScalar rr = orientationVertex[iDim*spaceDim+jDim] * orientationVertex[iDim*spaceDim+kDim];
+                        jacobianFaultN += rr * jacobianVertexN[jDim*spaceDim+kDim];
+                        jacobianFaultP += rr * jacobianVertexP[jDim*spaceDim+kDim];
+                    } // for
+                } // for
+                for (int jDim=0; jDim < spaceDim; ++jDim) {
+                    for (int kDim=0; kDim < spaceDim; ++kDim) {
+                        const PylithScalar rr = orientationVertex[iDim*spaceDim+jDim] * orientationVertex[iDim*spaceDim+kDim];
+                        jacobianInvVertexN[jDim*spaceDim+kDim] += rr / jacobianFaultN;
+                        jacobianInvVertexP[jDim*spaceDim+kDim] += rr / jacobianFaultP;
+                    } // for
+                } // for
+            } // for
+        } else {
+            assert(PC_DIAGONAL == _constraintPCType);
+            for (int iDim=0; iDim < spaceDim; ++iDim) {
+                jacobianInvVertexN[iDim*spaceDim+iDim] = 1.0/jacobianVertexN[iDim*spaceDim+iDim];
+                jacobianInvVertexP[iDim*spaceDim+iDim] = 1.0/jacobianVertexP[iDim*spaceDim+iDim];
+            } // for
+        } // if/else
 
         // Compute -[L] [Adiag]^(-1) [L]^T
         //   L_{ii} = L^T{ii} = areaVertex
-        //   Adiag^{-1}_{ii} = jacobianInvVertexN[i] + jacobianInvVertexP[i]
-        precondVertexL = 0.0;
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            precondVertexL[iDim] -= areaArray[aoff] * areaArray[aoff] *
-                                    (jacobianInvVertexN[iDim] + jacobianInvVertexP[iDim]);
-        } // for
-
+        //   Adiag^{-1} = jacobianInvVertexN + jacobianInvVertexP
+        const PylithScalar areaVertex = areaArray[aoff];
+        precondVertexL = -areaVertex * areaVertex * (jacobianInvVertexN + jacobianInvVertexP);
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(computeEvent);
         _logger->eventBegin(updateEvent);
 #endif
 
-        // Set diagonal entries in preconditioned matrix.
+        // Set entries in preconditioned matrix.
         PetscInt poff = 0;
         err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &poff); PYLITH_CHECK_ERROR(err);
 
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            err = MatSetValue(*precondMatrix, poff+iDim, poff+iDim, precondVertexL[iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
-        } // for
+        if (PC_DIAGONAL == _constraintPCType) {
+            for (int iDim=0; iDim < spaceDim; ++iDim) {
+                err = MatSetValue(*precondMatrix, poff+iDim, poff+iDim, precondVertexL[iDim*spaceDim+iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+            } // for
+        } else {
+            indicesL = indicesRel + poff;
+            err = MatSetValues(*precondMatrix,
+                               indicesL.size(), &indicesL[0],
+                               indicesL.size(), &indicesL[0],
+                               &precondVertexL[0], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+        } // if/else
 
 #if 0 // DEBUGGING
         std::cout << "1/P_vertex " << e_lagrange << ", poff: " << poff << std::endl;
         for(int iDim = 0; iDim < spaceDim; ++iDim) {
-            std::cout << "  " << precondVertexL[iDim] << std::endl;
+            std::cout << "  " << precondVertexL[iDim*spaceDim+iDim] << std::endl;
         } // for
 #endif
 
@@ -758,7 +776,19 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
 #endif
     } // for
     err = MatDestroy(&jacobianNP); PYLITH_CHECK_ERROR(err);
-    PetscLogFlops(numVertices*spaceDim*6);
+    switch (_constraintPCType) {
+    case PC_DIAGONAL :
+        PetscLogFlops(numVertices*spaceDim*6);
+        break;
+    case PC_VERTEX_BLOCK :
+        PetscLogFlops(numVertices*(2*spaceDim*spaceDim*spaceDim + spaceDim*spaceDim*4));
+        break;
+    case PC_FAULT_DIAGONAL :
+        PetscLogFlops(numVertices*(spaceDim*spaceDim*spaceDim*10 + spaceDim*spaceDim*4));
+        break;
+    default :
+        assert(0);
+    } // switch
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -1675,6 +1705,169 @@ pylith::faults::FaultCohesiveLagrange::_calcOrientation(const PylithScalar upDir
     PYLITH_METHOD_END;
 } // _calcOrientation
 
+// ----------------------------------------------------------------------
+// Setup global indices and values of constraint block in Jacobian.
+void
+pylith::faults::FaultCohesiveLagrange::_setupConstraintBlock(const topology::SolutionFields& fields)
+{ // _setupConstraintBlock
+    PYLITH_METHOD_BEGIN;
+
+    assert(_quadrature);
+    assert(_fields);
+
+    const int spaceDim = _quadrature->spaceDim();
+    const int numIndices = 3*spaceDim;
+    const int numValues = numIndices*numIndices;
+
+    // Get fields.
+    topology::Field& area = _fields->get("area");
+    topology::VecVisitorMesh areaVisitor(area);
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    PetscSection solnSection = fields.solution().localSection(); assert(solnSection);
+    PetscSection solnGlobalSection = fields.solution().globalSection(); assert(solnGlobalSection);
+
+    // Count local constraints.
+    PetscErrorCode err = 0;
+    const int numVertices = _cohesiveVertices.size();
+    int numConstraints = 0;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        if (e_lagrange < 0) { // Skip clamped edges.
+            continue;
+        } // if
+
+        PetscInt gloff = 0;
+        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
+        if (gloff >= 0)
+            ++numConstraints;
+    } // for
+
+    _constraintIndices.resize(numConstraints*numIndices);
+    _constraintValues.resize(numConstraints*numValues);
+    _constraintValues = 0.0;
+
+    int iConstraint = 0;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+        if (e_lagrange < 0) { // Skip clamped edges.
+            continue;
+        } // if
+
+        // Compute contribution only if Lagrange constraint is local.
+        PetscInt gloff = 0;
+        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
+        if (gloff < 0)
+            continue;
+
+        PetscInt gnoff = 0;
+        err = PetscSectionGetOffset(solnGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
+        gnoff = gnoff < 0 ? -(gnoff+1) : gnoff;
+
+        PetscInt gpoff = 0;
+        err = PetscSectionGetOffset(solnGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
+        gpoff = gpoff < 0 ? -(gpoff+1) : gpoff;
+
+        PetscInt cdof;
+        err = PetscSectionGetConstraintDof(solnSection, v_negative, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
+        err = PetscSectionGetConstraintDof(solnSection, v_positive, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
+
+        // Get area associated with fault vertex.
+        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+        assert(1 == areaVisitor.sectionDof(v_fault));
+        const PylithScalar areaVertex = areaArray[aoff];
+
+        // Set global order indices [P, N, L].
+        PetscInt* indicesPNL = &_constraintIndices[iConstraint*numIndices];
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            indicesPNL[0*spaceDim+iDim] = gpoff + iDim;
+            indicesPNL[1*spaceDim+iDim] = gnoff + iDim;
+            indicesPNL[2*spaceDim+iDim] = gloff + iDim;
+        } // for
+
+        // Rows L: area at positive vertex, -area at negative vertex,
+        // and zero at Lagrange vertex. Columns L: transpose. Entries
+        // coupling the positive and negative vertices are zero.
+        PylithScalar* valuesPNL = &_constraintValues[iConstraint*numValues];
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            const int iP = 0*spaceDim+iDim;
+            const int iN = 1*spaceDim+iDim;
+            const int iL = 2*spaceDim+iDim;
+            valuesPNL[iL*numIndices+iP] = +areaVertex;
+            valuesPNL[iL*numIndices+iN] = -areaVertex;
+            valuesPNL[iP*numIndices+iL] = +areaVertex;
+            valuesPNL[iN*numIndices+iL] = -areaVertex;
+        } // for
+
+        ++iConstraint;
+    } // for
+    assert(numConstraints == iConstraint);
+    PetscLogFlops(numConstraints*spaceDim*2);
+
+    err = PetscObjectGetId((PetscObject) solnGlobalSection, &_constraintSectionId); PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupConstraintBlock
+
+// ----------------------------------------------------------------------
+// Invert spaceDim x spaceDim vertex block of Jacobian.
+void
+pylith::faults::FaultCohesiveLagrange::_invertVertexBlock(scalar_array* blockInv,
+                                                          const scalar_array& block,
+                                                          const int spaceDim)
+{ // _invertVertexBlock
+    assert(blockInv);
+    assert(spaceDim*spaceDim == int(block.size()));
+    assert(spaceDim*spaceDim == int(blockInv->size()));
+
+    PylithScalar det = 0.0;
+    switch (spaceDim) {
+    case 1 :
+        det = block[0];
+        if (det != 0.0) {
+            (*blockInv)[0] = 1.0 / det;
+        } // if
+        break;
+    case 2 :
+        det = block[0]*block[3] - block[1]*block[2];
+        if (det != 0.0) {
+            (*blockInv)[0] =  block[3] / det;
+            (*blockInv)[1] = -block[1] / det;
+            (*blockInv)[2] = -block[2] / det;
+            (*blockInv)[3] =  block[0] / det;
+        } // if
+        break;
+    case 3 :
+        det =
+            block[0]*(block[4]*block[8] - block[5]*block[7]) -
+            block[1]*(block[3]*block[8] - block[5]*block[6]) +
+            block[2]*(block[3]*block[7] - block[4]*block[6]);
+        if (det != 0.0) {
+            (*blockInv)[0] = (block[4]*block[8] - block[5]*block[7]) / det;
+            (*blockInv)[1] = (block[2]*block[7] - block[1]*block[8]) / det;
+            (*blockInv)[2] = (block[1]*block[5] - block[2]*block[4]) / det;
+            (*blockInv)[3] = (block[5]*block[6] - block[3]*block[8]) / det;
+            (*blockInv)[4] = (block[0]*block[8] - block[2]*block[6]) / det;
+            (*blockInv)[5] = (block[2]*block[3] - block[0]*block[5]) / det;
+            (*blockInv)[6] = (block[3]*block[7] - block[4]*block[6]) / det;
+            (*blockInv)[7] = (block[1]*block[6] - block[0]*block[7]) / det;
+            (*blockInv)[8] = (block[0]*block[4] - block[1]*block[3]) / det;
+        } // if
+        break;
+    default :
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in _invertVertexBlock().");
+    } // switch
+
+    if (0.0 == det) {
+        throw std::runtime_error("Singular vertex block in Jacobian while computing fault preconditioner.");
+    } // if
+} // _invertVertexBlock
+
 // ----------------------------------------------------------------------
 void
 pylith::faults::FaultCohesiveLagrange::_calcArea(void)
@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "FaultCohesive.hh" // ISA FaultCohesive
 
+#include <petscsys.h> // HASA PetscObjectId
+
 // FaultCohesiveLagrange -----------------------------------------------------
 /**
  * @brief C++ abstract base class for implementing falt slip using
@@ -86,6 +88,16 @@ class pylith::faults::FaultCohesiveLagrange : public FaultCohesive
 { // class FaultCohesiveLagrange
   friend class TestFaultCohesiveLagrange; // unit testing
 
+  // PUBLIC ENUMS ///////////////////////////////////////////////////////
+public :
+
+  /// Approximation of [K]^(-1) in custom preconditioner.
+  enum ConstraintPCEnum {
+    PC_DIAGONAL=0, ///< Diagonal of [K] at each vertex.
+    PC_VERTEX_BLOCK=1, ///< Vertex blocks of [K].
+    PC_FAULT_DIAGONAL=2 ///< Diagonal of [K] in fault coordinate system.
+  }; // ConstraintPCEnum
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -112,6 +124,21 @@ public :
   void initialize(const topology::Mesh& mesh,
 		  const PylithScalar upDir[3]);
 
+  /** Set approximation of [K]^(-1) used in the custom preconditioner
+   * for the Lagrange multipliers.
+   *
+   * @param value Name of approximation ('diagonal', 'vertex_block', or
+   * 'fault_diagonal').
+   */
+  void constraintPCType(const char* value);
+
+  /** Get approximation of [K]^(-1) used in the custom preconditioner
+   * for the Lagrange multipliers.
+   *
+   * @returns Type of approximation.
+   */
+  ConstraintPCEnum constraintPCType(void) const;
+
   /** Setup DOF on solution field.
    *
    * @param field Solution field.
@@ -160,7 +187,9 @@ public :
    * We have J = [A C^T]
    *             [C   0]
    *
-   * We approximate C A^(-1) C^T.
+   * We approximate C A^(-1) C^T using the diagonal of A, the
+   * spaceDim x spaceDim vertex blocks of A, or the diagonal of the
+   * vertex blocks of A rotated into the fault coordinate system.
    *
    * @param pc PETSc preconditioner structure.
    * @param jacobian Sparse matrix for Jacobian of system.
@@ -306,6 +335,27 @@ private :
   /// Calculate fault area field.
   void _calcArea(void);
 
+  /** Setup global indices and values of the constraint block [C, C^T]
+   * in the Jacobian matrix. The block depends only on the fault
+   * geometry and the layout of the solution, so it is computed once
+   * and added directly into the storage of the Jacobian matrix every
+   * time the Jacobian is reformed.
+   *
+   * @param fields Solution fields.
+   */
+  void _setupConstraintBlock(const topology::SolutionFields& fields);
+
+  /** Invert spaceDim x spaceDim vertex block of Jacobian.
+   *
+   * @param blockInv Inverse of block.
+   * @param block Vertex block.
+   * @param spaceDim Dimension of block.
+   */
+  static
+  void _invertVertexBlock(scalar_array* blockInv,
+			  const scalar_array& block,
+			  const int spaceDim);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -317,6 +367,22 @@ protected :
 
   topology::StratumIS* _cohesiveIS; ///< Index set of cohesive cells.
 
+  /// Global indices [P, N, L] of local constraints in constraint block.
+  int_array _constraintIndices;
+
+  /// Values of rows and columns [P, N, L] of each local constraint in
+  /// constraint block.
+  scalar_array _constraintValues;
+
+  /// Id of global section of solution associated with constraint block.
+  PetscObjectId _constraintSectionId;
+
+  /// Map from constraint block to storage of Jacobian matrix.
+  topology::MatAssemblyMap* _constraintMap;
+
+  /// Approximation of [K]^(-1) in custom preconditioner.
+  ConstraintPCEnum _constraintPCType;
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -23,11 +23,24 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
+#include <algorithm> // USES std::sort()
+#include <utility> // USES std::pair
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::logic_error
 
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::SlipTimeFn::SlipTimeFn(void) :
-  _parameters(0)
+  _parameters(0),
+  _tActive(0.0),
+  _numStarted(0),
+  _haveActiveSet(false)
 { // constructor
 } // constructor
 
@@ -46,6 +59,7 @@ pylith::faults::SlipTimeFn::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   delete _parameters; _parameters = 0;
+  _haveActiveSet = false;
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -58,5 +72,148 @@ pylith::faults::SlipTimeFn::parameterFields(void) const
   return _parameters;
 } // parameterFields
 
+// ----------------------------------------------------------------------
+// Add slip on fault surface at time t using active set of points.
+void
+pylith::faults::SlipTimeFn::slipActive(topology::Field* const slipField,
+				       topology::Field* const slipFinished,
+				       const PylithScalar t)
+{ // slipActive
+  PYLITH_METHOD_BEGIN;
+
+  assert(slipField);
+  assert(slipFinished);
+
+  if (!_haveActiveSet) {
+    _setupActiveSet();
+  } // if
+  if (_numStarted > 0 && t < _tActive) {
+    std::ostringstream msg;
+    msg << "Time " << t << " for slip time function is earlier than time "
+	<< _tActive << " of previous update of active set.";
+    throw std::logic_error(msg.str());
+  } // if
+  _tActive = t;
+
+  // Add points where slip has started since previous update.
+  const int numPoints = _sortedPoints.size();
+  while (_numStarted < numPoints && _sortedStartTime[_numStarted] <= t) {
+    _activeIndices.push_back(_numStarted);
+    ++_numStarted;
+  } // while
+
+  // Separate points that are still slipping (front of buffer) from
+  // those where slip has finished (back of buffer).
+  const int numActive = _activeIndices.size();
+  int numSlipping = 0;
+  int numFinished = 0;
+  for (int i=0; i < numActive; ++i) {
+    const int index = _activeIndices[i];
+    if (t > _sortedEndTime[index]) {
+      ++numFinished;
+      _pointsBuffer[numPoints-numFinished] = _sortedPoints[index];
+    } else {
+      _activeIndices[numSlipping] = index;
+      _pointsBuffer[numSlipping++] = _sortedPoints[index];
+    } // if/else
+  } // for
+  _activeIndices.resize(numSlipping);
+
+  if (numSlipping > 0) {
+    _slipPoints(slipField, &_pointsBuffer[0], numSlipping, t);
+  } // if
+  if (numFinished > 0) {
+    const PylithInt* finishedPoints = &_pointsBuffer[numPoints-numFinished];
+    _slipPoints(slipField, finishedPoints, numFinished, t);
+    _slipPoints(slipFinished, finishedPoints, numFinished, t);
+  } // if
+
+  PYLITH_METHOD_END;
+} // slipActive
+
+// ----------------------------------------------------------------------
+// Reset active set.
+void
+pylith::faults::SlipTimeFn::resetActiveSet(void)
+{ // resetActiveSet
+  _activeIndices.clear();
+  _numStarted = 0;
+  _tActive = 0.0;
+} // resetActiveSet
+
+// ----------------------------------------------------------------------
+// Get duration of slip at points.
+void
+pylith::faults::SlipTimeFn::_slipDuration(PylithScalar* const duration,
+					  const PylithInt* points,
+					  const int numPoints)
+{ // _slipDuration
+  assert(!numPoints || duration);
+
+  for (int i=0; i < numPoints; ++i) {
+    duration[i] = PYLITH_MAXSCALAR;
+  } // for
+} // _slipDuration
+
+// ----------------------------------------------------------------------
+// Sort points by slip initiation time and compute when slip finishes.
+void
+pylith::faults::SlipTimeFn::_setupActiveSet(void)
+{ // _setupActiveSet
+  PYLITH_METHOD_BEGIN;
+
+  assert(_parameters);
+
+  // Get vertices in fault mesh
+  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  PetscDMLabel clamped = NULL;
+  PetscErrorCode err = DMGetLabel(dmMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
+
+  topology::VecVisitorMesh slipTimeVisitor(slipTime());
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  typedef std::pair<PylithScalar, PylithInt> time_point_type;
+  std::vector<time_point_type> timePoints;
+  timePoints.reserve(vEnd-vStart);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
+      continue;
+    } // if
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    assert(1 == slipTimeVisitor.sectionDof(v));
+    timePoints.push_back(time_point_type(slipTimeArray[stoff], v));
+  } // for
+  std::sort(timePoints.begin(), timePoints.end());
+
+  const int numPoints = timePoints.size();
+  _sortedPoints.resize(numPoints);
+  _sortedStartTime.resize(numPoints);
+  _sortedEndTime.resize(numPoints);
+  _pointsBuffer.resize(numPoints);
+  for (int i=0; i < numPoints; ++i) {
+    _sortedStartTime[i] = timePoints[i].first;
+    _sortedPoints[i] = timePoints[i].second;
+  } // for
+  if (numPoints > 0) {
+    _slipDuration(&_sortedEndTime[0], &_sortedPoints[0], numPoints);
+  } // if
+  for (int i=0; i < numPoints; ++i) {
+    if (_sortedEndTime[i] < PYLITH_MAXSCALAR) {
+      _sortedEndTime[i] += _sortedStartTime[i];
+    } // if
+  } // for
+
+  _activeIndices.clear();
+  _activeIndices.reserve(numPoints);
+  _numStarted = 0;
+  _haveActiveSet = true;
+
+  PYLITH_METHOD_END;
+} // _setupActiveSet
+
 
 // End of file 
@@ -28,6 +28,7 @@
 #include "faultsfwd.hh" // forward declarations
 
 #include "pylith/topology/topologyfwd.hh" // USES Fields<Mesh>
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array, int_vector
 
 #include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
 
@@ -75,6 +76,30 @@ public :
   void slip(topology::Field* const slipField,
 	    const PylithScalar t) = 0;
   
+  /** Add slip on fault surface at time t, computing slip only at
+   * points where slip has started but not finished (active set).
+   *
+   * Points are sorted by slip initiation time so that points where
+   * slip has not started are never visited. When slip finishes at a
+   * point, its final slip is added to both the slip field and the
+   * field of finished slip, and the point is not evaluated again. The
+   * caller must initialize the slip field with the finished slip from
+   * previous calls.
+   *
+   * @pre Time must not decrease between calls unless
+   * resetActiveSet() is called.
+   *
+   * @param slipField Slip field over fault surface.
+   * @param slipFinished Slip at points where slip has finished.
+   * @param t Time t.
+   */
+  void slipActive(topology::Field* const slipField,
+		  topology::Field* const slipFinished,
+		  const PylithScalar t);
+
+  /// Reset active set so that slip has not started at any point.
+  void resetActiveSet(void);
+
   /** Get final slip.
    *
    * @returns Final slip.
@@ -95,11 +120,57 @@ public :
    */
   const topology::Fields* parameterFields(void) const;
 
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Add slip at time t at points.
+   *
+   * @param slipField Slip field over fault surface.
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   * @param t Time t.
+   */
+  virtual
+  void _slipPoints(topology::Field* const slipField,
+		   const PylithInt* points,
+		   const int numPoints,
+		   const PylithScalar t) = 0;
+
+  /** Get duration of slip (time from slip initiation after which slip
+   * is constant) at points. Default is slip that never finishes.
+   *
+   * @param duration Array of durations [output].
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   */
+  virtual
+  void _slipDuration(PylithScalar* const duration,
+		     const PylithInt* points,
+		     const int numPoints);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Sort points by slip initiation time and compute when slip finishes.
+  void _setupActiveSet(void);
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
   topology::Fields* _parameters; ///< Parameters for slip time function.
 
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  int_array _sortedPoints; ///< Points sorted by slip initiation time.
+  scalar_array _sortedStartTime; ///< Slip initiation time at sorted points.
+  scalar_array _sortedEndTime; ///< Time when slip finishes at sorted points.
+  int_vector _activeIndices; ///< Indices of sorted points with active slip.
+  int_array _pointsBuffer; ///< Buffer for list of points.
+  PylithScalar _tActive; ///< Time of most recent update of active set.
+  int _numStarted; ///< Number of sorted points where slip has started.
+  bool _haveActiveSet; ///< True if active set has been setup.
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -259,6 +259,71 @@ pylith::faults::StepSlipFn::slip(topology::Field* slip,
   PYLITH_METHOD_END;
 } // slip
 
+// ----------------------------------------------------------------------
+// Add slip at time t at points.
+void
+pylith::faults::StepSlipFn::_slipPoints(topology::Field* const slipField,
+					const PylithInt* points,
+					const int numPoints,
+					const PylithScalar t)
+{ // _slipPoints
+  PYLITH_METHOD_BEGIN;
+
+  assert(slipField);
+  assert(_parameters);
+  assert(!numPoints || points);
+
+  // Get sections
+  const topology::Field& finalSlip = _parameters->get("final slip");
+  topology::VecVisitorMesh finalSlipVisitor(finalSlip);
+  const PetscScalar* finalSlipArray = finalSlipVisitor.localArray();
+
+  const topology::Field& slipTime = _parameters->get("slip time");
+  topology::VecVisitorMesh slipTimeVisitor(slipTime);
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  topology::VecVisitorMesh slipVisitor(*slipField);
+  PetscScalar* slipArray = slipVisitor.localArray();
+
+  const int spaceDim = _slipVertex.size();
+  for (int i=0; i < numPoints; ++i) {
+    const PetscInt v = points[i];
+    const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    const PetscInt soff = slipVisitor.sectionOffset(v);
+
+    assert(spaceDim == finalSlipVisitor.sectionDof(v));
+    assert(1 == slipTimeVisitor.sectionDof(v));
+    assert(spaceDim == slipVisitor.sectionDof(v));
+
+    const PylithScalar relTime = t - slipTimeArray[stoff];
+    if (relTime >= 0.0) {
+      for(PetscInt d = 0; d < spaceDim; ++d) {
+        slipArray[soff+d] += finalSlipArray[fsoff+d];
+      } // for
+    } // if
+  } // for
+
+  PetscLogFlops(numPoints * 1);
+
+  PYLITH_METHOD_END;
+} // _slipPoints
+
+// ----------------------------------------------------------------------
+// Get duration of slip at points.
+void
+pylith::faults::StepSlipFn::_slipDuration(PylithScalar* const duration,
+					  const PylithInt* points,
+					  const int numPoints)
+{ // _slipDuration
+  assert(!numPoints || duration);
+
+  // Slip is constant as soon as it starts.
+  for (int i=0; i < numPoints; ++i) {
+    duration[i] = 0.0;
+  } // for
+} // _slipDuration
+
 // ----------------------------------------------------------------------
 // Get final slip.
 const pylith::topology::Field&
@@ -281,6 +281,68 @@ pylith::faults::TimeHistorySlipFn::slip(topology::Field* slip,
   PYLITH_METHOD_END;
 } // slip
 
+// ----------------------------------------------------------------------
+// Add slip at time t at points.
+void
+pylith::faults::TimeHistorySlipFn::_slipPoints(topology::Field* const slipField,
+					       const PylithInt* points,
+					       const int numPoints,
+					       const PylithScalar t)
+{ // _slipPoints
+  PYLITH_METHOD_BEGIN;
+
+  assert(slipField);
+  assert(_parameters);
+  assert(_dbTimeHistory);
+  assert(!numPoints || points);
+
+  // Get sections
+  const topology::Field& slipAmplitude = _parameters->get("slip amplitude");
+  topology::VecVisitorMesh slipAmplitudeVisitor(slipAmplitude);
+  const PetscScalar* slipAmplitudeArray = slipAmplitudeVisitor.localArray();
+
+  const topology::Field& slipTime = _parameters->get("slip time");
+  topology::VecVisitorMesh slipTimeVisitor(slipTime);
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  topology::VecVisitorMesh slipVisitor(*slipField);
+  PetscScalar* slipArray = slipVisitor.localArray();
+
+  const int spaceDim = _slipVertex.size();
+  PylithScalar amplitude = 0.0;
+  for (int i=0; i < numPoints; ++i) {
+    const PetscInt v = points[i];
+    const PetscInt saoff = slipAmplitudeVisitor.sectionOffset(v);
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    const PetscInt soff = slipVisitor.sectionOffset(v);
+
+    assert(spaceDim == slipAmplitudeVisitor.sectionDof(v));
+    assert(1 == slipTimeVisitor.sectionDof(v));
+    assert(spaceDim == slipVisitor.sectionDof(v));
+
+    PylithScalar relTime = t - slipTimeArray[stoff];
+    if (relTime >= 0.0) {
+      relTime *= _timeScale;
+      const int err = _dbTimeHistory->query(&amplitude, relTime);
+      if (err) {
+        std::ostringstream msg;
+        msg << "Error querying for time '" << relTime
+            << "' in time history database '"
+            << _dbTimeHistory->label() << "'.";
+        throw std::runtime_error(msg.str());
+      } // if
+
+      for(PetscInt d = 0; d < spaceDim; ++d) {
+        slipArray[soff+d] += slipAmplitudeArray[saoff+d] * amplitude;
+      } // for
+    } // if
+  } // for
+
+  PetscLogFlops(numPoints * 3);
+
+  PYLITH_METHOD_END;
+} // _slipPoints
+
 // ----------------------------------------------------------------------
 // Get final slip.
 const pylith::topology::Field&
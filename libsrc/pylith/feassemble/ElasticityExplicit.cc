@@ -32,6 +32,7 @@
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
 
@@ -44,6 +45,7 @@
 
 #include "petscmat.h" // USES PetscMat
 
+#include <algorithm> // USES std::min()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
@@ -54,7 +56,8 @@
 // Constructor
 pylith::feassemble::ElasticityExplicit::ElasticityExplicit(void) :
   _dtm1(-1.0),
-  _normViscosity(0.1)
+  _normViscosity(0.1),
+  _rateSubstep(0)
 { // constructor
 } // constructor
 
@@ -109,6 +112,94 @@ pylith::feassemble::ElasticityExplicit::stableTimeStep(const topology::Mesh& mes
   PYLITH_METHOD_RETURN(_material->stableTimeStepExplicit(mesh, _quadrature));
 } // stableTimeStep
 
+// ----------------------------------------------------------------------
+// Compute time-step levels of cells for multi-rate time stepping.
+void
+pylith::feassemble::ElasticityExplicit::stableRateLevels(int_array* levels,
+							 const topology::Mesh& mesh,
+							 const PylithScalar dt,
+							 const int maxLevel) const
+{ // stableRateLevels
+  PYLITH_METHOD_BEGIN;
+
+  assert(levels);
+  assert(_material);
+  assert(_materialIS);
+  assert(dt > 0.0);
+  assert(maxLevel >= 0);
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  assert(levels->size() == size_t(cellsStratum.size()));
+
+  // Stable time step at quadrature points of cells in material.
+  topology::Field dtStableField(mesh);
+  _material->stableTimeStepExplicit(mesh, _quadrature, &dtStableField);
+  topology::VecVisitorMesh dtStableVisitor(dtStableField);
+  const PetscScalar* dtStableArray = dtStableVisitor.localArray();
+
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    const PetscInt off = dtStableVisitor.sectionOffset(cell);
+    const PetscInt dof = dtStableVisitor.sectionDof(cell);
+    PylithScalar dtCell = pylith::PYLITH_MAXSCALAR;
+    for(PetscInt d = 0; d < dof; ++d) {
+      dtCell = std::min(dtCell, PylithScalar(dtStableArray[off+d]));
+    } // for
+
+    // Coarsest power-of-two multiple of dt that is stable.
+    int level = 0;
+    while (level < maxLevel && PylithScalar(1 << (level+1))*dt <= dtCell) {
+      ++level;
+    } // while
+    (*levels)[cell-cStart] = level;
+  } // for
+
+  PYLITH_METHOD_END;
+} // stableRateLevels
+
+// ----------------------------------------------------------------------
+// Set levels at which cells are updated in multi-rate time stepping.
+void
+pylith::feassemble::ElasticityExplicit::rateLevels(const int_array& levels,
+						   const topology::Mesh& mesh)
+{ // rateLevels
+  PYLITH_METHOD_BEGIN;
+
+  assert(_materialIS);
+
+  if (!levels.size()) {
+    _rateLevels.resize(0);
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  assert(levels.size() == size_t(cellsStratum.size()));
+
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  _rateLevels.resize(numCells);
+  for(PetscInt c = 0; c < numCells; ++c) {
+    _rateLevels[c] = levels[cells[c]-cStart];
+  } // for
+  _rateSubstep = 0;
+
+  PYLITH_METHOD_END;
+} // rateLevels
+
+// ----------------------------------------------------------------------
+// Set current substep in cycle of multi-rate time stepping.
+void
+pylith::feassemble::ElasticityExplicit::rateSubstep(const int value)
+{ // rateSubstep
+  _rateSubstep = value;
+} // rateSubstep
+
 // ----------------------------------------------------------------------
 // Set normalized viscosity for numerical damping.
 void
@@ -127,6 +218,15 @@ pylith::feassemble::ElasticityExplicit::normViscosity(const PylithScalar viscosi
   PYLITH_METHOD_END;
 } // normViscosity
 
+// ----------------------------------------------------------------------
+// Check whether integrator splits cells into boundary and interior
+// subsets.
+bool
+pylith::feassemble::ElasticityExplicit::splitsResidual(void) const
+{ // splitsResidual
+  return true;
+} // splitsResidual
+
 // ----------------------------------------------------------------------
 // Integrate constributions to residual term (r) for operator.
 void
@@ -205,7 +305,8 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
   const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  PetscInt numCells = 0;
+  const int* residualCells = _residualCells(&numCells);
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
@@ -244,8 +345,17 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
   _logger->eventBegin(computeEvent);
 #endif
 
+  // Skip cells whose vertices are all between updates in the
+  // multi-rate cycle.
+  const bool useRateLevels = _rateLevels.size() > 0;
+  assert(!useRateLevels || _rateLevels.size() == size_t(_materialIS->size()));
+
   // Loop over cells
-  for(PetscInt c = 0; c < numCells; ++c) {
+  for(PetscInt iCell = 0; iCell < numCells; ++iCell) {
+    const PetscInt c = residualCells ? residualCells[iCell] : iCell;
+    if (useRateLevels && (_rateSubstep % (1 << _rateLevels[c]))) {
+      continue;
+    } // if
     const PetscInt cell = cells[c];
     // Compute geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
@@ -99,12 +99,53 @@ public :
    */
   PylithScalar stableTimeStep(const topology::Mesh& mesh) const;
 
+  /** Compute time-step levels of cells for multi-rate time stepping.
+   *
+   * A cell at level k is stable with a time step of 2^k*dt.
+   *
+   * @param levels Array of levels for cells in mesh (indexed by cell
+   * relative to first cell); only entries for cells in the material
+   * are set.
+   * @param mesh Finite-element mesh.
+   * @param dt Time step for finest level.
+   * @param maxLevel Maximum level.
+   */
+  void stableRateLevels(int_array* levels,
+			const topology::Mesh& mesh,
+			const PylithScalar dt,
+			const int maxLevel) const;
+
+  /** Set levels at which cells are updated in multi-rate time stepping.
+   *
+   * A cell at level k contributes to the residual every 2^k time
+   * steps. An empty array disables multi-rate time stepping.
+   *
+   * @param levels Array of levels for cells in mesh (indexed by cell
+   * relative to first cell).
+   * @param mesh Finite-element mesh.
+   */
+  void rateLevels(const int_array& levels,
+		  const topology::Mesh& mesh);
+
+  /** Set current substep in cycle of multi-rate time stepping.
+   *
+   * @param value Substep in cycle.
+   */
+  void rateSubstep(const int value);
+
   /** Set normalized viscosity for numerical damping.
    *
    * @param viscosity Normalized viscosity (viscosity / elastic modulus).
    */
   void normViscosity(const PylithScalar viscosity);
 
+  /** Check whether integrator restricts integration of the residual
+   * to the current subset of cells.
+   *
+   * @returns True.
+   */
+  bool splitsResidual(void) const;
+
   /** Integrate contributions to residual term (r) for operator.
    *
    * @param residual Field containing values for residual
@@ -146,6 +187,8 @@ private :
 
   PylithScalar _dtm1; ///< Time step for t-dt1 -> t
   PylithScalar _normViscosity; ///< Normalized viscosity for numerical damping.
+  int_array _rateLevels; ///< Level of cells in multi-rate time stepping.
+  int _rateSubstep; ///< Current substep in multi-rate cycle.
 
 }; // ElasticityExplicit
 
@@ -0,0 +1,765 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+#include <portinfo>
+
+#include "ElasticityExplicitHex8.hh" // implementation of class methods
+
+#include "Quadrature.hh" // USES Quadrature
+
+#include "pylith/materials/ElasticMaterial.hh" // USES ElasticMaterial
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+#include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimendional
+
+#include "petscmat.h" // USES PetscMat
+
+#include <algorithm> // USES std::max()
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+//#define DETAILED_EVENT_LOGGING
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace feassemble {
+    namespace _ElasticityExplicitHex8 {
+      /** Coordinates of vertices in reference cell in the order of the
+       * closure of the cell (vertices of bottom face are in the
+       * reverse order of the top face).
+       */
+      static const PylithScalar refVertices[8][3] = {
+	{ -1.0, -1.0, -1.0 },
+	{ -1.0, +1.0, -1.0 },
+	{ +1.0, +1.0, -1.0 },
+	{ +1.0, -1.0, -1.0 },
+	{ -1.0, -1.0, +1.0 },
+	{ +1.0, -1.0, +1.0 },
+	{ +1.0, +1.0, +1.0 },
+	{ -1.0, +1.0, +1.0 },
+      };
+    } // _ElasticityExplicitHex8
+  } // feassemble
+} // pylith
+
+// ----------------------------------------------------------------------
+const int pylith::feassemble::ElasticityExplicitHex8::_spaceDim = 3;
+const int pylith::feassemble::ElasticityExplicitHex8::_cellDim = 3;
+const int pylith::feassemble::ElasticityExplicitHex8::_tensorSize = 6;
+const int pylith::feassemble::ElasticityExplicitHex8::_numBasis = 8;
+const int pylith::feassemble::ElasticityExplicitHex8::_numCorners = 8;
+const int pylith::feassemble::ElasticityExplicitHex8::_numQuadPts = 1;
+const int pylith::feassemble::ElasticityExplicitHex8::_numHourglassModes = 4;
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::feassemble::ElasticityExplicitHex8::ElasticityExplicitHex8(void) :
+  _dtm1(-1.0),
+  _normViscosity(0.1),
+  _hourglassStiffness(0.1)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::feassemble::ElasticityExplicitHex8::~ElasticityExplicitHex8(void)
+{ // destructor
+  deallocate();
+} // destructor
+  
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::feassemble::ElasticityExplicitHex8::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  IntegratorElasticity::deallocate();
+  _hourglassModulus.resize(0);
+
+  PYLITH_METHOD_END;
+} // deallocate
+  
+// ----------------------------------------------------------------------
+// Set time step for advancing from time t to time t+dt.
+void
+pylith::feassemble::ElasticityExplicitHex8::timeStep(const PylithScalar dt)
+{ // timeStep
+  PYLITH_METHOD_BEGIN;
+  
+  if (_dt != -1.0)
+    _dtm1 = _dt;
+  else
+    _dtm1 = dt;
+  _dt = dt;
+  assert(_dt == _dtm1); // For now, don't allow variable time step
+  if (_material)
+    _material->timeStep(_dt);
+
+  PYLITH_METHOD_END;
+} // timeStep
+
+// ----------------------------------------------------------------------
+// Get stable time step for advancing from time t to time t+dt.
+PylithScalar
+pylith::feassemble::ElasticityExplicitHex8::stableTimeStep(const topology::Mesh& mesh) const
+{ // stableTimeStep
+  PYLITH_METHOD_BEGIN;
+  
+  assert(_material);
+  PYLITH_METHOD_RETURN(_material->stableTimeStepExplicit(mesh, _quadrature));
+} // stableTimeStep
+
+// ----------------------------------------------------------------------
+// Set normalized viscosity for numerical damping.
+void
+pylith::feassemble::ElasticityExplicitHex8::normViscosity(const PylithScalar viscosity)
+{ // normViscosity
+  PYLITH_METHOD_BEGIN;
+  
+  if (viscosity < 0.0) {
+    std::ostringstream msg;
+    msg << "Normalized viscosity (" << viscosity << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _normViscosity = viscosity;
+
+  PYLITH_METHOD_END;
+} // normViscosity
+
+// ----------------------------------------------------------------------
+// Set normalized hourglass stiffness.
+void
+pylith::feassemble::ElasticityExplicitHex8::hourglassStiffness(const PylithScalar value)
+{ // hourglassStiffness
+  PYLITH_METHOD_BEGIN;
+  
+  if (value < 0.0) {
+    std::ostringstream msg;
+    msg << "Normalized hourglass stiffness (" << value << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _hourglassStiffness = value;
+
+  PYLITH_METHOD_END;
+} // hourglassStiffness
+
+// ----------------------------------------------------------------------
+// Check whether integrator splits cells into boundary and interior
+// subsets.
+bool
+pylith::feassemble::ElasticityExplicitHex8::splitsResidual(void) const
+{ // splitsResidual
+  return true;
+} // splitsResidual
+
+// ----------------------------------------------------------------------
+// Integrate constributions to residual term (r) for operator.
+void
+pylith::feassemble::ElasticityExplicitHex8::integrateResidual(const topology::Field& residual,
+							      const PylithScalar t,
+							      topology::SolutionFields* const fields)
+{ // integrateResidual
+  PYLITH_METHOD_BEGIN;
+  
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIR setup");
+  const int computeEvent = _logger->eventId("ElIR compute");
+#if defined(DETAILED_EVENT_LOGGING)
+  const int geometryEvent = _logger->eventId("ElIR geometry");
+  const int restrictEvent = _logger->eventId("ElIR restrict");
+  const int stateVarsEvent = _logger->eventId("ElIR stateVars");
+  const int stressEvent = _logger->eventId("ElIR stress");
+  const int updateEvent = _logger->eventId("ElIR update");
+#endif
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  assert(_quadrature->numQuadPts() == _numQuadPts);
+  assert(_quadrature->numBasis() == _numBasis);
+  assert(_quadrature->spaceDim() == _spaceDim);
+  assert(_quadrature->cellDim() == _cellDim);
+  assert(_material->tensorSize() == _tensorSize);
+  const int spaceDim = _spaceDim;
+  const int cellDim = _cellDim;
+  const int tensorSize = _tensorSize;
+  const int numBasis = _numBasis;
+  const int numCorners = _numCorners;
+  const int numQuadPts = _numQuadPts;
+  const int numModes = _numHourglassModes;
+  const int cellVectorSize = numBasis*spaceDim;
+  if (cellDim != spaceDim)
+    throw std::logic_error("Integration for cells with spatial dimensions "
+         "different than the spatial dimension of the "
+         "domain not implemented yet.");
+
+  // Allocate vectors for cell values.
+  scalar_array strainCell(numQuadPts*tensorSize);
+  strainCell = 0.0;
+  scalar_array gravVec(spaceDim);
+  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
+  PylithScalar basisDeriv[8*3];
+  PylithScalar gamma[8*4];
+  PylithScalar hourglassDisp[3*4];
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  PetscInt numCells = 0;
+  const int* residualCells = _residualCells(&numCells);
+
+  // Setup field visitors.
+  scalar_array accCell(numBasis*spaceDim);
+  topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
+  accVisitor.optimizeClosure();
+
+  scalar_array velCell(numBasis*spaceDim);
+  topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
+  velVisitor.optimizeClosure();
+
+  scalar_array dispCell(numBasis*spaceDim);
+  scalar_array dispAdjCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+  
+  topology::VecVisitorMesh residualVisitor(residual, "displacement");
+  residualVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numCorners*spaceDim);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  _material->createPropsAndVarsVisitors();
+
+  // Moduli for hourglass control are normally computed with the
+  // Jacobian.
+  if (_hourglassModulus.size() != size_t(_materialIS->size()))
+    _calcHourglassModulus();
+
+  assert(_normalizer);
+  const PylithScalar lengthScale = _normalizer->lengthScale();
+  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
+
+  const PylithScalar dt = _dt;assert(dt > 0);
+  const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
+  const int hourglassFlops = (_hourglassStiffness > 0.0) ?
+    4 + numBasis*spaceDim*2 + spaceDim*numModes*(1+numBasis*2) + numBasis*spaceDim*(1+numModes*2) : 0;
+
+  _logger->eventEnd(setupEvent);
+#if !defined(DETAILED_EVENT_LOGGING)
+  _logger->eventBegin(computeEvent);
+#endif
+
+  // Loop over cells
+  for(PetscInt iCell = 0; iCell < numCells; ++iCell) {
+    const PetscInt c = residualCells ? residualCells[iCell] : iCell;
+    const PetscInt cell = cells[c];
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventBegin(restrictEvent);
+#endif
+
+    // Restrict input fields to cell
+    accVisitor.getClosure(&accCell, cell);
+    velVisitor.getClosure(&velCell, cell);
+    dispVisitor.getClosure(&dispCell, cell);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(restrictEvent);
+    _logger->eventBegin(geometryEvent);
+#endif
+
+    // Compute geometry information for current cell
+    coordsVisitor.getClosure(&coordsCell, cell);
+    const PylithScalar volume = _calcGeometry(basisDeriv, coordsCell);assert(volume > 0.0);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(geometryEvent);
+    _logger->eventBegin(stateVarsEvent);
+#endif
+
+    // Get state variables for cell.
+    _material->retrievePropsAndVars(cell);
+
+    // Get density at quadrature points for this cell
+    const scalar_array& density = _material->calcDensity();
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(stateVarsEvent);
+    _logger->eventBegin(computeEvent);
+#endif
+
+    // Reset element vector to zero
+    _resetCellVector();
+
+    // Compute body force vector if gravity is being used.
+    if (_gravityField) {
+      const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
+
+      quadPtsGlobal = 0.0;
+      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+          quadPtsGlobal[iDim] += coordsCell[iBasis*spaceDim+iDim] / numBasis;
+	} // for
+      } // for
+      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
+
+      // Compute action for element body forces
+      spatialdata::spatialdb::SpatialDB* db = _gravityField;
+      const int err = db->query(&gravVec[0], gravVec.size(), &quadPtsGlobal[0], spaceDim, cs);
+      if (err) {
+        throw std::runtime_error("Unable to get gravity vector for point.");
+      } // if
+      _normalizer->nondimensionalize(&gravVec[0], gravVec.size(), gravityScale);
+      const PylithScalar wtVertex = density[0] * volume / 8.0;
+      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            _cellVector[iBasis * spaceDim + iDim] += wtVertex * gravVec[iDim];
+	} // for
+      } // for
+      PetscLogFlops(numBasis*spaceDim*2 + numBasis*spaceDim*2);
+    } // if
+
+    // Compute action for inertial terms
+    const PylithScalar wtVertex = density[0] * volume / 8.0;
+    assert(cellVectorSize == dispCell.size());
+    for(PetscInt i = 0; i < cellVectorSize; ++i) {
+      _cellVector[i] -= wtVertex * accCell[i];
+    } // for
+
+#if defined(DETAILED_EVENT_LOGGING)
+    PetscLogFlops(2 + numBasis*spaceDim*2);
+    _logger->eventEnd(computeEvent);
+    _logger->eventBegin(stressEvent);
+#endif
+
+    // Numerical damping. Compute displacements adjusted by velocity
+    // times normalized viscosity.
+    for(PetscInt i = 0; i < cellVectorSize; ++i) {
+      dispAdjCell[i] = dispCell[i] + viscosity * velCell[i];
+    } // for
+
+    // Compute B(transpose) * sigma at centroid, first computing strains
+    assert(strainCell.size() == 6);
+    strainCell = 0.0;
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      const PylithScalar bx = basisDeriv[iBasis*spaceDim+0];
+      const PylithScalar by = basisDeriv[iBasis*spaceDim+1];
+      const PylithScalar bz = basisDeriv[iBasis*spaceDim+2];
+      const PylithScalar ux = dispAdjCell[iBasis*spaceDim+0];
+      const PylithScalar uy = dispAdjCell[iBasis*spaceDim+1];
+      const PylithScalar uz = dispAdjCell[iBasis*spaceDim+2];
+      strainCell[0] += bx * ux;
+      strainCell[1] += by * uy;
+      strainCell[2] += bz * uz;
+      strainCell[3] += 0.5 * (by * ux + bx * uy);
+      strainCell[4] += 0.5 * (bz * uy + by * uz);
+      strainCell[5] += 0.5 * (bz * ux + bx * uz);
+    } // for
+
+    const scalar_array& stressCell = _material->calcStress(strainCell, false);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    PetscLogFlops(numBasis*15);
+    _logger->eventEnd(stressEvent);
+    _logger->eventBegin(computeEvent);
+#endif
+
+    assert(_cellVector.size() == 24);
+    assert(stressCell.size() == 6);
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      const PylithScalar bx = basisDeriv[iBasis*spaceDim+0];
+      const PylithScalar by = basisDeriv[iBasis*spaceDim+1];
+      const PylithScalar bz = basisDeriv[iBasis*spaceDim+2];
+      _cellVector[iBasis*spaceDim+0] -= (bx*stressCell[0] + by*stressCell[3] + bz*stressCell[5]) * volume;
+      _cellVector[iBasis*spaceDim+1] -= (by*stressCell[1] + bx*stressCell[3] + bz*stressCell[4]) * volume;
+      _cellVector[iBasis*spaceDim+2] -= (bz*stressCell[2] + by*stressCell[4] + bx*stressCell[5]) * volume;
+    } // for
+
+    // Hourglass control.
+    if (_hourglassStiffness > 0.0) {
+      _calcHourglassVectors(gamma, basisDeriv, coordsCell);
+
+      PylithScalar basisDerivNorm = 0.0;
+      for (int i=0; i < numBasis*spaceDim; ++i) {
+	basisDerivNorm += basisDeriv[i] * basisDeriv[i];
+      } // for
+      const PylithScalar stiffness = _hourglassStiffness * _hourglassModulus[c] * volume * basisDerivNorm / 3.0;
+
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	for (int iMode=0; iMode < numModes; ++iMode) {
+	  PylithScalar value = 0.0;
+	  for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+	    value += dispAdjCell[iBasis*spaceDim+iDim] * gamma[iBasis*numModes+iMode];
+	  } // for
+	  hourglassDisp[iDim*numModes+iMode] = stiffness * value;
+	} // for
+      } // for
+
+      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+	for (int iDim=0; iDim < spaceDim; ++iDim) {
+	  PylithScalar value = 0.0;
+	  for (int iMode=0; iMode < numModes; ++iMode) {
+	    value += hourglassDisp[iDim*numModes+iMode] * gamma[iBasis*numModes+iMode];
+	  } // for
+	  _cellVector[iBasis*spaceDim+iDim] -= value;
+	} // for
+      } // for
+    } // if
+
+#if defined(DETAILED_EVENT_LOGGING)
+    PetscLogFlops(numBasis*18 + hourglassFlops);
+    _logger->eventEnd(computeEvent);
+    _logger->eventBegin(updateEvent);
+#endif
+
+    // Assemble cell contribution into field
+    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(updateEvent);
+#endif
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+
+#if !defined(DETAILED_EVENT_LOGGING)
+  PetscLogFlops(numCells*(2 + numBasis*spaceDim*2 + numBasis*15 + numBasis*18 + hourglassFlops));
+  _logger->eventEnd(computeEvent);
+#endif
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Compute matrix associated with operator.
+void
+pylith::feassemble::ElasticityExplicitHex8::integrateJacobian(topology::Jacobian* jacobian,
+							      const PylithScalar t,
+							      topology::SolutionFields* fields)
+{ // integrateJacobian
+  PYLITH_METHOD_BEGIN;
+  
+  throw std::logic_error("ElasticityExplicit::integrateJacobian() not implemented. Use integrateJacobian(lumped) instead.");
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Compute matrix associated with operator.
+void
+pylith::feassemble::ElasticityExplicitHex8::integrateJacobian(topology::Field* jacobian,
+							      const PylithScalar t,
+							      topology::SolutionFields* fields)
+{ // integrateJacobian
+  PYLITH_METHOD_BEGIN;
+  
+  assert(_quadrature);
+  assert(_material);
+  assert(jacobian);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIJ setup");
+  const int computeEvent = _logger->eventId("ElIJ compute");
+#if defined(DETAILED_EVENT_LOGGING)
+  const int geometryEvent = _logger->eventId("ElIJ geometry");
+  const int restrictEvent = _logger->eventId("ElIJ restrict");
+  const int stateVarsEvent = _logger->eventId("ElIJ stateVars");
+  const int updateEvent = _logger->eventId("ElIJ update");
+#endif
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  assert(_quadrature->numBasis() == _numBasis);
+  assert(_quadrature->spaceDim() == _spaceDim);
+  assert(_quadrature->cellDim() == _cellDim);
+  assert(_material->tensorSize() == _tensorSize);
+  const int spaceDim = _spaceDim;
+  const int cellDim = _cellDim;
+  const int numCorners = _numCorners;
+  if (cellDim != spaceDim)
+    throw std::logic_error("Don't know how to integrate elasticity " \
+			   "contribution to Jacobian matrix for cells with " \
+			   "different dimensions than the spatial dimension.");
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // Get parameters used in integration.
+  const PylithScalar dt = _dt;
+  const PylithScalar dt2 = dt*dt;
+  assert(dt > 0);
+
+  // Setup visitors.
+  topology::VecVisitorMesh jacobianVisitor(*jacobian, "displacement");
+  // Don't optimize closure since we compute the Jacobian only once.
+
+  _material->createPropsAndVarsVisitors();
+
+  scalar_array coordsCell(numCorners*spaceDim);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+  PylithScalar basisDeriv[8*3];
+
+  _logger->eventEnd(setupEvent);
+#if !defined(DETAILED_EVENT_LOGGING)
+  _logger->eventBegin(computeEvent);
+#endif
+  // Loop over cells
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    // Compute geometry information for current cell
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventBegin(geometryEvent);
+#endif
+    coordsVisitor.getClosure(&coordsCell, cell);
+    const PylithScalar volume = _calcGeometry(basisDeriv, coordsCell);assert(volume > 0.0);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(geometryEvent);
+    _logger->eventBegin(stateVarsEvent);
+#endif
+
+    // Get state variables for cell.
+    _material->retrievePropsAndVars(cell);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(stateVarsEvent);
+    _logger->eventBegin(computeEvent);
+#endif
+
+    // Compute Jacobian for inertial terms
+    const scalar_array& density = _material->calcDensity();
+    _cellVector = density[0] * volume / (8.0 * dt2);
+    
+#if defined(DETAILED_EVENT_LOGGING)
+    PetscLogFlops(3);
+    _logger->eventEnd(computeEvent);
+    _logger->eventBegin(updateEvent);
+#endif
+    
+    // Assemble cell contribution into lumped matrix.
+    jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(updateEvent);
+#endif
+  } // for
+
+  // Update moduli for hourglass control with the material properties.
+  _calcHourglassModulus();
+
+  _material->destroyPropsAndVarsVisitors();
+
+#if !defined(DETAILED_EVENT_LOGGING)
+  PetscLogFlops(numCells*3);
+  _logger->eventEnd(computeEvent);
+#endif
+
+  _needNewJacobian = false;
+  _material->resetNeedNewJacobian();
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::feassemble::ElasticityExplicitHex8::verifyConfiguration(const topology::Mesh& mesh) const
+{ // verifyConfiguration
+  PYLITH_METHOD_BEGIN;
+  
+  IntegratorElasticity::verifyConfiguration(mesh);
+
+  assert(_quadrature);
+  assert(_material);
+  if (_spaceDim != _quadrature->spaceDim() || _cellDim != _quadrature->cellDim() || _numBasis != _quadrature->numBasis() ||  _numQuadPts != _quadrature->numQuadPts()) {
+    std::ostringstream msg;
+    msg << "User specified quadrature settings material '" << _material->label() << "' do not match ElasticityExplicitHex8 hardwired quadrature settings.\n"
+	<< "  Space dim: " << _spaceDim << " (code), " << _quadrature->spaceDim() << " (user)\n"
+	<< "  Cell dim: " << _cellDim << " (code), " << _quadrature->cellDim() << " (user)\n"
+	<< "  # basis fns: " << _numBasis << " (code), " << _quadrature->numBasis() << " (user)\n"
+	<< "  # quad points: " << _numQuadPts << " (code), " << _quadrature->numQuadPts() << " (user)";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // verifyConfiguration
+
+// ----------------------------------------------------------------------
+// Compute derivatives of basis functions at centroid and volume of
+// hexahedral cell.
+PylithScalar
+pylith::feassemble::ElasticityExplicitHex8::_calcGeometry(PylithScalar basisDeriv[],
+							  const scalar_array& coordinatesCell) const
+{ // _calcGeometry
+  using namespace _ElasticityExplicitHex8;
+
+  assert(basisDeriv);
+  assert(24 == coordinatesCell.size());
+
+  // Jacobian of transformation at centroid, J_ij = dx_i/dxi_j. The
+  // derivatives of the basis functions at the centroid are
+  // dN_a/dxi_j = refVertices[a][j] / 8.
+  PylithScalar jacobian[3][3] = {
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+  };
+  for (int iBasis=0; iBasis < 8; ++iBasis) {
+    for (int i=0; i < 3; ++i) {
+      const PylithScalar x = coordinatesCell[iBasis*3+i] / 8.0;
+      for (int j=0; j < 3; ++j) {
+	jacobian[i][j] += x * refVertices[iBasis][j];
+      } // for
+    } // for
+  } // for
+
+  const PylithScalar det = 
+    jacobian[0][0]*(jacobian[1][1]*jacobian[2][2] - jacobian[1][2]*jacobian[2][1]) -
+    jacobian[0][1]*(jacobian[1][0]*jacobian[2][2] - jacobian[1][2]*jacobian[2][0]) +
+    jacobian[0][2]*(jacobian[1][0]*jacobian[2][1] - jacobian[1][1]*jacobian[2][0]);
+  assert(det > 0.0);
+
+  // Inverse of Jacobian, dxi_j/dx_i.
+  const PylithScalar invJ[3][3] = {
+    { (jacobian[1][1]*jacobian[2][2] - jacobian[1][2]*jacobian[2][1]) / det,
+      (jacobian[0][2]*jacobian[2][1] - jacobian[0][1]*jacobian[2][2]) / det,
+      (jacobian[0][1]*jacobian[1][2] - jacobian[0][2]*jacobian[1][1]) / det },
+    { (jacobian[1][2]*jacobian[2][0] - jacobian[1][0]*jacobian[2][2]) / det,
+      (jacobian[0][0]*jacobian[2][2] - jacobian[0][2]*jacobian[2][0]) / det,
+      (jacobian[0][2]*jacobian[1][0] - jacobian[0][0]*jacobian[1][2]) / det },
+    { (jacobian[1][0]*jacobian[2][1] - jacobian[1][1]*jacobian[2][0]) / det,
+      (jacobian[0][1]*jacobian[2][0] - jacobian[0][0]*jacobian[2][1]) / det,
+      (jacobian[0][0]*jacobian[1][1] - jacobian[0][1]*jacobian[1][0]) / det },
+  };
+
+  for (int iBasis=0; iBasis < 8; ++iBasis) {
+    for (int i=0; i < 3; ++i) {
+      PylithScalar value = 0.0;
+      for (int j=0; j < 3; ++j) {
+	value += refVertices[iBasis][j] * invJ[j][i];
+      } // for
+      basisDeriv[iBasis*3+i] = value / 8.0;
+    } // for
+  } // for
+
+  const PylithScalar volume = 8.0 * det;
+  PetscLogFlops(8*3*(1+3*2) + 17 + 9*4 + 8*3*(3*2+1) + 1);
+
+  return volume;
+} // _calcGeometry
+
+// ----------------------------------------------------------------------
+// Compute hourglass shape vectors of hexahedral cell.
+void
+pylith::feassemble::ElasticityExplicitHex8::_calcHourglassVectors(PylithScalar gamma[],
+								  const PylithScalar basisDeriv[],
+								  const scalar_array& coordinatesCell) const
+{ // _calcHourglassVectors
+  using namespace _ElasticityExplicitHex8;
+
+  assert(gamma);
+  assert(basisDeriv);
+  assert(24 == coordinatesCell.size());
+
+  const int numModes = _numHourglassModes;
+
+  // Hourglass base vectors: xi*eta, eta*zeta, zeta*xi, xi*eta*zeta.
+  PylithScalar hourglassBase[8][4];
+  for (int iBasis=0; iBasis < 8; ++iBasis) {
+    const PylithScalar* ref = refVertices[iBasis];
+    hourglassBase[iBasis][0] = ref[0]*ref[1];
+    hourglassBase[iBasis][1] = ref[1]*ref[2];
+    hourglassBase[iBasis][2] = ref[2]*ref[0];
+    hourglassBase[iBasis][3] = ref[0]*ref[1]*ref[2];
+  } // for
+
+  // Project base vectors so they are orthogonal to linear fields.
+  for (int iMode=0; iMode < numModes; ++iMode) {
+    PylithScalar hx[3] = { 0.0, 0.0, 0.0 };
+    for (int iBasis=0; iBasis < 8; ++iBasis) {
+      for (int i=0; i < 3; ++i) {
+	hx[i] += hourglassBase[iBasis][iMode] * coordinatesCell[iBasis*3+i];
+      } // for
+    } // for
+    for (int iBasis=0; iBasis < 8; ++iBasis) {
+      gamma[iBasis*numModes+iMode] = 
+	(hourglassBase[iBasis][iMode] - (hx[0]*basisDeriv[iBasis*3+0] + hx[1]*basisDeriv[iBasis*3+1] + hx[2]*basisDeriv[iBasis*3+2])) / 8.0;
+    } // for
+  } // for
+
+  PetscLogFlops(numModes*(8*3*2 + 8*8));
+} // _calcHourglassVectors
+
+// ----------------------------------------------------------------------
+// Compute dilatational modulus in each cell for hourglass control.
+void
+pylith::feassemble::ElasticityExplicitHex8::_calcHourglassModulus(void)
+{ // _calcHourglassModulus
+  PYLITH_METHOD_BEGIN;
+
+  assert(_material);
+  assert(_materialIS);
+
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  scalar_array strainCell(_numQuadPts*_tensorSize);
+  strainCell = 0.0;
+
+  _hourglassModulus.resize(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    _material->retrievePropsAndVars(cells[c]);
+    const scalar_array& elasticConsts = _material->calcDerivElastic(strainCell);
+    assert(elasticConsts.size() >= 15);
+
+    // Use largest of C1111, C2222, and C3333.
+    PylithScalar modulus = elasticConsts[0];
+    modulus = std::max(modulus, elasticConsts[7]);
+    modulus = std::max(modulus, elasticConsts[14]);
+    _hourglassModulus[c] = modulus;
+  } // for
+
+  PYLITH_METHOD_END;
+} // _calcHourglassModulus
+
+
+// End of file 
@@ -0,0 +1,221 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+/**
+ * @file libsrc/feassemble/ElasticityExplicitHex8.hh
+ *
+ * @brief Explicit time integration of dynamic elasticity equation
+ * using trilinear hexahedral finite-elements with one-point (reduced)
+ * integration and hourglass control.
+ */
+
+#if !defined(pylith_feassemble_elasticityexplicithex8_hh)
+#define pylith_feassemble_elasticityexplicithex8_hh
+
+// Include directives ---------------------------------------------------
+#include "IntegratorElasticity.hh" // ISA IntegratorElasticity
+
+// ElasticityExplicitHex8 -----------------------------------------------
+/**@brief Explicit time integration of the dynamic elasticity equation
+ * using trilinear hexahedral finite-elements with one-point (reduced)
+ * integration.
+ *
+ * Note: This object operates on a single finite-element family, which
+ * is defined by the quadrature and a database of material property
+ * parameters. The quadrature must use a single quadrature point.
+ *
+ * Computes contributions to terms A and r in
+ *
+ * A(t+dt) du(t) = b(t+dt, u(t), u(t-dt)) - A(t+dt) u(t),
+ *
+ * r(t+dt) = b(t+dt) - A(t+dt) (u(t) + du(t))
+ *
+ * where A(t) is a sparse matrix or vector, u(t+dt) is the field we
+ * want to compute at time t+dt, b is a vector that depends on the
+ * field at time t and t-dt, and u0 is zero at unknown DOF and set to
+ * the known values at the constrained DOF.
+ *
+ * Contributions from elasticity include the intertial and stiffness
+ * terms, so this object computes the following portions of A and r:
+ *
+ * A = 1/(dt*dt) [M]
+ *
+ * r = (1/(dt*dt) [M])(- {u(t+dt)} + 2/(dt*dt){u(t)} - {u(t-dt)}) - [K]{u(t)}
+ *
+ * The mass matrix is lumped with one eighth of the mass of the cell
+ * at each vertex. The stress is evaluated once per cell at the
+ * centroid. The zero energy (hourglass) modes of the one-point
+ * integration are controlled using the stiffness form of
+ * Flanagan and Belytschko (1981),
+ *
+ *   f_ai = -k q_ij gamma_aj,  q_ij = u_bi gamma_bj,
+ *
+ *   gamma_aj = 1/8 (h_aj - (h_bj x_bk) B_ak),
+ *
+ *   k = eps (lambda + 2 mu) V (B_ak B_ak) / 3,
+ *
+ * where h_aj are the four hourglass base vectors, B_ak are the
+ * derivatives of the basis functions at the centroid, and eps is the
+ * normalized hourglass stiffness.
+ *
+ * See governing equations section of user manual for more
+ * information.
+*/
+class pylith::feassemble::ElasticityExplicitHex8 : public IntegratorElasticity
+{ // ElasticityExplicitHex8
+  friend class TestElasticityExplicitHex8; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  ElasticityExplicitHex8(void);
+
+  /// Destructor
+  ~ElasticityExplicitHex8(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+  
+  /** Set time step for advancing from time t to time t+dt.
+   *
+   * @param dt Time step
+   */
+  void timeStep(const PylithScalar dt);
+
+  /** Get stable time step for advancing from time t to time t+dt.
+   *
+   * Default is current time step.
+   *
+   * @param mesh Finite-element mesh.
+   * @returns Time step
+   */
+  PylithScalar stableTimeStep(const topology::Mesh& mesh) const;
+
+  /** Set normalized viscosity for numerical damping.
+   *
+   * @param viscosity Normalized viscosity (viscosity / elastic modulus).
+   */
+  void normViscosity(const PylithScalar viscosity);
+
+  /** Set normalized hourglass stiffness.
+   *
+   * @param value Normalized hourglass stiffness (usually 0.05-0.15).
+   */
+  void hourglassStiffness(const PylithScalar value);
+
+  /** Check whether integrator restricts integration of the residual
+   * to the current subset of cells.
+   *
+   * @returns True.
+   */
+  bool splitsResidual(void) const;
+
+  /** Integrate contributions to residual term (r) for operator.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateResidual(const topology::Field& residual,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Integrate contributions to Jacobian matrix (A) associated with
+   * operator.
+   *
+   * @param jacobian Diagonal matrix (as field) for Jacobian of system.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateJacobian(topology::Field* jacobian,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Verify configuration is acceptable.
+   *
+   * @param mesh Finite-element mesh
+   */
+  void verifyConfiguration(const topology::Mesh& mesh) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute derivatives of basis functions at centroid and volume of
+   * hexahedral cell.
+   *
+   * @param basisDeriv Derivatives of basis functions at centroid [8*3].
+   * @param coordinatesCell Coordinates of vertices of cell.
+   * @returns Volume of cell.
+   */
+  PylithScalar _calcGeometry(PylithScalar basisDeriv[],
+			     const scalar_array& coordinatesCell) const;
+
+  /** Compute hourglass shape vectors of hexahedral cell.
+   *
+   * @param gamma Hourglass shape vectors [8*4].
+   * @param basisDeriv Derivatives of basis functions at centroid [8*3].
+   * @param coordinatesCell Coordinates of vertices of cell.
+   */
+  void _calcHourglassVectors(PylithScalar gamma[],
+			     const PylithScalar basisDeriv[],
+			     const scalar_array& coordinatesCell) const;
+
+  /** Compute dilatational modulus (lambda + 2 mu) in each cell for
+   * hourglass control.
+   *
+   * Material properties and state variables must have been setup
+   * with createPropsAndVarsVisitors().
+   */
+  void _calcHourglassModulus(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PylithScalar _dtm1; ///< Time step for t-dt1 -> t
+  PylithScalar _normViscosity; ///< Normalized viscosity for numerical damping.
+  PylithScalar _hourglassStiffness; ///< Normalized hourglass stiffness.
+  scalar_array _hourglassModulus; ///< Dilatational modulus of each cell for hourglass control.
+
+  static const int _spaceDim;
+  static const int _cellDim;
+  static const int _tensorSize;
+  static const int _numBasis;
+  static const int _numCorners;
+  static const int _numQuadPts;
+  static const int _numHourglassModes;
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  /// Not implemented.
+  ElasticityExplicitHex8(const ElasticityExplicitHex8&);
+
+  /// Not implemented
+  const ElasticityExplicitHex8& operator=(const ElasticityExplicitHex8&);
+
+  /// Not implemented.
+  void integrateJacobian(topology::Jacobian*,
+			 const PylithScalar,
+			 topology::SolutionFields* const);
+
+}; // ElasticityExplicitHex8
+
+#endif // pylith_feassemble_elasticityexplicithex8_hh
+
+
+// End of file 
@@ -122,6 +122,15 @@ pylith::feassemble::ElasticityExplicitLgDeform::normViscosity(const PylithScalar
   PYLITH_METHOD_END;
 } // normViscosity
 
+// ----------------------------------------------------------------------
+// Check whether integrator splits cells into boundary and interior
+// subsets.
+bool
+pylith::feassemble::ElasticityExplicitLgDeform::splitsResidual(void) const
+{ // splitsResidual
+  return true;
+} // splitsResidual
+
 // ----------------------------------------------------------------------
 // Integrate constributions to residual term (r) for operator.
 void
@@ -193,7 +202,8 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
   const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  PetscInt numCells = 0;
+  const int* residualCells = _residualCells(&numCells);
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
@@ -231,7 +241,8 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   _logger->eventBegin(computeEvent);
 
   // Loop over cells
-  for (PetscInt c = 0; c < numCells; ++c) {
+  for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+    const PetscInt c = residualCells ? residualCells[iCell] : iCell;
     const PetscInt cell = cells[c];
 
     // Compute geometry information for current cell
@@ -251,7 +262,6 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
     const scalar_array& quadPtsNondim = _quadrature->quadPts();
 
@@ -313,11 +323,10 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
     } // for
 
     // Compute B(transpose) * sigma, first computing strains
-    _calcDeformation(&deformCell, basisDeriv, &dispAdjCell[0], numBasis, numQuadPts, spaceDim);
-    calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
+    _calcKinematics(&deformCell, &strainCell, c, dispAdjCell, calcTotalStrainFn);
     const scalar_array& stressCell = _material->calcStress(strainCell, true);
 
-    CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, dispAdjCell);
+    CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, deformCell);
     
     // Assemble cell contribution into field
     residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
@@ -106,6 +106,13 @@ public :
    */
   void normViscosity(const PylithScalar viscosity);
 
+  /** Check whether integrator restricts integration of the residual
+   * to the current subset of cells.
+   *
+   * @returns True.
+   */
+  bool splitsResidual(void) const;
+
   /** Integrate contributions to residual term (r) for operator.
    *
    * @param residual Field containing values for residual
@@ -132,6 +132,15 @@ pylith::feassemble::ElasticityExplicitTet4::normViscosity(const PylithScalar vis
   PYLITH_METHOD_END;
 } // normViscosity
 
+// ----------------------------------------------------------------------
+// Check whether integrator splits cells into boundary and interior
+// subsets.
+bool
+pylith::feassemble::ElasticityExplicitTet4::splitsResidual(void) const
+{ // splitsResidual
+  return true;
+} // splitsResidual
+
 // ----------------------------------------------------------------------
 // Integrate constributions to residual term (r) for operator.
 void
@@ -193,7 +202,8 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
   const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  PetscInt numCells = 0;
+  const int* residualCells = _residualCells(&numCells);
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
@@ -233,7 +243,8 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
 #endif
 
   // Loop over cells
-  for(PetscInt c = 0; c < numCells; ++c) {
+  for(PetscInt iCell = 0; iCell < numCells; ++iCell) {
+    const PetscInt c = residualCells ? residualCells[iCell] : iCell;
     const PetscInt cell = cells[c];
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(restrictEvent);
@@ -27,6 +27,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/MatAssemblyMap.hh" // USES MatAssemblyMap
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
@@ -51,7 +52,8 @@
 // ----------------------------------------------------------------------
 // Constructor
 pylith::feassemble::ElasticityImplicit::ElasticityImplicit(void) :
-  _dtm1(-1.0)
+  _dtm1(-1.0),
+  _jacobianMap(0)
 { // constructor
 } // constructor
 
@@ -71,6 +73,8 @@ pylith::feassemble::ElasticityImplicit::deallocate(void)
 
   IntegratorElasticity::deallocate();
 
+  delete _jacobianMap; _jacobianMap = 0;
+
   PYLITH_METHOD_END;
 } // deallocate
   
@@ -356,9 +360,14 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 
   _material->createPropsAndVarsVisitors();
 
-  // Get sparse matrix
+  // Get sparse matrix and map from cell matrices to matrix storage.
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+  if (!_jacobianMap) {
+    _jacobianMap = new topology::MatAssemblyMap;assert(_jacobianMap);
+  } // if
+  if (!_jacobianMap->isCurrent(jacobianMat)) {
+    _jacobianMap->setup(jacobianMat, fields->get("disp(t)"), cells, numCells);
+  } // if
 
   // Get parameters used in integration.
   const PylithScalar dt = _dt;
@@ -366,6 +375,7 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
+  _jacobianMap->beginAssembly();
 
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
@@ -437,9 +447,9 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
     } // if
 
     // Assemble cell contribution into PETSc matrix.
-    //   Notice that we are using the default sections
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    _jacobianMap->addClosure(&_cellMatrix[0], _cellMatrix.size(), c);
   } // for
+  _jacobianMap->endAssembly();
   _material->destroyPropsAndVarsVisitors();
 
   _needNewJacobian = false;
@@ -131,6 +131,9 @@ private :
 
   PylithScalar _dtm1; ///< Time step for t-dt1 -> t
 
+  /// Precomputed map for adding cell matrices to Jacobian.
+  topology::MatAssemblyMap* _jacobianMap;
+
 }; // ElasticityImplicit
 
 #endif // pylith_feassemble_elasticityimplicit_hh
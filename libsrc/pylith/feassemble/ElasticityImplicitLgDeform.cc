@@ -27,6 +27,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/MatAssemblyMap.hh" // USES MatAssemblyMap
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
@@ -51,7 +52,8 @@
 // ----------------------------------------------------------------------
 // Constructor
 pylith::feassemble::ElasticityImplicitLgDeform::ElasticityImplicitLgDeform(void) :
-  _dtm1(-1.0)
+  _dtm1(-1.0),
+  _jacobianMap(0)
 { // constructor
 } // constructor
 
@@ -71,6 +73,8 @@ pylith::feassemble::ElasticityImplicitLgDeform::deallocate(void)
 
   IntegratorElasticityLgDeform::deallocate();
 
+  delete _jacobianMap; _jacobianMap = 0;
+
   PYLITH_METHOD_END;
 } // deallocate
   
@@ -214,7 +218,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
     const scalar_array& quadPtsNondim = _quadrature->quadPts();
 
@@ -254,11 +257,10 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
     } // for
 
     // Compute B(transpose) * sigma, first computing deformation tensor and strains
-    _calcDeformation(&deformCell, basisDeriv, &dispTpdtCell[0], numBasis, numQuadPts, spaceDim);
-    calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
+    _calcKinematics(&deformCell, &strainCell, c, dispTpdtCell, calcTotalStrainFn);
     const scalar_array& stressCell = _material->calcStress(strainCell, true);
 
-    CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, dispTpdtCell);
+    CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, deformCell);
 
     // Assemble cell contribution into field
     residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
@@ -352,9 +354,14 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
-  // Get sparse matrix
+  // Get sparse matrix and map from cell matrices to matrix storage.
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+  if (!_jacobianMap) {
+    _jacobianMap = new topology::MatAssemblyMap;assert(_jacobianMap);
+  } // if
+  if (!_jacobianMap->isCurrent(jacobianMat)) {
+    _jacobianMap->setup(jacobianMat, fields->get("disp(t)"), cells, numCells);
+  } // if
 
   _material->createPropsAndVarsVisitors();
 
@@ -364,6 +371,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
 
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
+  _jacobianMap->beginAssembly();
 
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
@@ -383,9 +391,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
     dispVisitor.getClosure(&dispCell, cell);
     dispIncrVisitor.getClosure(&dispIncrCell, cell);
 
-    // Get cell geometry information that depends on cell
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
-
     // Compute current estimate of displacement at time t+dt using
     // solution increment.
     for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
@@ -393,8 +398,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
     } // for
       
     // Compute deformation tensor, strains, and stresses
-    _calcDeformation(&deformCell, basisDeriv, &dispTpdtCell[0], numBasis, numQuadPts, spaceDim);
-    calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
+    _calcKinematics(&deformCell, &strainCell, c, dispTpdtCell, calcTotalStrainFn);
 
     // Get "elasticity" matrix at quadrature points for this cell
     const scalar_array& elasticConsts = _material->calcDerivElastic(strainCell);
@@ -402,7 +406,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
     // Get Second Priola-Kirchoff stress tensor
     const scalar_array& stressCell = _material->calcStress(strainCell, true);
 
-    CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts, stressCell, dispTpdtCell);
+    CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts, stressCell, deformCell);
 
     if (_quadrature->checkConditioning()) {
       int n = numBasis*spaceDim;
@@ -440,8 +444,9 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
     } // if
 
     // Assemble cell contribution into PETSc matrix.
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    _jacobianMap->addClosure(&_cellMatrix[0], _cellMatrix.size(), c);
   } // for
+  _jacobianMap->endAssembly();
   _material->destroyPropsAndVarsVisitors();
 
   _needNewJacobian = false;
@@ -132,6 +132,9 @@ private :
 
   PylithScalar _dtm1; ///< Time step for t-dt1 -> t
 
+  /// Precomputed map for adding cell matrices to Jacobian.
+  topology::MatAssemblyMap* _jacobianMap;
+
 }; // ElasticityImplicitLgDeform
 
 #endif // pylith_feassemble_elasticityimplicitlgdeform_hh
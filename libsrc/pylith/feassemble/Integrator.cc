@@ -40,7 +40,8 @@ pylith::feassemble::Integrator::Integrator(void) :
   _gravityField(0),
   _logger(0),
   _needNewJacobian(true),
-  _isJacobianSymmetric(true)
+  _isJacobianSymmetric(true),
+  _cellSubset(ALL_CELLS)
 { // constructor
 } // constructor
 
@@ -50,6 +50,16 @@ class pylith::feassemble::Integrator
 { // Integrator
   friend class TestIntegrator; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /// Subset of cells used when integrating the residual.
+  enum CellSubsetEnum {
+    ALL_CELLS=0, ///< All cells.
+    BOUNDARY_CELLS=1, ///< Cells with points shared with other processes.
+    INTERIOR_CELLS=2 ///< Cells with no points shared with other processes.
+  }; // CellSubsetEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -121,6 +131,22 @@ public :
   virtual
   bool isJacobianSymmetric(void) const;
 
+  /** Check whether integrator restricts integration of the residual
+   * to the current subset of cells. Integrators that do not split
+   * their cells ignore the subset and integrate all cells.
+   *
+   * @returns True if integrator splits cells into boundary and
+   * interior subsets, false otherwise.
+   */
+  virtual
+  bool splitsResidual(void) const;
+
+  /** Set subset of cells used when integrating the residual.
+   *
+   * @param value Subset of cells.
+   */
+  void cellSubset(const CellSubsetEnum value);
+
   /** Initialize integrator.
    *
    * @param mesh Finite-element mesh.
@@ -285,6 +311,9 @@ protected :
   /// Default is false;
   bool _isJacobianSymmetric;
 
+  /// Subset of cells used when integrating the residual.
+  CellSubsetEnum _cellSubset;
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
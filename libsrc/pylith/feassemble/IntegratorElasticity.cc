@@ -49,7 +49,9 @@
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
-    _outputFields(0)
+    _outputFields(0),
+    _cacheStrainStress(false),
+    _strainStressCached(false)
 { // constructor
 } // constructor
 
@@ -71,7 +73,12 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
 
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
+    _boundaryCells.resize(0);
+    _interiorCells.resize(0);
     delete _outputFields; _outputFields = 0;
+    _strainCache.resize(0);
+    _stressCache.resize(0);
+    _strainStressCached = false;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -87,6 +94,19 @@ pylith::feassemble::IntegratorElasticity::material(materials::ElasticMaterial* m
     } // if
 } // material
 
+// ----------------------------------------------------------------------
+// Set flag for caching strain and stress when updating state variables.
+void
+pylith::feassemble::IntegratorElasticity::cacheStrainStress(const bool value)
+{ // cacheStrainStress
+    _cacheStrainStress = value;
+    if (!_cacheStrainStress) {
+        _strainCache.resize(0);
+        _stressCache.resize(0);
+        _strainStressCached = false;
+    } // if
+} // cacheStrainStress
+
 // ----------------------------------------------------------------------
 // Determine whether we need to recompute the Jacobian.
 bool
@@ -118,6 +138,7 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
         const bool includeOnlyCells = true;
         delete _materialIS; _materialIS = new topology::StratumIS(dmMesh, "material-id", _material->id(), includeOnlyCells); assert(_materialIS);
     } // if
+    _setupCellPartition(dmMesh);
 
     // Compute geometry for quadrature operations.
     _quadrature->initializeGeometry();
@@ -125,6 +146,8 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     // Optimize coordinate retrieval in closure
     topology::CoordsVisitor::optimizeClosure(dmMesh);
 
+    _strainStressCached = false;
+
     // Initialize material.
     _material->initialize(mesh, _quadrature);
     _isJacobianSymmetric = _material->isJacobianSymmetric();
@@ -144,6 +167,105 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     PYLITH_METHOD_END;
 } // initialize
 
+// ----------------------------------------------------------------------
+// Partition cells of material into boundary and interior cells.
+void
+pylith::feassemble::IntegratorElasticity::_setupCellPartition(PetscDM dmMesh)
+{ // _setupCellPartition
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+    assert(_materialIS);
+
+    PetscErrorCode err = 0;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd); PYLITH_CHECK_ERROR(err);
+
+    // Mark points that are shared with other processes: ghost points
+    // (leaves of the point SF) and local points that are ghosts on
+    // other processes (roots with nonzero degree).
+    int_array isShared(0, pEnd-pStart);
+    PetscSF sf = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dmMesh, &sf); PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &leaves, NULL); PYLITH_CHECK_ERROR(err);
+    if (numRoots >= 0) {
+        for (PetscInt i = 0; i < numLeaves; ++i) {
+            const PetscInt point = leaves ? leaves[i] : i;
+            isShared[point-pStart] = 1;
+        } // for
+        const PetscInt* degree = NULL;
+        err = PetscSFComputeDegreeBegin(sf, &degree); PYLITH_CHECK_ERROR(err);
+        err = PetscSFComputeDegreeEnd(sf, &degree); PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < std::min(pEnd, numRoots); ++point) {
+            if (degree[point] > 0) {
+                isShared[point-pStart] = 1;
+            } // if
+        } // for
+    } // if
+
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    int_array isBoundary(0, numCells);
+    int numBoundaryCells = 0;
+    for (PetscInt c = 0; c < numCells; ++c) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmMesh, cells[c], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < closureSize; ++i) {
+            if (isShared[closure[2*i]-pStart]) {
+                isBoundary[c] = 1;
+                ++numBoundaryCells;
+                break;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, cells[c], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+    } // for
+
+    _boundaryCells.resize(numBoundaryCells);
+    _interiorCells.resize(numCells-numBoundaryCells);
+    for (PetscInt c = 0, iB = 0, iI = 0; c < numCells; ++c) {
+        if (isBoundary[c]) {
+            _boundaryCells[iB++] = c;
+        } else {
+            _interiorCells[iI++] = c;
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setupCellPartition
+
+// ----------------------------------------------------------------------
+// Get cells in current subset used when integrating the residual.
+const int*
+pylith::feassemble::IntegratorElasticity::_residualCells(PetscInt* numCells)
+{ // _residualCells
+    assert(numCells);
+    assert(_materialIS);
+
+    int_array* subset = 0;
+    switch (_cellSubset) {
+    case ALL_CELLS:
+        *numCells = _materialIS->size();
+        return 0;
+    case BOUNDARY_CELLS:
+        subset = &_boundaryCells;
+        break;
+    case INTERIOR_CELLS:
+        subset = &_interiorCells;
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown subset of cells in IntegratorElasticity::_residualCells().");
+    } // switch
+    assert(subset);
+    assert(_boundaryCells.size() + _interiorCells.size() == size_t(_materialIS->size()));
+
+    *numCells = subset->size();
+    return (*numCells > 0) ? &(*subset)[0] : 0;
+} // _residualCells
+
 // ----------------------------------------------------------------------
 // Update state variables as needed.
 void
@@ -156,8 +278,10 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     assert(_material);
     assert(fields);
 
-    // No need to update state vars if material doesn't have any.
-    if (!_material->hasStateVars())
+    // No need to update state vars if material doesn't have any and
+    // we are not caching strain and stress for output.
+    const bool hasStateVars = _material->hasStateVars();
+    if (!hasStateVars && !_cacheStrainStress)
         PYLITH_METHOD_END;
 
     // Get cell information that doesn't depend on particular cell
@@ -197,6 +321,7 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     topology::CoordsVisitor coordsVisitor(dmMesh);
 
     _material->createPropsAndVarsVisitors();
+    _initStrainStressCache();
 
     // Loop over cells
     for(PetscInt c = 0; c < numCells; ++c) {
@@ -217,9 +342,15 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
         calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
 
         // Update material state
-        _material->updateStateVars(strainCell, cell);
+        if (hasStateVars) {
+            _material->updateStateVars(strainCell, cell);
+        } // if
+        if (_cacheStrainStress) {
+            _storeStrainStress(c, strainCell);
+        } // if
     } // for
     _material->destroyPropsAndVarsVisitors();
+    _strainStressCached = _cacheStrainStress;
 
     PYLITH_METHOD_END;
 } // updateStateVars
@@ -329,7 +460,11 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
             buffer.label("total_strain");
             buffer.scale(1.0);
             buffer.dimensionalizeOkay(true);
-            _calcStrainStressField(&buffer, namelower.c_str(), fields);
+            if (_strainStressCached) {
+                _copyStrainStressCache(&buffer, _strainCache);
+            } else {
+                _calcStrainStressField(&buffer, namelower.c_str(), fields);
+            } // if/else
             PYLITH_METHOD_RETURN(buffer);
 
         } // if/else
@@ -352,7 +487,11 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
             buffer.label(namelower.c_str());
             buffer.scale(_normalizer->pressureScale());
             buffer.dimensionalizeOkay(true);
-            _calcStrainStressField(&buffer, namelower.c_str(), fields);
+            if (_strainStressCached && std::string("stress") == namelower) {
+                _copyStrainStressCache(&buffer, _stressCache);
+            } else {
+                _calcStrainStressField(&buffer, namelower.c_str(), fields);
+            } // if/else
             PYLITH_METHOD_RETURN(buffer);
 
         } // else
@@ -556,6 +695,90 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     PYLITH_METHOD_END;
 } // _calcStrainStressField
 
+// ----------------------------------------------------------------------
+// Prepare cache for strain and stress.
+void
+pylith::feassemble::IntegratorElasticity::_initStrainStressCache(void)
+{ // _initStrainStressCache
+    PYLITH_METHOD_BEGIN;
+
+    _strainStressCached = false;
+    if (!_cacheStrainStress) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_quadrature);
+    assert(_material);
+    assert(_materialIS);
+
+    const size_t cacheSize = _materialIS->size() * _quadrature->numQuadPts() * _material->tensorSize();
+    if (_strainCache.size() != cacheSize) {
+        _strainCache.resize(cacheSize);
+        _stressCache.resize(cacheSize);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initStrainStressCache
+
+// ----------------------------------------------------------------------
+// Store strain and stress for a cell in the cache.
+void
+pylith::feassemble::IntegratorElasticity::_storeStrainStress(const PetscInt index,
+                                                             const scalar_array& strain)
+{ // _storeStrainStress
+    PYLITH_METHOD_BEGIN;
+
+    assert(_material);
+
+    const size_t tensorCellSize = strain.size();
+    const size_t off = index*tensorCellSize;
+    assert(off+tensorCellSize <= _strainCache.size());
+    assert(off+tensorCellSize <= _stressCache.size());
+
+    // Material state for the cell is already current, so there is no
+    // need to compute the state variables again.
+    const scalar_array& stress = _material->calcStress(strain);
+    assert(stress.size() == tensorCellSize);
+    for (size_t i=0; i < tensorCellSize; ++i) {
+        _strainCache[off+i] = strain[i];
+        _stressCache[off+i] = stress[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // _storeStrainStress
+
+// ----------------------------------------------------------------------
+// Copy cached strain or stress into field.
+void
+pylith::feassemble::IntegratorElasticity::_copyStrainStressCache(topology::Field* field,
+                                                                 const scalar_array& cache)
+{ // _copyStrainStressCache
+    PYLITH_METHOD_BEGIN;
+
+    assert(field);
+    assert(_quadrature);
+    assert(_material);
+    assert(_materialIS);
+
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    const int tensorCellSize = _quadrature->numQuadPts() * _material->tensorSize();
+    assert(size_t(numCells*tensorCellSize) == cache.size());
+
+    topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+
+    for(PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+        assert(tensorCellSize == fieldVisitor.sectionDof(cells[c]));
+        for (int i=0; i < tensorCellSize; ++i) {
+            fieldArray[off+i] = cache[c*tensorCellSize+i];
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _copyStrainStressCache
+
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 2-D cells.
 void
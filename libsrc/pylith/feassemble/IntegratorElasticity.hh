@@ -75,6 +75,18 @@ public :
    */
   void material(materials::ElasticMaterial* m);
 
+  /** Set flag for caching strain and stress when updating state
+   * variables.
+   *
+   * When enabled, updateStateVars() stores the total strain and
+   * stress at the quadrature points and cellField() returns the
+   * cached values instead of recomputing them. This is worthwhile
+   * when strain or stress is written every time step.
+   *
+   * @param value True if strain and stress should be cached, false otherwise.
+   */
+  void cacheStrainStress(const bool value);
+
   /** Determine whether we need to recompute the Jacobian.
    *
    * @returns True if Jacobian needs to be recomputed, false otherwise.
@@ -128,6 +140,22 @@ protected :
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Partition cells of material into cells with points shared with
+   * other processes (boundary cells) and the remaining (interior)
+   * cells.
+   *
+   * @param dmMesh PETSc DM for finite-element mesh.
+   */
+  void _setupCellPartition(PetscDM dmMesh);
+
+  /** Get cells in current subset used when integrating the residual.
+   *
+   * @param numCells Number of cells in subset.
+   * @returns Indices of cells in index set for material, or NULL if
+   * the subset contains all cells in index set order.
+   */
+  const int* _residualCells(PetscInt* numCells);
+
   /** Allocate buffer for tensor field at quadrature points.
    *
    * @param mesh Finite-element mesh.
@@ -145,6 +173,29 @@ protected :
 			      const char* name,
 			      topology::SolutionFields* const fields);
 
+  /** Prepare cache for strain and stress at the beginning of
+   * updateStateVars().
+   */
+  void _initStrainStressCache(void);
+
+  /** Store strain and stress for a cell in the cache. Physical
+   * properties and state variables for the cell must already have
+   * been retrieved.
+   *
+   * @param index Index of cell in material index set.
+   * @param strain Strain tensor for cell at quadrature points.
+   */
+  void _storeStrainStress(const PetscInt index,
+			  const scalar_array& strain);
+
+  /** Copy cached strain or stress into field.
+   *
+   * @param field Field in which to store stress or strain.
+   * @param cache Cached strain or stress.
+   */
+  void _copyStrainStressCache(topology::Field* field,
+			      const scalar_array& cache);
+
   /** Integrate elasticity term in residual for 2-D cells.
    *
    * @param stress Stress tensor for cell at quadrature points.
@@ -214,9 +265,16 @@ protected :
   materials::ElasticMaterial* _material; ///< Material associated with integrator.
 
   topology::StratumIS* _materialIS; ///< Index set for material cells.
+  int_array _boundaryCells; ///< Indices in _materialIS of cells with points shared with other processes.
+  int_array _interiorCells; ///< Indices in _materialIS of cells without points shared with other processes.
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
+  scalar_array _strainCache; ///< Strain at quadrature points from updateStateVars().
+  scalar_array _stressCache; ///< Stress at quadrature points from updateStateVars().
+  bool _cacheStrainStress; ///< Cache strain and stress for output.
+  bool _strainStressCached; ///< True if cache holds current strain and stress.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -51,8 +51,26 @@ pylith::feassemble::IntegratorElasticityLgDeform::IntegratorElasticityLgDeform(v
 // Destructor
 pylith::feassemble::IntegratorElasticityLgDeform::~IntegratorElasticityLgDeform(void)
 { // destructor
+  deallocate();
 } // destructor
-  
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  IntegratorElasticity::deallocate();
+
+  _kinematicsDisp.resize(0);
+  _kinematicsDeform.resize(0);
+  _kinematicsStrain.resize(0);
+  _kinematicsCurrent.resize(0);
+
+  PYLITH_METHOD_END;
+} // deallocate
+
 // ----------------------------------------------------------------------
 // Determine whether we need to recompute the Jacobian.
 bool
@@ -76,8 +94,10 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
   assert(_material);
   assert(fields);
 
-  // No need to update state vars if material doesn't have any.
-  if (!_material->hasStateVars())
+  // No need to update state vars if material doesn't have any and
+  // we are not caching strain and stress for output.
+  const bool hasStateVars = _material->hasStateVars();
+  if (!hasStateVars && !_cacheStrainStress)
     PYLITH_METHOD_END;
 
   // Get cell information that doesn't depend on particular cell
@@ -118,6 +138,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
   _material->createPropsAndVarsVisitors();
+  _initStrainStressCache();
 
   // Loop over cells
   for (PetscInt c = 0; c < numCells; ++c) {
@@ -126,23 +147,25 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
     // Retrieve geometry information for current cell
     coordsVisitor.getClosure(&coordsCell, cell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     // Get physical properties and state variables for cell.
     _material->retrievePropsAndVars(cell);
 
     dispVisitor.getClosure(&dispCell, cell);
   
-    // Compute deformation tensor.
-    _calcDeformation(&deformCell, basisDeriv, &dispCell[0], numBasis, numQuadPts, spaceDim);
-
-    // Compute strains
-    calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
+    // Compute deformation tensor and strains.
+    _calcKinematics(&deformCell, &strainCell, c, dispCell, calcTotalStrainFn);
 
     // Update material state
-    _material->updateStateVars(strainCell, cell);
+    if (hasStateVars) {
+      _material->updateStateVars(strainCell, cell);
+    } // if
+    if (_cacheStrainStress) {
+      _storeStrainStress(c, strainCell);
+    } // if
   } // for
   _material->destroyPropsAndVarsVisitors();
+  _strainStressCached = _cacheStrainStress;
 
   PYLITH_METHOD_END;
 } // updateStateVars
@@ -217,16 +240,12 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
     // Retrieve geometry information for current cell
     coordsVisitor.getClosure(&coordsCell, cell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     // Restrict input fields to cell
     dispVisitor.getClosure(&dispCell, cell);
 
-    // Compute deformation tensor.
-    _calcDeformation(&deformCell, basisDeriv, &dispCell[0], numBasis, numQuadPts, spaceDim);
-
-    // Compute strains
-    calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
+    // Compute deformation tensor and strains.
+    _calcKinematics(&deformCell, &strainCell, c, dispCell, calcTotalStrainFn);
 
     const PetscInt off = fieldVisitor.sectionOffset(cell);
     assert(tensorCellSize == fieldVisitor.sectionDof(cell));
@@ -263,7 +282,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
 // Integrate elasticity term in residual for 2-D cells.
 void
 pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const scalar_array& stress,
-									const scalar_array& disp)
+									const scalar_array& deform)
 { // _elasticityResidual2D
   const int numQuadPts = _quadrature->numQuadPts();
   const int numBasis = _quadrature->numBasis();
@@ -276,10 +295,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const sc
   assert(2 == cellDim);
   assert(quadWts.size() == size_t(numQuadPts));
   const int stressSize = 3;
-
-  // Compute deformation gradient tensor.
-  scalar_array deform(numQuadPts*spaceDim*spaceDim);
-  _calcDeformation(&deform, basisDeriv, &disp[0], numBasis, numQuadPts, spaceDim);
+  assert(deform.size() == size_t(numQuadPts*spaceDim*spaceDim));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
     const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
@@ -313,7 +329,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const sc
 // Integrate elasticity term in residual for 3-D cells.
 void
 pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const scalar_array& stress,
-									const scalar_array& disp)
+									const scalar_array& deform)
 { // _elasticityResidual3D
   const int numQuadPts = _quadrature->numQuadPts();
   const int numBasis = _quadrature->numBasis();
@@ -326,10 +342,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const sc
   assert(3 == cellDim);
   assert(quadWts.size() == size_t(numQuadPts));
   const int stressSize = 6;
-  
-  // Compute deformation gradient tensor.
-  scalar_array deform(numQuadPts*spaceDim*spaceDim);
-  _calcDeformation(&deform, basisDeriv, &disp[0], numBasis, numQuadPts, spaceDim);
+  assert(deform.size() == size_t(numQuadPts*spaceDim*spaceDim));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
     const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
@@ -376,7 +389,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const sc
 void
 pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const scalar_array& elasticConsts,
 									const scalar_array& stress,
-									const scalar_array& disp)
+									const scalar_array& deform)
 { // _elasticityJacobian2D
   const int numQuadPts = _quadrature->numQuadPts();
   const int numBasis = _quadrature->numBasis();
@@ -392,7 +405,6 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const sc
   const int numConsts = 9;
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-    const int iQ = iQuad*numBasis*spaceDim;
     const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
     // tau_ij = C_ijkl * e_kl
     //        = C_ijlk * 0.5 (u_k,l + u_l,k)
@@ -414,17 +426,12 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const sc
     const PylithScalar s22 = stress[iS+1];
     const PylithScalar s12 = stress[iS+2];
 
-    PylithScalar l11 = 0.0;
-    PylithScalar l12 = 0.0;
-    PylithScalar l21 = 0.0;
-    PylithScalar l22 = 0.0;
-    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
-      const int iB = iBasis*spaceDim;
-      l11 += basisDeriv[iQ+iB  ] * disp[iB  ];
-      l12 += basisDeriv[iQ+iB+1] * disp[iB  ];
-      l21 += basisDeriv[iQ+iB  ] * disp[iB+1];
-      l22 += basisDeriv[iQ+iB+1] * disp[iB+1];
-    } // for
+    // Displacement gradient, l_ij = X_ij - delta_ij
+    const int iD = iQuad*spaceDim*spaceDim;
+    const PylithScalar l11 = deform[iD  ] - 1.0;
+    const PylithScalar l12 = deform[iD+1];
+    const PylithScalar l21 = deform[iD+2];
+    const PylithScalar l22 = deform[iD+3] - 1.0;
 
     for (int iBasis=0, iQ=iQuad*numBasis*spaceDim; iBasis < numBasis; ++iBasis) {
       const int iB = iBasis*spaceDim;
@@ -502,7 +509,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const sc
 void
 pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const scalar_array& elasticConsts,
 									const scalar_array& stress,
-									const scalar_array& disp)
+									const scalar_array& deform)
 { // _elasticityJacobian3D
   const int numQuadPts = _quadrature->numQuadPts();
   const int numBasis = _quadrature->numBasis();
@@ -520,7 +527,6 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const sc
 
   // Compute Jacobian for consistent tangent matrix
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-    const int iQ = iQuad*numBasis*spaceDim;
     const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
     // tau_ij = C_ijkl * e_kl
     //        = C_ijlk * 0.5 (u_k,l + u_l,k)
@@ -572,27 +578,17 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const sc
     const PylithScalar s23 = stress[iS+4];
     const PylithScalar s13 = stress[iS+5];
 
-    PylithScalar l11 = 0.0;
-    PylithScalar l12 = 0.0;
-    PylithScalar l13 = 0.0;
-    PylithScalar l21 = 0.0;
-    PylithScalar l22 = 0.0;
-    PylithScalar l23 = 0.0;
-    PylithScalar l31 = 0.0;
-    PylithScalar l32 = 0.0;
-    PylithScalar l33 = 0.0;
-    for (int kBasis=0; kBasis < numBasis; ++kBasis) {
-      const int kB = kBasis*spaceDim;
-      l11 += basisDeriv[iQ+kB  ] * disp[kB  ];
-      l12 += basisDeriv[iQ+kB+1] * disp[kB  ];
-      l13 += basisDeriv[iQ+kB+2] * disp[kB  ];
-      l21 += basisDeriv[iQ+kB  ] * disp[kB+1];
-      l22 += basisDeriv[iQ+kB+1] * disp[kB+1];
-      l23 += basisDeriv[iQ+kB+2] * disp[kB+1];
-      l31 += basisDeriv[iQ+kB  ] * disp[kB+2];
-      l32 += basisDeriv[iQ+kB+1] * disp[kB+2];
-      l33 += basisDeriv[iQ+kB+2] * disp[kB+2];
-    } // for
+    // Displacement gradient, l_ij = X_ij - delta_ij
+    const int iD = iQuad*spaceDim*spaceDim;
+    const PylithScalar l11 = deform[iD  ] - 1.0;
+    const PylithScalar l12 = deform[iD+1];
+    const PylithScalar l13 = deform[iD+2];
+    const PylithScalar l21 = deform[iD+3];
+    const PylithScalar l22 = deform[iD+4] - 1.0;
+    const PylithScalar l23 = deform[iD+5];
+    const PylithScalar l31 = deform[iD+6];
+    const PylithScalar l32 = deform[iD+7];
+    const PylithScalar l33 = deform[iD+8] - 1.0;
     
     for (int iBasis=0, iQ=iQuad*numBasis*spaceDim;
 	 iBasis < numBasis;
@@ -1127,6 +1123,75 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcDeformation(scalar_array*
 } // _calcDeformation
 
 
+// ----------------------------------------------------------------------
+// Get deformation gradient tensor and Green-Lagrange strain tensor.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::_calcKinematics(scalar_array* deform,
+								  scalar_array* strain,
+								  const PetscInt index,
+								  const scalar_array& disp,
+								  totalStrain_fn_type calcTotalStrainFn)
+{ // _calcKinematics
+  assert(deform);
+  assert(strain);
+  assert(_quadrature);
+  assert(_materialIS);
+
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const size_t dispSize = disp.size();
+  const size_t deformSize = deform->size();
+  const size_t strainSize = strain->size();
+  assert(dispSize == size_t(numBasis*spaceDim));
+  assert(deformSize == size_t(numQuadPts*spaceDim*spaceDim));
+
+  const size_t numCells = _materialIS->size();
+  assert(index >= 0 && size_t(index) < numCells);
+  if (_kinematicsCurrent.size() != numCells || _kinematicsDisp.size() != numCells*dispSize ||
+      _kinematicsDeform.size() != numCells*deformSize || _kinematicsStrain.size() != numCells*strainSize) {
+    _kinematicsDisp.resize(numCells*dispSize);
+    _kinematicsDeform.resize(numCells*deformSize);
+    _kinematicsStrain.resize(numCells*strainSize);
+    _kinematicsCurrent.resize(numCells);
+    _kinematicsCurrent = 0;
+  } // if
+
+  const size_t dispOff = index*dispSize;
+  const size_t deformOff = index*deformSize;
+  const size_t strainOff = index*strainSize;
+
+  // Use cached values if displacements match those used to compute them.
+  bool isCurrent = _kinematicsCurrent[index];
+  for (size_t i=0; isCurrent && i < dispSize; ++i) {
+    isCurrent = disp[i] == _kinematicsDisp[dispOff+i];
+  } // for
+  if (isCurrent) {
+    for (size_t i=0; i < deformSize; ++i) {
+      (*deform)[i] = _kinematicsDeform[deformOff+i];
+    } // for
+    for (size_t i=0; i < strainSize; ++i) {
+      (*strain)[i] = _kinematicsStrain[strainOff+i];
+    } // for
+    return;
+  } // if
+
+  const scalar_array& basisDeriv = _quadrature->basisDeriv();
+  _calcDeformation(deform, basisDeriv, &disp[0], numBasis, numQuadPts, spaceDim);
+  calcTotalStrainFn(strain, *deform, numQuadPts);
+
+  for (size_t i=0; i < dispSize; ++i) {
+    _kinematicsDisp[dispOff+i] = disp[i];
+  } // for
+  for (size_t i=0; i < deformSize; ++i) {
+    _kinematicsDeform[deformOff+i] = (*deform)[i];
+  } // for
+  for (size_t i=0; i < strainSize; ++i) {
+    _kinematicsStrain[strainOff+i] = (*strain)[i];
+  } // for
+  _kinematicsCurrent[index] = 1;
+} // _calcKinematics
+
 // ----------------------------------------------------------------------
 // Calculate 2-D Cauchy stress from 2nd Piola-Kirchoff stress.
 void
@@ -38,6 +38,8 @@
 class pylith::feassemble::IntegratorElasticityLgDeform : public IntegratorElasticity
 { // IntegratorElasticityLgDeform
   friend class TestIntegratorElasticityLgDeform; // unit testing
+  friend class TestElasticityImplicitLgDeform; // unit testing
+  friend class TestElasticityExplicitLgDeform; // unit testing
 
 // PUBLIC TYPEDEFS //////////////////////////////////////////////////////
 public :
@@ -57,6 +59,10 @@ public :
   virtual
   ~IntegratorElasticityLgDeform(void);
 
+  /// Deallocate PETSc and local data structures.
+  virtual
+  void deallocate(void);
+
   /** Determine whether we need to recompute the Jacobian.
    *
    * @returns True if Jacobian needs to be recomputed, false otherwise.
@@ -88,38 +94,59 @@ protected :
   /** Integrate elasticity term in residual for 2-D cells.
    *
    * @param stress Stress tensor for cell at quadrature points.
-   * @param disp Displacement field at cell's DOF.
+   * @param deform Deformation gradient tensor for cell at quadrature points.
    */
   void _elasticityResidual2D(const scalar_array& stress,
-			     const scalar_array& disp);
+			     const scalar_array& deform);
 
   /** Integrate elasticity term in residual for 3-D cells.
    *
    * @param stress Stress tensor for cell at quadrature points.
-   * @param disp Displacement field at cell's DOF.
+   * @param deform Deformation gradient tensor for cell at quadrature points.
    */
   void _elasticityResidual3D(const scalar_array& stress,
-			     const scalar_array& disp);
+			     const scalar_array& deform);
 
   /** Integrate elasticity term in Jacobian for 2-D cells.
    *
    * @param elasticConsts Matrix of elasticity constants at quadrature points.
    * @param stress Stress tensor for cell at quadrature points.
-   * @param disp Displacement field at cell's DOF.
+   * @param deform Deformation gradient tensor for cell at quadrature points.
    */
   void _elasticityJacobian2D(const scalar_array& elasticConsts,
 			     const scalar_array& stress,
-			     const scalar_array& disp);
+			     const scalar_array& deform);
 
   /** Integrate elasticity term in Jacobian for 3-D cells.
    *
    * @param elasticConsts Matrix of elasticity constants at quadrature points.
    * @param stress Stress tensor for cell at quadrature points.
-   * @param disp Displacement field at cell's DOF.
+   * @param deform Deformation gradient tensor for cell at quadrature points.
    */
   void _elasticityJacobian3D(const scalar_array& elasticConsts,
 			     const scalar_array& stress,
-			     const scalar_array& disp);
+			     const scalar_array& deform);
+
+  /** Get deformation gradient tensor and Green-Lagrange strain tensor
+   * at quadrature points of a cell.
+   *
+   * The values are cached for each cell together with the
+   * displacements used to compute them, so passes over the same
+   * solution (residual, Jacobian, state variable update, and output)
+   * compute the kinematics only once. Cell geometry must already have
+   * been computed for the cell.
+   *
+   * @param[out] deform Deformation tensor for cell at quadrature points.
+   * @param[out] strain Green-Lagrange strain tensor for cell at quadrature points.
+   * @param[in] index Index of cell in material index set.
+   * @param[in] disp Displacements of DOF of cell.
+   * @param[in] calcTotalStrainFn Function for computing strain from deformation.
+   */
+  void _calcKinematics(scalar_array* deform,
+		       scalar_array* strain,
+		       const PetscInt index,
+		       const scalar_array& disp,
+		       totalStrain_fn_type calcTotalStrainFn);
 
   /** Calculate Green-Lagrange strain tensor at quadrature points of a
    *  1-D cell.
@@ -200,6 +227,14 @@ protected :
 			   const scalar_array& deform,
 			   const int numQuadPts);
 
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  scalar_array _kinematicsDisp; ///< Cell displacements for cached kinematics.
+  scalar_array _kinematicsDeform; ///< Cached deformation gradient tensors.
+  scalar_array _kinematicsStrain; ///< Cached Green-Lagrange strain tensors.
+  int_array _kinematicsCurrent; ///< Flags indicating cells with cached kinematics.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -28,6 +28,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 #include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
@@ -50,6 +51,7 @@ pylith::friction::FrictionModel::FrictionModel(const materials::Metadata& metada
   _dbProperties(0),
   _dbInitialState(0),
   _fieldsPropsStateVars(0),
+  _batchSize(0),
   _propsFiberDim(0),
   _varsFiberDim(0)
 { // constructor
@@ -118,67 +120,78 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
   assert(_normalizer);
   const PylithScalar lengthScale = _normalizer->lengthScale();
 
-  scalar_array coordsVertexGlobal(spaceDim);
   topology::CoordsVisitor coordsVisitor(faultDMMesh);
-  PetscScalar* coordArray = coordsVisitor.localArray();
-
-  // Query database for properties
+  const PetscScalar* coordArray = coordsVisitor.localArray();
 
   // Create fields to hold physical properties and state variables.
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = new topology::Fields(faultMesh);assert(_fieldsPropsStateVars);
   _setupPropsStateVars();
 
+  // Gather coordinates of vertices for batch query.
+  const int numVertices = vEnd - vStart;
+  scalar_array coordsVertices(numVertices*spaceDim);
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt coff = coordsVisitor.sectionOffset(v);
+    assert(spaceDim == coordsVisitor.sectionDof(v));
+    for (PetscInt d = 0; d < spaceDim; ++d) {
+      coordsVertices[(v-vStart)*spaceDim+d] = coordArray[coff+d];
+    } // for
+  } // for
+  utils::BatchQuery query;
+  query.points(coordsVertices, spaceDim, lengthScale);
+
   // Create arrays for querying.
   const int numDBProperties = _metadata.numDBProperties();
   scalar_array propertiesDBQuery(numDBProperties);
   scalar_array propertiesVertex(_propsFiberDim);
+  scalar_array propertiesDBVertices;
 
-  // Setup database for querying for physical properties
+  // Query database for physical properties
   assert(_dbProperties);
   _dbProperties->open();
   _dbProperties->queryVals(_metadata.dbProperties(),
 			   _metadata.numDBProperties());
+  const int errPoint = query.query(&propertiesDBVertices, numDBProperties, _dbProperties, cs);
+  _dbProperties->close();
+  if (errPoint >= 0) {
+    const PylithScalar* xyz = query.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find parameters for physical properties at " << "(";
+    for (int i = 0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") in friction model '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const int numProperties = _metadata.numProperties();
+  std::vector<topology::VecVisitorMesh*> propertyVisitors(numProperties);
+  for (int i=0; i < numProperties; ++i) {
+    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
+    propertyVisitors[i] = new topology::VecVisitorMesh(_fieldsPropsStateVars->get(property.name.c_str()));
+  } // for
 
   for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt coff = coordsVisitor.sectionOffset(v);
-    assert(spaceDim == coordsVisitor.sectionDof(v));
-    for (PetscInt d = 0; d < spaceDim; ++d) {
-      coordsVertexGlobal[d] = coordArray[coff+d];
+    for (int i=0; i < numDBProperties; ++i) {
+      propertiesDBQuery[i] = propertiesDBVertices[(v-vStart)*numDBProperties+i];
     } // for
-    _normalizer->dimensionalize(&coordsVertexGlobal[0], coordsVertexGlobal.size(), lengthScale);
-
-    int err = _dbProperties->query(&propertiesDBQuery[0], 
-				   propertiesDBQuery.size(),
-				   &coordsVertexGlobal[0], spaceDim, cs);
-    if (err) {
-      std::ostringstream msg;
-      msg << "Could not find parameters for physical properties at " << "(";
-      for (int i = 0; i < spaceDim; ++i)
-        msg << "  " << coordsVertexGlobal[i];
-      msg << ") in friction model '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
-      throw std::runtime_error(msg.str());
-    } // if
     assert(propertiesVertex.size() == propertiesDBQuery.size());
     _dbToProperties(&propertiesVertex[0], propertiesDBQuery);
 
     _nondimProperties(&propertiesVertex[0], propertiesVertex.size());
     PetscInt iOff = 0;
 
-    for (int i=0; i < _metadata.numProperties(); ++i) {
-      const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-      // TODO This needs to be an integer instead of a string
-      topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-      topology::VecVisitorMesh propertyVisitor(propertyField);
-      PetscScalar* propertyArray = propertyVisitor.localArray();
-      const PetscInt off = propertyVisitor.sectionOffset(v);
-      const PetscInt dof = propertyVisitor.sectionDof(v);
+    for (int i=0; i < numProperties; ++i) {
+      PetscScalar* propertyArray = propertyVisitors[i]->localArray();
+      const PetscInt off = propertyVisitors[i]->sectionOffset(v);
+      const PetscInt dof = propertyVisitors[i]->sectionDof(v);
       for(PetscInt d = 0; d < dof; ++d, ++iOff) {
         propertyArray[off+d] += propertiesVertex[iOff];
       } // for
     } // for
   } // for
-  // Close properties database
-  _dbProperties->close();
+  for (int i=0; i < numProperties; ++i) {
+    delete propertyVisitors[i]; propertyVisitors[i] = 0;
+  } // for
 
   // Query database for initial state variables
   if (_dbInitialState) {
@@ -188,54 +201,72 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
     assert(_varsFiberDim > 0);
     scalar_array stateVarsDBQuery(numDBStateVars);
     scalar_array stateVarsVertex(_varsFiberDim);
-    
-    // Setup database for querying for initial state variables
-    _dbInitialState->open();
-    _dbInitialState->queryVals(_metadata.dbStateVars(), _metadata.numDBStateVars());
-    
+    scalar_array stateVarsDBVertices;
+
+    // Initial state is not set at clamped vertices.
     PetscDMLabel clamped = NULL;
     PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
+    int_array verticesState(numVertices);
+    int numVerticesState = 0;
     for(PetscInt v = vStart; v < vEnd; ++v) {
-      if (faults::FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
-	continue;
+      if (!faults::FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
+	verticesState[numVerticesState++] = v;
       } // if
-
-      const PetscInt coff = coordsVisitor.sectionOffset(v);
-      assert(spaceDim == coordsVisitor.sectionDof(v));
+    } // for
+    scalar_array coordsVerticesState(numVerticesState*spaceDim);
+    for (int iVertex=0; iVertex < numVerticesState; ++iVertex) {
+      const PetscInt v = verticesState[iVertex];
       for (PetscInt d = 0; d < spaceDim; ++d) {
-	coordsVertexGlobal[d] = coordArray[coff+d];
+	coordsVerticesState[iVertex*spaceDim+d] = coordsVertices[(v-vStart)*spaceDim+d];
+      } // for
+    } // for
+    utils::BatchQuery queryState;
+    queryState.points(coordsVerticesState, spaceDim, lengthScale);
+    
+    // Query database for initial state variables
+    _dbInitialState->open();
+    _dbInitialState->queryVals(_metadata.dbStateVars(), _metadata.numDBStateVars());
+    const int errPointState = queryState.query(&stateVarsDBVertices, numDBStateVars, _dbInitialState, cs);
+    _dbInitialState->close();
+    if (errPointState >= 0) {
+      const PylithScalar* xyz = queryState.point(errPointState);
+      std::ostringstream msg;
+      msg << "Could not find initial state variables at " << "(";
+      for (int i = 0; i < spaceDim; ++i)
+	msg << "  " << xyz[i];
+      msg << ") in friction model '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+
+    const int numStateVars = _metadata.numStateVars();
+    std::vector<topology::VecVisitorMesh*> stateVarVisitors(numStateVars);
+    for (int i=0; i < numStateVars; ++i) {
+      const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+      stateVarVisitors[i] = new topology::VecVisitorMesh(_fieldsPropsStateVars->get(stateVar.name.c_str()));
+    } // for
+
+    for (int iVertex=0; iVertex < numVerticesState; ++iVertex) {
+      const PetscInt v = verticesState[iVertex];
+      for (int i=0; i < numDBStateVars; ++i) {
+	stateVarsDBQuery[i] = stateVarsDBVertices[iVertex*numDBStateVars+i];
       } // for
-      _normalizer->dimensionalize(&coordsVertexGlobal[0], coordsVertexGlobal.size(), lengthScale);
-      
-      int err = _dbInitialState->query(&stateVarsDBQuery[0], numDBStateVars, &coordsVertexGlobal[0], spaceDim, cs);
-      if (err) {
-        std::ostringstream msg;
-        msg << "Could not find initial state variables at " << "(";
-        for (int i = 0; i < spaceDim; ++i)
-          msg << "  " << coordsVertexGlobal[i];
-        msg << ") in friction model '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
       _dbToStateVars(&stateVarsVertex[0], stateVarsDBQuery);
       _nondimStateVars(&stateVarsVertex[0], stateVarsVertex.size());
       PetscInt iOff = 0;
 
-      for (int i=0; i < _metadata.numStateVars(); ++i) {
-        const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-        // TODO This needs to be an integer instead of a string
-        topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-	topology::VecVisitorMesh stateVarVisitor(stateVarField);
-	PetscScalar* stateVarArray = stateVarVisitor.localArray();
-	const PetscInt off = stateVarVisitor.sectionOffset(v);
-	const PetscInt dof = stateVarVisitor.sectionDof(v);
+      for (int i=0; i < numStateVars; ++i) {
+	PetscScalar* stateVarArray = stateVarVisitors[i]->localArray();
+	const PetscInt off = stateVarVisitors[i]->sectionOffset(v);
+	const PetscInt dof = stateVarVisitors[i]->sectionDof(v);
         for(PetscInt d = 0; d < dof; ++d, ++iOff) {
           stateVarArray[off+d] += stateVarsVertex[iOff];
         } // for
       } // for
     } // for
-    // Close database
-    _dbInitialState->close();
+    for (int i=0; i < numStateVars; ++i) {
+      delete stateVarVisitors[i]; stateVarVisitors[i] = 0;
+    } // for
   } else if (_metadata.numDBStateVars()) {
     std::cerr << "WARNING: No initial state given for friction model '" << label() << "'. Using default value of zero." << std::endl;
   } // if/else
@@ -389,6 +420,108 @@ pylith::friction::FrictionModel::calcFrictionDeriv(const PylithScalar t,
   PYLITH_METHOD_RETURN(frictionDeriv);
 } // calcFrictionDeriv
 
+// ----------------------------------------------------------------------
+// Retrieve properties and state variables for a batch of points.
+void
+pylith::friction::FrictionModel::retrievePropsStateVarsBatch(const PylithInt* points,
+							     const int numPoints)
+{ // retrievePropsStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  assert(!numPoints || points);
+
+  _batchSize = numPoints;
+  _propsStateVarsBatch.resize((_propsFiberDim+_varsFiberDim)*numPoints);
+  if (!numPoints) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Create one visitor per field and loop over the points, rather
+  // than creating visitors at every point.
+  PetscInt iOff = 0;
+  const int numProperties = _metadata.numProperties();
+  const int numStateVars = _metadata.numStateVars();
+  for (int i=0; i < numProperties+numStateVars; ++i) {
+    const materials::Metadata::ParamDescription& value = (i < numProperties) ?
+      _metadata.getProperty(i) : _metadata.getStateVar(i-numProperties);
+    topology::Field& valueField = _fieldsPropsStateVars->get(value.name.c_str());
+    topology::VecVisitorMesh valueVisitor(valueField);
+    const PetscScalar* valueArray = valueVisitor.localArray();
+    for (int d=0; d < value.fiberDim; ++d, ++iOff) {
+      PylithScalar* valuesBatch = &_propsStateVarsBatch[iOff*numPoints];
+      for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+	const PetscInt off = valueVisitor.sectionOffset(points[iPoint]);
+	assert(value.fiberDim == valueVisitor.sectionDof(points[iPoint]));
+	valuesBatch[iPoint] = valueArray[off+d];
+      } // for
+    } // for
+  } // for
+  assert(_propsFiberDim+_varsFiberDim == iOff);
+
+  PYLITH_METHOD_END;
+} // retrievePropsStateVarsBatch
+
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFrictionBatch(PylithScalar* const friction,
+						   const PylithScalar t,
+						   const PylithScalar* slip,
+						   const PylithScalar* slipRate,
+						   const PylithScalar* normalTraction,
+						   const int numPoints)
+{ // calcFrictionBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  assert(numPoints == _batchSize);
+  assert(size_t((_propsFiberDim+_varsFiberDim)*numPoints) == _propsStateVarsBatch.size());
+  if (!numPoints) {
+    PYLITH_METHOD_END;
+  } // if
+
+  const PylithScalar* propertiesBatch = &_propsStateVarsBatch[0];
+  const PylithScalar* stateVarsBatch = (_varsFiberDim > 0) ?
+    &_propsStateVarsBatch[_propsFiberDim*numPoints] : 0;
+
+  _calcFrictionBatch(friction, t, slip, slipRate, normalTraction, numPoints,
+		     propertiesBatch, _propsFiberDim,
+		     stateVarsBatch, _varsFiberDim);
+
+  PYLITH_METHOD_END;
+} // calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							const PylithScalar t,
+							const PylithScalar* slip,
+							const PylithScalar* slipRate,
+							const PylithScalar* normalTraction,
+							const int numPoints)
+{ // calcFrictionDerivBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  assert(numPoints == _batchSize);
+  assert(size_t((_propsFiberDim+_varsFiberDim)*numPoints) == _propsStateVarsBatch.size());
+  if (!numPoints) {
+    PYLITH_METHOD_END;
+  } // if
+
+  const PylithScalar* propertiesBatch = &_propsStateVarsBatch[0];
+  const PylithScalar* stateVarsBatch = (_varsFiberDim > 0) ?
+    &_propsStateVarsBatch[_propsFiberDim*numPoints] : 0;
+
+  _calcFrictionDerivBatch(frictionDeriv, t, slip, slipRate, normalTraction, numPoints,
+			  propertiesBatch, _propsFiberDim,
+			  stateVarsBatch, _varsFiberDim);
+
+  PYLITH_METHOD_END;
+} // calcFrictionDerivBatch
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -457,6 +590,68 @@ pylith::friction::FrictionModel::_updateStateVars(
 { // _updateStateVars
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of vertices.
+void
+pylith::friction::FrictionModel::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const int numPoints,
+						    const PylithScalar* properties,
+						    const int numProperties,
+						    const PylithScalar* stateVars,
+						    const int numStateVars)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(properties);
+
+  // Gather values for each vertex and use the pointwise kernel.
+  scalar_array propertiesVertex(numProperties);
+  scalar_array stateVarsVertex(numStateVars);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numProperties; ++i)
+      propertiesVertex[i] = properties[i*numPoints+iPoint];
+    for (int i=0; i < numStateVars; ++i)
+      stateVarsVertex[i] = stateVars[i*numPoints+iPoint];
+    friction[iPoint] = _calcFriction(t, slip[iPoint], slipRate[iPoint], normalTraction[iPoint],
+				     (numProperties > 0) ? &propertiesVertex[0] : 0, numProperties,
+				     (numStateVars > 0) ? &stateVarsVertex[0] : 0, numStateVars);
+  } // for
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of vertices.
+void
+pylith::friction::FrictionModel::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const int numPoints,
+							 const PylithScalar* properties,
+							 const int numProperties,
+							 const PylithScalar* stateVars,
+							 const int numStateVars)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+  assert(properties);
+
+  // Gather values for each vertex and use the pointwise kernel.
+  scalar_array propertiesVertex(numProperties);
+  scalar_array stateVarsVertex(numStateVars);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numProperties; ++i)
+      propertiesVertex[i] = properties[i*numPoints+iPoint];
+    for (int i=0; i < numStateVars; ++i)
+      stateVarsVertex[i] = stateVars[i*numPoints+iPoint];
+    frictionDeriv[iPoint] = _calcFrictionDeriv(t, slip[iPoint], slipRate[iPoint], normalTraction[iPoint],
+					       (numProperties > 0) ? &propertiesVertex[0] : 0, numProperties,
+					       (numStateVars > 0) ? &stateVarsVertex[0] : 0, numStateVars);
+  } // for
+} // _calcFrictionDerivBatch
+
 // ----------------------------------------------------------------------
 // Setup fields for physical properties and state variables.
 void
@@ -208,6 +208,58 @@ public :
 		       const PylithScalar normalTraction,
 		       const int vertex);
   
+  /** Retrieve properties and state variables for a batch of points.
+   *
+   * The values are stored as structure-of-arrays (all points for the
+   * first value, then all points for the second value, etc) for use
+   * with calcFrictionBatch() and calcFrictionDerivBatch().
+   *
+   * @param points Array of finite-element points.
+   * @param numPoints Number of points.
+   */
+  void retrievePropsStateVarsBatch(const PylithInt* points,
+				   const int numPoints);
+
+  /** Compute friction at a batch of vertices.
+   *
+   * @pre Must call retrievePropsStateVarsBatch() for the vertices
+   * before calling calcFrictionBatch().
+   *
+   * @param friction Array of friction (magnitude of shear traction)
+   * at vertices [output].
+   * @param t Time in simulation.
+   * @param slip Array of current slip at vertices.
+   * @param slipRate Array of current slip rate at vertices.
+   * @param normalTraction Array of normal traction at vertices.
+   * @param numPoints Number of vertices.
+   */
+  void calcFrictionBatch(PylithScalar* const friction,
+			 const PylithScalar t,
+			 const PylithScalar* slip,
+			 const PylithScalar* slipRate,
+			 const PylithScalar* normalTraction,
+			 const int numPoints);
+
+  /** Compute derivative of friction with slip at a batch of vertices.
+   *
+   * @pre Must call retrievePropsStateVarsBatch() for the vertices
+   * before calling calcFrictionDerivBatch().
+   *
+   * @param frictionDeriv Array of derivative of friction at vertices
+   * [output].
+   * @param t Time in simulation.
+   * @param slip Array of current slip at vertices.
+   * @param slipRate Array of current slip rate at vertices.
+   * @param normalTraction Array of normal traction at vertices.
+   * @param numPoints Number of vertices.
+   */
+  void calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+			      const PylithScalar t,
+			      const PylithScalar* slip,
+			      const PylithScalar* slipRate,
+			      const PylithScalar* normalTraction,
+			      const int numPoints);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -314,6 +366,65 @@ protected :
 				  const PylithScalar* stateVars,
 				  const int numStateVars) = 0;
   
+  /** Compute friction for a batch of vertices from properties and
+   * state variables stored as structure-of-arrays.
+   *
+   * The default implementation calls _calcFriction() for each
+   * vertex. Friction models should override this with a loop over
+   * the arrays that the compiler can vectorize.
+   *
+   * @param friction Array of friction at vertices [output].
+   * @param t Time in simulation.
+   * @param slip Array of current slip at vertices.
+   * @param slipRate Array of current slip rate at vertices.
+   * @param normalTraction Array of normal traction at vertices.
+   * @param numPoints Number of vertices.
+   * @param properties Properties at vertices (numProperties x numPoints).
+   * @param numProperties Number of properties.
+   * @param stateVars State variables at vertices (numStateVars x numPoints).
+   * @param numStateVars Number of state variables.
+   */
+  virtual
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const int numPoints,
+			  const PylithScalar* properties,
+			  const int numProperties,
+			  const PylithScalar* stateVars,
+			  const int numStateVars);
+
+  /** Compute derivative of friction with slip for a batch of vertices
+   * from properties and state variables stored as structure-of-arrays.
+   *
+   * The default implementation calls _calcFrictionDeriv() for each
+   * vertex.
+   *
+   * @param frictionDeriv Array of derivative of friction at vertices [output].
+   * @param t Time in simulation.
+   * @param slip Array of current slip at vertices.
+   * @param slipRate Array of current slip rate at vertices.
+   * @param normalTraction Array of normal traction at vertices.
+   * @param numPoints Number of vertices.
+   * @param properties Properties at vertices (numProperties x numPoints).
+   * @param numProperties Number of properties.
+   * @param stateVars State variables at vertices (numStateVars x numPoints).
+   * @param numStateVars Number of state variables.
+   */
+  virtual
+  void _calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const int numPoints,
+			       const PylithScalar* properties,
+			       const int numProperties,
+			       const PylithScalar* stateVars,
+			       const int numStateVars);
+
   /** Update state variables (for next time step).
    *
    * @param t Time in simulation.
@@ -369,6 +480,11 @@ private :
   /// Buffer for properties and state variables at vertex.
   scalar_array _propsStateVarsVertex;
 
+  /// Buffer for properties and state variables at a batch of
+  /// vertices (structure-of-arrays).
+  scalar_array _propsStateVarsBatch;
+
+  int _batchSize; ///< Number of points in batch buffer.
   int _propsFiberDim; ///< Number of properties per point.
   int _varsFiberDim; ///< Number of state variables per point.
 
@@ -377,6 +377,90 @@ pylith::friction::RateStateAgeing::_calcFrictionDeriv(const PylithScalar t,
 } // _calcFrictionDeriv
 
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of vertices from properties and state
+// variables.
+void
+pylith::friction::RateStateAgeing::_calcFrictionBatch(PylithScalar* const friction,
+						      const PylithScalar t,
+						      const PylithScalar* slip,
+						      const PylithScalar* slipRate,
+						      const PylithScalar* normalTraction,
+						      const int numPoints,
+						      const PylithScalar* properties,
+						      const int numProperties,
+						      const PylithScalar* stateVars,
+						      const int numStateVars)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(properties);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(stateVars);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  const PylithScalar slipRateLinear = _linearSlipRate;
+
+  const PylithScalar* f0 = &properties[p_coef*numPoints];
+  const PylithScalar* a = &properties[p_a*numPoints];
+  const PylithScalar* b = &properties[p_b*numPoints];
+  const PylithScalar* L = &properties[p_L*numPoints];
+  const PylithScalar* slipRate0 = &properties[p_slipRate0*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  const PylithScalar* state = &stateVars[s_state*numPoints];
+
+  // The logarithmic and linear forms of the friction coefficient
+  // are combined with selects so that the loop has no branches and
+  // the log() calls can be vectorized.
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    // Prevent zero value for theta, reasonable value is L / slipRate0
+    const PylithScalar theta = (state[iPoint] > 0.0) ? state[iPoint] : L[iPoint] / slipRate0[iPoint];
+    const bool linear = slipRate[iPoint] < slipRateLinear;
+    const PylithScalar slipRateLog = (linear) ? slipRateLinear : slipRate[iPoint];
+    const PylithScalar muLinear = (linear) ? a[iPoint]*(1.0 - slipRate[iPoint]/slipRateLinear) : 0.0;
+    const PylithScalar mu_f = f0[iPoint] + a[iPoint]*log(slipRateLog / slipRate0[iPoint]) +
+      b[iPoint]*log(slipRate0[iPoint]*theta/L[iPoint]) - muLinear;
+    const PylithScalar normalTractionCompression = (normalTraction[iPoint] <= 0.0) ? normalTraction[iPoint] : 0.0;
+    friction[iPoint] = -mu_f * normalTractionCompression + cohesion[iPoint];
+  } // for
+
+  PetscLogFlops(numPoints*12);
+} // _calcFrictionBatch
+
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of vertices
+// from properties and state variables.
+void
+pylith::friction::RateStateAgeing::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							   const PylithScalar t,
+							   const PylithScalar* slip,
+							   const PylithScalar* slipRate,
+							   const PylithScalar* normalTraction,
+							   const int numPoints,
+							   const PylithScalar* properties,
+							   const int numProperties,
+							   const PylithScalar* stateVars,
+							   const int numStateVars)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+  assert(properties);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  const PylithScalar slipRateLinear = _linearSlipRate;
+
+  const PylithScalar* a = &properties[p_a*numPoints];
+
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar slipRateDeriv = (slipRate[iPoint] >= slipRateLinear) ? slipRate[iPoint] : slipRateLinear;
+    const PylithScalar normalTractionCompression = (normalTraction[iPoint] <= 0.0) ? normalTraction[iPoint] : 0.0;
+    frictionDeriv[iPoint] = -normalTractionCompression * a[iPoint] / (slipRateDeriv * _dt);
+  } // for
+
+  PetscLogFlops(numPoints*4);
+} // _calcFrictionDerivBatch
+
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -169,6 +169,56 @@ protected :
 				  const PylithScalar* stateVars,
 				  const int numStateVars);
 
+  /** Compute friction for a batch of vertices from properties and
+   * state variables stored as structure-of-arrays.
+   *
+   * @param friction Array of friction at vertices [output].
+   * @param t Time in simulation.
+   * @param slip Array of current slip at vertices.
+   * @param slipRate Array of current slip rate at vertices.
+   * @param normalTraction Array of normal traction at vertices.
+   * @param numPoints Number of vertices.
+   * @param properties Properties at vertices.
+   * @param numProperties Number of properties.
+   * @param stateVars State variables at vertices.
+   * @param numStateVars Number of state variables.
+   */
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const int numPoints,
+			  const PylithScalar* properties,
+			  const int numProperties,
+			  const PylithScalar* stateVars,
+			  const int numStateVars);
+
+  /** Compute derivative of friction with slip for a batch of vertices
+   * from properties and state variables stored as structure-of-arrays.
+   *
+   * @param frictionDeriv Array of derivative of friction at vertices [output].
+   * @param t Time in simulation.
+   * @param slip Array of current slip at vertices.
+   * @param slipRate Array of current slip rate at vertices.
+   * @param normalTraction Array of normal traction at vertices.
+   * @param numPoints Number of vertices.
+   * @param properties Properties at vertices.
+   * @param numProperties Number of properties.
+   * @param stateVars State variables at vertices.
+   * @param numStateVars Number of state variables.
+   */
+  void _calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const int numPoints,
+			       const PylithScalar* properties,
+			       const int numProperties,
+			       const PylithScalar* stateVars,
+			       const int numStateVars);
+
   /** Update state variables (for next time step).
    *
    * @param t Time in simulation.
@@ -339,6 +339,86 @@ pylith::friction::SlipWeakening::_calcFrictionDeriv(const PylithScalar t,
 } // _calcFrictionDeriv
 
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of vertices from properties and state
+// variables.
+void
+pylith::friction::SlipWeakening::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const int numPoints,
+						    const PylithScalar* properties,
+						    const int numProperties,
+						    const PylithScalar* stateVars,
+						    const int numStateVars)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(properties);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(stateVars);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  const PylithScalar* coefS = &properties[p_coefS*numPoints];
+  const PylithScalar* coefD = &properties[p_coefD*numPoints];
+  const PylithScalar* d0 = &properties[p_d0*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  const PylithScalar* slipCumPrev = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+
+  // Use selects instead of branches so the loop can be vectorized.
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar slipCum = slipCumPrev[iPoint] + fabs(slip[iPoint] - slipPrev[iPoint]);
+    const PylithScalar mu_f = (slipCum < d0[iPoint]) ?
+      coefS[iPoint] - (coefS[iPoint] - coefD[iPoint]) * slipCum / d0[iPoint] :
+      coefD[iPoint];
+    const PylithScalar normalTractionCompression = (normalTraction[iPoint] <= 0.0) ? normalTraction[iPoint] : 0.0;
+    friction[iPoint] = -mu_f * normalTractionCompression + cohesion[iPoint];
+  } // for
+
+  PetscLogFlops(numPoints*10);
+} // _calcFrictionBatch
+
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of vertices
+// from properties and state variables.
+void
+pylith::friction::SlipWeakening::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const int numPoints,
+							 const PylithScalar* properties,
+							 const int numProperties,
+							 const PylithScalar* stateVars,
+							 const int numStateVars)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+  assert(properties);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(stateVars);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  const PylithScalar* coefS = &properties[p_coefS*numPoints];
+  const PylithScalar* coefD = &properties[p_coefD*numPoints];
+  const PylithScalar* d0 = &properties[p_d0*numPoints];
+  const PylithScalar* slipCumPrev = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar slipCum = slipCumPrev[iPoint] + fabs(slip[iPoint] - slipPrev[iPoint]);
+    const bool weakening = normalTraction[iPoint] <= 0.0 && slipCum < d0[iPoint];
+    frictionDeriv[iPoint] = (weakening) ?
+      normalTraction[iPoint] * (coefS[iPoint] - coefD[iPoint]) / d0[iPoint] : 0.0;
+  } // for
+
+  PetscLogFlops(numPoints*6);
+} // _calcFrictionDerivBatch
+
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -183,4 +183,58 @@ pylith::friction::StaticFriction::_calcFrictionDeriv(const PylithScalar t,
 } // _calcFrictionDeriv
 
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of vertices from properties and state
+// variables.
+void
+pylith::friction::StaticFriction::_calcFrictionBatch(PylithScalar* const friction,
+						     const PylithScalar t,
+						     const PylithScalar* slip,
+						     const PylithScalar* slipRate,
+						     const PylithScalar* normalTraction,
+						     const int numPoints,
+						     const PylithScalar* properties,
+						     const int numProperties,
+						     const PylithScalar* stateVars,
+						     const int numStateVars)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(properties);
+  assert(_StaticFriction::numProperties == numProperties);
+  assert(0 == numStateVars);
+
+  const PylithScalar* coef = &properties[p_coef*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar normalTractionCompression = (normalTraction[iPoint] <= 0.0) ? normalTraction[iPoint] : 0.0;
+    friction[iPoint] = cohesion[iPoint] - coef[iPoint] * normalTractionCompression;
+  } // for
+
+  PetscLogFlops(numPoints*2);
+} // _calcFrictionBatch
+
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of vertices
+// from properties and state variables.
+void
+pylith::friction::StaticFriction::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							  const PylithScalar t,
+							  const PylithScalar* slip,
+							  const PylithScalar* slipRate,
+							  const PylithScalar* normalTraction,
+							  const int numPoints,
+							  const PylithScalar* properties,
+							  const int numProperties,
+							  const PylithScalar* stateVars,
+							  const int numStateVars)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    frictionDeriv[iPoint] = 0.0;
+  } // for
+} // _calcFrictionDerivBatch
+
+
 // End of file 
@@ -29,6 +29,7 @@
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 #include "pylith/utils/constdefs.h" // USES MAXSCALAR
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
@@ -49,12 +50,17 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
   _dbInitialStress(0),
   _dbInitialStrain(0),
   _initialFields(0),
-  _numQuadPts(0),
+  _numCoefsQuadPt(0),
+  _timeStepCoefs(0),
+  _timeStepCoefsDt(0.0),
+  _timeStepCoefsQuadPt(0),
+  _haveTimeStepCoefsCell(false),
   _numElasticConsts(numElasticConsts),
   _propertiesVisitor(0),
   _stateVarsVisitor(0),
   _stressVisitor(0),
-  _strainVisitor(0)
+  _strainVisitor(0),
+  _timeStepCoefsVisitor(0)
 { // constructor
 } // constructor
 
@@ -74,11 +80,13 @@ pylith::materials::ElasticMaterial::deallocate(void)
 
   Material::deallocate();
   delete _initialFields; _initialFields = 0;
+  delete _timeStepCoefs; _timeStepCoefs = 0;
 
   delete _propertiesVisitor; _propertiesVisitor = 0;
   delete _stateVarsVisitor; _stateVarsVisitor = 0;
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
+  delete _timeStepCoefsVisitor; _timeStepCoefsVisitor = 0;
 
   _dbInitialStress = 0; // :TODO: Use shared pointer.
   _dbInitialStrain = 0; // :TODO: Use shared pointer.
@@ -97,15 +105,16 @@ pylith::materials::ElasticMaterial::initialize(const topology::Mesh& mesh,
 
   Material::initialize(mesh, quadrature);
 
-  assert(0 != quadrature);
-  _numQuadPts = quadrature->numQuadPts();
-
   if (_dbInitialStress || _dbInitialStrain) {
     delete _initialFields; 
     _initialFields = new topology::Fields(mesh);assert(_initialFields);
   } // if
-  _initializeInitialStress(mesh, quadrature);
-  _initializeInitialStrain(mesh, quadrature);
+  if (_dbInitialStress || _dbInitialStrain) {
+    utils::BatchQuery query;
+    _setupQuery(&query, mesh, quadrature);
+    _initializeInitialStress(mesh, query);
+    _initializeInitialStrain(mesh, query);
+  } // if
   _allocateCellArrays();
 
   PYLITH_METHOD_END;
@@ -122,7 +131,7 @@ pylith::materials::ElasticMaterial::createPropsAndVarsVisitors(void)
 
   delete _propertiesVisitor; _propertiesVisitor = new pylith::topology::VecVisitorMesh(*_properties);assert(_propertiesVisitor);
   _propertiesVisitor->optimizeClosure();
-  if (hasStateVars()) {
+  if (hasStateVars() && !_reducedPrecision) {
     delete _stateVarsVisitor; _stateVarsVisitor = new pylith::topology::VecVisitorMesh(*_stateVars);assert(_stateVarsVisitor);
     _stateVarsVisitor->optimizeClosure();
   } // if
@@ -140,6 +149,15 @@ pylith::materials::ElasticMaterial::createPropsAndVarsVisitors(void)
     } // if
   } // if
 
+  if (_numCoefsQuadPt > 0) {
+    if (!_timeStepCoefs || _timeStepCoefsDt != _dt) {
+      _updateTimeStepCoefs();
+    } // if
+    assert(_timeStepCoefs);
+    delete _timeStepCoefsVisitor; _timeStepCoefsVisitor = new pylith::topology::VecVisitorMesh(*_timeStepCoefs);assert(_timeStepCoefsVisitor);
+    _timeStepCoefsVisitor->optimizeClosure();
+  } // if
+
   PYLITH_METHOD_END;
 } // createPropsAndVarsVisitors
 
@@ -153,6 +171,8 @@ pylith::materials::ElasticMaterial::destroyPropsAndVarsVisitors(void)
   delete _stateVarsVisitor; _stateVarsVisitor = 0;
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
+  delete _timeStepCoefsVisitor; _timeStepCoefsVisitor = 0;
+  _haveTimeStepCoefsCell = false;
 
   PYLITH_METHOD_END;
 } // destroyPropsAndVarsVisitors
@@ -175,12 +195,15 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
   assert(_propertiesVisitor);
   PetscScalar* propertiesArray = _propertiesVisitor->localArray();
   const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
-  assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
-  for(PetscInt d = 0; d < propertiesSize; ++d) {
-    _propertiesCell[d] = propertiesArray[poff+d];
-  } // for
+  const PetscInt pdof = _propertiesVisitor->sectionDof(cell);
+  _retrieveCompactValues(&_propertiesCell[0], _numQuadPts, _numPropsQuadPt, propertiesArray, poff, pdof, _propertiesMaterial);
 
-  if (hasStateVars()) {
+  if (hasStateVars() && _reducedPrecision) {
+    const PetscInt soff = _stateVarsReducedOffset(cell);
+    for(PetscInt d = 0; d < stateVarsSize; ++d) {
+      _stateVarsCell[d] = _stateVarsReduced[soff+d];
+    } // for
+  } else if (hasStateVars()) {
     assert(_stateVarsVisitor);
     PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
     const PetscInt soff = _stateVarsVisitor->sectionOffset(cell);
@@ -188,35 +211,41 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
     for(PetscInt d = 0; d < stateVarsSize; ++d) {
       _stateVarsCell[d] = stateVarsArray[soff+d];
     } // for
-  } // if
+  } // if/else
 
   _initialStressCell = 0.0;
   _initialStrainCell = 0.0;
   if (_initialFields) {
     if (_initialFields->hasField("initial stress")) {
-      const int stressSize = _numQuadPts*_tensorSize;
-      assert(_initialStressCell.size() == size_t(stressSize));
+      assert(_initialStressCell.size() == size_t(_numQuadPts*_tensorSize));
       assert(_stressVisitor);
       PetscScalar* stressArray = _stressVisitor->localArray();
       const PetscInt ioff = _stressVisitor->sectionOffset(cell);
-      assert(stressSize == _stressVisitor->sectionDof(cell));
-      for(PetscInt d = 0; d < stressSize; ++d) {
-	_initialStressCell[d] = stressArray[ioff+d];
-      } // for
+      const PetscInt idof = _stressVisitor->sectionDof(cell);
+      _retrieveCompactValues(&_initialStressCell[0], _numQuadPts, _tensorSize, stressArray, ioff, idof, _initialStressMaterial);
     } // if
     if (_initialFields->hasField("initial strain")) {
-      const int strainSize = _numQuadPts*_tensorSize;
-      assert(_initialStrainCell.size() == size_t(strainSize));
+      assert(_initialStrainCell.size() == size_t(_numQuadPts*_tensorSize));
       assert(_strainVisitor);
       PetscScalar* strainArray = _strainVisitor->localArray();
       const PetscInt ioff = _strainVisitor->sectionOffset(cell);
-      assert(strainSize == _strainVisitor->sectionDof(cell));
-      for(PetscInt d = 0; d < strainSize; ++d) {
-	_initialStrainCell[d] = strainArray[ioff+d];
-      } // for
+      const PetscInt idof = _strainVisitor->sectionDof(cell);
+      _retrieveCompactValues(&_initialStrainCell[0], _numQuadPts, _tensorSize, strainArray, ioff, idof, _initialStrainMaterial);
     } // if
   } // if
 
+  // Use cached time step coefficients only if they correspond to the
+  // current time step.
+  _haveTimeStepCoefsCell = false;
+  if (_timeStepCoefsVisitor && _timeStepCoefsDt == _dt) {
+    assert(_timeStepCoefsCell.size() == size_t(_numQuadPts*_numCoefsQuadPt));
+    PetscScalar* coefsArray = _timeStepCoefsVisitor->localArray();
+    const PetscInt coff = _timeStepCoefsVisitor->sectionOffset(cell);
+    const PetscInt cdof = _timeStepCoefsVisitor->sectionDof(cell);
+    _retrieveCompactValues(&_timeStepCoefsCell[0], _numQuadPts, _numCoefsQuadPt, coefsArray, coff, cdof, _timeStepCoefsMaterial);
+    _haveTimeStepCoefsCell = true;
+  } // if
+
   PYLITH_METHOD_END;
 } // retrievePropsAndVars
 
@@ -238,7 +267,9 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  const int numCoefsQuadPt = _haveTimeStepCoefsCell ? _numCoefsQuadPt : 0;
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _timeStepCoefsQuadPt = (numCoefsQuadPt > 0) ? &_timeStepCoefsCell[iQuad*numCoefsQuadPt] : 0;
     _calcStress(&_stressCell[iQuad*_tensorSize], _tensorSize,
 		&_propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
 		&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
@@ -246,6 +277,8 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
 		&_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		&_initialStrainCell[iQuad*_tensorSize], _tensorSize,
 		computeStateVars);
+  } // for
+  _timeStepCoefsQuadPt = 0;
 
   PYLITH_METHOD_RETURN(_stressCell);
 } // calcStress
@@ -267,7 +300,9 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  const int numCoefsQuadPt = _haveTimeStepCoefsCell ? _numCoefsQuadPt : 0;
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _timeStepCoefsQuadPt = (numCoefsQuadPt > 0) ? &_timeStepCoefsCell[iQuad*numCoefsQuadPt] : 0;
     _calcElasticConsts(&_elasticConstsCell[iQuad*_numElasticConsts], 
 		       _numElasticConsts,
 		       &_propertiesCell[iQuad*numPropsQuadPt], 
@@ -276,6 +311,8 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
 		       &totalStrain[iQuad*_tensorSize], _tensorSize,
 		       &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		       &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+  } // for
+  _timeStepCoefsQuadPt = 0;
 
   PYLITH_METHOD_RETURN(_elasticConstsCell);
 } // calcDerivElastic
@@ -297,22 +334,33 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  const int numCoefsQuadPt = _haveTimeStepCoefsCell ? _numCoefsQuadPt : 0;
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _timeStepCoefsQuadPt = (numCoefsQuadPt > 0) ? &_timeStepCoefsCell[iQuad*numCoefsQuadPt] : 0;
     _updateStateVars(&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
 		     &_propertiesCell[iQuad*numPropsQuadPt], 
 		     numPropsQuadPt,
 		     &totalStrain[iQuad*_tensorSize], _tensorSize,
 		     &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		     &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+  } // for
+  _timeStepCoefsQuadPt = 0;
   
-  topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
-  PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
-  const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
   const int stateVarsSize = numQuadPts*numVarsQuadPt;
-  assert(stateVarsSize == stateVarsVisitor.sectionDof(cell));
-  for (PetscInt d = 0; d < stateVarsSize; ++d) {
-    stateVarsArray[soff+d] = _stateVarsCell[d];
-  } // for
+  if (_reducedPrecision && stateVarsSize > 0) {
+    const PetscInt soff = _stateVarsReducedOffset(cell);
+    for (PetscInt d = 0; d < stateVarsSize; ++d) {
+      _stateVarsReduced[soff+d] = float(_stateVarsCell[d]);
+    } // for
+  } else {
+    topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
+    PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
+    const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
+    assert(stateVarsSize == stateVarsVisitor.sectionDof(cell));
+    for (PetscInt d = 0; d < stateVarsSize; ++d) {
+      stateVarsArray[soff+d] = _stateVarsCell[d];
+    } // for
+  } // if/else
 
   PYLITH_METHOD_END;
 } // updateStateVars
@@ -572,6 +620,63 @@ pylith::materials::ElasticMaterial::_stableTimeStepImplicitMax(const topology::M
   PYLITH_METHOD_RETURN(dtStable);
 } // _stableTimeStepImplicitMax
 
+// ----------------------------------------------------------------------
+// Compute coefficients that depend only on the time step and physical
+// properties.
+void
+pylith::materials::ElasticMaterial::_calcTimeStepCoefs(PylithScalar* const coefs,
+						       const int numCoefs,
+						       const PylithScalar* properties,
+						       const int numProperties) const
+{ // _calcTimeStepCoefs
+  assert(0 == numCoefs);
+} // _calcTimeStepCoefs
+
+// ----------------------------------------------------------------------
+// Compute time step coefficients for all material cells.
+void
+pylith::materials::ElasticMaterial::_updateTimeStepCoefs(void)
+{ // _updateTimeStepCoefs
+  PYLITH_METHOD_BEGIN;
+
+  assert(_properties);
+  assert(_materialIS);
+  assert(_numCoefsQuadPt > 0);
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numCoefsQuadPt = _numCoefsQuadPt;
+
+  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = _materialIS->points();
+
+  topology::VecVisitorMesh propertiesVisitor(*_properties);
+  const PetscScalar* propertiesArray = propertiesVisitor.localArray();
+
+  // Coefficients depend only on the properties, so values are uniform
+  // over the material whenever the properties are.
+  scalar_array propertiesCell(numQuadPts*numPropsQuadPt);
+  scalar_array coefsMaterialCells(numCells*numQuadPts*numCoefsQuadPt);
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    const PetscInt poff = propertiesVisitor.sectionOffset(cell);
+    const PetscInt pdof = propertiesVisitor.sectionDof(cell);
+    _retrieveCompactValues(&propertiesCell[0], numQuadPts, numPropsQuadPt, propertiesArray, poff, pdof, _propertiesMaterial);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      _calcTimeStepCoefs(&coefsMaterialCells[(c*numQuadPts+iQuad)*numCoefsQuadPt], numCoefsQuadPt,
+			 &propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt);
+    } // for
+  } // for
+
+  delete _timeStepCoefsVisitor; _timeStepCoefsVisitor = 0;
+  delete _timeStepCoefs; _timeStepCoefs = new topology::Field(_properties->mesh());assert(_timeStepCoefs);
+  _timeStepCoefs->label("time step coefficients");
+  _createCompactField(_timeStepCoefs, &_timeStepCoefsMaterial, coefsMaterialCells, numCoefsQuadPt);
+  _timeStepCoefsDt = _dt;
+
+  PYLITH_METHOD_END;
+} // _updateTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Allocate cell arrays.
 void
@@ -592,6 +697,7 @@ pylith::materials::ElasticMaterial::_allocateCellArrays(void)
   _densityCell.resize(numQuadPts);
   _stressCell.resize(numQuadPts * tensorSize);
   _elasticConstsCell.resize(numQuadPts * numElasticConsts);
+  _timeStepCoefsCell.resize(numQuadPts * _numCoefsQuadPt);
 
   PYLITH_METHOD_END;
 } // _allocateCellArrays
@@ -600,7 +706,7 @@ pylith::materials::ElasticMaterial::_allocateCellArrays(void)
 // Initialize initial stress field.
 void
 pylith::materials::ElasticMaterial::_initializeInitialStress(const topology::Mesh& mesh,
-							     feassemble::Quadrature* quadrature)
+							     const utils::BatchQuery& query)
 { // _initializeInitialStress
   PYLITH_METHOD_BEGIN;
 
@@ -612,37 +718,20 @@ pylith::materials::ElasticMaterial::_initializeInitialStress(const topology::Mes
   topology::Field& initialStress = _initialFields->get("initial stress");
 
   assert(_dbInitialStress);
-  assert(quadrature);
 
-  // Get quadrature information
-  const int numQuadPts = quadrature->numQuadPts();
-  const int spaceDim = quadrature->spaceDim();
-  const int numBasis = quadrature->numBasis();
+  const int numQuadPts = _numQuadPts;
+  const int spaceDim = query.spaceDim();
 
   const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();assert(cs);
 
   // Get cells associated with material
-  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
+  assert(query.numPoints() == numCells*numQuadPts);
 
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmMesh);
-
-  // Create arrays for querying
   const int tensorSize = _tensorSize;
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
-  scalar_array stressCell(numQuadPts*tensorSize);
-
-  // Create field to hold initial stress state.
   const int fiberDim = numQuadPts * tensorSize;
   assert(fiberDim > 0);
-  int_array cellsTmp(cells, numCells);
-  initialStress.newSection(cellsTmp, fiberDim);
-  initialStress.allocate();
-  initialStress.zeroAll();
-  topology::VecVisitorMesh stressVisitor(initialStress);
 
   // Setup databases for querying
   _dbInitialStress->open();
@@ -680,46 +769,30 @@ pylith::materials::ElasticMaterial::_initializeInitialStress(const topology::Mes
       throw std::logic_error(msg.str());
     } // switch
   
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-  const PylithScalar pressureScale = _normalizer->pressureScale();
-
-  for(PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
-
-    // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
-    quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-
-    // Dimensionalize coordinates for querying
-    const scalar_array& quadPtsNonDim = quadrature->quadPts();
-    quadPtsGlobal = quadPtsNonDim;
-    _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-    
-    // Loop over quadrature points in cell and query database
-    for (int iQuadPt=0, iCoord=0, iStress=0; iQuadPt < numQuadPts; ++iQuadPt, iCoord+=spaceDim, iStress+=tensorSize) {
-      int err = _dbInitialStress->query(&stressCell[iStress], tensorSize,
-					&quadPtsGlobal[iCoord], spaceDim, cs);
-      if (err) {
-	std::ostringstream msg;
-	msg << "Could not find initial stress at (";
-	for (int i=0; i < spaceDim; ++i)
-	  msg << "  " << quadPtsGlobal[iCoord+i];
-	msg << ") in material '" << label() << "' using spatial database '" << _dbInitialStress->label() << "'.";
-	throw std::runtime_error(msg.str());
-      } // if
-    } // for
-
-    // Nondimensionalize stress
-    _normalizer->nondimensionalize(&stressCell[0], stressCell.size(), 
-				   pressureScale);
-
-    stressVisitor.setClosure(&stressCell[0], stressCell.size(), cell, INSERT_VALUES);
-  } // for
+  // Query database for initial stress at quadrature points of all
+  // material cells.
+  scalar_array stressMaterialCells;
+  const int errPoint = query.query(&stressMaterialCells, tensorSize, _dbInitialStress, cs);
+  if (errPoint >= 0) {
+    const PylithScalar* xyz = query.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find initial stress at (";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") in material '" << label() << "' using spatial database '" << _dbInitialStress->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  assert(stressMaterialCells.size() == size_t(numCells*fiberDim));
 
   // Close databases
   _dbInitialStress->close();
 
+  // Nondimensionalize stress
+  assert(_normalizer);
+  _normalizer->nondimensionalize(&stressMaterialCells[0], stressMaterialCells.size(), _normalizer->pressureScale());
+
+  _createCompactField(&initialStress, &_initialStressMaterial, stressMaterialCells, tensorSize);
+
   PYLITH_METHOD_END;
 } // _initializeInitialStress
 
@@ -727,7 +800,7 @@ pylith::materials::ElasticMaterial::_initializeInitialStress(const topology::Mes
 // Initialize initial strain field.
 void
 pylith::materials::ElasticMaterial::_initializeInitialStrain(const topology::Mesh& mesh,
-							     feassemble::Quadrature* quadrature)
+							     const utils::BatchQuery& query)
 { // _initializeInitialStrain
   PYLITH_METHOD_BEGIN;
 
@@ -739,37 +812,20 @@ pylith::materials::ElasticMaterial::_initializeInitialStrain(const topology::Mes
   topology::Field& initialStrain = _initialFields->get("initial strain");
 
   assert(_dbInitialStrain);
-  assert(quadrature);
 
-  // Get quadrature information
-  const int numQuadPts = quadrature->numQuadPts();
-  const int spaceDim = quadrature->spaceDim();
-  const int numBasis = quadrature->numBasis();
+  const int numQuadPts = _numQuadPts;
+  const int spaceDim = query.spaceDim();
 
   const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();assert(cs);
 
   // Get cells associated with material
-  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
+  assert(query.numPoints() == numCells*numQuadPts);
 
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmMesh);
-
-  // Create arrays for querying
   const int tensorSize = _tensorSize;
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
-  scalar_array strainCell(numQuadPts*tensorSize);
-
-  // Create field to hold initial strain state.
   const int fiberDim = numQuadPts * tensorSize;
   assert(fiberDim > 0);
-  int_array cellsTmp(cells, numCells);
-  initialStrain.newSection(cellsTmp, fiberDim);
-  initialStrain.allocate();
-  initialStrain.zeroAll();
-  topology::VecVisitorMesh strainVisitor(initialStrain);
 
   // Setup databases for querying
   _dbInitialStrain->open();
@@ -807,43 +863,26 @@ pylith::materials::ElasticMaterial::_initializeInitialStrain(const topology::Mes
       throw std::logic_error(msg.str());
     } // switch
   
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-    
-  for(PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
-
-    // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
-    quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-
-    // Dimensionalize coordinates for querying
-    const scalar_array& quadPtsNonDim = quadrature->quadPts();
-    quadPtsGlobal = quadPtsNonDim;
-    _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-    
-    // Loop over quadrature points in cell and query database
-    for (int iQuadPt=0, iCoord=0, iStrain=0; 
-	 iQuadPt < numQuadPts; 
-	 ++iQuadPt, iCoord+=spaceDim, iStrain+=tensorSize) {
-      int err = _dbInitialStrain->query(&strainCell[iStrain], tensorSize,
-					&quadPtsGlobal[iCoord], spaceDim, cs);
-      if (err) {
-	std::ostringstream msg;
-	msg << "Could not find initial strain at (";
-	for (int i=0; i < spaceDim; ++i)
-	  msg << "  " << quadPtsGlobal[iCoord+i];
-	msg << ") in material '" << label() << "' using spatial database '" << _dbInitialStrain->label() << "'.";
-	throw std::runtime_error(msg.str());
-      } // if
-    } // for
-
-    strainVisitor.setClosure(&strainCell[0], strainCell.size(), cell, INSERT_VALUES);
-  } // for
+  // Query database for initial strain at quadrature points of all
+  // material cells.
+  scalar_array strainMaterialCells;
+  const int errPoint = query.query(&strainMaterialCells, tensorSize, _dbInitialStrain, cs);
+  if (errPoint >= 0) {
+    const PylithScalar* xyz = query.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find initial strain at (";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") in material '" << label() << "' using spatial database '" << _dbInitialStrain->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  assert(strainMaterialCells.size() == size_t(numCells*fiberDim));
 
   // Close databases
   _dbInitialStrain->close();
 
+  _createCompactField(&initialStrain, &_initialStrainMaterial, strainMaterialCells, tensorSize);
+
   PYLITH_METHOD_END;
 } // _initializeInitialStrain
 
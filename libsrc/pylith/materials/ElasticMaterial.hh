@@ -357,9 +357,48 @@ protected :
 				       const int numStateVars,
 				       const double minCellWidth) const = 0;
   
+  /** Compute coefficients at location that depend only on the
+   * current time step and the physical properties.
+   *
+   * Coefficients are computed for all material cells whenever the
+   * time step changes and are available to the constitutive kernels
+   * via _getTimeStepCoefs(). Materials with _numCoefsQuadPt > 0 must
+   * implement this method.
+   *
+   * @param coefs Array for coefficients at location.
+   * @param numCoefs Number of coefficients.
+   * @param properties Properties at location.
+   * @param numProperties Number of properties.
+   */
+  virtual
+  void _calcTimeStepCoefs(PylithScalar* const coefs,
+			  const int numCoefs,
+			  const PylithScalar* properties,
+			  const int numProperties) const;
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
+  /** Get coefficients that depend only on the current time step and
+   * the physical properties at location.
+   *
+   * Returns the cached coefficients for the current quadrature point
+   * when called from calcStress(), calcDerivElastic(), or
+   * updateStateVars(); otherwise, the coefficients are computed in
+   * the work array.
+   *
+   * @param coefs Work array for coefficients at location.
+   * @param numCoefs Number of coefficients.
+   * @param properties Properties at location.
+   * @param numProperties Number of properties.
+   *
+   * @returns Coefficients at location.
+   */
+  const PylithScalar* _getTimeStepCoefs(PylithScalar* const coefs,
+					const int numCoefs,
+					const PylithScalar* properties,
+					const int numProperties) const;
+
   /** Get stable time step for implicit time integration for a
    * material where the stable time step is infinite.
    *
@@ -432,9 +471,20 @@ protected :
   PylithScalar scalarProduct3D(const PylithScalar* tensor1,
 			       const PylithScalar* tensor2);
   
+  // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected :
+
+  /// Number of time step coefficients per quadrature point.
+  int _numCoefsQuadPt;
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
+  /** Compute time step coefficients for all material cells for the
+   * current time step.
+   */
+  void _updateTimeStepCoefs(void);
+
   /** Allocate cell arrays.
    *
    * @param numQuadPts Number of quadrature points.
@@ -444,18 +494,18 @@ private :
   /** Initialize initial stress field.
    *
    * @param mesh Finite-element mesh.
-   * @param quadrature Quadrature for finite-element integration
+   * @param query Batch query at quadrature points of material cells.
    */
   void _initializeInitialStress(const topology::Mesh& mesh,
-				feassemble::Quadrature* quadrature);
+				const utils::BatchQuery& query);
 
   /** Initialize initial strain field.
    *
    * @param mesh Finite-element mesh.
-   * @param quadrature Quadrature for finite-element integration
+   * @param query Batch query at quadrature points of material cells.
    */
   void _initializeInitialStrain(const topology::Mesh& mesh,
-				feassemble::Quadrature* quadrature);
+				const utils::BatchQuery& query);
 
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
@@ -468,6 +518,12 @@ private :
 
   /// Initial stress/strain fields.
   topology::Fields* _initialFields;
+
+  /// Initial stress uniform over material (compact storage).
+  scalar_array _initialStressMaterial;
+
+  /// Initial strain uniform over material (compact storage).
+  scalar_array _initialStrainMaterial;
   
   /** Properties at quadrature points for current cell.
    *
@@ -518,13 +574,35 @@ private :
    */
   scalar_array _elasticConstsCell;
 
-  int _numQuadPts; ///< Number of quadrature points
+  /** Time step coefficients at quadrature points for current cell.
+   *
+   * size = numQuadPts * numCoefsQuadPt
+   * index = iQuadPt * numCoefsQuadPt + iCoef
+   */
+  scalar_array _timeStepCoefsCell;
+
+  /// Time step coefficients uniform over material (compact storage).
+  scalar_array _timeStepCoefsMaterial;
+
+  /// Time step coefficients at quadrature points of material cells.
+  topology::Field* _timeStepCoefs;
+
+  /// Time step associated with time step coefficients.
+  PylithScalar _timeStepCoefsDt;
+
+  /// Time step coefficients at current quadrature point (NULL if not cached).
+  const PylithScalar* _timeStepCoefsQuadPt;
+
+  /// True if time step coefficients for current cell are current.
+  bool _haveTimeStepCoefsCell;
+
   const int _numElasticConsts; ///< Number of elastic constants.
 
   pylith::topology::VecVisitorMesh* _propertiesVisitor; ///< Visitor for properties field.
   pylith::topology::VecVisitorMesh* _stateVarsVisitor; ///< Visitor for stateVars field.
   pylith::topology::VecVisitorMesh* _stressVisitor; ///< Visitor for initial stress field.
   pylith::topology::VecVisitorMesh* _strainVisitor; ///< Visitor for initial strain field.
+  pylith::topology::VecVisitorMesh* _timeStepCoefsVisitor; ///< Visitor for time step coefficients field.
 
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
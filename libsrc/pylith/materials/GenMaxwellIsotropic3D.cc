@@ -114,6 +114,9 @@ namespace pylith {
 						 "viscous-strain-3-xz",
       };
 
+      /// Number of coefficients that depend on the time step.
+      const int numTimeStepCoefs = 2*numMaxwellModels;
+
     } // _GenMaxwellIsotropic3D
   } // materials
 } // pylith
@@ -199,6 +202,7 @@ pylith::materials::GenMaxwellIsotropic3D::GenMaxwellIsotropic3D(void) :
   _updateStateVarsFn(0)  
 { // constructor
   useElasticBehavior(false);
+  _numCoefsQuadPt = _GenMaxwellIsotropic3D::numTimeStepCoefs;
   _viscousStrain.resize(_GenMaxwellIsotropic3D::numMaxwellModels*_tensorSize);
 } // constructor
 
@@ -685,17 +689,17 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
   // Compute viscous contribution.
+  PylithScalar coefsWork[_GenMaxwellIsotropic3D::numTimeStepCoefs];
+  const PylithScalar* dq =
+    _getTimeStepCoefs(coefsWork, _GenMaxwellIsotropic3D::numTimeStepCoefs, properties, numProperties);
   PylithScalar visFac = 0.0;
   PylithScalar visFrac = 0.0;
   PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
     shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
     visFrac += shearRatio;
     if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      visFac += shearRatio * dq[imodel];
     } // if
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
@@ -910,6 +914,34 @@ pylith::materials::GenMaxwellIsotropic3D::_stableTimeStepExplicit(const PylithSc
   return dtStable;
 } // _stableTimeStepExplicit
 
+// ----------------------------------------------------------------------
+// Compute coefficients that depend only on the time step and physical
+// properties.
+void
+pylith::materials::GenMaxwellIsotropic3D::_calcTimeStepCoefs(PylithScalar* const coefs,
+							     const int numCoefs,
+							     const PylithScalar* properties,
+							     const int numProperties) const
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_GenMaxwellIsotropic3D::numTimeStepCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
+  for (int imodel=0; imodel < numMaxwellModels; ++imodel) {
+    if (properties[p_shearRatio+imodel] != 0.0) {
+      const PylithScalar maxwellTime = properties[p_maxwellTime+imodel];
+      coefs[imodel] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      coefs[numMaxwellModels+imodel] = exp(-_dt/maxwellTime);
+      PetscLogFlops(2);
+    } else {
+      coefs[imodel] = 0.0;
+      coefs[numMaxwellModels+imodel] = 0.0;
+    } // if/else
+  } // for
+} // _calcTimeStepCoefs
+
 
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
@@ -945,11 +977,6 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     properties[p_shearRatio+1],
     properties[p_shearRatio+2]
   };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
 
   // :TODO: Need to account for initial values for state variables
   const PylithScalar meanStrainTpdt =
@@ -963,12 +990,11 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
   
   PetscLogFlops(6);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+  // Get Prony series terms and decay factors
+  PylithScalar coefsWork[_GenMaxwellIsotropic3D::numTimeStepCoefs];
+  const PylithScalar* dq =
+    _getTimeStepCoefs(coefsWork, _GenMaxwellIsotropic3D::numTimeStepCoefs, properties, numProperties);
+  const PylithScalar* expFac = dq + numMaxwellModels;
 
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
@@ -984,7 +1010,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel * tensorSize+iComp] = 
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -993,7 +1019,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -1002,7 +1028,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -107,6 +107,9 @@ namespace pylith {
 						 "viscous-strain-3-xy",
       };
 
+      /// Number of coefficients that depend on the time step.
+      const int numTimeStepCoefs = 2*numMaxwellModels;
+
     } // _GenMaxwellPlaneStrain
   } // materials
 } // pylith
@@ -194,6 +197,7 @@ pylith::materials::GenMaxwellPlaneStrain::GenMaxwellPlaneStrain(void) :
   _updateStateVarsFn(0)  
 { // constructor
   useElasticBehavior(false);
+  _numCoefsQuadPt = _GenMaxwellPlaneStrain::numTimeStepCoefs;
   _viscousStrain.resize(_GenMaxwellPlaneStrain::numMaxwellModels * 4);
 } // constructor
 
@@ -676,17 +680,17 @@ pylith::materials::GenMaxwellPlaneStrain::_calcElasticConstsViscoelastic(
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
   // Compute viscous contribution.
+  PylithScalar coefsWork[_GenMaxwellPlaneStrain::numTimeStepCoefs];
+  const PylithScalar* dq =
+    _getTimeStepCoefs(coefsWork, _GenMaxwellPlaneStrain::numTimeStepCoefs, properties, numProperties);
   PylithScalar visFac = 0.0;
   PylithScalar visFrac = 0.0;
   PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
     shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
     visFrac += shearRatio;
     if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio * ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      visFac += shearRatio * dq[imodel];
     } // if
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
@@ -862,6 +866,34 @@ pylith::materials::GenMaxwellPlaneStrain::_stableTimeStepExplicit(const PylithSc
   return dtStable;
 } // _stableTimeStepExplicit
 
+// ----------------------------------------------------------------------
+// Compute coefficients that depend only on the time step and physical
+// properties.
+void
+pylith::materials::GenMaxwellPlaneStrain::_calcTimeStepCoefs(PylithScalar* const coefs,
+							     const int numCoefs,
+							     const PylithScalar* properties,
+							     const int numProperties) const
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_GenMaxwellPlaneStrain::numTimeStepCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const int numMaxwellModels = _GenMaxwellPlaneStrain::numMaxwellModels;
+  for (int imodel=0; imodel < numMaxwellModels; ++imodel) {
+    if (properties[p_shearRatio+imodel] != 0.0) {
+      const PylithScalar maxwellTime = properties[p_maxwellTime+imodel];
+      coefs[imodel] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      coefs[numMaxwellModels+imodel] = exp(-_dt/maxwellTime);
+      PetscLogFlops(2);
+    } else {
+      coefs[imodel] = 0.0;
+      coefs[numMaxwellModels+imodel] = 0.0;
+    } // if/else
+  } // for
+} // _calcTimeStepCoefs
+
 
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
@@ -896,11 +928,6 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     properties[p_shearRatio+1],
     properties[p_shearRatio+2]
   };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
 
   const PylithScalar strainTpdt[] = {totalStrain[0],
 			       totalStrain[1],
@@ -918,12 +945,11 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
 
   PetscLogFlops(4);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+  // Get Prony series terms and decay factors
+  PylithScalar coefsWork[_GenMaxwellPlaneStrain::numTimeStepCoefs];
+  const PylithScalar* dq =
+    _getTimeStepCoefs(coefsWork, _GenMaxwellPlaneStrain::numTimeStepCoefs, properties, numProperties);
+  const PylithScalar* expFac = dq + numMaxwellModels;
 
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
@@ -938,7 +964,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 1
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -946,7 +972,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 2
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -954,7 +980,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 3
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -27,6 +27,7 @@
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -46,12 +47,15 @@ pylith::materials::Material::Material(const int dimension,
   _stateVars(0),
   _normalizer(new spatialdata::units::Nondimensional),
   _materialIS(0),
+  _numQuadPts(0),
   _numPropsQuadPt(0),
   _numVarsQuadPt(0),
   _dimension(dimension),
   _tensorSize(tensorSize),
   _needNewJacobian(false),
   _isJacobianSymmetric(true),
+  _compactStorage(false),
+  _reducedPrecision(false),
   _dbProperties(0),
   _dbInitialState(0),
   _id(0),
@@ -87,6 +91,7 @@ pylith::materials::Material::deallocate(void)
   delete _materialIS; _materialIS = 0;
   delete _properties; _properties = 0;
   delete _stateVars; _stateVars = 0;
+  _stateVarsReduced.resize(0);
 
   _dbProperties = 0; // :TODO: Use shared pointer.
   _dbInitialState = 0; // :TODO: Use shared pointer.
@@ -122,8 +127,8 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
 
   // Get quadrature information
   const int numQuadPts = quadrature->numQuadPts();
-  const int numBasis = quadrature->numBasis();
   const int spaceDim = quadrature->spaceDim();
+  _numQuadPts = numQuadPts;
 
   // Get cells associated with material
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
@@ -134,35 +139,52 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
 
   const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();assert(cs);
 
-  // Create field to hold physical properties.
-  delete _properties; _properties = new topology::Field(mesh);assert(_properties);
-  _properties->label("properties");
-  const int propsFiberDim = numQuadPts * _numPropsQuadPt;
-  int_array cellsTmp(cells, numCells);
-
-  _properties->newSection(cellsTmp, propsFiberDim);
-  _properties->allocate();
-  _properties->zeroAll();
-  topology::VecVisitorMesh propertiesVisitor(*_properties);
-  PetscScalar* propertiesArray = propertiesVisitor.localArray();
-
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmMesh);
-
-  // Optimize coordinate retrieval in closure  
-  topology::CoordsVisitor::optimizeClosure(dmMesh);
+  // Gather quadrature points of all material cells for querying.
+  utils::BatchQuery query;
+  _setupQuery(&query, mesh, quadrature);
+  const int numPoints = query.numPoints();
+  assert(numPoints == numCells*numQuadPts);
 
-  // Create arrays for querying.
+  // Query database for physical properties at all quadrature points.
   const int numDBProperties = _metadata.numDBProperties();
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
-  scalar_array propertiesQuery(numDBProperties);
-  scalar_array propertiesCell(propsFiberDim);
-
-  // Setup database for quering for physical properties
+  scalar_array propertiesQuery;
   assert(_dbProperties);
   _dbProperties->open();
   _dbProperties->queryVals(_metadata.dbProperties(),
 			   _metadata.numDBProperties());
+  const int propertiesErrPoint = query.query(&propertiesQuery, numDBProperties, _dbProperties, cs);
+  if (propertiesErrPoint >= 0) {
+    const PylithScalar* xyz = query.point(propertiesErrPoint);
+    std::ostringstream msg;
+    msg << "Could not find parameters for physical properties at " << "(";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _dbProperties->close();
+
+  // Values of physical properties at quadrature points of all
+  // material cells. The field holding the physical properties is
+  // created from these values, because the storage layout (compact
+  // or not) depends on the values.
+  const int propsFiberDim = numQuadPts * _numPropsQuadPt;
+  scalar_array propertiesMaterialCells(numCells*propsFiberDim);
+  scalar_array propertiesDBPoint(numDBProperties);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numDBProperties; ++i) {
+      propertiesDBPoint[i] = propertiesQuery[iPoint*numDBProperties+i];
+    } // for
+    _dbToProperties(&propertiesMaterialCells[iPoint*_numPropsQuadPt], propertiesDBPoint);
+    _nondimProperties(&propertiesMaterialCells[iPoint*_numPropsQuadPt], _numPropsQuadPt);
+  } // for
+  propertiesQuery.resize(0);
+
+  // Create field to hold physical properties.
+  delete _properties; _properties = new topology::Field(mesh);assert(_properties);
+  _properties->label("properties");
+  _createCompactField(_properties, &_propertiesMaterial, propertiesMaterialCells, _numPropsQuadPt);
+  propertiesMaterialCells.resize(0);
 
   // Create field to hold state variables. We create the field even
   // if there is no initial state, because this we will use this field
@@ -170,37 +192,89 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   delete _stateVars; _stateVars = new topology::Field(mesh);assert(_stateVars);
   _stateVars->label("state variables");
   const int stateVarsFiberDim = numQuadPts * _numVarsQuadPt;
-  topology::VecVisitorMesh* stateVarsVisitor = 0;
-  PetscScalar* stateVarsArray = NULL;
   if (stateVarsFiberDim > 0) {
-    assert(_stateVars);
-    assert(_properties);
-    _stateVars->newSection(*_properties, stateVarsFiberDim);
+    int_array cellsTmp(cells, numCells);
+    _stateVars->newSection(cellsTmp, stateVarsFiberDim);
     _stateVars->allocate();
     _stateVars->zeroAll();
-    stateVarsVisitor = new topology::VecVisitorMesh(*_stateVars);
-    stateVarsArray = stateVarsVisitor->localArray();
   } // if
 
-
-  // Create arrays for querying
-  const int numDBStateVars = _metadata.numDBStateVars();
-  scalar_array stateVarsQuery;
-  scalar_array stateVarsCell;
   if (_dbInitialState) {
+    const int numDBStateVars = _metadata.numDBStateVars();
     assert(numDBStateVars > 0);
     assert(_numVarsQuadPt > 0);
-    stateVarsQuery.resize(numDBStateVars);
-    stateVarsCell.resize(stateVarsFiberDim);
-    
-    // Setup database for querying for initial state variables
+
+    // Query database for initial state variables at all quadrature points.
+    scalar_array stateVarsQuery;
     _dbInitialState->open();
     _dbInitialState->queryVals(_metadata.dbStateVars(), _metadata.numDBStateVars());
+    const int stateVarsErrPoint = query.query(&stateVarsQuery, numDBStateVars, _dbInitialState, cs);
+    if (stateVarsErrPoint >= 0) {
+      const PylithScalar* xyz = query.point(stateVarsErrPoint);
+      std::ostringstream msg;
+      msg << "Could not find initial state variables at \n" << "(";
+      for (int i=0; i < spaceDim; ++i)
+	msg << "  " << xyz[i];
+      msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+    _dbInitialState->close();
+
+    topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
+    PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
+    scalar_array stateVarsDBPoint(numDBStateVars);
+    for(PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
+      const PetscInt off = stateVarsVisitor.sectionOffset(cell);
+      assert(stateVarsFiberDim == stateVarsVisitor.sectionDof(cell));
+      for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt) {
+	const int iPoint = c*numQuadPts + iQuadPt;
+	for (int i=0; i < numDBStateVars; ++i) {
+	  stateVarsDBPoint[i] = stateVarsQuery[iPoint*numDBStateVars+i];
+	} // for
+	PylithScalar* stateVarsPoint = &stateVarsArray[off+iQuadPt*_numVarsQuadPt];
+	_dbToStateVars(stateVarsPoint, stateVarsDBPoint);
+	_nondimStateVars(stateVarsPoint, _numVarsQuadPt);
+      } // for
+    } // for
   } // if
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
+  if (_reducedPrecision && stateVarsFiberDim > 0) {
+    _reduceStateVars();
+  } // if
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Setup batch query at quadrature points of material cells.
+void
+pylith::materials::Material::_setupQuery(utils::BatchQuery* query,
+					 const topology::Mesh& mesh,
+					 feassemble::Quadrature* quadrature)
+{ // _setupQuery
+  PYLITH_METHOD_BEGIN;
+
+  assert(query);
+  assert(quadrature);
+  assert(_materialIS);
+
+  const int numQuadPts = quadrature->numQuadPts();
+  const int numBasis = quadrature->numBasis();
+  const int spaceDim = quadrature->spaceDim();
+
+  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = _materialIS->points();
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  // Optimize coordinate retrieval in closure  
+  topology::CoordsVisitor::optimizeClosure(dmMesh);
 
+  const int quadPtsFiberDim = numQuadPts*spaceDim;
+  scalar_array quadPtsMaterialCells(numCells*quadPtsFiberDim);
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
@@ -209,63 +283,167 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
     quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     const scalar_array& quadPtsNonDim = quadrature->quadPts();
-    quadPtsGlobal = quadPtsNonDim;
-    _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
-    // Loop over quadrature points in cell and query database
-    for (int iQuadPt=0, index=0; iQuadPt < numQuadPts; ++iQuadPt, index+=spaceDim) {
-      int err = _dbProperties->query(&propertiesQuery[0], numDBProperties, &quadPtsGlobal[index], spaceDim, cs);
-      if (err) {
-	std::ostringstream msg;
-	msg << "Could not find parameters for physical properties at " << "(";
-	for (int i=0; i < spaceDim; ++i)
-	  msg << "  " << quadPtsGlobal[index+i];
-	msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
-	throw std::runtime_error(msg.str());
+    assert(quadPtsNonDim.size() == size_t(quadPtsFiberDim));
+    for (int i=0; i < quadPtsFiberDim; ++i) {
+      quadPtsMaterialCells[c*quadPtsFiberDim+i] = quadPtsNonDim[i];
+    } // for
+  } // for
+
+  assert(_normalizer);
+  query->points(quadPtsMaterialCells, spaceDim, _normalizer->lengthScale());
+
+  PYLITH_METHOD_END;
+} // _setupQuery
+
+// ----------------------------------------------------------------------
+// Create field over material cells from values at quadrature points.
+void
+pylith::materials::Material::_createCompactField(topology::Field* field,
+						 scalar_array* materialValues,
+						 const scalar_array& values,
+						 const int numValuesQuadPt)
+{ // _createCompactField
+  PYLITH_METHOD_BEGIN;
+
+  assert(field);
+  assert(materialValues);
+  assert(_materialIS);
+  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = _materialIS->points();
+
+  const int numQuadPts = _numQuadPts;
+  const int fiberDim = numQuadPts * numValuesQuadPt;
+  assert(values.size() == size_t(numCells*fiberDim));
+
+  // Determine storage for each cell. Values are compared exactly, so
+  // compact storage never changes the values retrieved for a cell.
+  int_array cellsDof(fiberDim, numCells);
+  bool isUniformMaterial = _compactStorage && numCells > 0;
+  if (_compactStorage) {
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const int coff = c*fiberDim;
+      bool isUniformCell = true;
+      for (int iQuad=1; iQuad < numQuadPts && isUniformCell; ++iQuad) {
+	for (int i=0; i < numValuesQuadPt; ++i) {
+	  if (values[coff+iQuad*numValuesQuadPt+i] != values[coff+i]) {
+	    isUniformCell = false;
+	    break;
+	  } // if
+	} // for
+      } // for
+      if (!isUniformCell) {
+	isUniformMaterial = false;
+	continue;
       } // if
-      _dbToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], propertiesQuery);
-      _nondimProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
-
-      if (_dbInitialState) {
-	err = _dbInitialState->query(&stateVarsQuery[0], numDBStateVars, &quadPtsGlobal[index], spaceDim, cs);
-	if (err) {
-	  std::ostringstream msg;
-	  msg << "Could not find initial state variables at \n" << "(";
-	  for (int i=0; i < spaceDim; ++i)
-	    msg << "  " << quadPtsGlobal[index+i];
-	  msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
-	  throw std::runtime_error(msg.str());
+      cellsDof[c] = numValuesQuadPt;
+      for (int i=0; i < numValuesQuadPt && isUniformMaterial; ++i) {
+	if (values[coff+i] != values[i]) {
+	  isUniformMaterial = false;
 	} // if
-	_dbToStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], stateVarsQuery);
-	_nondimStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], _numVarsQuadPt);
-      } // if
+      } // for
+    } // for
+  } // if
 
+  if (isUniformMaterial) {
+    materialValues->resize(numValuesQuadPt);
+    for (int i=0; i < numValuesQuadPt; ++i) {
+      (*materialValues)[i] = values[i];
     } // for
-    // Insert cell contribution into fields
-    const PetscInt off = propertiesVisitor.sectionOffset(cell);
-    assert(propsFiberDim == propertiesVisitor.sectionDof(cell));
-    for(PetscInt d = 0; d < propsFiberDim; ++d) {
-      propertiesArray[off+d] = propertiesCell[d];
+    cellsDof = 0;
+  } else {
+    materialValues->resize(0);
+  } // if/else
+
+  field->newSection(cells, numCells, fiberDim);
+  if (_compactStorage) {
+    PetscSection fieldSection = field->localSection();assert(fieldSection);
+    PetscErrorCode err = 0;
+    for (PetscInt c = 0; c < numCells; ++c) {
+      err = PetscSectionSetDof(fieldSection, cells[c], cellsDof[c]);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // if
+  field->allocate();
+  field->zeroAll();
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    const PetscInt off = fieldVisitor.sectionOffset(cell);
+    const PetscInt dof = cellsDof[c];
+    assert(dof == fieldVisitor.sectionDof(cell));
+    for (PetscInt d = 0; d < dof; ++d) {
+      fieldArray[off+d] = values[c*fiberDim+d];
     } // for
-    if (_dbInitialState) {
-      assert(stateVarsVisitor);
-      assert(stateVarsArray);
-      const PetscInt off = stateVarsVisitor->sectionOffset(cell);
-      assert(stateVarsFiberDim == stateVarsVisitor->sectionDof(cell));
-      for(PetscInt d = 0; d < stateVarsFiberDim; ++d) {
-        stateVarsArray[off+d] = stateVarsCell[d];
-      } // for
-    } // if
   } // for
-  delete stateVarsVisitor; stateVarsVisitor = 0;
 
-  // Close databases
-  _dbProperties->close();
-  if (_dbInitialState)
-    _dbInitialState->close();
+  PYLITH_METHOD_END;
+} // _createCompactField
+
+// ----------------------------------------------------------------------
+// Move values of state variables to single precision storage.
+void
+pylith::materials::Material::_reduceStateVars(void)
+{ // _reduceStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(_stateVars);
+
+  PetscVec stateVarsVec = _stateVars->localVector();assert(stateVarsVec);
+  PetscInt size = 0;
+  const PetscScalar* stateVarsArray = NULL;
+  PetscErrorCode err;
+  err = VecGetLocalSize(stateVarsVec, &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(stateVarsVec, &stateVarsArray);PYLITH_CHECK_ERROR(err);
+  _stateVarsReduced.resize(size);
+  for (PetscInt i=0; i < size; ++i) {
+    _stateVarsReduced[i] = float(stateVarsArray[i]);
+  } // for
+  err = VecRestoreArrayRead(stateVarsVec, &stateVarsArray);PYLITH_CHECK_ERROR(err);
+
+  _stateVars->clear();
 
   PYLITH_METHOD_END;
-} // initialize
+} // _reduceStateVars
+
+// ----------------------------------------------------------------------
+// Set values of state variables field from single precision storage.
+void
+pylith::materials::Material::_expandStateVars(void) const
+{ // _expandStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(_stateVars);
+
+  _stateVars->allocate();
+  PetscVec stateVarsVec = _stateVars->localVector();assert(stateVarsVec);
+  PetscInt size = 0;
+  PetscScalar* stateVarsArray = NULL;
+  PetscErrorCode err;
+  err = VecGetLocalSize(stateVarsVec, &size);PYLITH_CHECK_ERROR(err);
+  assert(size_t(size) == _stateVarsReduced.size());
+  err = VecGetArray(stateVarsVec, &stateVarsArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < size; ++i) {
+    stateVarsArray[i] = _stateVarsReduced[i];
+  } // for
+  err = VecRestoreArray(stateVarsVec, &stateVarsArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _expandStateVars
+
+// ----------------------------------------------------------------------
+// Get offset of cell in single precision storage of state variables.
+PetscInt
+pylith::materials::Material::_stateVarsReducedOffset(const PetscInt cell) const
+{ // _stateVarsReducedOffset
+  assert(_stateVars);
+  PetscSection stateVarsSection = _stateVars->localSection();assert(stateVarsSection);
+  PetscInt off = 0;
+  PetscErrorCode err = PetscSectionGetOffset(stateVarsSection, cell, &off);PYLITH_CHECK_ERROR(err);
+  assert(size_t(off) < _stateVarsReduced.size());
+
+  return off;
+} // _stateVarsReducedOffset
 
 // ----------------------------------------------------------------------
 // Get the properties field.
@@ -350,17 +528,9 @@ pylith::materials::Material::getField(topology::Field *field,
     topology::VecVisitorMesh propertiesVisitor(*_properties);
     PetscScalar* propertiesArray = propertiesVisitor.localArray();
 
-    // Get properties section
-    PetscInt totalPropsFiberDimLocal = 0;
-    PetscInt totalPropsFiberDim = 0;
-    if (numCells > 0) {
-      totalPropsFiberDimLocal = propertiesVisitor.sectionDof(cells[0]);
-    } // if
-    MPI_Allreduce((void *) &totalPropsFiberDimLocal, (void *) &totalPropsFiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
-    assert(totalPropsFiberDim > 0);
     const int numPropsQuadPt = _numPropsQuadPt;
-    const int numQuadPts = totalPropsFiberDim / numPropsQuadPt;
-    assert(totalPropsFiberDim == numQuadPts * numPropsQuadPt);
+    const int numQuadPts = _numQuadPts;
+    assert(numQuadPts > 0);
     const int totalFiberDim = numQuadPts * fiberDim;
 
     // Allocate buffer for property field if necessary.
@@ -387,21 +557,21 @@ pylith::materials::Material::getField(topology::Field *field,
     topology::VecVisitorMesh fieldVisitor(*field);
     PetscScalar* fieldArray = fieldVisitor.localArray();
 
-    // Buffer for property at cell's quadrature points
-    scalar_array propertiesCell(numPropsQuadPt);
+    // Buffer for properties at cell's quadrature points
+    scalar_array propertiesCell(numQuadPts*numPropsQuadPt);
 
     // Loop over cells
     for(PetscInt c = 0; c < numCells; ++c) {
       const PetscInt cell = cells[c];
 
       const PetscInt poff = propertiesVisitor.sectionOffset(cell);
+      const PetscInt pdof = propertiesVisitor.sectionDof(cell);
+      _retrieveCompactValues(&propertiesCell[0], numQuadPts, numPropsQuadPt, propertiesArray, poff, pdof, _propertiesMaterial);
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-        for (int i=0; i < numPropsQuadPt; ++i)
-          propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
-        _dimProperties(&propertiesCell[0], numPropsQuadPt);
+        _dimProperties(&propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt);
         for (int i=0; i < fiberDim; ++i)
-          fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
+          fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[iQuad*numPropsQuadPt+propOffset+i];
       } // for
     } // for
   } else { // field is a state variable
@@ -414,6 +584,9 @@ pylith::materials::Material::getField(topology::Field *field,
     const int fiberDim = _metadata.getStateVar(stateVarIndex).fiberDim;
 
     // Get state variables
+    if (_reducedPrecision) {
+      _expandStateVars();
+    } // if
     topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
     PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
 
@@ -472,6 +645,9 @@ pylith::materials::Material::getField(topology::Field *field,
       } // for
     } // for
   } // if/else
+  if (_reducedPrecision && stateVarIndex >= 0) {
+    _stateVars->clear();
+  } // if
 
   topology::FieldBase::VectorFieldEnum multiType = topology::FieldBase::MULTI_OTHER;
   switch (fieldType)
@@ -29,11 +29,14 @@
 
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/utils/utilsfwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 
 #include "Metadata.hh" // HASA Metadata
 
+#include "pylith/utils/array.hh" // HASA scalar_array
+
 #include <string> // HASA std::string
 
 // Material -------------------------------------------------------------
@@ -130,6 +133,42 @@ public :
    */
   void normalizer(const spatialdata::units::Nondimensional& dim);
 
+  /** Set flag for compact storage of physical properties.
+   *
+   * With compact storage, values that are uniform over a cell are
+   * stored once per cell and values that are uniform over all cells
+   * of the material are stored once per material.
+   *
+   * @param flag True to use compact storage, false to store values
+   * at every quadrature point.
+   */
+  void compactStorage(const bool flag);
+
+  /** Get flag for compact storage of physical properties.
+   *
+   * @returns True if using compact storage, false otherwise.
+   */
+  bool compactStorage(void) const;
+
+  /** Set flag for storing state variables in single precision.
+   *
+   * With reduced precision, the state variables are held in a single
+   * precision array after initialization and are converted to double
+   * precision when retrieved for a cell. The state variables field
+   * keeps its layout but only holds values while it is being output.
+   *
+   * @param flag True to store state variables in single precision,
+   * false to store them in double precision.
+   */
+  void reducedPrecision(const bool flag);
+
+  /** Get flag for storing state variables in single precision.
+   *
+   * @returns True if storing state variables in single precision,
+   * false otherwise.
+   */
+  bool reducedPrecision(void) const;
+
   /** Initialize material by getting physical property parameters from
    * database.
    *
@@ -205,6 +244,9 @@ public :
   const topology::Field* propertiesField() const;
 
   /** Get the field with all of the state variables.
+   *
+   * @note With reduced precision storage the field holds the layout
+   * of the state variables but not their values.
    *
    * @returns State variables field.
    */
@@ -269,6 +311,76 @@ protected :
   void _dimStateVars(PylithScalar* const values,
 			const int nvalues) const;
 
+  /** Setup batch query of spatial databases at the quadrature points
+   * of the material cells.
+   *
+   * @pre Must call initialize() to setup the material cells.
+   *
+   * @param query Batch query for quadrature points.
+   * @param mesh Finite-element mesh.
+   * @param quadrature Quadrature for finite-element integration.
+   */
+  void _setupQuery(utils::BatchQuery* query,
+		   const topology::Mesh& mesh,
+		   feassemble::Quadrature* quadrature);
+
+  /** Create field over material cells from values at quadrature
+   * points, using compact storage if enabled.
+   *
+   * The fiber dimension of each cell gives its layout:
+   * numQuadPts*numValuesQuadPt (values at quadrature points),
+   * numValuesQuadPt (values uniform over cell), or 0 (values uniform
+   * over material and stored in materialValues).
+   *
+   * @param field Field to create.
+   * @param materialValues Array for values uniform over material.
+   * @param values Values at quadrature points of material cells
+   *   [numCells][numQuadPts][numValuesQuadPt].
+   * @param numValuesQuadPt Number of values per quadrature point.
+   */
+  void _createCompactField(topology::Field* field,
+			   scalar_array* materialValues,
+			   const scalar_array& values,
+			   const int numValuesQuadPt);
+
+  /** Move values of state variables from field to single precision
+   * storage. The vectors of the state variables field are destroyed.
+   */
+  void _reduceStateVars(void);
+
+  /** Allocate vectors of state variables field and set values from
+   * single precision storage.
+   */
+  void _expandStateVars(void) const;
+
+  /** Get offset of cell in single precision storage of state
+   * variables.
+   *
+   * @param cell Finite-element cell.
+   * @returns Offset of values for cell.
+   */
+  PetscInt _stateVarsReducedOffset(const PetscInt cell) const;
+
+  /** Get values at quadrature points for a cell in a field created
+   * with _createCompactField().
+   *
+   * @param valuesCell Array for values at quadrature points [numQuadPts*numValuesQuadPt].
+   * @param numQuadPts Number of quadrature points.
+   * @param numValuesQuadPt Number of values per quadrature point.
+   * @param fieldArray Local array for field.
+   * @param off Offset of cell in field array.
+   * @param dof Fiber dimension of cell in field.
+   * @param materialValues Values uniform over material.
+   */
+  static
+  void _retrieveCompactValues(PylithScalar* const valuesCell,
+			      const int numQuadPts,
+			      const int numValuesQuadPt,
+			      const PetscScalar* fieldArray,
+			      const PetscInt off,
+			      const PetscInt dof,
+			      const scalar_array& materialValues);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -280,16 +392,25 @@ protected :
   /// Field containing the state variables for the material.
   topology::Field *_stateVars;
 
+  /// Physical properties uniform over material (compact storage).
+  scalar_array _propertiesMaterial;
+
+  /// State variables in single precision (reduced precision storage).
+  float_array _stateVarsReduced;
+
   spatialdata::units::Nondimensional* _normalizer; ///< Nondimensionalizer
   
   topology::StratumIS* _materialIS; ///< Index set for material cells.
 
+  int _numQuadPts; ///< Number of quadrature points.
   int _numPropsQuadPt; ///< Number of properties per quad point.
   int _numVarsQuadPt; ///< Number of state variables per quad point.
   const int _dimension; ///< Spatial dimension associated with material.
   const int _tensorSize; ///< Tensor size for material.
   bool _needNewJacobian; ///< True if need to reform Jacobian, false otherwise.
   bool _isJacobianSymmetric; ///< True if Jacobian is symmetric;
+  bool _compactStorage; ///< True if using compact storage of properties.
+  bool _reducedPrecision; ///< True if state variables are stored in single precision.
 
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
@@ -88,6 +88,9 @@ namespace pylith {
 				   "viscous-strain-xz",
       };
 
+      /// Number of coefficients that depend on the time step.
+      const int numTimeStepCoefs = 2;
+
     } // _MaxwellIsotropic3D
   } // materials
 } // pylith
@@ -147,6 +150,7 @@ pylith::materials::MaxwellIsotropic3D::MaxwellIsotropic3D(void) :
   _updateStateVarsFn(0)
 { // constructor
   useElasticBehavior(false);
+  _numCoefsQuadPt = _MaxwellIsotropic3D::numTimeStepCoefs;
   _viscousStrain.resize(_tensorSize);
 } // constructor
 
@@ -567,12 +571,14 @@ pylith::materials::MaxwellIsotropic3D::_calcElasticConstsViscoelastic(
 
   const PylithScalar mu = properties[p_mu];
   const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  PylithScalar coefsWork[_MaxwellIsotropic3D::numTimeStepCoefs];
+  const PylithScalar* coefs = 
+    _getTimeStepCoefs(coefsWork, _MaxwellIsotropic3D::numTimeStepCoefs, properties, numProperties);
+  const PylithScalar dq = coefs[0];
 
   const PylithScalar visFac = mu * dq / 3.0;
 
@@ -752,6 +758,28 @@ pylith::materials::MaxwellIsotropic3D::_stableTimeStepExplicit(const PylithScala
   return dtStable;
 } // _stableTimeStepExplicit
 
+// ----------------------------------------------------------------------
+// Compute coefficients that depend only on the time step and physical
+// properties.
+void
+pylith::materials::MaxwellIsotropic3D::_calcTimeStepCoefs(PylithScalar* const coefs,
+							  const int numCoefs,
+							  const PylithScalar* properties,
+							  const int numProperties) const
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_MaxwellIsotropic3D::numTimeStepCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const PylithScalar maxwellTime = properties[p_maxwellTime];
+
+  coefs[0] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  coefs[1] = exp(-_dt/maxwellTime);
+
+  PetscLogFlops(2);
+} // _calcTimeStepCoefs
+
 
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
@@ -780,7 +808,6 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
   assert(_MaxwellIsotropic3D::tensorSize == initialStrainSize);
 
   const int tensorSize = _tensorSize;
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   // :TODO: Need to account for initial values for state variables
   // and the initial strain??
@@ -799,8 +826,11 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
       stateVars[s_totalStrain+2] ) / 3.0;
   
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  PylithScalar coefsWork[_MaxwellIsotropic3D::numTimeStepCoefs];
+  const PylithScalar* coefs = 
+    _getTimeStepCoefs(coefsWork, _MaxwellIsotropic3D::numTimeStepCoefs, properties, numProperties);
+  const PylithScalar dq = coefs[0];
+  const PylithScalar expFac = coefs[1];
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
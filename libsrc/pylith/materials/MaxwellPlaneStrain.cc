@@ -85,6 +85,9 @@ namespace pylith {
 				    "viscous-strain-zz",
 				    "viscous-strain-xy" };
 
+      /// Number of coefficients that depend on the time step.
+      const int numTimeStepCoefs = 2;
+
     } // _MaxwellPlaneStrain
   } // materials
 } // pylith
@@ -150,6 +153,7 @@ pylith::materials::MaxwellPlaneStrain::MaxwellPlaneStrain(void) :
   _updateStateVarsFn(0)
 { // constructor
   useElasticBehavior(false);
+  _numCoefsQuadPt = _MaxwellPlaneStrain::numTimeStepCoefs;
   _viscousStrain.resize(4);
 } // constructor
 
@@ -563,12 +567,14 @@ pylith::materials::MaxwellPlaneStrain::_calcElasticConstsViscoelastic(
  
   const PylithScalar mu = properties[p_mu];
   const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  PylithScalar coefsWork[_MaxwellPlaneStrain::numTimeStepCoefs];
+  const PylithScalar* coefs = 
+    _getTimeStepCoefs(coefsWork, _MaxwellPlaneStrain::numTimeStepCoefs, properties, numProperties);
+  const PylithScalar dq = coefs[0];
 
   const PylithScalar visFac = mu * dq / 3.0;
   elasticConsts[ 0] = bulkModulus + 4.0 * visFac; // C1111
@@ -721,6 +727,28 @@ pylith::materials::MaxwellPlaneStrain::_stableTimeStepExplicit(const PylithScala
   return dtStable;
 } // _stableTimeStepExplicit
 
+// ----------------------------------------------------------------------
+// Compute coefficients that depend only on the time step and physical
+// properties.
+void
+pylith::materials::MaxwellPlaneStrain::_calcTimeStepCoefs(PylithScalar* const coefs,
+							  const int numCoefs,
+							  const PylithScalar* properties,
+							  const int numProperties) const
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_MaxwellPlaneStrain::numTimeStepCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const PylithScalar maxwellTime = properties[p_maxwellTime];
+
+  coefs[0] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  coefs[1] = exp(-_dt/maxwellTime);
+
+  PetscLogFlops(2);
+} // _calcTimeStepCoefs
+
 
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
@@ -748,8 +776,6 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   assert(initialStrain);
   assert(_MaxwellPlaneStrain::tensorSize == initialStrainSize);
 
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
-
   const PylithScalar strainTpdt[4] = {
     totalStrain[0],
     totalStrain[1],
@@ -769,8 +795,11 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0 };
 
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  PylithScalar coefsWork[_MaxwellPlaneStrain::numTimeStepCoefs];
+  const PylithScalar* coefs = 
+    _getTimeStepCoefs(coefsWork, _MaxwellPlaneStrain::numTimeStepCoefs, properties, numProperties);
+  const PylithScalar dq = coefs[0];
+  const PylithScalar expFac = coefs[1];
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
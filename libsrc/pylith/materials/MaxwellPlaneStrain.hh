@@ -247,6 +247,19 @@ protected :
 				       const PylithScalar* stateVars,
 				       const int numStateVars,
 				       const double minCellWidth) const;
+
+  /** Compute coefficients at location that depend only on the
+   * current time step and the physical properties.
+   *
+   * @param coefs Array for coefficients at location [dq, expFac].
+   * @param numCoefs Number of coefficients.
+   * @param properties Properties at location.
+   * @param numProperties Number of properties.
+   */
+  void _calcTimeStepCoefs(PylithScalar* const coefs,
+			  const int numCoefs,
+			  const PylithScalar* properties,
+			  const int numProperties) const;
   
   // PRIVATE TYPEDEFS ///////////////////////////////////////////////////
 private :
@@ -0,0 +1,400 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "AsciiTokenizer.hh" // implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <sys/mman.h> // USES mmap(), munmap()
+#include <sys/stat.h> // USES fstat()
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES read(), close()
+#include <strings.h> // USES strncasecmp()
+#include <cstdlib> // USES strtod()
+#include <climits> // USES INT_MAX
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _AsciiTokenizer {
+      /// Powers of 10 that are exactly representable as doubles.
+      static const double exactPowers10[] = {
+	1.0e+0, 1.0e+1, 1.0e+2, 1.0e+3, 1.0e+4, 1.0e+5, 1.0e+6, 1.0e+7,
+	1.0e+8, 1.0e+9, 1.0e+10, 1.0e+11, 1.0e+12, 1.0e+13, 1.0e+14, 1.0e+15,
+	1.0e+16, 1.0e+17, 1.0e+18, 1.0e+19, 1.0e+20, 1.0e+21, 1.0e+22,
+      };
+      static const int maxExactPower10 = 22;
+
+      /// Largest integer that is exactly representable as a double (2**53).
+      static const unsigned long long maxExactMantissa = 9007199254740992ULL;
+
+      /// Maximum number of digits accumulated in mantissa.
+      static const int maxMantissaDigits = 19;
+    } // _AsciiTokenizer
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::AsciiTokenizer::AsciiTokenizer(void) :
+  _filename(""),
+  _begin(0),
+  _end(0),
+  _pos(0),
+  _mapping(0),
+  _mappingSize(0),
+  _buffer(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::AsciiTokenizer::~AsciiTokenizer(void)
+{ // destructor
+  close();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Open file.
+void
+pylith::meshio::AsciiTokenizer::open(const char* filename)
+{ // open
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+
+  close();
+  _filename = filename;
+
+  const int fd = ::open(filename, O_RDONLY);
+  struct stat fileinfo;
+  if (fd < 0 || fstat(fd, &fileinfo) < 0) {
+    if (fd >= 0)
+      ::close(fd);
+    std::ostringstream msg;
+    msg << "Could not open file '" << filename << "' for reading.";
+    throw std::runtime_error(msg.str());
+  } // if
+  const size_t fileSize = fileinfo.st_size;
+
+  if (fileSize > 0) {
+    void* mapping = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED != mapping) {
+      _mapping = mapping;
+      _mappingSize = fileSize;
+      _begin = (const char*) mapping;
+#if defined(MADV_SEQUENTIAL)
+      madvise(mapping, fileSize, MADV_SEQUENTIAL);
+#endif
+    } else {
+      // Fall back to reading file into buffer.
+      _buffer = new char[fileSize];
+      size_t numRead = 0;
+      while (numRead < fileSize) {
+	const ssize_t count = ::read(fd, _buffer+numRead, fileSize-numRead);
+	if (count <= 0) {
+	  ::close(fd);
+	  delete[] _buffer; _buffer = 0;
+	  std::ostringstream msg;
+	  msg << "Error while reading file '" << filename << "'.";
+	  throw std::runtime_error(msg.str());
+	} // if
+	numRead += count;
+      } // while
+      _begin = _buffer;
+    } // if/else
+  } // if
+  ::close(fd);
+
+  _end = _begin + fileSize;
+  _pos = _begin;
+
+  PYLITH_METHOD_END;
+} // open
+
+// ----------------------------------------------------------------------
+// Close file.
+void
+pylith::meshio::AsciiTokenizer::close(void)
+{ // close
+  if (_mapping) {
+    munmap(_mapping, _mappingSize);
+    _mapping = 0;
+    _mappingSize = 0;
+  } // if
+  delete[] _buffer; _buffer = 0;
+  _begin = 0;
+  _end = 0;
+  _pos = 0;
+} // close
+
+// ----------------------------------------------------------------------
+// Get size of file.
+size_t
+pylith::meshio::AsciiTokenizer::size(void) const
+{ // size
+  return _end - _begin;
+} // size
+
+// ----------------------------------------------------------------------
+// Get current position in file.
+size_t
+pylith::meshio::AsciiTokenizer::position(void) const
+{ // position
+  return _pos - _begin;
+} // position
+
+// ----------------------------------------------------------------------
+// Get next token.
+bool
+pylith::meshio::AsciiTokenizer::next(std::string* token)
+{ // next
+  assert(token);
+
+  _skipWhitespace();
+  if (_pos >= _end) {
+    token->clear();
+    return false;
+  } // if
+
+  const char* start = _pos;
+  if ('=' == *_pos || '{' == *_pos || '}' == *_pos) {
+    ++_pos;
+  } else {
+    while (_pos < _end && !_isDelimiter(_pos))
+      ++_pos;
+  } // if/else
+  token->assign(start, _pos - start);
+
+  return true;
+} // next
+
+// ----------------------------------------------------------------------
+// Read next token and check that it matches the expected token.
+void
+pylith::meshio::AsciiTokenizer::expect(const char* token)
+{ // expect
+  assert(token);
+
+  std::string value;
+  if (!next(&value) || strcasecmp(value.c_str(), token)) {
+    std::ostringstream msg;
+    msg << "Expected '" << token << "' but encountered '" << value << "'.";
+    error(msg.str());
+  } // if
+} // expect
+
+// ----------------------------------------------------------------------
+// Read remainder of current line.
+std::string
+pylith::meshio::AsciiTokenizer::restOfLine(void)
+{ // restOfLine
+  while (_pos < _end && (' ' == *_pos || '\t' == *_pos))
+    ++_pos;
+  const char* start = _pos;
+  while (_pos < _end && '\n' != *_pos && '\r' != *_pos &&
+	 !('/' == *_pos && _pos+1 < _end && '/' == *(_pos+1)))
+    ++_pos;
+  const char* end = _pos;
+  while (end > start && (' ' == *(end-1) || '\t' == *(end-1)))
+    --end;
+
+  return std::string(start, end - start);
+} // restOfLine
+
+// ----------------------------------------------------------------------
+// Read integer.
+int
+pylith::meshio::AsciiTokenizer::readInt(void)
+{ // readInt
+  _skipWhitespace();
+
+  const char* p = _pos;
+  bool negative = false;
+  if (p < _end && ('-' == *p || '+' == *p)) {
+    negative = '-' == *p;
+    ++p;
+  } // if
+  const char* digits = p;
+  long value = 0;
+  for (; p < _end && *p >= '0' && *p <= '9'; ++p) {
+    value = 10*value + (*p - '0');
+    if (value > INT_MAX)
+      error("Integer value is out of range.");
+  } // for
+  if (p == digits || (p < _end && !_isDelimiter(p))) {
+    const char* end = p;
+    while (end < _end && !_isDelimiter(end))
+      ++end;
+    std::ostringstream msg;
+    msg << "Could not parse '" << std::string(_pos, end - _pos) << "' into an integer.";
+    error(msg.str());
+  } // if
+  _pos = p;
+
+  return negative ? -int(value) : int(value);
+} // readInt
+
+// ----------------------------------------------------------------------
+// Read floating point number.
+PylithScalar
+pylith::meshio::AsciiTokenizer::readScalar(void)
+{ // readScalar
+  using namespace _AsciiTokenizer;
+
+  _skipWhitespace();
+
+  // Accumulate up to maxMantissaDigits significant digits in an
+  // integer mantissa and track the decimal exponent. If the mantissa
+  // and power of 10 are exactly representable as doubles, a single
+  // multiplication or division gives the correctly rounded
+  // value. Otherwise, fall back to strtod().
+  const char* p = _pos;
+  bool negative = false;
+  if (p < _end && ('-' == *p || '+' == *p)) {
+    negative = '-' == *p;
+    ++p;
+  } // if
+  unsigned long long mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool haveDigits = false;
+  bool exact = true;
+  for (; p < _end && *p >= '0' && *p <= '9'; ++p) {
+    haveDigits = true;
+    if (numDigits < maxMantissaDigits) {
+      mantissa = 10*mantissa + (*p - '0');
+      if (mantissa > 0)
+	++numDigits;
+    } else {
+      ++exponent;
+      exact = false;
+    } // if/else
+  } // for
+  if (p < _end && '.' == *p) {
+    ++p;
+    for (; p < _end && *p >= '0' && *p <= '9'; ++p) {
+      haveDigits = true;
+      if (numDigits < maxMantissaDigits) {
+	mantissa = 10*mantissa + (*p - '0');
+	if (mantissa > 0)
+	  ++numDigits;
+	--exponent;
+      } else if ('0' != *p) {
+	exact = false;
+      } // if/else
+    } // for
+  } // if
+  if (haveDigits && p < _end && ('e' == *p || 'E' == *p)) {
+    ++p;
+    bool negativeExponent = false;
+    if (p < _end && ('-' == *p || '+' == *p)) {
+      negativeExponent = '-' == *p;
+      ++p;
+    } // if
+    const char* exponentDigits = p;
+    int value = 0;
+    for (; p < _end && *p >= '0' && *p <= '9'; ++p) {
+      if (value < 100000)
+	value = 10*value + (*p - '0');
+    } // for
+    if (p == exponentDigits)
+      haveDigits = false;
+    exponent += negativeExponent ? -value : value;
+  } // if
+  if (!haveDigits || (p < _end && !_isDelimiter(p))) {
+    const char* end = p;
+    while (end < _end && !_isDelimiter(end))
+      ++end;
+    std::ostringstream msg;
+    msg << "Could not parse '" << std::string(_pos, end - _pos) << "' into a floating point number.";
+    error(msg.str());
+  } // if
+
+  double value = 0.0;
+  if (0 == mantissa) {
+    value = 0.0;
+  } else if (exact && mantissa <= maxExactMantissa && exponent >= -maxExactPower10 && exponent <= maxExactPower10) {
+    value = double(mantissa);
+    if (exponent >= 0)
+      value *= exactPowers10[exponent];
+    else
+      value /= exactPowers10[-exponent];
+    if (negative)
+      value = -value;
+  } else {
+    const std::string number(_pos, p - _pos);
+    value = strtod(number.c_str(), 0);
+  } // if/else
+  _pos = p;
+
+  return negative && 0.0 == value ? -0.0 : PylithScalar(value);
+} // readScalar
+
+// ----------------------------------------------------------------------
+// Throw exception with current line number appended to message.
+void
+pylith::meshio::AsciiTokenizer::error(const std::string& msg) const
+{ // error
+  int lineNumber = 1;
+  for (const char* p=_begin; p < _pos; ++p)
+    if ('\n' == *p)
+      ++lineNumber;
+
+  std::ostringstream fullMsg;
+  fullMsg << msg << "\nLine " << lineNumber << " in file '" << _filename << "'.";
+  throw std::runtime_error(fullMsg.str());
+} // error
+
+// ----------------------------------------------------------------------
+// Skip whitespace and comments.
+void
+pylith::meshio::AsciiTokenizer::_skipWhitespace(void)
+{ // _skipWhitespace
+  while (_pos < _end) {
+    const char c = *_pos;
+    if (' ' == c || '\t' == c || '\n' == c || '\r' == c) {
+      ++_pos;
+    } else if ('/' == c && _pos+1 < _end && '/' == *(_pos+1)) {
+      while (_pos < _end && '\n' != *_pos)
+	++_pos;
+    } else {
+      break;
+    } // if/else
+  } // while
+} // _skipWhitespace
+
+// ----------------------------------------------------------------------
+// Check whether character ends a number or token.
+bool
+pylith::meshio::AsciiTokenizer::_isDelimiter(const char* p) const
+{ // _isDelimiter
+  assert(p < _end);
+  const char c = *p;
+  return ' ' == c || '\t' == c || '\n' == c || '\r' == c ||
+    '=' == c || '{' == c || '}' == c ||
+    ('/' == c && p+1 < _end && '/' == *(p+1));
+} // _isDelimiter
+
+
+// End of file
@@ -0,0 +1,153 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/AsciiTokenizer.hh
+ *
+ * @brief C++ object for reading tokens and numbers from an ASCII file.
+ *
+ * The file is mapped into memory and parsed in place, so values are
+ * converted directly into the destination arrays without going
+ * through lines or string streams. Tokens are separated by
+ * whitespace; '=', '{', and '}' are always single character
+ * tokens. Comments begin with '//' and continue to the end of the
+ * line.
+ */
+
+#if !defined(pylith_meshio_asciitokenizer_hh)
+#define pylith_meshio_asciitokenizer_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <string> // USES std::string
+#include <cstddef> // USES size_t
+
+// AsciiTokenizer -------------------------------------------------------
+/// Read tokens and numbers from a memory mapped ASCII file.
+class pylith::meshio::AsciiTokenizer
+{ // AsciiTokenizer
+  friend class TestAsciiTokenizer; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  AsciiTokenizer(void);
+
+  /// Destructor
+  ~AsciiTokenizer(void);
+
+  /** Open file.
+   *
+   * @param filename Name of file.
+   */
+  void open(const char* filename);
+
+  /// Close file.
+  void close(void);
+
+  /** Get size of file.
+   *
+   * @returns Size of file in bytes.
+   */
+  size_t size(void) const;
+
+  /** Get current position in file.
+   *
+   * @returns Number of bytes parsed.
+   */
+  size_t position(void) const;
+
+  /** Get next token.
+   *
+   * @param token Token (empty at end of file).
+   * @returns False if at end of file, true otherwise.
+   */
+  bool next(std::string* token);
+
+  /** Read next token and check that it matches the expected token
+   * (case insensitive).
+   *
+   * @param token Expected token.
+   */
+  void expect(const char* token);
+
+  /** Read remainder of current line, excluding comments and leading
+   * and trailing whitespace.
+   *
+   * @returns Remainder of line.
+   */
+  std::string restOfLine(void);
+
+  /** Read integer.
+   *
+   * @returns Value of integer.
+   */
+  int readInt(void);
+
+  /** Read floating point number.
+   *
+   * @returns Value of number.
+   */
+  PylithScalar readScalar(void);
+
+  /** Throw exception with current line number appended to message.
+   *
+   * @param msg Error message.
+   */
+  void error(const std::string& msg) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Skip whitespace and comments.
+  void _skipWhitespace(void);
+
+  /** Check whether character ends a number or token.
+   *
+   * @param p Pointer to character.
+   * @returns True if character is a delimiter, false otherwise.
+   */
+  bool _isDelimiter(const char* p) const;
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  AsciiTokenizer(const AsciiTokenizer&); ///< Not implemented
+  const AsciiTokenizer& operator=(const AsciiTokenizer&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::string _filename; ///< Name of file.
+  const char* _begin; ///< Beginning of file contents.
+  const char* _end; ///< End of file contents.
+  const char* _pos; ///< Current position in file contents.
+  void* _mapping; ///< Memory mapping of file.
+  size_t _mappingSize; ///< Size of memory mapping.
+  char* _buffer; ///< Buffer with file contents if file can't be mapped.
+
+}; // AsciiTokenizer
+
+#endif // pylith_meshio_asciitokenizer_hh
+
+
+// End of file
@@ -0,0 +1,167 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "CellFilterTemporal.hh" // Implementation of class methods
+
+#include "CellFilterAvg.hh" // USES CellFilterAvg
+
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::CellFilterTemporal::CellFilterTemporal(void) :
+  _filterAvg(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::CellFilterTemporal::~CellFilterTemporal(void)
+{ // destructor
+  deallocate();
+} // destructor  
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::CellFilterTemporal::deallocate(void)
+{ // deallocate
+  CellFilter::deallocate();
+
+  _reduction.deallocate();
+  delete _filterAvg; _filterAvg = 0;
+} // deallocate
+  
+// ----------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::CellFilterTemporal::CellFilterTemporal(const CellFilterTemporal& f) :
+  CellFilter(f),
+  _reduction(f._reduction),
+  _filterAvg(0)
+{ // copy constructor
+} // copy constructor
+
+// ----------------------------------------------------------------------
+// Create copy of filter.
+pylith::meshio::CellFilter*
+pylith::meshio::CellFilterTemporal::clone(void) const
+{ // clone
+  PYLITH_METHOD_BEGIN;
+  
+  pylith::meshio::CellFilter* f = new CellFilterTemporal(*this);
+
+  PYLITH_METHOD_RETURN(f);
+} // clone
+
+// ----------------------------------------------------------------------
+// Set type of reduction.
+void
+pylith::meshio::CellFilterTemporal::reduction(const char* value)
+{ // reduction
+  _reduction.reduction(value);
+} // reduction
+
+// ----------------------------------------------------------------------
+// Set threshold for 'threshold_time' reduction.
+void
+pylith::meshio::CellFilterTemporal::threshold(const PylithScalar value)
+{ // threshold
+  _reduction.threshold(value);
+} // threshold
+
+// ----------------------------------------------------------------------
+// Set time scale used to dimensionalize time for 'threshold_time'.
+void
+pylith::meshio::CellFilterTemporal::timeScale(const PylithScalar value)
+{ // timeScale
+  _reduction.timeScale(value);
+} // timeScale
+
+// ----------------------------------------------------------------------
+// Update reduction with cell field at time t.
+void
+pylith::meshio::CellFilterTemporal::update(const PylithScalar t,
+					   const topology::Field& fieldIn,
+					   const char* label,
+					   const int labelId)
+{ // update
+  PYLITH_METHOD_BEGIN;
+
+  _reduction.update(t, _cellValues(fieldIn, label, labelId));
+
+  PYLITH_METHOD_END;
+} // update
+
+// ----------------------------------------------------------------------
+// Filter field.
+pylith::topology::Field&
+pylith::meshio::CellFilterTemporal::filter(const topology::Field& fieldIn,
+					   const char* label,
+					   const int labelId)
+{ // filter
+  PYLITH_METHOD_BEGIN;
+
+  PYLITH_METHOD_RETURN(_reduction.reduced(_cellValues(fieldIn, label, labelId)));
+} // filter
+
+// ----------------------------------------------------------------------
+// Get number of fields with reductions.
+int
+pylith::meshio::CellFilterTemporal::numReduced(void) const
+{ // numReduced
+  return _reduction.numFields();
+} // numReduced
+
+// ----------------------------------------------------------------------
+// Get reduced field.
+pylith::topology::Field&
+pylith::meshio::CellFilterTemporal::reduced(const int index)
+{ // reduced
+  PYLITH_METHOD_BEGIN;
+
+  PYLITH_METHOD_RETURN(_reduction.reduced(index));
+} // reduced
+
+// ----------------------------------------------------------------------
+// Get values in cells, averaging over quadrature points if quadrature
+// has been set.
+const pylith::topology::Field&
+pylith::meshio::CellFilterTemporal::_cellValues(const topology::Field& fieldIn,
+						const char* label,
+						const int labelId)
+{ // _cellValues
+  PYLITH_METHOD_BEGIN;
+
+  if (!_quadrature) {
+    PYLITH_METHOD_RETURN(fieldIn);
+  } // if
+
+  if (!_filterAvg) {
+    _filterAvg = new CellFilterAvg();assert(_filterAvg);
+    _filterAvg->quadrature(_quadrature);
+  } // if
+
+  PYLITH_METHOD_RETURN(_filterAvg->filter(fieldIn, label, labelId));
+} // _cellValues
+
+
+// End of file
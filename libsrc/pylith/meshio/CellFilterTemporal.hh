@@ -0,0 +1,166 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/CellFilterTemporal.hh
+ *
+ * @brief C++ object for reducing cell fields in time (max, min, mean,
+ * RMS, or time threshold is first exceeded) when outputing
+ * finite-element data.
+ */
+
+#if !defined(pylith_meshio_cellfiltertemporal_hh)
+#define pylith_meshio_cellfiltertemporal_hh
+
+// Include directives ---------------------------------------------------
+#include "CellFilter.hh" // ISA CellFilter
+
+#include "TemporalReduction.hh" // HASA TemporalReduction
+
+// CellFilterTemporal ---------------------------------------------------
+/** @brief C++ object for reducing cell fields in time when outputing
+ * finite-element data.
+ *
+ * If a quadrature is set, values are first averaged over the
+ * quadrature points in each cell (as in CellFilterAvg). The reduction
+ * is updated every time step via update(); filter() returns the
+ * reduction accumulated so far.
+ */
+class pylith::meshio::CellFilterTemporal : public CellFilter
+{ // CellFilterTemporal
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  CellFilterTemporal(void);
+
+  /// Destructor
+  ~CellFilterTemporal(void);
+
+  /** Create copy of filter.
+   *
+   * @returns Copy of filter.
+   */
+  CellFilter* clone(void) const;
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set type of reduction.
+   *
+   * @param value Name of reduction ('max', 'min', 'mean', 'rms', or
+   * 'threshold_time').
+   */
+  void reduction(const char* value);
+
+  /** Set threshold for 'threshold_time' reduction.
+   *
+   * @param value Threshold for magnitude of field (dimensional).
+   */
+  void threshold(const PylithScalar value);
+
+  /** Set time scale used to dimensionalize time for 'threshold_time'.
+   *
+   * @param value Time scale.
+   */
+  void timeScale(const PylithScalar value);
+
+  /** Update reduction with cell field at time t.
+   *
+   * @param t Time associated with field.
+   * @param fieldIn Field with current values.
+   * @param label Label identifying cells.
+   * @param labelId Value of label of cells to filter.
+   */
+  void update(const PylithScalar t,
+	      const topology::Field& fieldIn,
+	      const char* label =0,
+	      const int labelId =0);
+
+  /** Filter field over cells.
+   *
+   * @param fieldIn Field to filter.
+   * @param label Label identifying cells.
+   * @param labelId Value of label of cells to filter.
+   *
+   * @returns Reduced field.
+   */
+  topology::Field&
+  filter(const topology::Field& fieldIn,
+	 const char* label =0,
+	 const int labelId =0);
+
+  /** Get number of fields with reductions.
+   *
+   * @returns Number of fields.
+   */
+  int numReduced(void) const;
+
+  /** Get reduced field.
+   *
+   * @param index Index of field in order of first update.
+   * @returns Reduced field.
+   */
+  topology::Field& reduced(const int index);
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Copy constructor.
+   *
+   * @param f Filter to copy.
+   * @returns Pointer to this.
+   */
+  CellFilterTemporal(const CellFilterTemporal& f);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Get values in cells, averaging over quadrature points if
+   * quadrature has been set.
+   *
+   * @param fieldIn Field over cells.
+   * @param label Label identifying cells.
+   * @param labelId Value of label of cells to filter.
+   *
+   * @returns Field with values in cells.
+   */
+  const topology::Field&
+  _cellValues(const topology::Field& fieldIn,
+	      const char* label,
+	      const int labelId);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  /// Not implemented.
+  const CellFilterTemporal& operator=(const CellFilterTemporal&);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  TemporalReduction _reduction; ///< Reduction of fields over time.
+  CellFilterAvg* _filterAvg; ///< Filter for averaging over quadrature points.
+
+}; // CellFilterTemporal
+
+#endif // pylith_meshio_cellfiltertemporal_hh
+
+
+// End of file 
@@ -44,7 +44,10 @@ extern PetscErrorCode VecView_MPI(Vec, PetscViewer);
 pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(void) :
     _filename("output.h5"),
     _h5(new HDF5),
-    _tstampIndex(0)
+    _tstampIndex(0),
+    _aggregatorStride(0),
+    _groupComm(MPI_COMM_NULL),
+    _aggregatorComm(MPI_COMM_NULL)
 { // constructor
 } // constructor
 
@@ -65,13 +68,13 @@ pylith::meshio::DataWriterHDF5Ext::deallocate(void)
 
     DataWriter::deallocate();
 
-    PetscErrorCode err = 0;
     const dataset_type::const_iterator& dEnd = _datasets.end();
     for (dataset_type::iterator d_iter=_datasets.begin();
          d_iter != dEnd;
          ++d_iter) {
-        err = PetscViewerDestroy(&d_iter->second.viewer); PYLITH_CHECK_ERROR(err);
+        _closeDataset(&d_iter->second);
     } // for
+    _deallocateAggregators();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -82,7 +85,10 @@ pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(const DataWriterHDF5Ext& w)
     DataWriter(w),
     _filename(w._filename),
     _h5(new HDF5),
-    _tstampIndex(0)
+    _tstampIndex(0),
+    _aggregatorStride(w._aggregatorStride),
+    _groupComm(MPI_COMM_NULL),
+    _aggregatorComm(MPI_COMM_NULL)
 { // copy constructor
 } // copy constructor
 
@@ -109,6 +115,7 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
         PetscErrorCode err = PetscObjectGetComm((PetscObject) dmMesh, &comm); PYLITH_CHECK_ERROR(err);
 
         err = MPI_Comm_rank(comm, &commRank); PYLITH_CHECK_ERROR(err);
+        _setupAggregators(comm);
         if (!commRank) {
             _h5->open(hdf5Filename().c_str(), H5F_ACC_TRUNC);
 
@@ -118,7 +125,7 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
         } // if
         _tstampIndex = 0;
 
-        PetscViewer binaryViewer;
+        ExternalDataset meshDataset;
 
         const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
 
@@ -144,17 +151,9 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
         err = VecScale(coordVector, lengthScale); PYLITH_CHECK_ERROR(err);
 
         const std::string& filenameVertices = _datasetFilename("vertices");
-        err = PetscViewerBinaryOpen(comm, filenameVertices.c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
-        err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
-#if 0
-        err = VecView(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err);
-#else
-        PetscBool isseq;
-        err = PetscObjectTypeCompare((PetscObject) coordVector, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
-        if (isseq) {err = VecView_Seq(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-        else       {err = VecView_MPI(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-#endif
-        err = PetscViewerDestroy(&binaryViewer); PYLITH_CHECK_ERROR(err);
+        _openDataset(&meshDataset, filenameVertices.c_str(), comm);
+        _writeDataset(&meshDataset, coordVector);
+        _closeDataset(&meshDataset);
 
         PetscInt vStart, vEnd;
         PetscInt n, numVerticesLocal = 0, numVertices;
@@ -264,17 +263,10 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
         numCells /= numCorners;
 
         const std::string& filenameCells = _datasetFilename("cells");
-        err = PetscViewerBinaryOpen(comm, filenameCells.c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
-        err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
-#if 0
-        err = VecView(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err);
-#else
-        err = PetscObjectTypeCompare((PetscObject) cellVec, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
-        if (isseq) {err = VecView_Seq(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err); }
-        else       {err = VecView_MPI(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err); }
-#endif
+        _openDataset(&meshDataset, filenameCells.c_str(), comm);
+        _writeDataset(&meshDataset, cellVec);
+        _closeDataset(&meshDataset);
         err = VecDestroy(&cellVec); PYLITH_CHECK_ERROR(err);
-        err = PetscViewerDestroy(&binaryViewer); PYLITH_CHECK_ERROR(err);
 
         // Create external dataset for cells
         if (!commRank) {
@@ -342,37 +334,22 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
         field.createScatterWithBC(mesh, "", 0, context);
         field.scatterLocalToGlobal(context);
 
-        PetscViewer binaryViewer;
-
         const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
 
         // Create external dataset if necessary
         bool createdExternalDataset = false;
-        if (_datasets.find(field.label()) != _datasets.end()) {
-            binaryViewer = _datasets[field.label()].viewer;
-        } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(field.label()).c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
-            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
+        if (_datasets.find(field.label()) == _datasets.end()) {
             ExternalDataset dataset;
             dataset.numTimeSteps = 0;
-            dataset.viewer = binaryViewer;
+            _openDataset(&dataset, _datasetFilename(field.label()).c_str(), comm);
             _datasets[field.label()] = dataset;
 
             createdExternalDataset = true;
-        } // else
-        assert(binaryViewer);
+        } // if
+        ExternalDataset& datasetInfo = _datasets[field.label()];
 
         PetscVec vector = field.vector(context); assert(vector);
-#if 0
-        err = VecView(vector, binaryViewer); PYLITH_CHECK_ERROR(err);
-#else
-        PetscBool isseq;
-        err = PetscObjectTypeCompare((PetscObject) vector, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
-        if (isseq) {err = VecView_Seq(vector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-        else       {err = VecView_MPI(vector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-#endif
-
-        ExternalDataset& datasetInfo = _datasets[field.label()];
+        _writeDataset(&datasetInfo, vector);
         ++datasetInfo.numTimeSteps;
 
         // Update time stamp in "/time, if necessary.
@@ -488,37 +465,22 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
         field.createScatterWithBC(field.mesh(), label ? label : "", labelId, context);
         field.scatterLocalToGlobal(context);
 
-        PetscViewer binaryViewer;
-
         const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
 
         // Create external dataset if necessary
         bool createdExternalDataset = false;
-        if (_datasets.find(field.label()) != _datasets.end()) {
-            binaryViewer = _datasets[field.label()].viewer;
-        } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(field.label()).c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
-            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
+        if (_datasets.find(field.label()) == _datasets.end()) {
             ExternalDataset dataset;
             dataset.numTimeSteps = 0;
-            dataset.viewer = binaryViewer;
+            _openDataset(&dataset, _datasetFilename(field.label()).c_str(), comm);
             _datasets[field.label()] = dataset;
 
             createdExternalDataset = true;
-        } // else
-        assert(binaryViewer);
+        } // if
+        ExternalDataset& datasetInfo = _datasets[field.label()];
 
         PetscVec vector = field.vector(context); assert(vector);
-#if 0
-        err = VecView(vector, binaryViewer); PYLITH_CHECK_ERROR(err);
-#else
-        PetscBool isseq;
-        err = PetscObjectTypeCompare((PetscObject) vector, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
-        if (isseq) {err = VecView_Seq(vector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-        else       {err = VecView_MPI(vector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-#endif
-
-        ExternalDataset& datasetInfo = _datasets[field.label()];
+        _writeDataset(&datasetInfo, vector);
         ++datasetInfo.numTimeSteps;
 
         // Update time stamp in "/time, if necessary.
@@ -619,6 +581,180 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
     PYLITH_METHOD_END;
 } // writeCellField
 
+// ----------------------------------------------------------------------
+// Create communicators for I/O aggregation.
+void
+pylith::meshio::DataWriterHDF5Ext::_setupAggregators(const MPI_Comm comm)
+{ // _setupAggregators
+    PYLITH_METHOD_BEGIN;
+
+    _deallocateAggregators();
+    if (_aggregatorStride <= 0) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscMPIInt commRank;
+    PetscErrorCode err = MPI_Comm_rank(comm, &commRank); PYLITH_CHECK_ERROR(err);
+
+    // Consecutive processes share an aggregator, so the data gathered
+    // by an aggregator is contiguous in the global vectors.
+    const int group = commRank / _aggregatorStride;
+    err = MPI_Comm_split(comm, group, commRank, &_groupComm); PYLITH_CHECK_ERROR(err);
+
+    PetscMPIInt groupRank;
+    err = MPI_Comm_rank(_groupComm, &groupRank); PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_split(comm, groupRank ? MPI_UNDEFINED : 0, commRank, &_aggregatorComm); PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupAggregators
+
+// ----------------------------------------------------------------------
+// Free communicators for I/O aggregation.
+void
+pylith::meshio::DataWriterHDF5Ext::_deallocateAggregators(void)
+{ // _deallocateAggregators
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    if (MPI_COMM_NULL != _aggregatorComm) {
+        err = MPI_Comm_free(&_aggregatorComm); PYLITH_CHECK_ERROR(err);
+    } // if
+    if (MPI_COMM_NULL != _groupComm) {
+        err = MPI_Comm_free(&_groupComm); PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _deallocateAggregators
+
+// ----------------------------------------------------------------------
+// Open external raw data file for dataset.
+void
+pylith::meshio::DataWriterHDF5Ext::_openDataset(ExternalDataset* dataset,
+                                                const char* filename,
+                                                const MPI_Comm comm)
+{ // _openDataset
+    PYLITH_METHOD_BEGIN;
+
+    assert(dataset);
+
+    dataset->viewer = NULL;
+    dataset->file = MPI_FILE_NULL;
+    dataset->offset = 0;
+
+    PetscErrorCode err = 0;
+    if (MPI_COMM_NULL == _groupComm) {
+        err = PetscViewerBinaryOpen(comm, filename, FILE_MODE_WRITE, &dataset->viewer); PYLITH_CHECK_ERROR(err);
+        err = PetscViewerBinarySetSkipHeader(dataset->viewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
+    } else if (MPI_COMM_NULL != _aggregatorComm) {
+        err = MPI_File_open(_aggregatorComm, const_cast<char*>(filename), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &dataset->file);
+        if (MPI_SUCCESS != err) {
+            std::ostringstream msg;
+            msg << "Could not open external raw data file '" << filename << "' for writing.";
+            throw std::runtime_error(msg.str());
+        } // if
+        err = MPI_File_set_size(dataset->file, 0); PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // _openDataset
+
+// ----------------------------------------------------------------------
+// Append values of PETSc global vector to external raw data file.
+void
+pylith::meshio::DataWriterHDF5Ext::_writeDataset(ExternalDataset* dataset,
+                                                 const PetscVec vector)
+{ // _writeDataset
+    PYLITH_METHOD_BEGIN;
+
+    assert(dataset);
+    assert(vector);
+
+    PetscErrorCode err = 0;
+    if (MPI_COMM_NULL == _groupComm) {
+        assert(dataset->viewer);
+#if 0
+        err = VecView(vector, dataset->viewer); PYLITH_CHECK_ERROR(err);
+#else
+        PetscBool isseq;
+        err = PetscObjectTypeCompare((PetscObject) vector, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
+        if (isseq) {err = VecView_Seq(vector, dataset->viewer); PYLITH_CHECK_ERROR(err); }
+        else       {err = VecView_MPI(vector, dataset->viewer); PYLITH_CHECK_ERROR(err); }
+#endif
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscInt sizeLocal = 0, size = 0, ownershipStart = 0;
+    err = VecGetLocalSize(vector, &sizeLocal); PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(vector, &size); PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(vector, &ownershipStart, NULL); PYLITH_CHECK_ERROR(err);
+
+    PetscMPIInt groupSize, groupRank;
+    err = MPI_Comm_size(_groupComm, &groupSize); PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_rank(_groupComm, &groupRank); PYLITH_CHECK_ERROR(err);
+
+    // Gather values on aggregator.
+    const int count = sizeLocal;
+    int_array counts;
+    int_array offsets;
+    if (!groupRank) {
+        counts.resize(groupSize);
+        offsets.resize(groupSize);
+    } // if
+    err = MPI_Gather((void*)&count, 1, MPI_INT, groupRank ? NULL : &counts[0], 1, MPI_INT, 0, _groupComm); PYLITH_CHECK_ERROR(err);
+    int numValues = 0;
+    if (!groupRank) {
+        for (int i=0; i < groupSize; ++i) {
+            offsets[i] = numValues;
+            numValues += counts[i];
+        } // for
+    } // if
+    scalar_array values(numValues > 0 ? numValues : 1);
+
+    const PetscScalar* vectorArray = NULL;
+    err = VecGetArrayRead(vector, &vectorArray); PYLITH_CHECK_ERROR(err);
+    err = MPI_Gatherv((void*)vectorArray, count, MPIU_SCALAR, &values[0], groupRank ? NULL : &counts[0], groupRank ? NULL : &offsets[0], MPIU_SCALAR, 0, _groupComm); PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(vector, &vectorArray); PYLITH_CHECK_ERROR(err);
+
+    // Aggregators write their values with a single contiguous write
+    // at the offset of the first process in the group. Raw data files
+    // are big endian to match the PETSc binary viewer.
+    if (MPI_COMM_NULL != _aggregatorComm) {
+        assert(MPI_FILE_NULL != dataset->file);
+#if !defined(PETSC_WORDS_BIGENDIAN)
+        err = PetscByteSwap(&values[0], PETSC_SCALAR, numValues); PYLITH_CHECK_ERROR(err);
+#endif
+        const MPI_Offset offset = dataset->offset + MPI_Offset(ownershipStart)*sizeof(PetscScalar);
+        MPI_Status status;
+        err = MPI_File_write_at_all(dataset->file, offset, &values[0], numValues, MPIU_SCALAR, &status);
+        if (MPI_SUCCESS != err) {
+            throw std::runtime_error("Error while writing values to external raw data file.");
+        } // if
+    } // if
+    dataset->offset += MPI_Offset(size)*sizeof(PetscScalar);
+
+    PYLITH_METHOD_END;
+} // _writeDataset
+
+// ----------------------------------------------------------------------
+// Close external raw data file for dataset.
+void
+pylith::meshio::DataWriterHDF5Ext::_closeDataset(ExternalDataset* dataset)
+{ // _closeDataset
+    PYLITH_METHOD_BEGIN;
+
+    assert(dataset);
+
+    PetscErrorCode err = 0;
+    if (dataset->viewer) {
+        err = PetscViewerDestroy(&dataset->viewer); PYLITH_CHECK_ERROR(err);
+    } // if
+    if (MPI_FILE_NULL != dataset->file) {
+        err = MPI_File_close(&dataset->file); PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _closeDataset
+
 // ----------------------------------------------------------------------
 // Write dataset with names of points to file.
 void
@@ -45,6 +45,8 @@
 // Include directives ---------------------------------------------------
 #include "DataWriter.hh" // ISA DataWriter
 
+#include <mpi.h> // HASA MPI_Comm, MPI_File
+
 #include <string> // USES std::string
 #include <map> // HASA std::map
 
@@ -82,6 +84,18 @@ void deallocate(void);
  */
 void filename(const char* filename);
 
+/** Set number of processes per I/O aggregator.
+ *
+ * If the stride is positive, consecutive groups of processes send
+ * their data for the external raw data files to the first process in
+ * the group (aggregator), and only the aggregators write to the
+ * files using MPI I/O. The layout of the files does not change. If
+ * the stride is zero, all processes write via a PETSc binary viewer.
+ *
+ * @param value Number of processes per aggregator (0 for no aggregation).
+ */
+void aggregatorStride(const int value);
+
 /** Generate filename for HDF5 file.
  *
  * Appends _info if only writing parameters.
@@ -142,6 +156,19 @@ void writeCellField(const PylithScalar t,
 void writePointNames(const pylith::string_vector& names,
                      const topology::Mesh& mesh);
 
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+struct ExternalDataset {
+    PetscViewer viewer; ///< Binary viewer (without aggregation).
+    MPI_File file; ///< MPI file (aggregators only).
+    MPI_Offset offset; ///< Offset in bytes of next write (with aggregation).
+    PetscInt numTimeSteps;
+    PetscInt numPoints;
+    PetscInt fiberDim;
+};
+typedef std::map<std::string, ExternalDataset> dataset_type;
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private:
 
@@ -154,6 +181,39 @@ DataWriterHDF5Ext(const DataWriterHDF5Ext& w);
 /// Generate filename for external dataset file.
 std::string _datasetFilename(const char* field) const;
 
+/** Create communicators for I/O aggregation.
+ *
+ * @param comm MPI communicator for mesh.
+ */
+void _setupAggregators(const MPI_Comm comm);
+
+/// Free communicators for I/O aggregation.
+void _deallocateAggregators(void);
+
+/** Open external raw data file for dataset.
+ *
+ * @param dataset Dataset information.
+ * @param filename Name of external raw data file.
+ * @param comm MPI communicator for mesh.
+ */
+void _openDataset(ExternalDataset* dataset,
+                  const char* filename,
+                  const MPI_Comm comm);
+
+/** Append values of PETSc global vector to external raw data file.
+ *
+ * @param dataset Dataset information.
+ * @param vector PETSc global vector.
+ */
+void _writeDataset(ExternalDataset* dataset,
+                   const PetscVec vector);
+
+/** Close external raw data file for dataset.
+ *
+ * @param dataset Dataset information.
+ */
+void _closeDataset(ExternalDataset* dataset);
+
 /** Write time stamp to file.
  *
  * @param t Time in seconds.
@@ -165,17 +225,6 @@ private:
 
 const DataWriterHDF5Ext& operator=(const DataWriterHDF5Ext&);   ///< Not implemented
 
-// PRIVATE STRUCTS //////////////////////////////////////////////////////
-private:
-
-struct ExternalDataset {
-    PetscViewer viewer;
-    PetscInt numTimeSteps;
-    PetscInt numPoints;
-    PetscInt fiberDim;
-};
-typedef std::map<std::string, ExternalDataset> dataset_type;
-
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
@@ -183,6 +232,9 @@ std::string _filename;   ///< Name of HDF5 file.
 HDF5* _h5;   ///< HDF5 file
 dataset_type _datasets;   ///< Datasets
 int _tstampIndex;   ///< Index of last time stamp written.
+int _aggregatorStride;   ///< Number of processes per I/O aggregator (0 for no aggregation).
+MPI_Comm _groupComm;   ///< Communicator for processes sharing an aggregator.
+MPI_Comm _aggregatorComm;   ///< Communicator for aggregators.
 
 }; // DataWriterHDF5Ext
 
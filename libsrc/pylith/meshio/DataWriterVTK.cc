@@ -24,17 +24,89 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Fields.hh" // HOLDSA Fields
 #include "pylith/topology/Stratum.hh" // USES StratumIS
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include <petscdmplex.h>
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ofstream
 #include <stdexcept> // USES std::runtime_error
+#include <algorithm> // USES std::find(), std::max()
+#include <stdint.h> // USES uint64_t
 
 extern
 PetscErrorCode DMPlexVTKWriteAll(PetscObject odm, 
 				 PetscViewer viewer);
 
+// ----------------------------------------------------------------------
+// Anonymous namespace with helpers for XML files.
+namespace {
+  /** Append array to buffer of raw binary data, preceded by the
+   * number of bytes in the array.
+   *
+   * @param buffer Buffer of raw binary data.
+   * @param values Array of values.
+   * @returns Offset of array in buffer.
+   */
+  template<typename T>
+  size_t
+  appendRaw(std::vector<char>* buffer,
+	    const std::vector<T>& values) {
+    assert(buffer);
+    const size_t offset = buffer->size();
+    const uint64_t numBytes = values.size()*sizeof(T);
+    const char* header = (const char*)&numBytes;
+    buffer->insert(buffer->end(), header, header+sizeof(uint64_t));
+    if (numBytes > 0) {
+      const char* data = (const char*)&values[0];
+      buffer->insert(buffer->end(), data, data+numBytes);
+    } // if
+    return offset;
+  } // appendRaw
+
+  /** Get byte order for XML files.
+   *
+   * @returns Name of byte order of this machine.
+   */
+  const char*
+  byteOrder(void) {
+    const int value = 1;
+    return (1 == *(const char*)&value) ? "LittleEndian" : "BigEndian";
+  } // byteOrder
+
+  /** Get VTK cell type.
+   *
+   * @param cellDim Dimension of cell.
+   * @param numCorners Number of vertices in cell.
+   * @returns VTK cell type.
+   */
+  unsigned char
+  vtkCellType(const int cellDim,
+	      const int numCorners) {
+    switch (numCorners) {
+    case 1 :
+      return 1; // VTK_VERTEX
+    case 2 :
+      return 3; // VTK_LINE
+    case 3 :
+      return 5; // VTK_TRIANGLE
+    case 4 :
+      return (2 == cellDim) ? 9 : 10; // VTK_QUAD, VTK_TETRA
+    case 8 :
+      return 12; // VTK_HEXAHEDRON
+    default : {
+      std::ostringstream msg;
+      msg << "Unknown VTK cell type for cell with dimension " << cellDim << " and " << numCorners << " vertices.";
+      throw std::runtime_error(msg.str());
+    } // default
+    } // switch
+  } // vtkCellType
+
+  const char* vtkScalarType = (sizeof(PylithScalar) == 4) ? "Float32" : "Float64";
+  const char* vtkIntType = (sizeof(PetscInt) == 4) ? "Int32" : "Int64";
+} // namespace
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::meshio::DataWriterVTK::DataWriterVTK(void) :
@@ -46,6 +118,8 @@ pylith::meshio::DataWriterVTK::DataWriterVTK(void) :
   _vertexFieldCache(0),
   _cellFieldCache(0),
   _precision(6),
+  _time(0.0),
+  _xmlFormat(false),
   _isOpen(false),
   _isOpenTimeStep(false),
   _wroteVertexHeader(false),
@@ -89,6 +163,8 @@ pylith::meshio::DataWriterVTK::DataWriterVTK(const DataWriterVTK& w) :
   _vertexFieldCache(0),
   _cellFieldCache(0),
   _precision(w._precision),
+  _time(0.0),
+  _xmlFormat(w._xmlFormat),
   _isOpen(w._isOpen),
   _isOpenTimeStep(w._isOpenTimeStep),
   _wroteVertexHeader(w._wroteVertexHeader),
@@ -150,6 +226,9 @@ pylith::meshio::DataWriterVTK::open(const topology::Mesh& mesh,
   _dm = mesh.dmMesh();assert(_dm);
   err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
 
+  _collectionTimes.clear();
+  _collectionFiles.clear();
+
   _isOpen = true;
 
   PYLITH_METHOD_END;
@@ -216,10 +295,17 @@ pylith::meshio::DataWriterVTK::openTimeStep(const PylithScalar t,
 
   } // if
 
-  err = PetscViewerCreate(mesh.comm(), &_viewer);PYLITH_CHECK_ERROR(err);
-  err = PetscViewerSetType(_viewer, PETSCVIEWERVTK);PYLITH_CHECK_ERROR(err);
-  err = PetscViewerPushFormat(_viewer, PETSC_VIEWER_ASCII_VTK);PYLITH_CHECK_ERROR(err);
-  err = PetscViewerFileSetName(_viewer, filename.c_str());PYLITH_CHECK_ERROR(err);
+  if (_xmlFormat) {
+    // Fields are written from the caches in closeTimeStep().
+    _time = t;
+    _vertexFieldNames.clear();
+    _cellFieldNames.clear();
+  } else {
+    err = PetscViewerCreate(mesh.comm(), &_viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerSetType(_viewer, PETSCVIEWERVTK);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(_viewer, PETSC_VIEWER_ASCII_VTK);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerFileSetName(_viewer, filename.c_str());PYLITH_CHECK_ERROR(err);
+  } // if/else
   
   // Increment reference count on mesh DM, because the viewer destroys the DM.
   assert(_dm);
@@ -239,6 +325,10 @@ pylith::meshio::DataWriterVTK::closeTimeStep(void)
 
   PetscErrorCode err = 0;
 
+  if (_isOpenTimeStep && _xmlFormat) {
+    _writeXML();
+  } // if
+
   // Destroy the viewer (which also writes the file).
   err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);
 
@@ -288,6 +378,14 @@ pylith::meshio::DataWriterVTK::writeVertexField(const PylithScalar t,
   assert(fieldCached.sectionSize() == field.sectionSize());
   fieldCached.copy(field);
 
+  if (_xmlFormat) {
+    if (std::find(_vertexFieldNames.begin(), _vertexFieldNames.end(), fieldLabel) == _vertexFieldNames.end()) {
+      _vertexFieldNames.push_back(fieldLabel);
+    } // if
+    _wroteVertexHeader = true;
+    PYLITH_METHOD_END;
+  } // if
+
   // Could check the field.localSection() matches the default section from VecGetDM().
   PetscVec fieldVec = fieldCached.localVector();assert(fieldVec);
 
@@ -332,6 +430,14 @@ pylith::meshio::DataWriterVTK::writeCellField(const PylithScalar t,
   assert(fieldCached.sectionSize() == field.sectionSize());
   fieldCached.copy(field);
 
+  if (_xmlFormat) {
+    if (std::find(_cellFieldNames.begin(), _cellFieldNames.end(), fieldLabel) == _cellFieldNames.end()) {
+      _cellFieldNames.push_back(fieldLabel);
+    } // if
+    _wroteCellHeader = true;
+    PYLITH_METHOD_END;
+  } // if
+
   // Could check the field.localSection() matches the default section from VecGetDM().
   PetscVec fieldVec = fieldCached.localVector();assert(fieldVec);
 
@@ -374,5 +480,317 @@ pylith::meshio::DataWriterVTK::_vtkFilename(const PylithScalar t) const
   PYLITH_METHOD_RETURN(std::string(filename.str()));
 } // _vtkFilename
 
+// ----------------------------------------------------------------------
+// Write XML files (pieces, index, and collection) for current time step.
+void
+pylith::meshio::DataWriterVTK::_writeXML(void)
+{ // _writeXML
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+
+  PetscMPIInt commRank = 0;
+  PetscErrorCode err = MPI_Comm_rank(PetscObjectComm((PetscObject) _dm), &commRank);PYLITH_CHECK_ERROR(err);
+
+  // Use legacy filename with time stamp as root of XML filenames.
+  const std::string& vtkFilename = _vtkFilename(_time);
+  const std::string root(vtkFilename, 0, vtkFilename.rfind(".vtk"));
+
+  std::ostringstream pieceFilename;
+  pieceFilename << root << "_p" << commRank << ".vtu";
+  _writeXMLPiece(pieceFilename.str().c_str());
+
+  const std::string indexFilename = root + ".pvtu";
+  if (!commRank) {
+    _writeXMLIndex(indexFilename.c_str(), root.c_str());
+  } // if
+
+  if (DataWriter::_numTimeSteps > 0) {
+    _collectionTimes.push_back(_time*DataWriter::_timeScale);
+    _collectionFiles.push_back(indexFilename);
+    if (!commRank) {
+      _writeXMLCollection();
+    } // if
+  } // if
+
+  PYLITH_METHOD_END;
+} // _writeXML
+
+// ----------------------------------------------------------------------
+// Write piece of mesh and fields on this process to XML file.
+void
+pylith::meshio::DataWriterVTK::_writeXMLPiece(const char* filename)
+{ // _writeXMLPiece
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+  assert(filename);
+
+  MPI_Comm comm = PetscObjectComm((PetscObject) _dm);
+  PetscErrorCode err = 0;
+
+  PetscInt dim = 0, cellHeight = 0, cStart = 0, cEnd = 0, cMax = 0, vStart = 0, vEnd = 0;
+  err = DMGetDimension(_dm, &dim);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetVTKCellHeight(_dm, &cellHeight);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(_dm, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(_dm, &cMax, PETSC_NULL, PETSC_NULL, PETSC_NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax >= 0) {
+    cEnd = PetscMin(cEnd, cMax);
+  } // if
+  err = DMPlexGetDepthStratum(_dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscBool hasLabel = PETSC_FALSE;
+  err = DMHasLabel(_dm, "vtk", &hasLabel);PYLITH_CHECK_ERROR(err);
+
+  // Cells and vertices in piece. Vertices are numbered in order of
+  // first use by the cells.
+  std::vector<PetscInt> cells;
+  std::vector<PetscInt> vertices;
+  std::vector<PetscInt> vertexIndex(vEnd-vStart, -1);
+  std::vector<PetscInt> connectivity;
+  std::vector<PetscInt> offsets;
+  std::vector<unsigned char> types;
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    if (hasLabel) {
+      PetscInt value = 0;
+      err = DMGetLabelValue(_dm, "vtk", c, &value);PYLITH_CHECK_ERROR(err);
+      if (value != 1) {
+	continue;
+      } // if
+    } // if
+    cells.push_back(c);
+
+    PetscInt *closure = NULL;
+    PetscInt closureSize = 0, nC = 0;
+    err = DMPlexGetTransitiveClosure(_dm, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p=0; p < closureSize*2; p += 2) {
+      if ((closure[p] >= vStart) && (closure[p] < vEnd)) {
+	closure[nC++] = closure[p];
+      } // if
+    } // for
+    err = DMPlexInvertCell(dim, nC, closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < nC; ++i) {
+      const PetscInt v = closure[i] - vStart;
+      if (vertexIndex[v] < 0) {
+	vertexIndex[v] = vertices.size();
+	vertices.push_back(closure[i]);
+      } // if
+      connectivity.push_back(vertexIndex[v]);
+    } // for
+    err = DMPlexRestoreTransitiveClosure(_dm, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    offsets.push_back(connectivity.size());
+    types.push_back(vtkCellType(dim-cellHeight, nC));
+  } // for
+  const size_t numVertices = vertices.size();
+  const size_t numCells = cells.size();
+
+  std::vector<char> rawData;
+  std::ostringstream xml;
+
+  // Points, always with 3 components.
+  PetscSection coordSection = NULL;
+  PetscVec coordVec = NULL;
+  PetscScalar* coordArray = NULL;
+  PylithScalar lengthScale = 1.0;
+  err = DMPlexGetScale(_dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateSection(_dm, &coordSection);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinatesLocal(_dm, &coordVec);PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+  std::vector<PylithScalar> points(3*numVertices, 0.0);
+  for (size_t i=0; i < numVertices; ++i) {
+    PetscInt off = 0, dof = 0;
+    err = PetscSectionGetOffset(coordSection, vertices[i], &off);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetDof(coordSection, vertices[i], &dof);PYLITH_CHECK_ERROR(err);
+    for (PetscInt d=0; d < dof && d < 3; ++d) {
+      points[3*i+d] = coordArray[off+d]*lengthScale;
+    } // for
+  } // for
+  err = VecRestoreArray(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+
+  // Offsets into the appended data must be computed in order.
+  const size_t pointsOffset = appendRaw(&rawData, points);
+  const size_t connectivityOffset = appendRaw(&rawData, connectivity);
+  const size_t offsetsOffset = appendRaw(&rawData, offsets);
+  const size_t typesOffset = appendRaw(&rawData, types);
+  xml << "    <Piece NumberOfPoints=\"" << numVertices << "\" NumberOfCells=\"" << numCells << "\">\n"
+      << "      <Points>\n"
+      << "        <DataArray type=\"" << vtkScalarType << "\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << pointsOffset << "\"/>\n"
+      << "      </Points>\n"
+      << "      <Cells>\n"
+      << "        <DataArray type=\"" << vtkIntType << "\" Name=\"connectivity\" format=\"appended\" offset=\"" << connectivityOffset << "\"/>\n"
+      << "        <DataArray type=\"" << vtkIntType << "\" Name=\"offsets\" format=\"appended\" offset=\"" << offsetsOffset << "\"/>\n"
+      << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << typesOffset << "\"/>\n"
+      << "      </Cells>\n";
+
+  // Vertex and cell fields. The number of components must agree
+  // across processes, so use the largest fiber dimension. Vector
+  // fields always have 3 components.
+  for (int iType=0; iType < 2; ++iType) {
+    const bool isVertex = (0 == iType);
+    const std::vector<std::string>& names = isVertex ? _vertexFieldNames : _cellFieldNames;
+    std::vector<int>& numComponentsAll = isVertex ? _vertexFieldComponents : _cellFieldComponents;
+    const std::vector<PetscInt>& fieldPoints = isVertex ? vertices : cells;
+    topology::Fields* cache = isVertex ? _vertexFieldCache : _cellFieldCache;
+    const size_t numFields = names.size();
+    const size_t numPoints = fieldPoints.size();
+
+    numComponentsAll.resize(numFields);
+    if (numFields > 0) {
+      assert(cache);
+      xml << (isVertex ? "      <PointData>\n" : "      <CellData>\n");
+    } // if
+    for (size_t iField=0; iField < numFields; ++iField) {
+      topology::Field& field = cache->get(names[iField].c_str());
+      topology::VecVisitorMesh fieldVisitor(field);
+      const PetscScalar* fieldArray = fieldVisitor.localArray();
+
+      int numComponents = 0;
+      if (field.vectorFieldType() == topology::FieldBase::VECTOR) {
+	numComponents = 3;
+      } else {
+	int numComponentsLocal = 0;
+	for (size_t i=0; i < numPoints; ++i) {
+	  numComponentsLocal = std::max(numComponentsLocal, int(fieldVisitor.sectionDof(fieldPoints[i])));
+	} // for
+	err = MPI_Allreduce(&numComponentsLocal, &numComponents, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+      } // if/else
+      numComponentsAll[iField] = numComponents;
+
+      std::vector<PylithScalar> values(numComponents*numPoints, 0.0);
+      for (size_t i=0; i < numPoints; ++i) {
+	const PetscInt off = fieldVisitor.sectionOffset(fieldPoints[i]);
+	const PetscInt dof = fieldVisitor.sectionDof(fieldPoints[i]);
+	for (PetscInt d=0; d < dof && d < numComponents; ++d) {
+	  values[numComponents*i+d] = fieldArray[off+d];
+	} // for
+      } // for
+      const size_t valuesOffset = appendRaw(&rawData, values);
+      xml << "        <DataArray type=\"" << vtkScalarType << "\" Name=\"" << names[iField]
+	  << "\" NumberOfComponents=\"" << numComponents << "\" format=\"appended\" offset=\"" << valuesOffset << "\"/>\n";
+    } // for
+    if (numFields > 0) {
+      xml << (isVertex ? "      </PointData>\n" : "      </CellData>\n");
+    } // if
+  } // for
+  xml << "    </Piece>\n";
+
+  std::ofstream fileout(filename, std::ios::out | std::ios::binary);
+  if (!fileout.is_open() || !fileout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTK file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fileout << "<?xml version=\"1.0\"?>\n"
+	  << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << byteOrder() << "\" header_type=\"UInt64\">\n"
+	  << "  <UnstructuredGrid>\n"
+	  << xml.str()
+	  << "  </UnstructuredGrid>\n"
+	  << "  <AppendedData encoding=\"raw\">\n"
+	  << "   _";
+  if (rawData.size() > 0) {
+    fileout.write(&rawData[0], rawData.size());
+  } // if
+  fileout << "\n  </AppendedData>\n"
+	  << "</VTKFile>\n";
+  if (!fileout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing VTK file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fileout.close();
+
+  PYLITH_METHOD_END;
+} // _writeXMLPiece
+
+// ----------------------------------------------------------------------
+// Write index of pieces to parallel XML file.
+void
+pylith::meshio::DataWriterVTK::_writeXMLIndex(const char* filename,
+					      const char* pieceRoot)
+{ // _writeXMLIndex
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+  assert(filename);
+  assert(pieceRoot);
+
+  PetscMPIInt commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(PetscObjectComm((PetscObject) _dm), &commSize);PYLITH_CHECK_ERROR(err);
+
+  std::ofstream fileout(filename);
+  if (!fileout.is_open() || !fileout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTK file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fileout << "<?xml version=\"1.0\"?>\n"
+	  << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << byteOrder() << "\" header_type=\"UInt64\">\n"
+	  << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+	  << "    <PPoints>\n"
+	  << "      <PDataArray type=\"" << vtkScalarType << "\" NumberOfComponents=\"3\"/>\n"
+	  << "    </PPoints>\n";
+  for (int iType=0; iType < 2; ++iType) {
+    const bool isVertex = (0 == iType);
+    const std::vector<std::string>& names = isVertex ? _vertexFieldNames : _cellFieldNames;
+    const std::vector<int>& numComponents = isVertex ? _vertexFieldComponents : _cellFieldComponents;
+    const size_t numFields = names.size();
+    if (!numFields) {
+      continue;
+    } // if
+    fileout << (isVertex ? "    <PPointData>\n" : "    <PCellData>\n");
+    for (size_t iField=0; iField < numFields; ++iField) {
+      fileout << "      <PDataArray type=\"" << vtkScalarType << "\" Name=\"" << names[iField]
+	      << "\" NumberOfComponents=\"" << numComponents[iField] << "\"/>\n";
+    } // for
+    fileout << (isVertex ? "    </PPointData>\n" : "    </PCellData>\n");
+  } // for
+
+  // Pieces are in the same directory as the index file.
+  const std::string root(pieceRoot);
+  const std::string rootName = root.substr(root.rfind('/')+1);
+  for (int i=0; i < commSize; ++i) {
+    fileout << "    <Piece Source=\"" << rootName << "_p" << i << ".vtu\"/>\n";
+  } // for
+  fileout << "  </PUnstructuredGrid>\n"
+	  << "</VTKFile>\n";
+  fileout.close();
+
+  PYLITH_METHOD_END;
+} // _writeXMLIndex
+
+// ----------------------------------------------------------------------
+// Write collection of time steps to XML file.
+void
+pylith::meshio::DataWriterVTK::_writeXMLCollection(void)
+{ // _writeXMLCollection
+  PYLITH_METHOD_BEGIN;
+
+  const std::string filename = std::string(_filename, 0, _filename.find(".vtk")) + ".pvd";
+  std::ofstream fileout(filename.c_str());
+  if (!fileout.is_open() || !fileout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTK file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fileout << "<?xml version=\"1.0\"?>\n"
+	  << "<VTKFile type=\"Collection\" version=\"1.0\" byte_order=\"" << byteOrder() << "\">\n"
+	  << "  <Collection>\n";
+  fileout.precision(_precision);
+  const size_t numSteps = _collectionFiles.size();
+  assert(_collectionTimes.size() == numSteps);
+  for (size_t i=0; i < numSteps; ++i) {
+    const std::string& file = _collectionFiles[i];
+    fileout << "    <DataSet timestep=\"" << _collectionTimes[i] << "\" group=\"\" part=\"0\" file=\""
+	    << file.substr(file.rfind('/')+1) << "\"/>\n";
+  } // for
+  fileout << "  </Collection>\n"
+	  << "</VTKFile>\n";
+  fileout.close();
+
+  PYLITH_METHOD_END;
+} // _writeXMLCollection
+
 
 // End of file 
@@ -26,6 +26,11 @@
  * allow the output manager to reuse fields for dimensionalizing,
  * etc. Other writers do not suffer from this restriction, so we
  * implement this functionality in DataWriterVTK.
+ *
+ * In XML format each process writes its own piece (.vtu) with the
+ * data in appended raw binary form, process 0 writes the index of
+ * the pieces (.pvtu), and the time steps are collected in a .pvd
+ * file.
  */
 
 #if !defined(pylith_meshio_datawritervtk_hh)
@@ -37,6 +42,8 @@
 #include "pylith/topology/topologyfwd.hh" // HOLDSA Fields
 #include "pylith/utils/petscfwd.h" // HASA PetscDM
 
+#include <vector> // HASA std::vector
+
 // DataWriterVTK --------------------------------------------------------
 /// Object for writing finite-element data to VTK file.
 class pylith::meshio::DataWriterVTK : public DataWriter
@@ -92,6 +99,13 @@ public :
    */
   void precision(const int value);
 
+  /** Set flag for writing parallel XML files with binary data
+   * instead of legacy ASCII files.
+   *
+   * @param value True to write XML files, false for legacy files.
+   */
+  void xmlFormat(const bool value);
+
   /** Prepare for writing files.
    *
    * @param mesh Finite-element mesh. 
@@ -162,6 +176,26 @@ private :
    */
   std::string _vtkFilename(const PylithScalar t) const;
 
+  /// Write XML files (pieces, index, and collection) for current time step.
+  void _writeXML(void);
+
+  /** Write piece of mesh and fields on this process to XML file.
+   *
+   * @param filename Name of file.
+   */
+  void _writeXMLPiece(const char* filename);
+
+  /** Write index of pieces to parallel XML file.
+   *
+   * @param filename Name of file.
+   * @param pieceRoot Root of filenames for pieces.
+   */
+  void _writeXMLIndex(const char* filename,
+		      const char* pieceRoot);
+
+  /// Write collection of time steps to XML file.
+  void _writeXMLCollection(void);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -184,6 +218,16 @@ private :
 
   int _precision; ///< Precision of floating point values in output.
 
+  PylithScalar _time; ///< Time stamp of current time step.
+  std::vector<std::string> _vertexFieldNames; ///< Vertex fields in current time step.
+  std::vector<std::string> _cellFieldNames; ///< Cell fields in current time step.
+  std::vector<int> _vertexFieldComponents; ///< Number of components of vertex fields.
+  std::vector<int> _cellFieldComponents; ///< Number of components of cell fields.
+  std::vector<PylithScalar> _collectionTimes; ///< Times of XML time steps.
+  std::vector<std::string> _collectionFiles; ///< Files of XML time steps.
+
+  bool _xmlFormat; ///< True if writing XML files, false for legacy files.
+
   bool _isOpen; ///< True if called open().
   bool _isOpenTimeStep; ///< true if called openTimeStep().
   bool _wroteVertexHeader; ///< True if wrote header for vertex data.
@@ -24,14 +24,15 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 
 #include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
-#include "spatialdata/utils/LineParser.hh" // USES LineParser
+#include "AsciiTokenizer.hh" // USES AsciiTokenizer
 
 #include "journal/info.h" // USES journal::info_t
 
 #include <iomanip> // USES setw(), setiosflags(), resetiosflags()
+#include <algorithm> // USES std::max()
 #include <strings.h> // USES strcasecmp()
 #include <cassert> // USES assert()
-#include <fstream> // USES std::ifstream, std::ofstream
+#include <fstream> // USES std::ofstream
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 
@@ -86,56 +87,43 @@ pylith::meshio::MeshIOAscii::_read(void)
   int_array materialIds;
 
   if (0 == commRank) {
-    std::ifstream filein(_filename.c_str());
-    if (!filein.is_open() || !filein.good()) {
-      std::ostringstream msg;
-      msg << "Could not open mesh file '" << _filename
-          << "' for reading.\n";
-      throw std::runtime_error(msg.str());
-    } // if
+    AsciiTokenizer tokenizer;
+    tokenizer.open(_filename.c_str());
 
-    spatialdata::utils::LineParser parser(filein, "//");
-    parser.eatwhitespace(true);
-    
-    std::string token;
-    std::istringstream buffer;
-    const int maxIgnore = 1024;
-    
-    buffer.str(parser.next());
-    buffer >> token;
-    if (strcasecmp(token.c_str(), "mesh")) {
-      std::ostringstream msg;
-      msg << "Expected 'mesh' token but encountered '" << token << "'\n";
-      throw std::runtime_error(msg.str());
-    } // if
+    journal::info_t info("meshioascii");
+    info << journal::at(__HERE__)
+	 << "Reading ASCII mesh file '" << _filename << "' ("
+	 << tokenizer.size() << " bytes)." << journal::endl;
 
     bool readDim = false;
     bool readCells = false;
     bool readVertices = false;
     bool builtMesh = false;
 
+    std::string token;
     try {
-      buffer.str(parser.next());
-      buffer.clear();
-      buffer >> token;
-      while (buffer.good() && token != "}") {
+      tokenizer.expect("mesh");
+      tokenizer.expect("=");
+      tokenizer.expect("{");
+
+      while (tokenizer.next(&token) && token != "}") {
 	if (0 == strcasecmp(token.c_str(), "dimension")) {
-	  buffer.ignore(maxIgnore, '=');
-	  buffer >> meshDim;
+	  tokenizer.expect("=");
+	  meshDim = tokenizer.readInt();
 	  readDim = true;
 	} else if (0 == strcasecmp(token.c_str(), "use-index-zero")) {
-	  buffer.ignore(maxIgnore, '=');
+	  tokenizer.expect("=");
 	  std::string flag = "";
-	  buffer >> flag;
+	  tokenizer.next(&flag);
 	  if (0 == strcasecmp(flag.c_str(), "true"))
 	    _useIndexZero = true;
 	  else
 	    _useIndexZero = false;
 	} else if (0 == strcasecmp(token.c_str(), "vertices")) {
-	  _readVertices(parser, &coordinates, &numVertices, &spaceDim);
+	  _readVertices(tokenizer, &coordinates, &numVertices, &spaceDim);
 	  readVertices = true;
 	} else if (0 == strcasecmp(token.c_str(), "cells")) {
-	  _readCells(parser, &cells, &materialIds, &numCells, &numCorners);
+	  _readCells(tokenizer, &cells, &materialIds, &numCells, &numCorners);
 	  readCells = true;
 	} else if (0 == strcasecmp(token.c_str(), "group")) {
 	  std::string name;
@@ -145,12 +133,12 @@ pylith::meshio::MeshIOAscii::_read(void)
 	  if (!builtMesh)
 	    throw std::runtime_error("Both 'vertices' and 'cells' must "
 				     "precede any groups in mesh file.");
-	  _readGroup(parser, &points, &type, &name);
+	  _readGroup(tokenizer, &points, &type, &name);
 	  _setGroup(name, type, points);
 	} else {
 	  std::ostringstream msg;
 	  msg << "Could not parse '" << token << "' into a mesh setting.";
-	  throw std::runtime_error(msg.str());  
+	  tokenizer.error(msg.str());
 	} // else
 
 	if (readDim && readCells && readVertices && !builtMesh) {
@@ -161,10 +149,6 @@ pylith::meshio::MeshIOAscii::_read(void)
 	  _setMaterials(materialIds);
 	  builtMesh = true;
 	} // if
-
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> token;
       } // while
       if (token != "}")
 	throw std::runtime_error("I/O error occurred while parsing mesh tokens.");
@@ -180,7 +164,10 @@ pylith::meshio::MeshIOAscii::_read(void)
 	  << _filename << "'.\n";
       throw std::runtime_error(msg.str());
     } // catch
-    filein.close();
+    tokenizer.close();
+
+    info << journal::at(__HERE__)
+	 << "Done reading ASCII mesh file '" << _filename << "'." << journal::endl;
   } else {
     MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim, _interpolate);
     _setMaterials(materialIds);
@@ -228,7 +215,7 @@ pylith::meshio::MeshIOAscii::_write(void) const
 // ----------------------------------------------------------------------
 // Read mesh vertices.
 void
-pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readVertices(AsciiTokenizer& tokenizer,
 					   scalar_array* coordinates,
 					   int* numVertices, 
 					   int* numDims) const
@@ -240,18 +227,15 @@ pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parse
   assert(numDims);
 
   std::string token;
-  std::istringstream buffer;
-  const int maxIgnore = 1024;
-  buffer.str(parser.next());
-  buffer.clear();
-  buffer >> token;
-  while (buffer.good() && token != "}") {
+  tokenizer.expect("=");
+  tokenizer.expect("{");
+  while (tokenizer.next(&token) && token != "}") {
     if (0 == strcasecmp(token.c_str(), "dimension")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numDims;
+      tokenizer.expect("=");
+      *numDims = tokenizer.readInt();
     } else if (0 == strcasecmp(token.c_str(), "count")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numVertices;
+      tokenizer.expect("=");
+      *numVertices = tokenizer.readInt();
     } else if (0 == strcasecmp(token.c_str(), "coordinates")) {
       const int size = (*numVertices) * (*numDims);
       if (0 == size) {
@@ -259,24 +243,24 @@ pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parse
 	  "Tokens 'dimension' and 'count' must precede 'coordinates'.";
 	throw std::runtime_error(msg);
       } // if
+      tokenizer.expect("=");
+      tokenizer.expect("{");
       coordinates->resize(size);
-      int label;
+      const int numDimsV = *numDims;
+      const int progressStride = _progressStride(*numVertices);
       for (int iVertex=0, i=0; iVertex < *numVertices; ++iVertex) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	for (int iDim=0; iDim < *numDims; ++iDim)
-	  buffer >> (*coordinates)[i++];
+	tokenizer.readInt(); // label
+	for (int iDim=0; iDim < numDimsV; ++iDim)
+	  (*coordinates)[i++] = tokenizer.readScalar();
+	if (0 == (iVertex+1) % progressStride)
+	  _reportProgress(tokenizer, "vertices", iVertex+1, *numVertices);
       } // for
-      parser.ignore('}');
+      tokenizer.expect("}");
     } else {
       std::ostringstream msg;
       msg << "Could not parse '" << token << "' into a vertices setting.";
-      throw std::runtime_error(msg.str());
+      tokenizer.error(msg.str());
     } // else
-    buffer.str(parser.next());
-    buffer.clear();
-    buffer >> token;
   } // while
   if (token != "}")
     throw std::runtime_error("I/O error while parsing vertices.");
@@ -321,7 +305,7 @@ pylith::meshio::MeshIOAscii::_writeVertices(std::ostream& fileout) const
 // ----------------------------------------------------------------------
 // Read mesh cells.
 void
-pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readCells(AsciiTokenizer& tokenizer,
 					int_array* cells,
 					int_array* materialIds,
 					int* numCells, 
@@ -335,18 +319,15 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
   assert(numCorners);
 
   std::string token;
-  std::istringstream buffer;
-  const int maxIgnore = 1024;
-  buffer.str(parser.next());
-  buffer.clear();
-  buffer >> token;
-  while (buffer.good() && token != "}") {
+  tokenizer.expect("=");
+  tokenizer.expect("{");
+  while (tokenizer.next(&token) && token != "}") {
     if (0 == strcasecmp(token.c_str(), "num-corners")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numCorners;
+      tokenizer.expect("=");
+      *numCorners = tokenizer.readInt();
     } else if (0 == strcasecmp(token.c_str(), "count")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numCells;
+      tokenizer.expect("=");
+      *numCells = tokenizer.readInt();
     } else if (0 == strcasecmp(token.c_str(), "simplices")) {
       const int size = (*numCells) * (*numCorners);
       if (0 == size) {
@@ -354,46 +335,42 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
 	  "Tokens 'num-corners' and 'count' must precede 'cells'.";
 	throw std::runtime_error(msg);
       } // if
+      tokenizer.expect("=");
+      tokenizer.expect("{");
       cells->resize(size);
-      int label;
+      // If file begins with index 1, then decrement to index 0 for
+      // compatibility with PETSc.
+      const int offset = _useIndexZero ? 0 : 1;
+      const int numCornersV = *numCorners;
+      const int progressStride = _progressStride(*numCells);
       for (int iCell=0, i=0; iCell < *numCells; ++iCell) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	for (int iCorner=0; iCorner < *numCorners; ++iCorner)
-	  buffer >> (*cells)[i++];
+	tokenizer.readInt(); // label
+	for (int iCorner=0; iCorner < numCornersV; ++iCorner)
+	  (*cells)[i++] = tokenizer.readInt() - offset;
+	if (0 == (iCell+1) % progressStride)
+	  _reportProgress(tokenizer, "cells", iCell+1, *numCells);
       } // for
-      if (!_useIndexZero) {
-	// if files begins with index 1, then decrement to index 0
-	// for compatibility with PETSc
-	for (int i=0; i < size; ++i)
-	  --(*cells)[i];
-      } // if
-      parser.ignore('}');
+      tokenizer.expect("}");
     } else if (0 == strcasecmp(token.c_str(), "material-ids")) {
       if (0 == *numCells) {
 	const char* msg =
 	  "Token 'count' must precede 'material-ids'.";
 	throw std::runtime_error(msg);
       } // if
+      tokenizer.expect("=");
+      tokenizer.expect("{");
       const int size = *numCells;
       materialIds->resize(size);
-      int label = 0;
       for (int iCell=0; iCell < *numCells; ++iCell) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	buffer >> (*materialIds)[iCell];
+	tokenizer.readInt(); // label
+	(*materialIds)[iCell] = tokenizer.readInt();
       } // for
-      parser.ignore('}');
+      tokenizer.expect("}");
     } else {
       std::ostringstream msg;
       msg << "Could not parse '" << token << "' into an cells setting.";
-      throw std::runtime_error(msg.str());
+      tokenizer.error(msg.str());
     } // else
-    buffer.str(parser.next());
-    buffer.clear();
-    buffer >> token;
   } // while
   if (token != "}")
     throw std::runtime_error("I/O error while parsing cells.");
@@ -454,7 +431,7 @@ pylith::meshio::MeshIOAscii::_writeCells(std::ostream& fileout) const
 // ----------------------------------------------------------------------
 // Read mesh group.
 void
-pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readGroup(AsciiTokenizer& tokenizer,
 					int_array* points,
 					GroupPtType* type,
 					std::string* name) const
@@ -466,23 +443,17 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
   assert(name);
 
   std::string token;
-  std::istringstream buffer;
-  const int maxIgnore = 1024;
   int numPoints = -1;
-  buffer.str(parser.next());
-  buffer.clear();
-  buffer >> token;
-  while (buffer.good() && token != "}") {
+  tokenizer.expect("=");
+  tokenizer.expect("{");
+  while (tokenizer.next(&token) && token != "}") {
     if (0 == strcasecmp(token.c_str(), "name")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> std::ws;
-      char cbuffer[maxIgnore];
-      buffer.get(cbuffer, maxIgnore, '\n');
-      *name = cbuffer;
+      tokenizer.expect("=");
+      *name = tokenizer.restOfLine();
     } else if (0 == strcasecmp(token.c_str(), "type")) {
       std::string typeName;
-      buffer.ignore(maxIgnore, '=');
-      buffer >> typeName;
+      tokenizer.expect("=");
+      tokenizer.next(&typeName);
       if (typeName == groupTypeNames[VERTEX])
         *type = VERTEX;
       else if (typeName == groupTypeNames[CELL])
@@ -490,38 +461,29 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
       else {
         std::ostringstream msg;
         msg << "Invalid point type " << typeName << ".";
-        throw std::runtime_error(msg.str());
+        tokenizer.error(msg.str());
       } // else
     } else if (0 == strcasecmp(token.c_str(), "count")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> numPoints;
+      tokenizer.expect("=");
+      numPoints = tokenizer.readInt();
     } else if (0 == strcasecmp(token.c_str(), "indices")) {
       if (-1 == numPoints) {
         std::ostringstream msg;
         msg << "Tokens 'count' must precede 'indices'.";
         throw std::runtime_error(msg.str());
       } // if
+      tokenizer.expect("=");
+      tokenizer.expect("{");
       points->resize(numPoints);
-      buffer.str(parser.next());
-      buffer.clear();
-      int i = 0;
-      while (buffer.good() && i < numPoints) {
-	buffer >> (*points)[i++];
-	buffer >> std::ws;
-	if (!buffer.good() && i < numPoints) {
-	  buffer.str(parser.next());
-	  buffer.clear();
-	} // if
-      } // while
-      parser.ignore('}');
+      const int offset = _useIndexZero ? 0 : 1;
+      for (int i=0; i < numPoints; ++i)
+	(*points)[i] = tokenizer.readInt() - offset;
+      tokenizer.expect("}");
     } else {
       std::ostringstream msg;
       msg << "Could not parse '" << token << "' into a group setting.";
-      throw std::runtime_error(msg.str());
+      tokenizer.error(msg.str());
     } // else
-    buffer.str(parser.next());
-    buffer.clear();
-    buffer >> token;
   } // while
   if (token != "}") {
     std::ostringstream msg;
@@ -529,9 +491,6 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
     throw std::runtime_error(msg.str());
   } // if
 
-  if (!_useIndexZero)
-    *points -= 1;
-
   PYLITH_METHOD_END;
 } // _readGroup
 
@@ -565,5 +524,29 @@ pylith::meshio::MeshIOAscii::_writeGroup(std::ostream& fileout,
 
   PYLITH_METHOD_END;
 } // _writeGroup
-  
+
+// ----------------------------------------------------------------------
+// Get number of entities between progress reports.
+int
+pylith::meshio::MeshIOAscii::_progressStride(const int numEntities)
+{ // _progressStride
+  const int numReports = 10;
+  return numEntities >= numReports ? numEntities / numReports : 1;
+} // _progressStride
+
+// ----------------------------------------------------------------------
+// Report progress reading entities.
+void
+pylith::meshio::MeshIOAscii::_reportProgress(const AsciiTokenizer& tokenizer,
+					     const char* entities,
+					     const int numRead,
+					     const int numEntities)
+{ // _reportProgress
+  journal::info_t info("meshioascii");
+  info << journal::at(__HERE__)
+       << "Read " << numRead << " of " << numEntities << " " << entities
+       << " (" << int(100.0 * tokenizer.position() / std::max(tokenizer.size(), size_t(1)))
+       << "% of file)." << journal::endl;
+} // _reportProgress
+
 // End of file 
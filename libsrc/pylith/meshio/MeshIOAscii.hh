@@ -28,7 +28,6 @@
 // Include directives ---------------------------------------------------
 #include "MeshIO.hh" // ISA MeshIO
 
-#include "spatialdata/utils/utilsfwd.hh" // USES LineParser
 
 #include <iosfwd> // USES std::istream, std::ostream
 #include <string> // HASA std::string
@@ -77,12 +76,12 @@ private :
 
   /** Read mesh vertices.
    *
-   * @param parser Input parser.
+   * @param tokenizer Tokenizer for input file.
    * @param coordinates Pointer to array of vertex coordinates
    * @param numVertices Pointer to number of vertices
    * @param spaceDim Pointer to dimension of coordinates vector space
    */
-  void _readVertices(spatialdata::utils::LineParser& parser,
+  void _readVertices(AsciiTokenizer& tokenizer,
 		     scalar_array* coordinates,
 		     int* numVertices,
 		     int* spaceDim) const;
@@ -95,13 +94,13 @@ private :
   
   /** Read mesh cells.
    *
-   * @param parser Input parser.
+   * @param tokenizer Tokenizer for input file.
    * @param pCells Pointer to array of indices of cell vertices
    * @param pMaterialIds Pointer to array of material identifiers
    * @param pNumCells Pointer to number of cells
    * @param pNumCorners Pointer to number of corners
    */
-  void _readCells(spatialdata::utils::LineParser& parser,
+  void _readCells(AsciiTokenizer& tokenizer,
 		  int_array* pCells,
 		  int_array* pMaterialIds,
 		  int* numCells,
@@ -118,10 +117,10 @@ private :
   
   /** Read a point group.
    *
-   * @param parser Input parser.
+   * @param tokenizer Tokenizer for input file.
    * @param mesh The mesh
    */
-  void _readGroup(spatialdata::utils::LineParser& parser,
+  void _readGroup(AsciiTokenizer& tokenizer,
 		  int_array* points,
                   GroupPtType* type,
                   std::string* name) const;
@@ -134,6 +133,27 @@ private :
   void _writeGroup(std::ostream& fileout,
 		   const char* name) const;
 
+  /** Get number of entities between progress reports.
+   *
+   * @param numEntities Number of entities.
+   * @returns Number of entities between reports.
+   */
+  static
+  int _progressStride(const int numEntities);
+
+  /** Report progress reading entities.
+   *
+   * @param tokenizer Tokenizer for input file.
+   * @param entities Name of entities.
+   * @param numRead Number of entities read.
+   * @param numEntities Total number of entities.
+   */
+  static
+  void _reportProgress(const AsciiTokenizer& tokenizer,
+		       const char* entities,
+		       const int numRead,
+		       const int numEntities);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
@@ -0,0 +1,514 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOBox.hh" // implementation of class methods
+
+#include "MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+
+#include "journal/info.h" // USES journal::info_t
+
+#include <cmath> // USES fabs()
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+const char* pylith::meshio::MeshIOBox::_faceNames[3][2] = {
+  { "face_xneg", "face_xpos" },
+  { "face_yneg", "face_ypos" },
+  { "face_zneg", "face_zpos" },
+};
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOBox::MeshIOBox(void) :
+  _cellType(HEX8),
+  _defaultMaterialId(0)
+{ // constructor
+  for (int i=0; i < 3; ++i) {
+    _lower[i] = 0.0;
+    _upper[i] = 1.0;
+    _numCells[i] = 1;
+  } // for
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOBox::~MeshIOBox(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOBox::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIO::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Set extent and number of cells along a coordinate direction.
+void
+pylith::meshio::MeshIOBox::axis(const int dir,
+				const PylithScalar lower,
+				const PylithScalar upper,
+				const int numCells)
+{ // axis
+  PYLITH_METHOD_BEGIN;
+
+  if (dir < 0 || dir > 2) {
+    std::ostringstream msg;
+    msg << "Coordinate direction (" << dir << ") for box mesh must be 0, 1, or 2.";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (upper <= lower) {
+    std::ostringstream msg;
+    msg << "Maximum coordinate (" << upper << ") for box mesh must be greater than minimum coordinate (" << lower << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (numCells <= 0) {
+    std::ostringstream msg;
+    msg << "Number of cells (" << numCells << ") along direction " << dir << " of box mesh must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _lower[dir] = lower;
+  _upper[dir] = upper;
+  _numCells[dir] = numCells;
+
+  PYLITH_METHOD_END;
+} // axis
+
+// ----------------------------------------------------------------------
+// Add planar fault surface normal to a coordinate direction.
+void
+pylith::meshio::MeshIOBox::addFault(const char* name,
+				    const int dir,
+				    const PylithScalar coordinate)
+{ // addFault
+  PYLITH_METHOD_BEGIN;
+
+  assert(name);
+  if (dir < 0 || dir > 2) {
+    std::ostringstream msg;
+    msg << "Coordinate direction (" << dir << ") normal to fault '" << name << "' must be 0, 1, or 2.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  Fault fault;
+  fault.name = name;
+  fault.dir = dir;
+  fault.coordinate = coordinate;
+  _faults.push_back(fault);
+
+  PYLITH_METHOD_END;
+} // addFault
+
+// ----------------------------------------------------------------------
+// Add material block.
+void
+pylith::meshio::MeshIOBox::addMaterialBlock(const int id,
+					    const int dir,
+					    const PylithScalar lower,
+					    const PylithScalar upper)
+{ // addMaterialBlock
+  PYLITH_METHOD_BEGIN;
+
+  if (dir < 0 || dir > 2) {
+    std::ostringstream msg;
+    msg << "Coordinate direction (" << dir << ") for material block " << id << " must be 0, 1, or 2.";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (upper < lower) {
+    std::ostringstream msg;
+    msg << "Maximum coordinate (" << upper << ") for material block " << id
+	<< " must be greater than minimum coordinate (" << lower << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  MaterialBlock block;
+  block.id = id;
+  block.dir = dir;
+  block.lower = lower;
+  block.upper = upper;
+  _materialBlocks.push_back(block);
+
+  PYLITH_METHOD_END;
+} // addMaterialBlock
+
+// ----------------------------------------------------------------------
+// Get number of vertices in mesh.
+int
+pylith::meshio::MeshIOBox::numVertices(void) const
+{ // numVertices
+  const int meshDim = _meshDim();
+  int numVertices = 1;
+  for (int iDim=0; iDim < meshDim; ++iDim)
+    numVertices *= _numCells[iDim]+1;
+
+  return numVertices;
+} // numVertices
+
+// ----------------------------------------------------------------------
+// Get number of cells in mesh.
+int
+pylith::meshio::MeshIOBox::numCells(void) const
+{ // numCells
+  const int meshDim = _meshDim();
+  int numCells = 1;
+  for (int iDim=0; iDim < meshDim; ++iDim)
+    numCells *= _numCells[iDim];
+
+  switch (_cellType) {
+  case TRI3 :
+    numCells *= 2;
+    break;
+  case TET4 :
+    numCells *= 6;
+    break;
+  case QUAD4 :
+  case HEX8 :
+    break;
+  default :
+    assert(0);
+    throw std::logic_error("Unknown cell type in MeshIOBox::numCells().");
+  } // switch
+
+  return numCells;
+} // numCells
+
+// ----------------------------------------------------------------------
+// Generate mesh.
+void
+pylith::meshio::MeshIOBox::_read(void)
+{ // _read
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  const int commRank = _mesh->commRank();
+  const int meshDim = _meshDim();
+  int numVertices = 0;
+  int numCells = 0;
+  int numCorners = 0;
+  scalar_array coordinates;
+  int_array cells;
+  int_array materialIds;
+
+  if (0 == commRank) {
+    // Check faults before generating mesh.
+    const int numFaults = _faults.size();
+    for (int iFault=0; iFault < numFaults; ++iFault) {
+      const Fault& fault = _faults[iFault];
+      const int index = _planeIndex(fault.dir, fault.coordinate);
+      if (fault.dir >= meshDim || index <= 0 || index >= _numCells[fault.dir]) {
+	std::ostringstream msg;
+	msg << "Fault '" << fault.name << "' at coordinate " << fault.coordinate
+	    << " along direction " << fault.dir << " does not coincide with an interior grid plane of the box mesh.";
+	throw std::runtime_error(msg.str());
+      } // if
+    } // for
+
+    numVertices = this->numVertices();
+    numCells = this->numCells();
+
+    journal::info_t info("meshiobox");
+    info << journal::at(__HERE__)
+	 << "Generating box mesh with " << numVertices << " vertices and "
+	 << numCells << " cells." << journal::endl;
+
+    _createVertices(&coordinates);
+    _createCells(&cells, &materialIds, &numCorners);
+    assert(coordinates.size() == size_t(numVertices*meshDim));
+    assert(cells.size() == size_t(numCells*numCorners));
+
+    MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, meshDim, cells, numCells, numCorners, meshDim, _interpolate);
+    _setMaterials(materialIds);
+
+    int_array points;
+    for (int iDim=0; iDim < meshDim; ++iDim) {
+      _planeVertices(&points, iDim, 0);
+      _setGroup(_faceNames[iDim][0], VERTEX, points);
+      _planeVertices(&points, iDim, _numCells[iDim]);
+      _setGroup(_faceNames[iDim][1], VERTEX, points);
+    } // for
+    for (int iFault=0; iFault < numFaults; ++iFault) {
+      const Fault& fault = _faults[iFault];
+      _planeVertices(&points, fault.dir, _planeIndex(fault.dir, fault.coordinate));
+      _setGroup(fault.name, VERTEX, points);
+    } // for
+  } else {
+    MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, meshDim, cells, numCells, numCorners, meshDim, _interpolate);
+    _setMaterials(materialIds);
+  } // if/else
+  _distributeGroups();
+
+  PYLITH_METHOD_END;
+} // _read
+
+// ----------------------------------------------------------------------
+// Write mesh.
+void
+pylith::meshio::MeshIOBox::_write(void) const
+{ // _write
+  throw std::logic_error("MeshIOBox generates meshes and cannot write them. Use MeshIOAscii or DataWriterHDF5 instead.");
+} // _write
+
+// ----------------------------------------------------------------------
+// Get dimension of mesh.
+int
+pylith::meshio::MeshIOBox::_meshDim(void) const
+{ // _meshDim
+  return (TRI3 == _cellType || QUAD4 == _cellType) ? 2 : 3;
+} // _meshDim
+
+// ----------------------------------------------------------------------
+// Create vertices.
+void
+pylith::meshio::MeshIOBox::_createVertices(scalar_array* coordinates) const
+{ // _createVertices
+  PYLITH_METHOD_BEGIN;
+
+  assert(coordinates);
+
+  const int meshDim = _meshDim();
+  const int nx = _numCells[0]+1;
+  const int ny = _numCells[1]+1;
+  const int nz = (3 == meshDim) ? _numCells[2]+1 : 1;
+
+  PylithScalar dx[3];
+  for (int iDim=0; iDim < 3; ++iDim)
+    dx[iDim] = (_upper[iDim] - _lower[iDim]) / _numCells[iDim];
+
+  coordinates->resize(nx*ny*nz*meshDim);
+  int index = 0;
+  for (int k=0; k < nz; ++k) {
+    for (int j=0; j < ny; ++j) {
+      for (int i=0; i < nx; ++i) {
+	// Use upper coordinate on last plane to avoid roundoff error.
+	(*coordinates)[index++] = (i < nx-1) ? _lower[0] + i*dx[0] : _upper[0];
+	(*coordinates)[index++] = (j < ny-1) ? _lower[1] + j*dx[1] : _upper[1];
+	if (3 == meshDim)
+	  (*coordinates)[index++] = (k < nz-1) ? _lower[2] + k*dx[2] : _upper[2];
+      } // for
+    } // for
+  } // for
+  assert(size_t(index) == coordinates->size());
+
+  PYLITH_METHOD_END;
+} // _createVertices
+
+// ----------------------------------------------------------------------
+// Create cells and material ids.
+void
+pylith::meshio::MeshIOBox::_createCells(int_array* cells,
+					int_array* materialIds,
+					int* numCorners) const
+{ // _createCells
+  PYLITH_METHOD_BEGIN;
+
+  assert(cells);
+  assert(materialIds);
+  assert(numCorners);
+
+  const int meshDim = _meshDim();
+  const int nx = _numCells[0];
+  const int ny = _numCells[1];
+  const int nz = (3 == meshDim) ? _numCells[2] : 1;
+  const int strideY = nx+1;
+  const int strideZ = (nx+1)*(ny+1);
+
+  int numCellsGrid = 0;
+  switch (_cellType) {
+  case TRI3 :
+    *numCorners = 3;
+    numCellsGrid = 2;
+    break;
+  case QUAD4 :
+    *numCorners = 4;
+    numCellsGrid = 1;
+    break;
+  case TET4 :
+    *numCorners = 4;
+    numCellsGrid = 6;
+    break;
+  case HEX8 :
+    *numCorners = 8;
+    numCellsGrid = 1;
+    break;
+  default :
+    assert(0);
+    throw std::logic_error("Unknown cell type in MeshIOBox::_createCells().");
+  } // switch
+
+  // Tetrahedra follow paths from the first to the last vertex of the
+  // hexahedron along the edges in the order given by a permutation of
+  // the coordinate directions. Vertices of tetrahedra from odd
+  // permutations are reordered to give positive orientation.
+  const int numPermutations = 6;
+  const int permutations[numPermutations][3] = {
+    { 0, 1, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, // even
+    { 0, 2, 1 }, { 2, 1, 0 }, { 1, 0, 2 }, // odd
+  };
+  const int strides[3] = { 1, strideY, strideZ };
+
+  cells->resize(nx*ny*nz*numCellsGrid*(*numCorners));
+  materialIds->resize(nx*ny*nz*numCellsGrid);
+
+  int index = 0;
+  int iCell = 0;
+  for (int k=0; k < nz; ++k) {
+    for (int j=0; j < ny; ++j) {
+      for (int i=0; i < nx; ++i) {
+	// Material id from centroid of grid cell.
+	const int indices[3] = { i, j, k };
+	int materialId = _defaultMaterialId;
+	const int numBlocks = _materialBlocks.size();
+	for (int iBlock=0; iBlock < numBlocks; ++iBlock) {
+	  const MaterialBlock& block = _materialBlocks[iBlock];
+	  if (block.dir >= meshDim)
+	    continue;
+	  const PylithScalar dx = (_upper[block.dir] - _lower[block.dir]) / _numCells[block.dir];
+	  const PylithScalar xc = _lower[block.dir] + (indices[block.dir]+0.5)*dx;
+	  if (xc >= block.lower && xc <= block.upper)
+	    materialId = block.id;
+	} // for
+	for (int iSub=0; iSub < numCellsGrid; ++iSub)
+	  (*materialIds)[iCell++] = materialId;
+
+	const int v0 = i + j*strideY + k*strideZ;
+	switch (_cellType) {
+	case TRI3 :
+	  (*cells)[index++] = v0;
+	  (*cells)[index++] = v0+1;
+	  (*cells)[index++] = v0+1+strideY;
+
+	  (*cells)[index++] = v0;
+	  (*cells)[index++] = v0+1+strideY;
+	  (*cells)[index++] = v0+strideY;
+	  break;
+	case QUAD4 :
+	  (*cells)[index++] = v0;
+	  (*cells)[index++] = v0+1;
+	  (*cells)[index++] = v0+1+strideY;
+	  (*cells)[index++] = v0+strideY;
+	  break;
+	case TET4 :
+	  for (int iPerm=0; iPerm < numPermutations; ++iPerm) {
+	    const int* perm = permutations[iPerm];
+	    const int v1 = v0 + strides[perm[0]];
+	    const int v2 = v1 + strides[perm[1]];
+	    const int v3 = v2 + strides[perm[2]];
+	    (*cells)[index++] = v0;
+	    (*cells)[index++] = v1;
+	    (*cells)[index++] = (iPerm < 3) ? v2 : v3;
+	    (*cells)[index++] = (iPerm < 3) ? v3 : v2;
+	  } // for
+	  break;
+	case HEX8 :
+	  (*cells)[index++] = v0;
+	  (*cells)[index++] = v0+1;
+	  (*cells)[index++] = v0+1+strideY;
+	  (*cells)[index++] = v0+strideY;
+	  (*cells)[index++] = v0+strideZ;
+	  (*cells)[index++] = v0+1+strideZ;
+	  (*cells)[index++] = v0+1+strideY+strideZ;
+	  (*cells)[index++] = v0+strideY+strideZ;
+	  break;
+	default :
+	  assert(0);
+	  throw std::logic_error("Unknown cell type in MeshIOBox::_createCells().");
+	} // switch
+      } // for
+    } // for
+  } // for
+  assert(size_t(index) == cells->size());
+  assert(size_t(iCell) == materialIds->size());
+
+  PYLITH_METHOD_END;
+} // _createCells
+
+// ----------------------------------------------------------------------
+// Get vertices on a grid plane.
+void
+pylith::meshio::MeshIOBox::_planeVertices(int_array* points,
+					  const int dir,
+					  const int index) const
+{ // _planeVertices
+  PYLITH_METHOD_BEGIN;
+
+  assert(points);
+  assert(dir >= 0 && dir < _meshDim());
+  assert(index >= 0 && index <= _numCells[dir]);
+
+  const int meshDim = _meshDim();
+  const int nx = _numCells[0]+1;
+  const int ny = _numCells[1]+1;
+  const int nz = (3 == meshDim) ? _numCells[2]+1 : 1;
+  const int num[3] = { nx, ny, nz };
+
+  points->resize(nx*ny*nz / num[dir]);
+  int iPoint = 0;
+  for (int k=0; k < nz; ++k) {
+    if (2 == dir && k != index)
+      continue;
+    for (int j=0; j < ny; ++j) {
+      if (1 == dir && j != index)
+	continue;
+      for (int i=0; i < nx; ++i) {
+	if (0 == dir && i != index)
+	  continue;
+	(*points)[iPoint++] = i + j*nx + k*nx*ny;
+      } // for
+    } // for
+  } // for
+  assert(size_t(iPoint) == points->size());
+
+  PYLITH_METHOD_END;
+} // _planeVertices
+
+// ----------------------------------------------------------------------
+// Get index of grid plane matching coordinate.
+int
+pylith::meshio::MeshIOBox::_planeIndex(const int dir,
+				       const PylithScalar coordinate) const
+{ // _planeIndex
+  assert(dir >= 0 && dir < 3);
+
+  const PylithScalar dx = (_upper[dir] - _lower[dir]) / _numCells[dir];
+  const PylithScalar tolerance = 1.0e-6;
+  const PylithScalar xi = (coordinate - _lower[dir]) / dx;
+  const int index = int(floor(xi + 0.5));
+  if (index < 0 || index > _numCells[dir] || fabs(xi - index) > tolerance)
+    return -1;
+
+  return index;
+} // _planeIndex
+
+
+// End of file
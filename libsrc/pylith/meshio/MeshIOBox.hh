@@ -0,0 +1,242 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOBox.hh
+ *
+ * @brief C++ generator for structured meshes of a box.
+ *
+ * The box is divided into a uniform grid of quadrilateral (2-D) or
+ * hexahedral (3-D) cells, which are optionally split into triangles
+ * or tetrahedra. The mesh includes a vertex group for each face of
+ * the box ("face_xneg", "face_xpos", etc), a vertex group for each
+ * fault surface, and material ids assigned by layers along the
+ * coordinate directions.
+ *
+ * The mesh is generated in memory on process 0 and distributed in the
+ * same way as meshes read from files, so fault surfaces can be
+ * inserted before distribution.
+ */
+
+#if !defined(pylith_meshio_meshiobox_hh)
+#define pylith_meshio_meshiobox_hh
+
+// Include directives ---------------------------------------------------
+#include "MeshIO.hh" // ISA MeshIO
+
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+// MeshIOBox ------------------------------------------------------------
+/// C++ generator for structured meshes of a box.
+class pylith::meshio::MeshIOBox : public MeshIO
+{ // MeshIOBox
+  friend class TestMeshIOBox; // unit testing
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /// Type of cells.
+  enum CellEnum {
+    TRI3=0, ///< Triangles (2-D).
+    QUAD4=1, ///< Quadrilaterals (2-D).
+    TET4=2, ///< Tetrahedra (3-D).
+    HEX8=3, ///< Hexahedra (3-D).
+  }; // CellEnum
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  MeshIOBox(void);
+
+  /// Destructor
+  ~MeshIOBox(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set type of cells.
+   *
+   * @param value Type of cells.
+   */
+  void cellType(const CellEnum value);
+
+  /** Get type of cells.
+   *
+   * @returns Type of cells.
+   */
+  CellEnum cellType(void) const;
+
+  /** Set extent and number of cells along a coordinate direction.
+   *
+   * @param dir Coordinate direction (0=x, 1=y, 2=z).
+   * @param lower Minimum coordinate.
+   * @param upper Maximum coordinate.
+   * @param numCells Number of cells.
+   */
+  void axis(const int dir,
+	    const PylithScalar lower,
+	    const PylithScalar upper,
+	    const int numCells);
+
+  /** Add planar fault surface normal to a coordinate direction.
+   *
+   * The fault must coincide with an interior grid plane.
+   *
+   * @param name Name of vertex group for fault.
+   * @param dir Coordinate direction normal to fault (0=x, 1=y, 2=z).
+   * @param coordinate Coordinate of fault along direction.
+   */
+  void addFault(const char* name,
+		const int dir,
+		const PylithScalar coordinate);
+
+  /** Set material id of cells not in any material block.
+   *
+   * @param value Material id.
+   */
+  void defaultMaterialId(const int value);
+
+  /** Add material block. Cells with centroids in [lower, upper] along
+   * a coordinate direction are assigned the material id. Blocks added
+   * later take precedence.
+   *
+   * @param id Material id.
+   * @param dir Coordinate direction (0=x, 1=y, 2=z).
+   * @param lower Minimum coordinate of block.
+   * @param upper Maximum coordinate of block.
+   */
+  void addMaterialBlock(const int id,
+			const int dir,
+			const PylithScalar lower,
+			const PylithScalar upper);
+
+  /** Get number of vertices in mesh.
+   *
+   * @returns Number of vertices.
+   */
+  int numVertices(void) const;
+
+  /** Get number of cells in mesh.
+   *
+   * @returns Number of cells.
+   */
+  int numCells(void) const;
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /// Write mesh
+  void _write(void) const;
+
+  /// Read mesh
+  void _read(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Get dimension of mesh.
+   *
+   * @returns Dimension of mesh.
+   */
+  int _meshDim(void) const;
+
+  /** Create vertices.
+   *
+   * @param coordinates Array of vertex coordinates.
+   */
+  void _createVertices(scalar_array* coordinates) const;
+
+  /** Create cells and material ids.
+   *
+   * @param cells Array of vertices in cells.
+   * @param materialIds Array of material ids.
+   * @param numCorners Number of vertices in a cell.
+   */
+  void _createCells(int_array* cells,
+		    int_array* materialIds,
+		    int* numCorners) const;
+
+  /** Get vertices on a grid plane.
+   *
+   * @param points Array of vertices.
+   * @param dir Coordinate direction normal to plane.
+   * @param index Index of grid plane along direction.
+   */
+  void _planeVertices(int_array* points,
+		      const int dir,
+		      const int index) const;
+
+  /** Get index of grid plane matching coordinate.
+   *
+   * @param dir Coordinate direction.
+   * @param coordinate Coordinate along direction.
+   * @returns Index of grid plane or -1 if coordinate does not match a
+   * grid plane.
+   */
+  int _planeIndex(const int dir,
+		  const PylithScalar coordinate) const;
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  MeshIOBox(const MeshIOBox&); ///< Not implemented
+  const MeshIOBox& operator=(const MeshIOBox&); ///< Not implemented
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Planar fault surface.
+  struct Fault {
+    std::string name; ///< Name of vertex group.
+    int dir; ///< Coordinate direction normal to fault.
+    PylithScalar coordinate; ///< Coordinate along direction.
+  }; // Fault
+
+  /// Material block.
+  struct MaterialBlock {
+    int id; ///< Material id.
+    int dir; ///< Coordinate direction.
+    PylithScalar lower; ///< Minimum coordinate.
+    PylithScalar upper; ///< Maximum coordinate.
+  }; // MaterialBlock
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PylithScalar _lower[3]; ///< Minimum coordinates of box.
+  PylithScalar _upper[3]; ///< Maximum coordinates of box.
+  int _numCells[3]; ///< Number of cells along each direction.
+  CellEnum _cellType; ///< Type of cells.
+  int _defaultMaterialId; ///< Material id of cells not in a block.
+  std::vector<Fault> _faults; ///< Fault surfaces.
+  std::vector<MaterialBlock> _materialBlocks; ///< Material blocks.
+
+  static const char* _faceNames[3][2]; ///< Names of vertex groups for faces of box.
+
+}; // MeshIOBox
+
+#include "MeshIOBox.icc" // inline methods
+
+#endif // pylith_meshio_meshiobox_hh
+
+
+// End of file
@@ -0,0 +1,556 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOHDF5.hh" // implementation of class methods
+
+#include "HDF5.hh" // USES HDF5
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5Open()
+#include "journal/info.h" // USES journal::info_t
+
+#include <map> // USES std::map
+#include <algorithm> // USES std::sort()
+#include <vector> // USES std::vector
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+const char* pylith::meshio::MeshIOHDF5::groupParents[2] = {
+  "/vertex_groups",
+  "/cell_groups",
+};
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOHDF5::MeshIOHDF5(void) :
+  _filename("")
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOHDF5::~MeshIOHDF5(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOHDF5::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIO::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::MeshIOHDF5::_read(void)
+{ // _read
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  try {
+    MPI_Comm comm = _mesh->comm();
+    PetscErrorCode err = 0;
+
+    int meshDim = 0;
+    string_vector groupNames;
+    int_array groupTypes;
+    _readMetadata(&meshDim, &groupNames, &groupTypes);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, _filename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+
+    // Each process reads a contiguous block of vertices.
+    PetscVec verticesVec = NULL;
+    err = VecCreate(comm, &verticesVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) verticesVec, "vertices");PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PushGroup(viewer, "/geometry");PYLITH_CHECK_ERROR(err);
+    err = VecLoad(verticesVec, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    PetscInt spaceDim = 0, verticesSize = 0, vRStart = 0, vREnd = 0;
+    err = VecGetBlockSize(verticesVec, &spaceDim);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(verticesVec, &verticesSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(verticesVec, &vRStart, &vREnd);PYLITH_CHECK_ERROR(err);
+    assert(spaceDim > 0);
+    const PetscInt numVertices = verticesSize / spaceDim;
+    const PetscInt vertexOffset = vRStart / spaceDim;
+
+    // Each process reads a contiguous block of cells.
+    PetscVec cellsVec = NULL;
+    err = VecCreate(comm, &cellsVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) cellsVec, "cells");PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PushGroup(viewer, "/topology");PYLITH_CHECK_ERROR(err);
+    err = VecLoad(cellsVec, viewer);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numCorners = 0, cellsSize = 0, cRStart = 0, cREnd = 0;
+    err = VecGetBlockSize(cellsVec, &numCorners);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(cellsVec, &cellsSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(cellsVec, &cRStart, &cREnd);PYLITH_CHECK_ERROR(err);
+    assert(numCorners > 0);
+    const PetscInt numCells = cellsSize / numCorners;
+    const PetscInt cellOffset = cRStart / numCorners;
+
+    // Material identifiers follow the same partition as the cells.
+    PetscVec materialsVec = NULL;
+    err = VecCreate(comm, &materialsVec);PYLITH_CHECK_ERROR(err);
+    err = VecSetSizes(materialsVec, numCells, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(materialsVec, 1);PYLITH_CHECK_ERROR(err);
+    err = VecSetFromOptions(materialsVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) materialsVec, "material_ids");PYLITH_CHECK_ERROR(err);
+    err = VecLoad(materialsVec, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    journal::info_t info("meshiohdf5");
+    info << journal::at(__HERE__)
+	 << "Read " << numVertices << " vertices and " << numCells
+	 << " cells on process " << _mesh->commRank() << "." << journal::endl;
+
+    int_array cells(numCells*numCorners);
+    const PetscScalar* cellsArray = NULL;
+    err = VecGetArrayRead(cellsVec, &cellsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < cellsSize; ++i) {
+      cells[i] = PetscInt(cellsArray[i]);
+    } // for
+    err = VecRestoreArrayRead(cellsVec, &cellsArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&cellsVec);PYLITH_CHECK_ERROR(err);
+    for (PetscInt coff=0; coff < cellsSize; coff += numCorners) {
+      err = DMPlexInvertCell(meshDim, numCorners, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PetscDM dmMesh = NULL;
+    PetscSF vertexSF = NULL;
+    const PetscScalar* verticesArray = NULL;
+    err = VecGetArrayRead(verticesVec, &verticesArray);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreateFromCellListParallel(comm, meshDim, numCells, numVertices, numCorners, PETSC_TRUE, &cells[0], spaceDim, verticesArray, &vertexSF, &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(verticesVec, &verticesArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&verticesVec);PYLITH_CHECK_ERROR(err);
+    _mesh->dmMesh(dmMesh);
+
+    // Cells retain the order in which they were read.
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    assert(cellsStratum.size() == numCells);
+    const PetscScalar* materialsArray = NULL;
+    err = VecGetArrayRead(materialsVec, &materialsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+      err = DMSetLabelValue(dmMesh, "material-id", c, PetscInt(materialsArray[c-cStart]));PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayRead(materialsVec, &materialsArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&materialsVec);PYLITH_CHECK_ERROR(err);
+
+    // Global ids of the vertices in the local mesh come from the
+    // block of vertices that owns them.
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    int_array blockGlobalIds(numVertices);
+    for (PetscInt v=0; v < numVertices; ++v) {
+      blockGlobalIds[v] = vertexOffset + v;
+    } // for
+    int_array vertexGlobalIds(verticesStratum.size());
+    err = PetscSFBcastBegin(vertexSF, MPIU_INT, &blockGlobalIds[0], &vertexGlobalIds[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(vertexSF, MPIU_INT, &blockGlobalIds[0], &vertexGlobalIds[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&vertexSF);PYLITH_CHECK_ERROR(err);
+
+    _readGroups(viewer, groupNames, groupTypes, vertexGlobalIds, cellOffset);
+
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+  } catch (std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error while reading HDF5 mesh file '" << _filename << "'.\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Unknown error while reading HDF5 mesh file '" << _filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // _read
+
+// ----------------------------------------------------------------------
+// Write mesh to file.
+void
+pylith::meshio::MeshIOHDF5::_write(void) const
+{ // _write
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  MPI_Comm comm = _mesh->comm();
+  PetscErrorCode err = 0;
+
+  PetscViewer viewer = NULL;
+  err = PetscViewerHDF5Open(comm, _filename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+  err = PetscViewerHDF5SetBaseDimension2(viewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+
+  PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+
+  // Vertices owned by this process, in global vertex order.
+  PetscVec coordVec = NULL;
+  PetscInt coordSize = 0, spaceDim = 0;
+  PylithScalar lengthScale = 1.0;
+  err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinates(dmMesh, &coordVec);PYLITH_CHECK_ERROR(err);
+  err = VecGetLocalSize(coordVec, &coordSize);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateDim(dmMesh, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+  PetscVec verticesVec = NULL;
+  err = VecCreate(comm, &verticesVec);PYLITH_CHECK_ERROR(err);
+  err = VecSetSizes(verticesVec, coordSize, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+  err = VecSetBlockSize(verticesVec, spaceDim);PYLITH_CHECK_ERROR(err);
+  err = VecSetFromOptions(verticesVec);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) verticesVec, "vertices");PYLITH_CHECK_ERROR(err);
+  err = VecCopy(coordVec, verticesVec);PYLITH_CHECK_ERROR(err);
+  err = VecScale(verticesVec, lengthScale);PYLITH_CHECK_ERROR(err);
+  err = PetscViewerHDF5PushGroup(viewer, "/geometry");PYLITH_CHECK_ERROR(err);
+  err = VecView(verticesVec, viewer);PYLITH_CHECK_ERROR(err);
+  err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&verticesVec);PYLITH_CHECK_ERROR(err);
+
+  // Cells with global vertex numbers.
+  int numCells = 0, numCorners = 0, meshDim = 0;
+  int_array cells;
+  _getCells(&cells, &numCells, &numCorners, &meshDim);
+  int_array materialIds;
+  _getMaterials(&materialIds);
+
+  PetscVec cellsVec = NULL;
+  PetscScalar* cellsArray = NULL;
+  err = VecCreate(comm, &cellsVec);PYLITH_CHECK_ERROR(err);
+  err = VecSetSizes(cellsVec, numCells*numCorners, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+  err = VecSetBlockSize(cellsVec, numCorners);PYLITH_CHECK_ERROR(err);
+  err = VecSetFromOptions(cellsVec);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) cellsVec, "cells");PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(cellsVec, &cellsArray);PYLITH_CHECK_ERROR(err);
+  for (int i=0; i < numCells*numCorners; ++i) {
+    cellsArray[i] = cells[i];
+  } // for
+  err = VecRestoreArray(cellsVec, &cellsArray);PYLITH_CHECK_ERROR(err);
+
+  PetscVec materialsVec = NULL;
+  PetscScalar* materialsArray = NULL;
+  err = VecCreate(comm, &materialsVec);PYLITH_CHECK_ERROR(err);
+  err = VecSetSizes(materialsVec, numCells, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+  err = VecSetBlockSize(materialsVec, 1);PYLITH_CHECK_ERROR(err);
+  err = VecSetFromOptions(materialsVec);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) materialsVec, "material_ids");PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(materialsVec, &materialsArray);PYLITH_CHECK_ERROR(err);
+  for (int i=0; i < numCells; ++i) {
+    materialsArray[i] = materialIds[i];
+  } // for
+  err = VecRestoreArray(materialsVec, &materialsArray);PYLITH_CHECK_ERROR(err);
+
+  err = PetscViewerHDF5PushGroup(viewer, "/topology");PYLITH_CHECK_ERROR(err);
+  err = VecView(cellsVec, viewer);PYLITH_CHECK_ERROR(err);
+  err = VecView(materialsVec, viewer);PYLITH_CHECK_ERROR(err);
+  err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&cellsVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&materialsVec);PYLITH_CHECK_ERROR(err);
+
+  hid_t h5 = -1;
+  err = PetscViewerHDF5GetFileId(viewer, &h5);PYLITH_CHECK_ERROR(err);
+  assert(h5 >= 0);
+  HDF5::writeAttribute(h5, "/topology/cells", "cell_dim", (void*)&meshDim, H5T_NATIVE_INT);
+
+  _writeGroups(viewer);
+
+  err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _write
+
+// ----------------------------------------------------------------------
+// Read cell dimension and names of groups.
+void
+pylith::meshio::MeshIOHDF5::_readMetadata(int* meshDim,
+					  string_vector* groupNames,
+					  int_array* groupTypes) const
+{ // _readMetadata
+  PYLITH_METHOD_BEGIN;
+
+  assert(meshDim);
+  assert(groupNames);
+  assert(groupTypes);
+  assert(_mesh);
+
+  MPI_Comm comm = _mesh->comm();
+  PetscErrorCode err = 0;
+
+  // Pack group names, each prefixed by the group type, into a single
+  // buffer of null terminated strings in order of creation.
+  std::string nameBuffer;
+  if (!_mesh->commRank()) {
+    HDF5 h5(_filename.c_str(), H5F_ACC_RDONLY);
+    h5.readAttribute("/topology/cells", "cell_dim", (void*)meshDim, H5T_NATIVE_INT);
+
+    std::map<int,std::string> groups;
+    for (int iType=VERTEX; iType <= CELL; ++iType) {
+      const char* parent = groupParents[iType];
+      if (!h5.hasGroup(parent)) {
+	continue;
+      } // if
+      string_vector names;
+      h5.getGroupDatasets(&names, parent);
+      const size_t numNames = names.size();
+      for (size_t i=0; i < numNames; ++i) {
+	const std::string dataset = std::string(parent) + "/" + names[i];
+	int groupIndex = 0;
+	h5.readAttribute(dataset.c_str(), "group_index", (void*)&groupIndex, H5T_NATIVE_INT);
+	groups[groupIndex] = std::string(1, char('0'+iType)) + names[i];
+      } // for
+    } // for
+    for (std::map<int,std::string>::const_iterator iter=groups.begin(); iter != groups.end(); ++iter) {
+      nameBuffer += iter->second;
+      nameBuffer += '\0';
+    } // for
+    h5.close();
+  } // if
+
+  err = MPI_Bcast(meshDim, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+  int bufferSize = nameBuffer.size();
+  err = MPI_Bcast(&bufferSize, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+  nameBuffer.resize(bufferSize);
+  if (bufferSize > 0) {
+    err = MPI_Bcast(&nameBuffer[0], bufferSize, MPI_CHAR, 0, comm);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  std::vector<std::string> names;
+  std::vector<int> types;
+  for (size_t pos=0; pos < nameBuffer.size(); ) {
+    const size_t end = nameBuffer.find('\0', pos);
+    types.push_back(nameBuffer[pos] - '0');
+    names.push_back(nameBuffer.substr(pos+1, end-pos-1));
+    pos = end + 1;
+  } // for
+  const size_t numGroups = names.size();
+  groupNames->resize(numGroups);
+  groupTypes->resize(numGroups);
+  for (size_t i=0; i < numGroups; ++i) {
+    (*groupNames)[i] = names[i];
+    (*groupTypes)[i] = types[i];
+  } // for
+
+  PYLITH_METHOD_END;
+} // _readMetadata
+
+// ----------------------------------------------------------------------
+// Read groups and mark local points.
+void
+pylith::meshio::MeshIOHDF5::_readGroups(PetscViewer viewer,
+					const string_vector& groupNames,
+					const int_array& groupTypes,
+					const int_array& vertexGlobalIds,
+					const int cellOffset)
+{ // _readGroups
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+  assert(groupNames.size() == groupTypes.size());
+
+  MPI_Comm comm = _mesh->comm();
+  PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt numCells = cellsStratum.size();
+  PetscErrorCode err = 0;
+
+  std::map<PetscInt,PetscInt> vertexGlobalToLocal;
+  const size_t numLocalVertices = vertexGlobalIds.size();
+  for (size_t v=0; v < numLocalVertices; ++v) {
+    vertexGlobalToLocal[vertexGlobalIds[v]] = v;
+  } // for
+
+  const size_t numGroups = groupNames.size();
+  for (size_t iGroup=0; iGroup < numGroups; ++iGroup) {
+    const GroupPtType type = GroupPtType(groupTypes[iGroup]);
+
+    // Groups are read in blocks and then gathered, because the points
+    // of a group may be on any process.
+    PetscVec groupVec = NULL;
+    err = VecCreate(comm, &groupVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) groupVec, groupNames[iGroup].c_str());PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PushGroup(viewer, groupParents[type]);PYLITH_CHECK_ERROR(err);
+    err = VecLoad(groupVec, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    PetscVecScatter scatter = NULL;
+    PetscVec groupAllVec = NULL;
+    err = VecScatterCreateToAll(groupVec, &scatter, &groupAllVec);PYLITH_CHECK_ERROR(err);
+    err = VecScatterBegin(scatter, groupVec, groupAllVec, INSERT_VALUES, SCATTER_FORWARD);PYLITH_CHECK_ERROR(err);
+    err = VecScatterEnd(scatter, groupVec, groupAllVec, INSERT_VALUES, SCATTER_FORWARD);PYLITH_CHECK_ERROR(err);
+    err = VecScatterDestroy(&scatter);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&groupVec);PYLITH_CHECK_ERROR(err);
+
+    PetscInt groupSize = 0;
+    const PetscScalar* groupArray = NULL;
+    err = VecGetLocalSize(groupAllVec, &groupSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(groupAllVec, &groupArray);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> localPoints;
+    for (PetscInt i=0; i < groupSize; ++i) {
+      const PetscInt globalId = PetscInt(groupArray[i]);
+      if (VERTEX == type) {
+	const std::map<PetscInt,PetscInt>::const_iterator iter = vertexGlobalToLocal.find(globalId);
+	if (iter != vertexGlobalToLocal.end()) {
+	  localPoints.push_back(iter->second);
+	} // if
+      } else {
+	const PetscInt cell = globalId - cellOffset;
+	if (cell >= 0 && cell < numCells) {
+	  localPoints.push_back(cell);
+	} // if
+      } // if/else
+    } // for
+    err = VecRestoreArrayRead(groupAllVec, &groupArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&groupAllVec);PYLITH_CHECK_ERROR(err);
+
+    std::sort(localPoints.begin(), localPoints.end());
+    int_array points(localPoints.size());
+    for (size_t i=0; i < localPoints.size(); ++i) {
+      points[i] = localPoints[i];
+    } // for
+    _setGroup(groupNames[iGroup], type, points);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _readGroups
+
+// ----------------------------------------------------------------------
+// Write groups.
+void
+pylith::meshio::MeshIOHDF5::_writeGroups(PetscViewer viewer) const
+{ // _writeGroups
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  MPI_Comm comm = _mesh->comm();
+  PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  PetscErrorCode err = 0;
+
+  string_vector groupNames;
+  _getGroupNames(&groupNames);
+  const int numGroups = groupNames.size();
+
+  PetscIS globalVertexNumbers = NULL, globalCellNumbers = NULL;
+  const PetscInt* gvertex = NULL;
+  const PetscInt* gcell = NULL;
+  err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(globalVertexNumbers, &gvertex);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetCellNumbering(dmMesh, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(globalCellNumbers, &gcell);PYLITH_CHECK_ERROR(err);
+
+  hid_t h5 = -1;
+  err = PetscViewerHDF5GetFileId(viewer, &h5);PYLITH_CHECK_ERROR(err);
+  assert(h5 >= 0);
+
+  for (int iGroup=0; iGroup < numGroups; ++iGroup) {
+    const char* name = groupNames[iGroup].c_str();
+
+    // Only write points owned by this process, using global numbers.
+    std::vector<PetscInt> groupPoints;
+    int isCellGroup = 0;
+    PetscIS groupIS = NULL;
+    err = DMGetStratumIS(dmMesh, name, 1, &groupIS);PYLITH_CHECK_ERROR(err);
+    if (groupIS) {
+      PetscInt groupSize = 0;
+      const PetscInt* groupIndices = NULL;
+      err = ISGetLocalSize(groupIS, &groupSize);PYLITH_CHECK_ERROR(err);
+      err = ISGetIndices(groupIS, &groupIndices);PYLITH_CHECK_ERROR(err);
+      for (PetscInt i=0; i < groupSize; ++i) {
+	const PetscInt point = groupIndices[i];
+	if (point >= cStart && point < cEnd) {
+	  isCellGroup = 1;
+	  if (gcell[point-cStart] >= 0) {
+	    groupPoints.push_back(gcell[point-cStart]);
+	  } // if
+	} else if (point >= vStart && point < vEnd && gvertex[point-vStart] >= 0) {
+	  groupPoints.push_back(gvertex[point-vStart]);
+	} // if/else
+      } // for
+      err = ISRestoreIndices(groupIS, &groupIndices);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&groupIS);PYLITH_CHECK_ERROR(err);
+    } // if
+    int isCellGroupAll = 0;
+    err = MPI_Allreduce(&isCellGroup, &isCellGroupAll, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    if (isCellGroupAll) {
+      // Cell groups hold only cells, so drop any lower dimension points.
+      groupPoints.clear();
+      for (PetscInt c=cStart; c < cEnd; ++c) {
+	PetscInt value = 0;
+	err = DMGetLabelValue(dmMesh, name, c, &value);PYLITH_CHECK_ERROR(err);
+	if (1 == value && gcell[c-cStart] >= 0) {
+	  groupPoints.push_back(gcell[c-cStart]);
+	} // if
+      } // for
+    } // if
+    const GroupPtType type = isCellGroupAll ? CELL : VERTEX;
+
+    PetscVec groupVec = NULL;
+    PetscScalar* groupArray = NULL;
+    const PetscInt groupSize = groupPoints.size();
+    err = VecCreate(comm, &groupVec);PYLITH_CHECK_ERROR(err);
+    err = VecSetSizes(groupVec, groupSize, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(groupVec, 1);PYLITH_CHECK_ERROR(err);
+    err = VecSetFromOptions(groupVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) groupVec, name);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(groupVec, &groupArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < groupSize; ++i) {
+      groupArray[i] = groupPoints[i];
+    } // for
+    err = VecRestoreArray(groupVec, &groupArray);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PushGroup(viewer, groupParents[type]);PYLITH_CHECK_ERROR(err);
+    err = VecView(groupVec, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&groupVec);PYLITH_CHECK_ERROR(err);
+
+    // Group names are returned in order of creation; keep that order
+    // when the groups are read.
+    const std::string dataset = std::string(groupParents[type]) + "/" + name;
+    HDF5::writeAttribute(h5, dataset.c_str(), "group_index", (void*)&iGroup, H5T_NATIVE_INT);
+  } // for
+
+  err = ISRestoreIndices(globalCellNumbers, &gcell);PYLITH_CHECK_ERROR(err);
+  err = ISRestoreIndices(globalVertexNumbers, &gvertex);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _writeGroups
+
+
+// End of file
@@ -0,0 +1,133 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOHDF5.hh
+ *
+ * @brief C++ input/output manager for PyLith HDF5 mesh files.
+ *
+ * The layout matches the one used by DataWriterHDF5 for the mesh
+ * topology and geometry, with material identifiers and groups added:
+ *
+ *   /geometry/vertices (numVertices, spaceDim)
+ *   /topology/cells (numCells, numCorners), attribute cell_dim
+ *   /topology/material_ids (numCells, 1)
+ *   /vertex_groups/NAME (numGroupVertices, 1), attribute group_index
+ *   /cell_groups/NAME (numGroupCells, 1), attribute group_index
+ *
+ * All processes read contiguous blocks of vertices and cells so the
+ * mesh is created directly in distributed form.
+ */
+
+#if !defined(pylith_meshio_meshiohdf5_hh)
+#define pylith_meshio_meshiohdf5_hh
+
+// Include directives ---------------------------------------------------
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <string> // HASA std::string
+
+// MeshIOHDF5 -----------------------------------------------------------
+/// C++ input/output manager for PyLith HDF5 mesh files.
+class pylith::meshio::MeshIOHDF5 : public MeshIO
+{ // MeshIOHDF5
+  friend class TestMeshIOHDF5; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  MeshIOHDF5(void);
+
+  /// Destructor
+  ~MeshIOHDF5(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set filename for HDF5 file.
+   *
+   * @param filename Name of file
+   */
+  void filename(const char* name);
+
+  /** Get filename of HDF5 file.
+   *
+   * @returns Name of file
+   */
+  const char* filename(void) const;
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /// Write mesh
+  void _write(void) const;
+
+  /// Read mesh
+  void _read(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Read cell dimension and names of groups.
+   *
+   * Metadata is read on process 0 and broadcast to all processes.
+   *
+   * @param meshDim Pointer to dimension of cells.
+   * @param groupNames Pointer to names of groups in order of creation.
+   * @param groupTypes Pointer to types of groups.
+   */
+  void _readMetadata(int* meshDim,
+		     string_vector* groupNames,
+		     int_array* groupTypes) const;
+
+  /** Read groups and mark local points.
+   *
+   * @param viewer PETSc HDF5 viewer.
+   * @param groupNames Names of groups.
+   * @param groupTypes Types of groups.
+   * @param vertexGlobalIds Global ids of local vertices.
+   * @param cellOffset Global id of first local cell.
+   */
+  void _readGroups(PetscViewer viewer,
+		   const string_vector& groupNames,
+		   const int_array& groupTypes,
+		   const int_array& vertexGlobalIds,
+		   const int cellOffset);
+
+  /** Write groups.
+   *
+   * @param viewer PETSc HDF5 viewer.
+   */
+  void _writeGroups(PetscViewer viewer) const;
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::string _filename; ///< Name of file
+
+  static
+  const char *groupParents[]; ///< HDF5 groups holding each type of mesh group.
+
+}; // MeshIOHDF5
+
+#include "MeshIOHDF5.icc" // inline methods
+
+#endif // pylith_meshio_meshiohdf5_hh
+
+// End of file
@@ -22,7 +22,9 @@
 
 #include "DataWriter.hh" // USES DataWriter
 #include "VertexFilter.hh" // USES VertexFilter
+#include "VertexFilterTemporal.hh" // USES VertexFilterTemporal
 #include "CellFilter.hh" // USES CellFilter
+#include "CellFilterTemporal.hh" // USES CellFilterTemporal
 
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Fields.hh" // USES Fields
@@ -225,6 +227,71 @@ pylith::meshio::OutputManager::appendCellField(const PylithScalar t,
   PYLITH_METHOD_END;
 } // appendCellField
 
+// ----------------------------------------------------------------------
+// Update temporal reduction of vertex field.
+void
+pylith::meshio::OutputManager::updateVertexField(const PylithScalar t,
+						 const topology::Field& field)
+{ // updateVertexField
+  PYLITH_METHOD_BEGIN;
+
+  VertexFilterTemporal* filter = dynamic_cast<VertexFilterTemporal*>(_vertexFilter);
+  if (filter) {
+    filter->update(t, field);
+  } // if
+
+  PYLITH_METHOD_END;
+} // updateVertexField
+
+// ----------------------------------------------------------------------
+// Update temporal reduction of cell field.
+void
+pylith::meshio::OutputManager::updateCellField(const PylithScalar t,
+					       const topology::Field& field,
+					       const char* label,
+					       const int labelId)
+{ // updateCellField
+  PYLITH_METHOD_BEGIN;
+
+  CellFilterTemporal* filter = dynamic_cast<CellFilterTemporal*>(_cellFilter);
+  if (filter) {
+    filter->update(t, field, label, labelId);
+  } // if
+
+  PYLITH_METHOD_END;
+} // updateCellField
+
+// ----------------------------------------------------------------------
+// Write current temporal reductions of all fields as a time step.
+void
+pylith::meshio::OutputManager::writeReductions(const PylithScalar t,
+					       const topology::Mesh& mesh,
+					       const char* label,
+					       const int labelId)
+{ // writeReductions
+  PYLITH_METHOD_BEGIN;
+
+  VertexFilterTemporal* vertexFilter = dynamic_cast<VertexFilterTemporal*>(_vertexFilter);
+  CellFilterTemporal* cellFilter = dynamic_cast<CellFilterTemporal*>(_cellFilter);
+  const int numVertexFields = (vertexFilter) ? vertexFilter->numReduced() : 0;
+  const int numCellFields = (cellFilter) ? cellFilter->numReduced() : 0;
+  if (!numVertexFields && !numCellFields) {
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(_writer);
+  _writer->openTimeStep(t, mesh, label, labelId);
+  for (int i=0; i < numVertexFields; ++i) {
+    _writer->writeVertexField(t, _dimension(vertexFilter->reduced(i)), mesh);
+  } // for
+  for (int i=0; i < numCellFields; ++i) {
+    _writer->writeCellField(t, _dimension(cellFilter->reduced(i)), label, labelId);
+  } // for
+  _writer->closeTimeStep();
+
+  PYLITH_METHOD_END;
+} // writeReductions
+
 // ----------------------------------------------------------------------
 // Dimension field.
 pylith::topology::Field&
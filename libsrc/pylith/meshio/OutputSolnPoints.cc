@@ -64,6 +64,11 @@ pylith::meshio::OutputSolnPoints::deallocate(void)
     _mesh = 0; // :TODO: Use shared pointer
     delete _pointsMesh; _pointsMesh = 0;
 
+    _pointIndices.resize(0);
+    _weightsOffsets.resize(0);
+    _weightsVertices.resize(0);
+    _weights.resize(0);
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -169,6 +174,8 @@ pylith::meshio::OutputSolnPoints::setupInterpolator(topology::Mesh* mesh,
 
     // Copy station names. :TODO: Reorder to match output (pointsLocal).
     _stations.resize(numPointsLocal);
+    _pointIndices.resize(numPointsLocal);
+    _pointIndices = -1;
     for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
 	// Find point in array of points to get index for station name.
 	for (int iAll=0; iAll < numPoints; ++iAll) {
@@ -179,6 +186,7 @@ pylith::meshio::OutputSolnPoints::setupInterpolator(topology::Mesh* mesh,
 	    } // for
 	    if (sqrt(dist) < tolerance) {
 		_stations[iLocal] = names[iAll];
+		_pointIndices[iLocal] = iAll;
 		break;
 	    } // if
 	} // for
@@ -324,4 +332,156 @@ pylith::meshio::OutputSolnPoints::writePointNames(void)
     PYLITH_METHOD_END;
 } // writePointNames
 
+// ----------------------------------------------------------------------
+// Set source term of adjoint problem for a component of the solution
+// interpolated to a point.
+void
+pylith::meshio::OutputSolnPoints::adjointSource(topology::Field* source,
+                                                const int point,
+                                                const int component)
+{ // adjointSource
+    PYLITH_METHOD_BEGIN;
+
+    assert(source);
+    assert(_interpolator);
+
+    if (!_weightsOffsets.size()) {
+        _setupInterpolationWeights(source);
+    } // if
+    assert(_weightsOffsets.size() == _pointIndices.size()+1);
+
+    source->zeroAll();
+
+    // Only the process with the point adds the weights.
+    const int numPointsLocal = _pointIndices.size();
+    int iLocal = 0;
+    for (; iLocal < numPointsLocal; ++iLocal) {
+        if (point == _pointIndices[iLocal]) {
+            break;
+        } // if
+    } // for
+    if (iLocal < numPointsLocal) {
+        PetscSection sourceSection = source->localSection(); assert(sourceSection);
+        PetscVec sourceVec = source->localVector(); assert(sourceVec);
+        PetscScalar* sourceArray = NULL;
+        PetscErrorCode err = 0;
+        err = VecGetArray(sourceVec, &sourceArray); PYLITH_CHECK_ERROR(err);
+        for (int iWeight=_weightsOffsets[iLocal]; iWeight < _weightsOffsets[iLocal+1]; ++iWeight) {
+            PetscInt off = 0, dof = 0;
+            err = PetscSectionGetOffset(sourceSection, _weightsVertices[iWeight], &off); PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetDof(sourceSection, _weightsVertices[iWeight], &dof); PYLITH_CHECK_ERROR(err);
+            assert(component >= 0 && component < dof);
+            sourceArray[off+component] += _weights[iWeight];
+        } // for
+        err = VecRestoreArray(sourceVec, &sourceArray); PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Assemble contributions at vertices shared with other processes.
+    source->complete();
+
+    PYLITH_METHOD_END;
+} // adjointSource
+
+// ----------------------------------------------------------------------
+// Compute weights of vertices for interpolating a field to the local
+// points.
+void
+pylith::meshio::OutputSolnPoints::_setupInterpolationWeights(topology::Field* field)
+{ // _setupInterpolationWeights
+    PYLITH_METHOD_BEGIN;
+
+    assert(field);
+    assert(_interpolator);
+
+    PetscErrorCode err = 0;
+
+    PetscDM dmMesh = field->dmMesh(); assert(dmMesh);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+    const PetscInt numVertices = verticesStratum.size();
+
+    PetscSection fieldSection = field->localSection(); assert(fieldSection);
+    PetscInt fiberDimLocal = 0;
+    if (numVertices > 0) {
+        err = PetscSectionGetDof(fieldSection, vStart, &fiberDimLocal); PYLITH_CHECK_ERROR(err);
+    } // if
+    PetscInt fiberDim = 0;
+    err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm()); PYLITH_CHECK_ERROR(err);
+    assert(fiberDim > 0);
+
+    const int numPointsLocal = _interpolator->n;
+    assert(size_t(numPointsLocal) == _pointIndices.size());
+
+    // Count vertices in cells containing points.
+    _weightsOffsets.resize(numPointsLocal+1);
+    _weightsOffsets[0] = 0;
+    for (int iPoint=0; iPoint < numPointsLocal; ++iPoint) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        int count = 0;
+        err = DMPlexGetTransitiveClosure(dmMesh, _interpolator->cells[iPoint], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        for (PetscInt c=0; c < closureSize*2; c += 2) {
+            if (closure[c] >= vStart && closure[c] < vEnd) {
+                ++count;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, _interpolator->cells[iPoint], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        _weightsOffsets[iPoint+1] = _weightsOffsets[iPoint] + count;
+    } // for
+    const int numWeights = _weightsOffsets[numPointsLocal];
+    _weightsVertices.resize(numWeights);
+    _weights.resize(numWeights);
+
+    if (numPointsLocal > 0) {
+        // Interpolate unit value of the first component at each vertex
+        // of the cell containing a point. Interpolation is linear in the
+        // vertex values, so the interpolated value is the weight of the
+        // vertex.
+        field->zeroAll();
+        PetscVec fieldVec = field->localVector(); assert(fieldVec);
+        PetscVec interpVec = NULL;
+        err = VecCreateSeq(PETSC_COMM_SELF, numPointsLocal*fiberDim, &interpVec); PYLITH_CHECK_ERROR(err);
+        err = DMInterpolationSetDof(_interpolator, fiberDim); PYLITH_CHECK_ERROR(err);
+
+        for (int iPoint=0; iPoint < numPointsLocal; ++iPoint) {
+            PetscInt* closure = NULL;
+            PetscInt closureSize = 0;
+            err = DMPlexGetTransitiveClosure(dmMesh, _interpolator->cells[iPoint], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+            int iWeight = _weightsOffsets[iPoint];
+            for (PetscInt c=0; c < closureSize*2; c += 2) {
+                const PetscInt vertex = closure[c];
+                if (vertex < vStart || vertex >= vEnd) {
+                    continue;
+                } // if
+                PetscInt off = 0;
+                err = PetscSectionGetOffset(fieldSection, vertex, &off); PYLITH_CHECK_ERROR(err);
+
+                PetscScalar* fieldArray = NULL;
+                err = VecGetArray(fieldVec, &fieldArray); PYLITH_CHECK_ERROR(err);
+                fieldArray[off] = 1.0;
+                err = VecRestoreArray(fieldVec, &fieldArray); PYLITH_CHECK_ERROR(err);
+
+                err = DMInterpolationEvaluate(_interpolator, dmMesh, fieldVec, interpVec); PYLITH_CHECK_ERROR(err);
+
+                const PetscScalar* interpArray = NULL;
+                err = VecGetArrayRead(interpVec, &interpArray); PYLITH_CHECK_ERROR(err);
+                _weightsVertices[iWeight] = vertex;
+                _weights[iWeight] = interpArray[iPoint*fiberDim];
+                err = VecRestoreArrayRead(interpVec, &interpArray); PYLITH_CHECK_ERROR(err);
+                ++iWeight;
+
+                err = VecGetArray(fieldVec, &fieldArray); PYLITH_CHECK_ERROR(err);
+                fieldArray[off] = 0.0;
+                err = VecRestoreArray(fieldVec, &fieldArray); PYLITH_CHECK_ERROR(err);
+            } // for
+            assert(_weightsOffsets[iPoint+1] == iWeight);
+            err = DMPlexRestoreTransitiveClosure(dmMesh, _interpolator->cells[iPoint], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        } // for
+        err = VecDestroy(&interpVec); PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupInterpolationWeights
+
 // End of file
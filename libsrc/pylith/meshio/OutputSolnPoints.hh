@@ -36,6 +36,8 @@
 #include "pylith/topology/Field.hh" // ISA OutputManager<Field<Mesh>>
 #include "OutputManager.hh" // ISA OutputManager
 
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array
+
 // OutputSolnPoints -----------------------------------------------------
 /** @brief C++ object for managing output of finite-element data over
  * a subdomain.
@@ -133,6 +135,36 @@ void appendCellField(const PylithScalar t,
  */
 void writePointNames(void);
 
+/** Set source term of adjoint problem for a component of the
+ * solution interpolated to a point.
+ *
+ * The source term is the transpose of the interpolation operator
+ * applied to the unit vector for the point and component, so that the
+ * inner product of the source term with a field is the value of the
+ * field component interpolated to the point.
+ *
+ * @param source Field for source term (layout of solution field).
+ * @param point Index of point in array of points used to setup interpolator.
+ * @param component Index of component.
+ */
+void adjointSource(pylith::topology::Field* source,
+                   const int point,
+                   const int component);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+/** Compute weights of vertices for interpolating a field to the
+ * local points.
+ *
+ * The weights are computed by interpolating unit values at each
+ * vertex in the cell containing a point, so they match the
+ * interpolation used for output.
+ *
+ * @param field Field with layout of fields to interpolate (values are zeroed).
+ */
+void _setupInterpolationWeights(pylith::topology::Field* field);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
@@ -146,6 +178,10 @@ pylith::topology::Mesh* _mesh;   ///< Domain mesh.
 pylith::topology::Mesh* _pointsMesh;   ///< Mesh for points (no cells).
 DMInterpolationInfo _interpolator;   ///< Field interpolator.
 pylith::string_vector _stations; ///< Array of station names.
+pylith::int_array _pointIndices; ///< Index of local points in array of points used to setup interpolator.
+pylith::int_array _weightsOffsets; ///< Offset of interpolation weights for each local point.
+pylith::int_array _weightsVertices; ///< Vertex associated with each interpolation weight.
+pylith::scalar_array _weights; ///< Weights for interpolating vertex values to local points.
 
 }; // OutputSolnPoints
 
@@ -0,0 +1,384 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TemporalReduction.hh" // Implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include <algorithm> // USES std::max(), std::min()
+#include <cmath> // USES sqrt()
+#include <strings.h> // USES strcasecmp()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::TemporalReduction::TemporalReduction(void) :
+  _threshold(0.0),
+  _timeScale(1.0),
+  _t(0.0),
+  _reduction(MAXIMUM)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::TemporalReduction::TemporalReduction(const TemporalReduction& r) :
+  _threshold(r._threshold),
+  _timeScale(r._timeScale),
+  _t(0.0),
+  _reduction(r._reduction)
+{ // copy constructor
+} // copy constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::TemporalReduction::~TemporalReduction(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::TemporalReduction::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  const state_map_type::iterator statesEnd = _states.end();
+  for (state_map_type::iterator s_iter=_states.begin(); s_iter != statesEnd; ++s_iter) {
+    delete s_iter->second.accum; s_iter->second.accum = 0;
+    delete s_iter->second.output; s_iter->second.output = 0;
+  } // for
+  _states.clear();
+  _labels.clear();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Set type of reduction.
+void
+pylith::meshio::TemporalReduction::reduction(const char* value)
+{ // reduction
+  PYLITH_METHOD_BEGIN;
+
+  assert(value);
+  if (0 == strcasecmp(value, "max")) {
+    _reduction = MAXIMUM;
+  } else if (0 == strcasecmp(value, "min")) {
+    _reduction = MINIMUM;
+  } else if (0 == strcasecmp(value, "mean")) {
+    _reduction = MEAN;
+  } else if (0 == strcasecmp(value, "rms")) {
+    _reduction = RMS;
+  } else if (0 == strcasecmp(value, "threshold_time")) {
+    _reduction = THRESHOLD_TIME;
+  } else {
+    std::ostringstream msg;
+    msg << "Unknown temporal reduction '" << value << "'. Valid reductions are "
+	<< "'max', 'min', 'mean', 'rms', and 'threshold_time'.";
+    throw std::runtime_error(msg.str());
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // reduction
+
+// ----------------------------------------------------------------------
+// Get type of reduction.
+pylith::meshio::TemporalReduction::ReductionEnum
+pylith::meshio::TemporalReduction::reduction(void) const
+{ // reduction
+  return _reduction;
+} // reduction
+
+// ----------------------------------------------------------------------
+// Set threshold for THRESHOLD_TIME reduction.
+void
+pylith::meshio::TemporalReduction::threshold(const PylithScalar value)
+{ // threshold
+  _threshold = value;
+} // threshold
+
+// ----------------------------------------------------------------------
+// Set time scale used to dimensionalize THRESHOLD_TIME.
+void
+pylith::meshio::TemporalReduction::timeScale(const PylithScalar value)
+{ // timeScale
+  PYLITH_METHOD_BEGIN;
+
+  if (value <= 0.0) {
+    std::ostringstream msg;
+    msg << "Time scale (" << value << ") for temporal reduction must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _timeScale = value;
+
+  PYLITH_METHOD_END;
+} // timeScale
+
+// ----------------------------------------------------------------------
+// Update reduction using field at time t.
+void
+pylith::meshio::TemporalReduction::update(const PylithScalar t,
+					  const topology::Field& fieldIn)
+{ // update
+  PYLITH_METHOD_BEGIN;
+
+  State& state = _state(fieldIn);
+  if (!state.updated) {
+    _labels.push_back(fieldIn.label());
+    state.updated = true;
+  } // if
+  _t = t;
+  _accumulate(&state, t, fieldIn);
+
+  PYLITH_METHOD_END;
+} // update
+
+// ----------------------------------------------------------------------
+// Get reduced field corresponding to field.
+pylith::topology::Field&
+pylith::meshio::TemporalReduction::reduced(const topology::Field& fieldIn)
+{ // reduced
+  PYLITH_METHOD_BEGIN;
+
+  // Fields that are never updated (for example, information fields)
+  // are reduced over a single time step and are not included in the
+  // list of reduced fields.
+  State& state = _state(fieldIn);
+  if (!state.count) {
+    _accumulate(&state, _t, fieldIn);
+  } // if
+
+  PYLITH_METHOD_RETURN(_reduced(state));
+} // reduced
+
+// ----------------------------------------------------------------------
+// Get number of fields with reductions.
+int
+pylith::meshio::TemporalReduction::numFields(void) const
+{ // numFields
+  return _labels.size();
+} // numFields
+
+// ----------------------------------------------------------------------
+// Get reduced field.
+pylith::topology::Field&
+pylith::meshio::TemporalReduction::reduced(const int index)
+{ // reduced
+  PYLITH_METHOD_BEGIN;
+
+  assert(index >= 0 && index < numFields());
+  const state_map_type::iterator s_iter = _states.find(_labels[index]);
+  assert(s_iter != _states.end());
+
+  PYLITH_METHOD_RETURN(_reduced(s_iter->second));
+} // reduced
+
+// ----------------------------------------------------------------------
+// Accumulate values of field into reduction state.
+void
+pylith::meshio::TemporalReduction::_accumulate(State* state,
+					       const PylithScalar t,
+					       const topology::Field& fieldIn)
+{ // _accumulate
+  PYLITH_METHOD_BEGIN;
+
+  assert(state);
+  assert(state->accum);
+
+  topology::VecVisitorMesh fieldInVisitor(fieldIn);
+  const PetscScalar* fieldInArray = fieldInVisitor.localArray();
+
+  topology::VecVisitorMesh accumVisitor(*state->accum);
+  PetscScalar* accumArray = accumVisitor.localArray();
+
+  if (THRESHOLD_TIME == _reduction) {
+    // Magnitude over all components at each point, with -1 (after
+    // dimensionalization) marking points that have not exceeded the
+    // threshold.
+    const PylithScalar notExceeded = -1.0 / _timeScale;
+    const PylithScalar scale = fieldIn.scale();
+
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(fieldIn.localSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+      const PetscInt fiberDim = fieldInVisitor.sectionDof(p);
+      if (!fiberDim) {
+	continue;
+      } // if
+      const PetscInt ioff = fieldInVisitor.sectionOffset(p);
+      const PetscInt aoff = accumVisitor.sectionOffset(p);
+      assert(1 == accumVisitor.sectionDof(p));
+
+      if (0 == state->count) {
+	accumArray[aoff] = notExceeded;
+      } // if
+      if (notExceeded != accumArray[aoff]) {
+	continue;
+      } // if
+
+      PylithScalar mag2 = 0.0;
+      for (PetscInt d = 0; d < fiberDim; ++d) {
+	mag2 += fieldInArray[ioff+d]*fieldInArray[ioff+d];
+      } // for
+      if (sqrt(mag2)*scale >= _threshold) {
+	accumArray[aoff] = t;
+      } // if
+      PetscLogFlops(2 + 2*fiberDim);
+    } // for
+  } else {
+    // Reduction is componentwise, so operate directly on the local
+    // arrays, which share the same layout.
+    const PetscInt size = fieldIn.sectionSize();
+    if (size != state->accum->sectionSize()) {
+      std::ostringstream msg;
+      msg << "Size of field '" << fieldIn.label() << "' (" << size
+	  << ") does not match size of its temporal reduction (" << state->accum->sectionSize() << ").";
+      throw std::logic_error(msg.str());
+    } // if
+
+    if (0 == state->count) {
+      for (PetscInt i = 0; i < size; ++i) {
+	accumArray[i] = (RMS == _reduction) ? fieldInArray[i]*fieldInArray[i] : fieldInArray[i];
+      } // for
+    } else {
+      switch (_reduction) {
+      case MAXIMUM :
+	for (PetscInt i = 0; i < size; ++i) {
+	  accumArray[i] = std::max(accumArray[i], fieldInArray[i]);
+	} // for
+	break;
+      case MINIMUM :
+	for (PetscInt i = 0; i < size; ++i) {
+	  accumArray[i] = std::min(accumArray[i], fieldInArray[i]);
+	} // for
+	break;
+      case MEAN :
+	for (PetscInt i = 0; i < size; ++i) {
+	  accumArray[i] += fieldInArray[i];
+	} // for
+	break;
+      case RMS :
+	for (PetscInt i = 0; i < size; ++i) {
+	  accumArray[i] += fieldInArray[i]*fieldInArray[i];
+	} // for
+	break;
+      default :
+	assert(0);
+	throw std::logic_error("Unknown temporal reduction.");
+      } // switch
+    } // if/else
+    PetscLogFlops(size * ((RMS == _reduction) ? 2 : 1));
+  } // if/else
+  ++state->count;
+
+  PYLITH_METHOD_END;
+} // _accumulate
+
+// ----------------------------------------------------------------------
+// Get state for field, creating it if necessary.
+pylith::meshio::TemporalReduction::State&
+pylith::meshio::TemporalReduction::_state(const topology::Field& fieldIn)
+{ // _state
+  PYLITH_METHOD_BEGIN;
+
+  const std::string label = fieldIn.label();
+  const state_map_type::iterator s_iter = _states.find(label);
+  if (s_iter != _states.end()) {
+    PYLITH_METHOD_RETURN(s_iter->second);
+  } // if
+
+  State state;
+  state.accum = new topology::Field(fieldIn.mesh());assert(state.accum);
+  state.output = 0;
+  state.count = 0;
+  state.updated = false;
+
+  if (THRESHOLD_TIME == _reduction) {
+    const int fiberDim = 1;
+    state.accum->newSection(fieldIn, fiberDim);
+    state.accum->allocate();
+    state.accum->vectorFieldType(topology::FieldBase::SCALAR);
+    state.accum->scale(_timeScale);
+  } else {
+    state.accum->cloneSection(fieldIn);
+    state.accum->vectorFieldType(fieldIn.vectorFieldType());
+    state.accum->scale(fieldIn.scale());
+  } // if/else
+  state.accum->label(label.c_str());
+
+  _states[label] = state;
+
+  PYLITH_METHOD_RETURN(_states[label]);
+} // _state
+
+// ----------------------------------------------------------------------
+// Compute reduced field from accumulated state.
+pylith::topology::Field&
+pylith::meshio::TemporalReduction::_reduced(State& state)
+{ // _reduced
+  PYLITH_METHOD_BEGIN;
+
+  assert(state.accum);
+  if (MEAN != _reduction && RMS != _reduction) {
+    PYLITH_METHOD_RETURN(*state.accum);
+  } // if
+
+  if (!state.output) {
+    state.output = new topology::Field(state.accum->mesh());assert(state.output);
+    state.output->cloneSection(*state.accum);
+    state.output->vectorFieldType(state.accum->vectorFieldType());
+    state.output->scale(state.accum->scale());
+    state.output->label(state.accum->label());
+  } // if
+  // Output buffer is recomputed from the accumulated values every
+  // time, so it can be dimensionalized in place.
+  state.output->dimensionalizeOkay(true);
+
+  topology::VecVisitorMesh accumVisitor(*state.accum);
+  const PetscScalar* accumArray = accumVisitor.localArray();
+
+  topology::VecVisitorMesh outputVisitor(*state.output);
+  PetscScalar* outputArray = outputVisitor.localArray();
+
+  assert(state.count > 0);
+  const PylithScalar countInv = 1.0 / state.count;
+  const PetscInt size = state.accum->sectionSize();
+  if (MEAN == _reduction) {
+    for (PetscInt i = 0; i < size; ++i) {
+      outputArray[i] = accumArray[i] * countInv;
+    } // for
+    PetscLogFlops(size);
+  } else {
+    for (PetscInt i = 0; i < size; ++i) {
+      outputArray[i] = sqrt(accumArray[i] * countInv);
+    } // for
+    PetscLogFlops(size * 2);
+  } // if/else
+
+  PYLITH_METHOD_RETURN(*state.output);
+} // _reduced
+
+
+// End of file
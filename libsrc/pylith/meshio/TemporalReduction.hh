@@ -0,0 +1,194 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/TemporalReduction.hh
+ *
+ * @brief C++ object for accumulating reductions of fields over time
+ * steps (maximum, minimum, mean, root-mean-square, or time at which
+ * the magnitude first exceeds a threshold).
+ *
+ * The state is kept separately for each field (identified by its
+ * label) and is updated every time step, independent of how often the
+ * reduced fields are written.
+ */
+
+#if !defined(pylith_meshio_temporalreduction_hh)
+#define pylith_meshio_temporalreduction_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/arrayfwd.hh" // HASA string_vector
+
+#include <map> // HASA std::map
+#include <string> // USES std::string
+
+// TemporalReduction ----------------------------------------------------
+/// C++ object for accumulating reductions of fields over time steps.
+class pylith::meshio::TemporalReduction
+{ // TemporalReduction
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum ReductionEnum {
+    MAXIMUM=0, ///< Maximum value over time steps.
+    MINIMUM=1, ///< Minimum value over time steps.
+    MEAN=2, ///< Mean value over time steps.
+    RMS=3, ///< Root-mean-square value over time steps.
+    THRESHOLD_TIME=4 ///< Time at which magnitude first exceeds threshold.
+  }; // ReductionEnum
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  TemporalReduction(void);
+
+  /** Copy constructor. Only the parameters are copied, not the
+   * accumulated state.
+   *
+   * @param r Reduction to copy.
+   */
+  TemporalReduction(const TemporalReduction& r);
+
+  /// Destructor
+  ~TemporalReduction(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set type of reduction.
+   *
+   * @param value Name of reduction ('max', 'min', 'mean', 'rms', or
+   * 'threshold_time').
+   */
+  void reduction(const char* value);
+
+  /** Get type of reduction.
+   *
+   * @returns Type of reduction.
+   */
+  ReductionEnum reduction(void) const;
+
+  /** Set threshold for THRESHOLD_TIME reduction.
+   *
+   * @param value Threshold for magnitude of field (dimensional).
+   */
+  void threshold(const PylithScalar value);
+
+  /** Set time scale used to dimensionalize THRESHOLD_TIME.
+   *
+   * @param value Time scale.
+   */
+  void timeScale(const PylithScalar value);
+
+  /** Update reduction using field at time t.
+   *
+   * @param t Time (nondimensional) associated with field.
+   * @param fieldIn Field with current values.
+   */
+  void update(const PylithScalar t,
+	      const topology::Field& fieldIn);
+
+  /** Get reduced field corresponding to field. If the field has not
+   * been updated, it is treated as a single time step and is not
+   * included in the list of reduced fields.
+   *
+   * @param fieldIn Field to reduce.
+   * @returns Reduced field.
+   */
+  topology::Field& reduced(const topology::Field& fieldIn);
+
+  /** Get number of fields with reductions.
+   *
+   * @returns Number of fields.
+   */
+  int numFields(void) const;
+
+  /** Get reduced field.
+   *
+   * @param index Index of updated field in order of first update.
+   * @returns Reduced field.
+   */
+  topology::Field& reduced(const int index);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// State of reduction for a field.
+  struct State {
+    topology::Field* accum; ///< Accumulated values.
+    topology::Field* output; ///< Buffer for MEAN and RMS output.
+    int count; ///< Number of time steps accumulated.
+    bool updated; ///< True if field has been updated via update().
+  }; // State
+
+  typedef std::map<std::string, State> state_map_type;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Get state for field, creating it if necessary.
+   *
+   * @param fieldIn Field with current values.
+   * @returns State of reduction for field.
+   */
+  State& _state(const topology::Field& fieldIn);
+
+  /** Accumulate values of field into reduction state.
+   *
+   * @param state State of reduction for field.
+   * @param t Time (nondimensional) associated with field.
+   * @param fieldIn Field with current values.
+   */
+  void _accumulate(State* state,
+		   const PylithScalar t,
+		   const topology::Field& fieldIn);
+
+  /** Compute reduced field from accumulated state.
+   *
+   * @param state State of reduction.
+   * @returns Reduced field.
+   */
+  topology::Field& _reduced(State& state);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  /// Not implemented.
+  const TemporalReduction& operator=(const TemporalReduction&);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  state_map_type _states; ///< Reduction state for each field.
+  string_vector _labels; ///< Labels of fields in order of first update.
+  PylithScalar _threshold; ///< Threshold for THRESHOLD_TIME.
+  PylithScalar _timeScale; ///< Time scale for THRESHOLD_TIME.
+  PylithScalar _t; ///< Time of most recent update.
+  ReductionEnum _reduction; ///< Type of reduction.
+
+}; // TemporalReduction
+
+#endif // pylith_meshio_temporalreduction_hh
+
+
+// End of file
@@ -0,0 +1,134 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "VertexFilterTemporal.hh" // Implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::VertexFilterTemporal::VertexFilterTemporal(void)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::VertexFilterTemporal::~VertexFilterTemporal(void)
+{ // destructor
+  deallocate();
+} // destructor  
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::VertexFilterTemporal::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  VertexFilter::deallocate();  
+
+  _reduction.deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+  
+// ----------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::VertexFilterTemporal::VertexFilterTemporal(const VertexFilterTemporal& f) :
+  VertexFilter(f),
+  _reduction(f._reduction)
+{ // copy constructor
+} // copy constructor
+
+// ----------------------------------------------------------------------
+// Create copy of filter.
+pylith::meshio::VertexFilter*
+pylith::meshio::VertexFilterTemporal::clone(void) const
+{ // clone
+  return new VertexFilterTemporal(*this);
+} // clone
+
+// ----------------------------------------------------------------------
+// Set type of reduction.
+void
+pylith::meshio::VertexFilterTemporal::reduction(const char* value)
+{ // reduction
+  _reduction.reduction(value);
+} // reduction
+
+// ----------------------------------------------------------------------
+// Set threshold for 'threshold_time' reduction.
+void
+pylith::meshio::VertexFilterTemporal::threshold(const PylithScalar value)
+{ // threshold
+  _reduction.threshold(value);
+} // threshold
+
+// ----------------------------------------------------------------------
+// Set time scale used to dimensionalize time for 'threshold_time'.
+void
+pylith::meshio::VertexFilterTemporal::timeScale(const PylithScalar value)
+{ // timeScale
+  _reduction.timeScale(value);
+} // timeScale
+
+// ----------------------------------------------------------------------
+// Update reduction with vertex field at time t.
+void
+pylith::meshio::VertexFilterTemporal::update(const PylithScalar t,
+					     const topology::Field& fieldIn)
+{ // update
+  PYLITH_METHOD_BEGIN;
+
+  _reduction.update(t, fieldIn);
+
+  PYLITH_METHOD_END;
+} // update
+
+// ----------------------------------------------------------------------
+// Filter field.
+pylith::topology::Field&
+pylith::meshio::VertexFilterTemporal::filter(const topology::Field& fieldIn)
+{ // filter
+  PYLITH_METHOD_BEGIN;
+
+  PYLITH_METHOD_RETURN(_reduction.reduced(fieldIn));
+} // filter
+
+// ----------------------------------------------------------------------
+// Get number of fields with reductions.
+int
+pylith::meshio::VertexFilterTemporal::numReduced(void) const
+{ // numReduced
+  return _reduction.numFields();
+} // numReduced
+
+// ----------------------------------------------------------------------
+// Get reduced field.
+pylith::topology::Field&
+pylith::meshio::VertexFilterTemporal::reduced(const int index)
+{ // reduced
+  PYLITH_METHOD_BEGIN;
+
+  PYLITH_METHOD_RETURN(_reduction.reduced(index));
+} // reduced
+
+
+// End of file
@@ -0,0 +1,136 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/VertexFilterTemporal.hh
+ *
+ * @brief C++ object for reducing fields over vertices in time (max,
+ * min, mean, RMS, or time threshold is first exceeded) when outputing
+ * finite-element data.
+ */
+
+#if !defined(pylith_meshio_vertexfiltertemporal_hh)
+#define pylith_meshio_vertexfiltertemporal_hh
+
+// Include directives ---------------------------------------------------
+#include "VertexFilter.hh" // ISA VertexFilter
+
+#include "TemporalReduction.hh" // HASA TemporalReduction
+
+// VertexFilterTemporal -------------------------------------------------
+/** @brief C++ object for reducing fields over vertices in time when
+ * outputing finite-element data.
+ *
+ * The reduction is updated every time step via update(); filter()
+ * returns the reduction accumulated so far.
+ */
+class pylith::meshio::VertexFilterTemporal : public VertexFilter
+{ // VertexFilterTemporal
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  VertexFilterTemporal(void);
+
+  /// Destructor
+  ~VertexFilterTemporal(void);
+
+  /** Create copy of filter.
+   *
+   * @returns Copy of filter.
+   */
+  VertexFilter* clone(void) const;
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set type of reduction.
+   *
+   * @param value Name of reduction ('max', 'min', 'mean', 'rms', or
+   * 'threshold_time').
+   */
+  void reduction(const char* value);
+
+  /** Set threshold for 'threshold_time' reduction.
+   *
+   * @param value Threshold for magnitude of field (dimensional).
+   */
+  void threshold(const PylithScalar value);
+
+  /** Set time scale used to dimensionalize time for 'threshold_time'.
+   *
+   * @param value Time scale.
+   */
+  void timeScale(const PylithScalar value);
+
+  /** Update reduction with vertex field at time t.
+   *
+   * @param t Time associated with field.
+   * @param fieldIn Field with current values.
+   */
+  void update(const PylithScalar t,
+	      const topology::Field& fieldIn);
+
+  /** Filter vertex field.
+   *
+   * @param fieldIn Field to filter.
+   */
+  topology::Field&
+  filter(const topology::Field& fieldIn);
+
+  /** Get number of fields with reductions.
+   *
+   * @returns Number of fields.
+   */
+  int numReduced(void) const;
+
+  /** Get reduced field.
+   *
+   * @param index Index of field in order of first update.
+   * @returns Reduced field.
+   */
+  topology::Field& reduced(const int index);
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Copy constructor.
+   *
+   * @param f Filter to copy.
+   * @returns Pointer to this.
+   */
+  VertexFilterTemporal(const VertexFilterTemporal& f);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  /// Not implemented.
+  const VertexFilterTemporal& operator=(const VertexFilterTemporal&);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  TemporalReduction _reduction; ///< Reduction of fields over time.
+
+}; // VertexFilterTemporal
+
+#endif // pylith_meshio_vertexfiltertemporal_hh
+
+
+// End of file 
@@ -30,6 +30,7 @@
 namespace pylith {
   namespace meshio {
 
+    class AsciiTokenizer;
     class BinaryIO;
 
     class MeshIO;
@@ -37,6 +38,8 @@ namespace pylith {
     class MeshIOAscii;
     class MeshIOCubit;
     class MeshIOLagrit;
+    class MeshIOHDF5;
+    class MeshIOBox;
 
     class GMVFile;
     class GMVFileAscii;
@@ -53,8 +56,11 @@ namespace pylith {
     class DataWriterHDF5Ext;
     class CellFilter;
     class CellFilterAvg;
+    class CellFilterTemporal;
     class VertexFilter;
     class VertexFilterVecNorm;
+    class VertexFilterTemporal;
+    class TemporalReduction;
     class OutputSolnSubset;
     class OutputSolnPoints;
 
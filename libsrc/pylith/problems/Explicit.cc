@@ -20,15 +20,26 @@
 
 #include "Explicit.hh" // implementation of class methods
 
+#include "pylith/feassemble/ElasticityExplicit.hh" // USES ElasticityExplicit
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include <algorithm> // USES std::min()
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
 // ----------------------------------------------------------------------
 // Constructor
-pylith::problems::Explicit::Explicit(void)
+pylith::problems::Explicit::Explicit(void) :
+  _maxRateLevel(0),
+  _rateSubstep(0)
 { // constructor
 } // constructor
 
@@ -38,6 +49,236 @@ pylith::problems::Explicit::~Explicit(void)
 { // destructor
 } // destructor
 
+// ----------------------------------------------------------------------
+// Set maximum level for multi-rate time stepping.
+void
+pylith::problems::Explicit::maxRateLevel(const int value)
+{ // maxRateLevel
+  PYLITH_METHOD_BEGIN;
+
+  if (value < 0) {
+    std::ostringstream msg;
+    msg << "Maximum level for multi-rate time stepping (" << value << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _maxRateLevel = value;
+
+  PYLITH_METHOD_END;
+} // maxRateLevel
+
+// ----------------------------------------------------------------------
+// Get maximum level for multi-rate time stepping.
+int
+pylith::problems::Explicit::maxRateLevel(void) const
+{ // maxRateLevel
+  return _maxRateLevel;
+} // maxRateLevel
+
+// ----------------------------------------------------------------------
+// Compute levels of vertices and cells for multi-rate time stepping.
+void
+pylith::problems::Explicit::calcRateLevels(void)
+{ // calcRateLevels
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  // Elasticity integrators that support multi-rate time stepping.
+  std::vector<feassemble::ElasticityExplicit*> integrators;
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    feassemble::ElasticityExplicit* integrator = dynamic_cast<feassemble::ElasticityExplicit*>(_integrators[i]);
+    if (integrator) {
+      integrators.push_back(integrator);
+    } // if
+  } // for
+  const int numElasticity = integrators.size();
+
+  _rateSubstep = 0;
+  const topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  const topology::Mesh& mesh = dispIncr.mesh();
+  if (_maxRateLevel <= 0) {
+    _rateLevels.resize(0);
+    for (int i=0; i < numElasticity; ++i) {
+      integrators[i]->rateLevels(_rateLevels, mesh);
+    } // for
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Levels of cells from stable time step. Cells not integrated by an
+  // elasticity integrator (e.g., cohesive cells) remain at the finest
+  // level.
+  int_array cellLevels(cEnd-cStart);
+  cellLevels = 0;
+  for (int i=0; i < numElasticity; ++i) {
+    integrators[i]->stableRateLevels(&cellLevels, mesh, _dt, _maxRateLevel);
+  } // for
+
+  // The level of a vertex is the finest level of the cells attached
+  // to it. We count the number of cells at each level so the counts
+  // can be assembled across processes.
+  const int numLevels = _maxRateLevel + 1;
+  topology::Field levelCounts(mesh);
+  levelCounts.label("rate level counts");
+  levelCounts.newSection(topology::FieldBase::VERTICES_FIELD, numLevels);
+  levelCounts.allocate();
+  levelCounts.zeroAll();
+
+  PetscErrorCode err = 0;
+  topology::VecVisitorMesh countsVisitor(levelCounts);
+  PetscScalar* countsArray = countsVisitor.localArray();
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    PetscInt closureSize = 0, *closure = NULL;
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+      const PetscInt v = closure[cl];
+      if (v >= vStart && v < vEnd) {
+	assert(numLevels == countsVisitor.sectionDof(v));
+	countsArray[countsVisitor.sectionOffset(v)+cellLevels[c-cStart]] += 1.0;
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+  levelCounts.complete();
+
+  // Vertices with constrained degrees of freedom remain at the finest
+  // level.
+  PetscSection solnSection = dispIncr.localSection();assert(solnSection);
+  _rateLevels.resize(vEnd-vStart);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    PetscInt cdof = 0;
+    err = PetscSectionGetConstraintDof(solnSection, v, &cdof);PYLITH_CHECK_ERROR(err);
+    const PetscInt off = countsVisitor.sectionOffset(v);
+    int level = 0;
+    if (!cdof) {
+      while (level < _maxRateLevel && countsArray[off+level] <= 0.0) {
+	++level;
+      } // while
+      if (countsArray[off+level] <= 0.0) {
+	level = 0;
+      } // if
+    } // if
+    _rateLevels[v-vStart] = level;
+  } // for
+
+  // A cell is updated whenever any of its vertices is updated, so
+  // the update level of a cell is the finest level of its vertices.
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    PetscInt closureSize = 0, *closure = NULL;
+    int level = _maxRateLevel;
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+      const PetscInt v = closure[cl];
+      if (v >= vStart && v < vEnd) {
+	level = std::min(level, int(_rateLevels[v-vStart]));
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    cellLevels[c-cStart] = level;
+  } // for
+  for (int i=0; i < numElasticity; ++i) {
+    integrators[i]->rateLevels(cellLevels, mesh);
+    integrators[i]->rateSubstep(_rateSubstep);
+  } // for
+
+  PYLITH_METHOD_END;
+} // calcRateLevels
+
+// ----------------------------------------------------------------------
+// Adjust solution from solver with lumped Jacobian for multi-rate time
+// stepping.
+void
+pylith::problems::Explicit::adjustSolnMultiRate(topology::Field* solution)
+{ // adjustSolnMultiRate
+  PYLITH_METHOD_BEGIN;
+
+  assert(solution);
+  assert(_fields);
+
+  if (!_rateLevels.size()) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Vertices at level k advance with time step dt_k = 2^k*dt. At the
+  // start of a cycle for level k, the solver gives the increment for
+  // time step dt,
+  //
+  // du = du(t-dt->t) + dt^2/m f,
+  //
+  // which we rescale to 1/2^k of the increment for time step dt_k,
+  //
+  // du = du(t-dt->t) + 2^k*dt^2/m f.
+  //
+  // Within a cycle the displacement is linearly interpolated, so the
+  // increment from the previous time step is reused.
+
+  const spatialdata::geocoords::CoordSys* cs = solution->mesh().coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  topology::VecVisitorMesh solutionVisitor(*solution);
+  PetscScalar* solutionArray = solutionVisitor.localArray();
+
+  topology::VecVisitorMesh dispTVisitor(_fields->get("disp(t)"));
+  const PetscScalar* dispTArray = dispTVisitor.localArray();
+
+  topology::VecVisitorMesh dispTmdtVisitor(_fields->get("disp(t-dt)"));
+  const PetscScalar* dispTmdtArray = dispTmdtVisitor.localArray();
+
+  PetscDM dmMesh = solution->mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  assert(_rateLevels.size() == size_t(vEnd-vStart));
+
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const int level = _rateLevels[v-vStart];
+    if (!level) {
+      continue;
+    } // if
+    const PetscInt soff = solutionVisitor.sectionOffset(v);
+    assert(spaceDim == solutionVisitor.sectionDof(v));
+
+    const PetscInt dtoff = dispTVisitor.sectionOffset(v);
+    assert(spaceDim == dispTVisitor.sectionDof(v));
+
+    const PetscInt dmoff = dispTmdtVisitor.sectionOffset(v);
+    assert(spaceDim == dispTmdtVisitor.sectionDof(v));
+
+    const int ratio = 1 << level;
+    if (_rateSubstep % ratio) {
+      for (int i=0; i < spaceDim; ++i) {
+	solutionArray[soff+i] = dispTArray[dtoff+i] - dispTmdtArray[dmoff+i];
+      } // for
+    } else {
+      for (int i=0; i < spaceDim; ++i) {
+	const PylithScalar dispIncrTmdt = dispTArray[dtoff+i] - dispTmdtArray[dmoff+i];
+	solutionArray[soff+i] = ratio*solutionArray[soff+i] - (ratio-1)*dispIncrTmdt;
+      } // for
+    } // if/else
+  } // for
+  PetscLogFlops((vEnd - vStart) * 4*spaceDim);
+
+  // Advance to next substep in cycle.
+  _rateSubstep = (_rateSubstep + 1) % (1 << _maxRateLevel);
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    feassemble::ElasticityExplicit* integrator = dynamic_cast<feassemble::ElasticityExplicit*>(_integrators[i]);
+    if (integrator) {
+      integrator->rateSubstep(_rateSubstep);
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // adjustSolnMultiRate
+
 // ----------------------------------------------------------------------
 // Compute velocity and acceleration at time t.
 void
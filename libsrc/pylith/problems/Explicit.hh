@@ -47,9 +47,46 @@ public :
   /// Destructor
   ~Explicit(void);
 
+  /** Set maximum level for multi-rate time stepping.
+   *
+   * Vertices at level k are advanced with a time step of 2^k*dt,
+   * where dt is the time step of the formulation. A value of 0
+   * disables multi-rate time stepping.
+   *
+   * @param value Maximum level.
+   */
+  void maxRateLevel(const int value);
+
+  /** Get maximum level for multi-rate time stepping.
+   *
+   * @returns Maximum level.
+   */
+  int maxRateLevel(void) const;
+
+  /** Compute levels of vertices and cells for multi-rate time stepping
+   * from the stable time step of the cells.
+   *
+   * @pre Must call updateSettings() before calcRateLevels().
+   */
+  void calcRateLevels(void);
+
+  /** Adjust solution from solver with lumped Jacobian for multi-rate
+   * time stepping.
+   *
+   * @param solution Solution field.
+   */
+  void adjustSolnMultiRate(topology::Field* solution);
+
   /// Compute rate fields (velocity and/or acceleration) at time t.
   void calcRateFields(void);
 
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  int_array _rateLevels; ///< Level of vertices in multi-rate time stepping.
+  int _maxRateLevel; ///< Maximum level in multi-rate time stepping.
+  int _rateSubstep; ///< Current substep in multi-rate cycle.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -40,7 +40,9 @@ pylith::problems::Formulation::Formulation(void) :
   _jacobianLumped(0),
   _fields(0),
   _isJacobianSymmetric(false),
-  _splitFields(false)
+  _splitFields(false),
+  _useCustomConstraintPC(false),
+  _overlapAssembly(false)
 { // constructor
 } // constructor
 
@@ -107,6 +109,24 @@ pylith::problems::Formulation::useCustomConstraintPC(void) const
   return _useCustomConstraintPC;
 } // useCustomConstraintPC
 
+// ----------------------------------------------------------------------
+// Set flag for overlapping residual assembly with integration of
+// interior cells.
+void
+pylith::problems::Formulation::overlapAssembly(const bool flag)
+{ // overlapAssembly
+  _overlapAssembly = flag;
+} // overlapAssembly
+
+// ----------------------------------------------------------------------
+// Get flag for overlapping residual assembly with integration of
+// interior cells.
+bool
+pylith::problems::Formulation::overlapAssembly(void) const
+{ // overlapAssembly
+  return _overlapAssembly;
+} // overlapAssembly
+
 // ----------------------------------------------------------------------
 // Return the fields
 const pylith::topology::SolutionFields&
@@ -187,6 +207,14 @@ pylith::problems::Formulation::updateSettings(topology::Field* jacobian,
   _dt = dt;
 } // updateSettings
 
+// ----------------------------------------------------------------------
+// Get current time step.
+PylithScalar
+pylith::problems::Formulation::timeStep(void) const
+{ // timeStep
+  return _dt;
+} // timeStep
+
 // ----------------------------------------------------------------------
 // Reform system residual.
 void
@@ -213,13 +241,47 @@ pylith::problems::Formulation::reformResidual(const PetscVec* tmpResidualVec,
   // Add in contributions that require assembly.
   const int numIntegrators = _integrators.size();
   assert(numIntegrators > 0); // must have at least 1 integrator
-  for (int i=0; i < numIntegrators; ++i) {
-    _integrators[i]->timeStep(_dt);
-    _integrators[i]->integrateResidual(residual, _t, _fields);
-  } // for
+  if (!_overlapAssembly) {
+    for (int i=0; i < numIntegrators; ++i) {
+      _integrators[i]->timeStep(_dt);
+      _integrators[i]->integrateResidual(residual, _t, _fields);
+    } // for
+
+    // Assemble residual.
+    residual.complete();
+  } else {
+    // Integrate cells that contribute to points shared with other
+    // processes (along with all integrators that do not split their
+    // cells), so that assembly across processes can start.
+    for (int i=0; i < numIntegrators; ++i) {
+      _integrators[i]->timeStep(_dt);
+      _integrators[i]->cellSubset(feassemble::Integrator::BOUNDARY_CELLS);
+      _integrators[i]->integrateResidual(residual, _t, _fields);
+    } // for
+    residual.completeBegin();
+
+    // Integrate interior cells into a separate buffer while the
+    // residual is being assembled. Interior cells only contribute to
+    // points that are local and not shared, so assembly leaves their
+    // values unchanged and we can simply add them afterwards.
+    if (!_fields->hasField("residual interior")) {
+      _fields->add("residual interior", "residual_interior");
+      topology::Field& residualInterior = _fields->get("residual interior");
+      residualInterior.cloneSection(residual);
+    } // if
+    topology::Field& residualInterior = _fields->get("residual interior");
+    residualInterior.zeroAll();
+    for (int i=0; i < numIntegrators; ++i) {
+      if (_integrators[i]->splitsResidual()) {
+	_integrators[i]->cellSubset(feassemble::Integrator::INTERIOR_CELLS);
+	_integrators[i]->integrateResidual(residualInterior, _t, _fields);
+      } // if
+      _integrators[i]->cellSubset(feassemble::Integrator::ALL_CELLS);
+    } // for
 
-  // Assemble residual.
-  residual.complete();
+    residual.completeEnd();
+    PetscErrorCode err = VecAXPY(residual.localVector(), 1.0, residualInterior.localVector());PYLITH_CHECK_ERROR(err);
+  } // if/else
 
   // Update PETSc view of residual
   if (tmpResidualVec)
@@ -377,6 +439,14 @@ pylith::problems::Formulation::adjustSolnLumped(void)
   PYLITH_METHOD_END;
 } // adjustSolnLumped
 
+// ----------------------------------------------------------------------
+// Adjust solution from solver with lumped Jacobian for multi-rate
+// time stepping.
+void
+pylith::problems::Formulation::adjustSolnMultiRate(topology::Field* solution)
+{ // adjustSolnMultiRate
+} // adjustSolnMultiRate
+
 #include "pylith/meshio/DataWriterHDF5.hh"
 // ----------------------------------------------------------------------
 void
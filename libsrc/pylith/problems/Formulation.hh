@@ -79,6 +79,22 @@ public :
    */
   bool useCustomConstraintPC(void) const;
 
+  /** Set flag for overlapping assembly of residual across processes
+   * with integration of interior cells.
+   *
+   * @param flag True if overlapping assembly with computation, false
+   * otherwise.
+   */
+  void overlapAssembly(const bool flag);
+
+  /** Get flag for overlapping assembly of residual across processes
+   * with integration of interior cells.
+   *
+   * @returns True if overlapping assembly with computation, false
+   * otherwise.
+   */
+  bool overlapAssembly(void) const;
+
   /** Get solution fields.
    *
    * @returns solution fields.
@@ -131,6 +147,12 @@ public :
 		      const PylithScalar t,
 		      const PylithScalar dt);
 
+  /** Get current time step.
+   *
+   * @returns Time step (nondimensional).
+   */
+  PylithScalar timeStep(void) const;
+
   /** Reform system residual.
    *
    * @param tmpResidualVec Temporary PETSc vector for residual.
@@ -160,6 +182,16 @@ public :
    */
   void adjustSolnLumped(void);
 
+  /** Adjust solution from solver with lumped Jacobian for multi-rate
+   * time stepping.
+   *
+   * Default is to leave the solution unchanged.
+   *
+   * @param solution Solution field.
+   */
+  virtual
+  void adjustSolnMultiRate(topology::Field* solution);
+
   /// Compute rate fields (velocity and/or acceleration) at time t.
   virtual
   void calcRateFields(void) = 0;
@@ -186,6 +218,7 @@ protected :
   bool _splitFields; ///< True if splitting fields.
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
+  bool _overlapAssembly; ///< True if overlapping residual assembly with integration of interior cells.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -334,9 +334,13 @@ pylith::problems::Solver::_setupFieldSplit(PetscPC* const pc,
         err = MatSetType(_jacobianPCFault, MATAIJ); PYLITH_CHECK_ERROR(err);
         err = MatSetFromOptions(_jacobianPCFault); PYLITH_CHECK_ERROR(err);
 
-        // Allocate just the diagonal.
-        err = MatSeqAIJSetPreallocation(_jacobianPCFault, 1, NULL); PYLITH_CHECK_ERROR(err);
-        err = MatMPIAIJSetPreallocation(_jacobianPCFault, 1, NULL, 0, NULL); PYLITH_CHECK_ERROR(err);
+        // Allocate the spaceDim x spaceDim vertex blocks on the
+        // diagonal; faults using only the diagonal leave the remaining
+        // entries unused, and they are squeezed out during assembly.
+        const spatialdata::geocoords::CoordSys* cs = fields.mesh().coordsys(); assert(cs);
+        const PetscInt blockSize = cs->spaceDim();
+        err = MatSeqAIJSetPreallocation(_jacobianPCFault, blockSize, NULL); PYLITH_CHECK_ERROR(err);
+        err = MatMPIAIJSetPreallocation(_jacobianPCFault, blockSize, NULL, 0, NULL); PYLITH_CHECK_ERROR(err);
         // Set preconditioning matrix in formulation
         formulation->customPCMatrix(_jacobianPCFault); assert(_jacobianPCFault);
 
@@ -133,6 +133,9 @@ pylith::problems::SolverLumped::solve(topology::Field* solution,
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(adjustEvent);
 
+  // Adjust solution at vertices updated at a coarser rate.
+  _formulation->adjustSolnMultiRate(solution);
+
   // Update rate fields to be consistent with current solution.
   _formulation->calcRateFields();
 
@@ -33,6 +33,14 @@
 
 #include <petscsnes.h> // USES PetscSNES
 
+#include "journal/info.h" // USES journal::info_t
+
+#include <strings.h> // USES strcasecmp()
+#include <algorithm> // USES std::min()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
 // KLUDGE, Fixes issue with PetscIsInfOrNanReal and include cmath
 // instead of math.h.
 #define isnan std::isnan // TEMPORARY
@@ -52,7 +60,16 @@ struct PetscSNESLineSearch_BT {
 // ----------------------------------------------------------------------
 // Constructor
 pylith::problems::SolverNonlinear::SolverNonlinear(void) :
-  _snes(0)
+  _snes(0),
+  _incrN(0),
+  _incrNm1(0),
+  _incrPredicted(0),
+  _dtN(0.0),
+  _dtNm1(0.0),
+  _numIncr(0),
+  _numNewtonIts(0),
+  _numLinearIts(0),
+  _predictor(PREDICTOR_ZERO)
 { // constructor
 } // constructor
 
@@ -73,9 +90,61 @@ pylith::problems::SolverNonlinear::deallocate(void)
   Solver::deallocate();
 
   PetscErrorCode err = SNESDestroy(&_snes);PYLITH_CHECK_ERROR(err);
+  resetPredictor();
 
   PYLITH_METHOD_END;
 } // deallocate
+
+// ----------------------------------------------------------------------
+// Set predictor used for initial guess of solution increment.
+void
+pylith::problems::SolverNonlinear::predictor(const char* value)
+{ // predictor
+  PYLITH_METHOD_BEGIN;
+
+  assert(value);
+  if (0 == strcasecmp(value, "zero")) {
+    _predictor = PREDICTOR_ZERO;
+  } else if (0 == strcasecmp(value, "linear")) {
+    _predictor = PREDICTOR_LINEAR;
+  } else if (0 == strcasecmp(value, "quadratic")) {
+    _predictor = PREDICTOR_QUADRATIC;
+  } else {
+    std::ostringstream msg;
+    msg << "Unknown predictor '" << value << "'. Valid predictors are "
+	<< "'zero', 'linear', and 'quadratic'.";
+    throw std::runtime_error(msg.str());
+  } // if/else
+  resetPredictor();
+
+  PYLITH_METHOD_END;
+} // predictor
+
+// ----------------------------------------------------------------------
+// Get predictor used for initial guess of solution increment.
+pylith::problems::SolverNonlinear::PredictorEnum
+pylith::problems::SolverNonlinear::predictor(void) const
+{ // predictor
+  return _predictor;
+} // predictor
+
+// ----------------------------------------------------------------------
+// Discard history of solution increments used by predictor.
+void
+pylith::problems::SolverNonlinear::resetPredictor(void)
+{ // resetPredictor
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  err = VecDestroy(&_incrN);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&_incrNm1);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&_incrPredicted);PYLITH_CHECK_ERROR(err);
+  _dtN = 0.0;
+  _dtNm1 = 0.0;
+  _numIncr = 0;
+
+  PYLITH_METHOD_END;
+} // resetPredictor
   
 // ----------------------------------------------------------------------
 // Initialize solver.
@@ -114,7 +183,7 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
 
   // Get SNES options and allow the user to override the line search type
   err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
-  err = SNESSetComputeInitialGuess(_snes, initialGuess, (void*) formulation);PYLITH_CHECK_ERROR(err);
+  err = SNESSetComputeInitialGuess(_snes, initialGuess, (void*) this);PYLITH_CHECK_ERROR(err);
 
   if (formulation->splitFields()) {
     PetscKSP ksp = 0;
@@ -150,6 +219,7 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   const PetscVec solutionVec = solution->globalVector();
 
   err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
+  _updatePredictor(solutionVec);
   
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
@@ -582,11 +652,124 @@ pylith::problems::SolverNonlinear::initialGuess(PetscSNES snes,
 { // initialGuess
   PYLITH_METHOD_BEGIN;
 
-  PetscErrorCode err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
+  assert(lsctx);
+  SolverNonlinear* solver = (SolverNonlinear*) lsctx;
+  solver->_predictIncr(initialGuessVec);
 
   PYLITH_METHOD_RETURN(0);
 } // initialGuess
 
+// ----------------------------------------------------------------------
+// Predict solution increment from increments of previous time steps.
+void
+pylith::problems::SolverNonlinear::_predictIncr(PetscVec incrVec)
+{ // _predictIncr
+  PYLITH_METHOD_BEGIN;
+
+  assert(_formulation);
+
+  const PylithScalar dt = _formulation->timeStep();
+  const int order = std::min(int(_predictor), _numIncr);
+
+  PetscErrorCode err = 0;
+  if (dt <= 0.0 || 0 == order) {
+    err = VecSet(incrVec, 0.0);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_END;
+  } // if
+
+  // Linear: assume constant rate over previous and current step,
+  //   du = (dt/dt_n) du_n
+  //
+  // Quadratic: extrapolate rate from midpoints of previous two steps
+  // to midpoint of current step,
+  //   v_n = du_n / dt_n
+  //   v = v_n + (v_n - v_{n-1}) (dt + dt_n) / (dt_n + dt_{n-1})
+  //   du = dt v
+  assert(_incrN);
+  err = VecCopy(_incrN, incrVec);PYLITH_CHECK_ERROR(err);
+  if (1 == order) {
+    err = VecScale(incrVec, dt/_dtN);PYLITH_CHECK_ERROR(err);
+  } else {
+    assert(2 == order);
+    assert(_incrNm1);
+    const PylithScalar ratio = (dt + _dtN) / (_dtN + _dtNm1);
+    err = VecAXPBY(incrVec, -dt*ratio/_dtNm1, dt*(1.0+ratio)/_dtN, _incrNm1);PYLITH_CHECK_ERROR(err);
+  } // if/else
+
+  if (!_incrPredicted) {
+    err = VecDuplicate(incrVec, &_incrPredicted);PYLITH_CHECK_ERROR(err);
+  } // if
+  err = VecCopy(incrVec, _incrPredicted);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _predictIncr
+
+// ----------------------------------------------------------------------
+// Add converged solution increment to history for predictor and
+// report iteration counts.
+void
+pylith::problems::SolverNonlinear::_updatePredictor(const PetscVec incrVec)
+{ // _updatePredictor
+  PYLITH_METHOD_BEGIN;
+
+  assert(_snes);
+  assert(_formulation);
+
+  PetscErrorCode err = 0;
+  PetscInt numNewtonIts = 0;
+  PetscInt numLinearIts = 0;
+  err = SNESGetIterationNumber(_snes, &numNewtonIts);PYLITH_CHECK_ERROR(err);
+  err = SNESGetLinearSolveIterations(_snes, &numLinearIts);PYLITH_CHECK_ERROR(err);
+  _numNewtonIts += numNewtonIts;
+  _numLinearIts += numLinearIts;
+
+  // Relative difference between predicted and converged increments.
+  PetscReal predictorError = 1.0;
+  const bool usedPredictor = _numIncr > 0 && PREDICTOR_ZERO != _predictor;
+  if (usedPredictor) {
+    assert(_incrPredicted);
+    PetscReal incrNorm = 0.0;
+    err = VecNorm(incrVec, NORM_2, &incrNorm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(_incrPredicted, -1.0, incrVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(_incrPredicted, NORM_2, &predictorError);PYLITH_CHECK_ERROR(err);
+    predictorError = (incrNorm > 0.0) ? predictorError / incrNorm : 0.0;
+  } // if
+
+  journal::info_t info("solvernonlinear");
+  PetscMPIInt rank = 0;
+  err = MPI_Comm_rank(PetscObjectComm((PetscObject) _snes), &rank);PYLITH_CHECK_ERROR(err);
+  if (0 == rank) {
+    info << journal::at(__HERE__)
+	 << "Newton iterations: " << numNewtonIts
+	 << " (total " << _numNewtonIts << "), linear iterations: " << numLinearIts
+	 << " (total " << _numLinearIts << ")";
+    if (usedPredictor) {
+      info << ", relative error of predicted increment: " << predictorError;
+    } // if
+    info << "." << journal::endl;
+  } // if
+
+  if (PREDICTOR_ZERO == _predictor) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Shift history and store converged increment.
+  if (PREDICTOR_QUADRATIC == _predictor) {
+    PetscVec tmpVec = _incrNm1;
+    _incrNm1 = _incrN;
+    _incrN = tmpVec;
+    _dtNm1 = _dtN;
+  } // if
+  if (!_incrN) {
+    err = VecDuplicate(incrVec, &_incrN);PYLITH_CHECK_ERROR(err);
+  } // if
+  err = VecCopy(incrVec, _incrN);PYLITH_CHECK_ERROR(err);
+  _dtN = _formulation->timeStep();
+  _numIncr = std::min(_numIncr+1, int(_predictor));
+
+  PYLITH_METHOD_END;
+} // _updatePredictor
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
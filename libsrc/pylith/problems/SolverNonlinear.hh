@@ -43,6 +43,15 @@ class pylith::problems::SolverNonlinear : public Solver
 { // SolverNonlinear
   friend class TestSolverNonlinear; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum PredictorEnum {
+    PREDICTOR_ZERO=0, ///< Start Newton iterations from zero increment.
+    PREDICTOR_LINEAR=1, ///< Extrapolate previous increment.
+    PREDICTOR_QUADRATIC=2 ///< Extrapolate previous two increments.
+  }; // PredictorEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -54,6 +63,21 @@ public :
 
   /// Deallocate PETSc and local data structures.
   void deallocate(void);
+
+  /** Set predictor used for initial guess of solution increment.
+   *
+   * @param value Name of predictor ('zero', 'linear', or 'quadratic').
+   */
+  void predictor(const char* value);
+
+  /** Get predictor used for initial guess of solution increment.
+   *
+   * @returns Type of predictor.
+   */
+  PredictorEnum predictor(void) const;
+
+  /// Discard history of solution increments used by predictor.
+  void resetPredictor(void);
   
   /** Initialize solver.
    *
@@ -122,7 +146,7 @@ public :
    *
    * @param snes PETSc SNES solver.
    * @param initialGuessVec PETSc vector for initial guess.
-   * @param lsctx Optional context for line search (not used here).
+   * @param lsctx Context with solver (SolverNonlinear).
    * @returns PETSc error code.
    */
   static
@@ -136,10 +160,33 @@ private :
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Predict solution increment from increments of previous time
+   * steps.
+   *
+   * @param incrVec PETSc vector for predicted increment.
+   */
+  void _predictIncr(PetscVec incrVec);
+
+  /** Add converged solution increment to history for predictor and
+   * report iteration counts.
+   *
+   * @param incrVec PETSc vector with converged increment.
+   */
+  void _updatePredictor(const PetscVec incrVec);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscSNES _snes; ///< PETSc SNES nonlinear solver.
+  PetscVec _incrN; ///< Solution increment of previous time step.
+  PetscVec _incrNm1; ///< Solution increment of time step before previous one.
+  PetscVec _incrPredicted; ///< Predicted solution increment.
+  PylithScalar _dtN; ///< Time step of previous time step.
+  PylithScalar _dtNm1; ///< Time step of time step before previous one.
+  int _numIncr; ///< Number of increments in history.
+  PetscInt _numNewtonIts; ///< Total number of Newton iterations.
+  PetscInt _numLinearIts; ///< Total number of linear iterations.
+  PredictorEnum _predictor; ///< Predictor for initial guess.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
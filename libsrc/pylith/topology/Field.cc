@@ -701,6 +701,39 @@ pylith::topology::Field::complete(void)
   PYLITH_METHOD_END;
 } // complete
 
+// ----------------------------------------------------------------------
+// Start assembling section across processors.
+void
+pylith::topology::Field::completeBegin(void)
+{ // completeBegin
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+  PetscErrorCode err;
+
+  err = VecSet(_globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalBegin(_dm, _localVec, ADD_VALUES, _globalVec);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // completeBegin
+
+// ----------------------------------------------------------------------
+// Finish assembling section across processors.
+void
+pylith::topology::Field::completeEnd(void)
+{ // completeEnd
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+  PetscErrorCode err;
+
+  err = DMLocalToGlobalEnd(_dm, _localVec, ADD_VALUES, _globalVec);PYLITH_CHECK_ERROR(err);
+  err = DMGlobalToLocalBegin(_dm, _globalVec, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+  err = DMGlobalToLocalEnd(_dm, _globalVec, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // completeEnd
+
 // ----------------------------------------------------------------------
 // Copy field values and metadata.
 void
@@ -353,6 +353,14 @@ public :
   /// Complete section by assembling across processors.
   void complete(void);
 
+  /** Start assembling section across processors. The local values
+   * must not be changed until completeEnd() is called.
+   */
+  void completeBegin(void);
+
+  /// Finish assembling section across processors.
+  void completeEnd(void);
+
   /** Copy field values and metadata.
    *
    * @param field Field to copy.
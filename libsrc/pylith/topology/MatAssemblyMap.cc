@@ -0,0 +1,567 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MatAssemblyMap.hh" // implementation of class methods
+
+#include "Mesh.hh" // USES Mesh
+#include "Field.hh" // USES Field
+#include "VisitorSubMesh.hh" // USES SubMeshIS
+
+#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::lower_bound()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Anonymous namespace with codes for entries of cell matrices that are
+// not stored in the value array of the local rows and columns.
+namespace {
+  const PetscInt POSITION_SKIP = -1; ///< Constrained row or column.
+  const PetscInt POSITION_REMOTE = -2; ///< Row owned by another process.
+  const PetscInt POSITION_OFFDIAG = -3; ///< Start of positions in off-process columns.
+} // namespace
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::topology::MatAssemblyMap::MatAssemblyMap(void) :
+  _mat(0),
+  _diagMat(0),
+  _offdiagMat(0),
+  _diagArray(0),
+  _offdiagArray(0),
+  _nonzeroState(0),
+  _canUsePositions(false),
+  _usePositions(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Default destructor.
+pylith::topology::MatAssemblyMap::~MatAssemblyMap(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::MatAssemblyMap::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  endAssembly();
+
+  // Matrices are not owned by map.
+  _mat = 0;
+  _diagMat = 0;
+  _offdiagMat = 0;
+  _nonzeroState = 0;
+
+  _offsets.resize(0);
+  _indices.resize(0);
+  _positionOffsets.resize(0);
+  _positions.resize(0);
+
+  _canUsePositions = false;
+  _usePositions = false;
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Check whether map is current for matrix.
+bool
+pylith::topology::MatAssemblyMap::isCurrent(const PetscMat mat) const
+{ // isCurrent
+  PYLITH_METHOD_BEGIN;
+
+  if (!_mat || mat != _mat) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  PetscErrorCode err = 0;
+  PetscObjectState nonzeroState = 0;
+  err = MatGetNonzeroState(mat, &nonzeroState);PYLITH_CHECK_ERROR(err);
+  if (nonzeroState != _nonzeroState) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  // Positions can be computed once the nonzero structure has been
+  // assembled.
+  if (_canUsePositions && !_usePositions) {
+    PetscBool assembled = PETSC_FALSE;
+    err = MatAssembled(mat, &assembled);PYLITH_CHECK_ERROR(err);
+    if (assembled) {
+      PYLITH_METHOD_RETURN(false);
+    } // if
+  } // if
+
+  PYLITH_METHOD_RETURN(true);
+} // isCurrent
+
+// ----------------------------------------------------------------------
+// Setup map for cells of a mesh.
+void
+pylith::topology::MatAssemblyMap::setup(const PetscMat mat,
+					const Field& field,
+					const PetscInt* cells,
+					const PetscInt numCells)
+{ // setup
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+  assert(cells || 0 == numCells);
+
+  deallocate();
+  _mat = mat;
+
+  PetscDM dm = field.mesh().dmMesh();assert(dm);
+  PetscSection section = field.localSection();assert(section);
+  PetscSection globalSection = field.globalSection();assert(globalSection);
+  _setup(dm, section, globalSection, cells, 0, numCells);
+
+  PYLITH_METHOD_END;
+} // setup
+
+// ----------------------------------------------------------------------
+// Setup map for cells of a submesh.
+void
+pylith::topology::MatAssemblyMap::setup(const PetscMat mat,
+					const Field& field,
+					const SubMeshIS& submeshIS,
+					const PetscInt cStart,
+					const PetscInt cEnd)
+{ // setup
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+
+  deallocate();
+  _mat = mat;
+
+  PetscDM dm = submeshIS.submesh().dmMesh();assert(dm);
+  PetscIS subpointIS = submeshIS.indexSet();
+  PetscSection section = field.localSection();assert(section);
+  PetscSection globalSection = field.globalSection();assert(globalSection);
+
+  PetscErrorCode err = 0;
+  PetscSection subsection = NULL, globalSubsection = NULL;
+  err = PetscSectionCreateSubmeshSection(section, subpointIS, &subsection);PYLITH_CHECK_ERROR(err);assert(subsection);
+  err = PetscSectionCreateSubmeshSection(globalSection, subpointIS, &globalSubsection);PYLITH_CHECK_ERROR(err);assert(globalSubsection);
+
+  _setup(dm, subsection, globalSubsection, NULL, cStart, cEnd-cStart);
+
+  err = PetscSectionDestroy(&subsection);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionDestroy(&globalSubsection);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // setup
+
+// ----------------------------------------------------------------------
+// Setup map for blocks with precomputed global indices.
+void
+pylith::topology::MatAssemblyMap::setup(const PetscMat mat,
+					const PetscInt* indices,
+					const PetscInt numBlocks,
+					const PetscInt blockSize)
+{ // setup
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+  assert(indices || 0 == numBlocks);
+  assert(blockSize > 0);
+
+  deallocate();
+  _mat = mat;
+
+  _offsets.resize(numBlocks+1);
+  for (PetscInt b = 0; b <= numBlocks; ++b) {
+    _offsets[b] = b*blockSize;
+  } // for
+  _indices.resize(numBlocks*blockSize);
+  for (PetscInt i = 0; i < numBlocks*blockSize; ++i) {
+    _indices[i] = indices[i];
+  } // for
+
+  _setupStorage();
+
+  PYLITH_METHOD_END;
+} // setup
+
+// ----------------------------------------------------------------------
+// Get access to storage of matrix before adding cell matrices.
+void
+pylith::topology::MatAssemblyMap::beginAssembly(void)
+{ // beginAssembly
+  PYLITH_METHOD_BEGIN;
+
+  if (_usePositions) {
+    PetscErrorCode err = 0;
+    assert(_diagMat);
+    err = MatSeqAIJGetArray(_diagMat, &_diagArray);PYLITH_CHECK_ERROR(err);
+    if (_offdiagMat) {
+      err = MatSeqAIJGetArray(_offdiagMat, &_offdiagArray);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // if
+
+  PYLITH_METHOD_END;
+} // beginAssembly
+
+// ----------------------------------------------------------------------
+// Add cell matrix to matrix.
+void
+pylith::topology::MatAssemblyMap::addClosure(const PetscScalar* valuesCell,
+					     const PetscInt valuesSize,
+					     const PetscInt index)
+{ // addClosure
+  assert(_mat);
+  assert(index >= 0 && index+1 < PetscInt(_offsets.size()));
+
+  const PetscInt numIndices = _offsets[index+1] - _offsets[index];
+  assert(valuesSize == numIndices*numIndices);
+  const PetscInt* indicesCell = &_indices[_offsets[index]];
+
+  PetscErrorCode err = 0;
+  if (_usePositions) {
+    assert(_diagArray);
+    const PetscInt* positionsCell = &_positions[_positionOffsets[index]];
+    for (PetscInt i = 0; i < valuesSize; ++i) {
+      const PetscInt position = positionsCell[i];
+      if (position >= 0) {
+	_diagArray[position] += valuesCell[i];
+      } else if (position <= POSITION_OFFDIAG) {
+	assert(_offdiagArray);
+	_offdiagArray[POSITION_OFFDIAG-position] += valuesCell[i];
+      } else if (POSITION_REMOTE == position) {
+	err = MatSetValue(_mat, indicesCell[i / numIndices], indicesCell[i % numIndices], valuesCell[i], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+      } // if/else
+    } // for
+  } else {
+    // Negative (constrained) indices are ignored by PETSc.
+    err = MatSetValues(_mat, numIndices, indicesCell, numIndices, indicesCell, valuesCell, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+  } // if/else
+} // addClosure
+
+// ----------------------------------------------------------------------
+// Restore access to storage of matrix after adding cell matrices.
+void
+pylith::topology::MatAssemblyMap::endAssembly(void)
+{ // endAssembly
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  if (_diagArray) {
+    assert(_diagMat);
+    err = MatSeqAIJRestoreArray(_diagMat, &_diagArray);PYLITH_CHECK_ERROR(err);
+    _diagArray = 0;
+  } // if
+  if (_offdiagArray) {
+    assert(_offdiagMat);
+    err = MatSeqAIJRestoreArray(_offdiagMat, &_offdiagArray);PYLITH_CHECK_ERROR(err);
+    _offdiagArray = 0;
+  } // if
+
+  PYLITH_METHOD_END;
+} // endAssembly
+
+// ----------------------------------------------------------------------
+// Setup map.
+void
+pylith::topology::MatAssemblyMap::_setup(PetscDM dm,
+					 PetscSection section,
+					 PetscSection globalSection,
+					 const PetscInt* cells,
+					 const PetscInt cStart,
+					 const PetscInt numCells)
+{ // _setup
+  PYLITH_METHOD_BEGIN;
+
+  assert(dm);
+  assert(section);
+  assert(globalSection);
+  assert(_mat);
+
+  PetscErrorCode err = 0;
+  PetscInt numFields = 0;
+  err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+
+  // Count number of indices in closure of each cell.
+  _offsets.resize(numCells+1);
+  _offsets[0] = 0;
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells ? cells[c] : cStart + c;
+    PetscInt* closure = NULL;
+    PetscInt closureSize = 0;
+    err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    PetscInt numIndices = 0;
+    for (PetscInt p = 0; p < closureSize; ++p) {
+      PetscInt dof = 0;
+      err = PetscSectionGetDof(section, closure[2*p], &dof);PYLITH_CHECK_ERROR(err);
+      numIndices += dof;
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    _offsets[c+1] = _offsets[c] + numIndices;
+  } // for
+
+  // Compute global indices using the same ordering and conventions
+  // as DMPlexMatSetClosure(): indices are ordered by field and then
+  // by point in the closure, ghost points use the global offset of
+  // the owner, and constrained DOF get negative indices. DOF are
+  // associated with vertices, so the orientation of points is not
+  // used.
+  _indices.resize(_offsets[numCells]);
+  int_array fieldOffsets(numFields > 0 ? numFields : 1);
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells ? cells[c] : cStart + c;
+    PetscInt* indicesCell = &_indices[_offsets[c]];
+    PetscInt* closure = NULL;
+    PetscInt closureSize = 0;
+    err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    if (numFields > 0) {
+      // Starting index of each field.
+      fieldOffsets = 0;
+      for (PetscInt p = 0; p < closureSize; ++p) {
+	for (PetscInt f = 0; f < numFields; ++f) {
+	  PetscInt fdof = 0;
+	  err = PetscSectionGetFieldDof(section, closure[2*p], f, &fdof);PYLITH_CHECK_ERROR(err);
+	  if (f+1 < numFields) {
+	    fieldOffsets[f+1] += fdof;
+	  } // if
+	} // for
+      } // for
+      for (PetscInt f = 1; f < numFields; ++f) {
+	fieldOffsets[f] += fieldOffsets[f-1];
+      } // for
+    } else {
+      fieldOffsets = 0;
+    } // if/else
+
+    for (PetscInt p = 0; p < closureSize; ++p) {
+      const PetscInt point = closure[2*p];
+      PetscInt goff = 0;
+      err = PetscSectionGetOffset(globalSection, point, &goff);PYLITH_CHECK_ERROR(err);
+      const PetscInt off = (goff < 0) ? -(goff+1) : goff;
+
+      if (numFields > 0) {
+	PetscInt foff = 0;
+	for (PetscInt f = 0; f < numFields; ++f) {
+	  PetscInt fdof = 0, fcdof = 0;
+	  const PetscInt* fcdofs = NULL;
+	  err = PetscSectionGetFieldDof(section, point, f, &fdof);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetFieldConstraintDof(section, point, f, &fcdof);PYLITH_CHECK_ERROR(err);
+	  if (fcdof > 0) {
+	    err = PetscSectionGetFieldConstraintIndices(section, point, f, &fcdofs);PYLITH_CHECK_ERROR(err);
+	  } // if
+	  for (PetscInt k = 0, cind = 0; k < fdof; ++k) {
+	    if (cind < fcdof && k == fcdofs[cind]) {
+	      indicesCell[fieldOffsets[f]+k] = -(off+foff+k+1);
+	      ++cind;
+	    } else {
+	      indicesCell[fieldOffsets[f]+k] = off+foff+k-cind;
+	    } // if/else
+	  } // for
+	  foff += fdof - fcdof;
+	  fieldOffsets[f] += fdof;
+	} // for
+      } else {
+	PetscInt dof = 0, cdof = 0;
+	const PetscInt* cdofs = NULL;
+	err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetConstraintDof(section, point, &cdof);PYLITH_CHECK_ERROR(err);
+	if (cdof > 0) {
+	  err = PetscSectionGetConstraintIndices(section, point, &cdofs);PYLITH_CHECK_ERROR(err);
+	} // if
+	for (PetscInt k = 0, cind = 0; k < dof; ++k) {
+	  if (cind < cdof && k == cdofs[cind]) {
+	    indicesCell[fieldOffsets[0]+k] = -(off+k+1);
+	    ++cind;
+	  } else {
+	    indicesCell[fieldOffsets[0]+k] = off+k-cind;
+	  } // if/else
+	} // for
+	fieldOffsets[0] += dof;
+      } // if/else
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  _setupStorage();
+
+  PYLITH_METHOD_END;
+} // _setup
+
+// ----------------------------------------------------------------------
+// Record nonzero state and type of matrix and compute positions of
+// entries if matrix has been assembled.
+void
+pylith::topology::MatAssemblyMap::_setupStorage(void)
+{ // _setupStorage
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mat);
+
+  PetscErrorCode err = 0;
+  err = MatGetNonzeroState(_mat, &_nonzeroState);PYLITH_CHECK_ERROR(err);
+
+  // Direct access to the matrix storage is limited to AIJ matrices.
+  PetscBool isSeqAIJ = PETSC_FALSE, isMPIAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject)_mat, MATSEQAIJ, &isSeqAIJ);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject)_mat, MATMPIAIJ, &isMPIAIJ);PYLITH_CHECK_ERROR(err);
+  _canUsePositions = isSeqAIJ || isMPIAIJ;
+
+  PetscBool assembled = PETSC_FALSE;
+  err = MatAssembled(_mat, &assembled);PYLITH_CHECK_ERROR(err);
+  if (_canUsePositions && assembled) {
+    _usePositions = _setupPositions();
+    _canUsePositions = _usePositions;
+  } // if
+
+  PYLITH_METHOD_END;
+} // _setupStorage
+
+// ----------------------------------------------------------------------
+// Compute positions of entries of cell matrices in storage of
+// assembled AIJ matrix.
+bool
+pylith::topology::MatAssemblyMap::_setupPositions(void)
+{ // _setupPositions
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mat);
+
+  PetscErrorCode err = 0;
+  PetscBool isMPIAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject)_mat, MATMPIAIJ, &isMPIAIJ);PYLITH_CHECK_ERROR(err);
+
+  const PetscInt* colmap = NULL;
+  PetscInt numOffdiagCols = 0;
+  if (isMPIAIJ) {
+    err = MatMPIAIJGetSeqAIJ(_mat, &_diagMat, &_offdiagMat, &colmap);PYLITH_CHECK_ERROR(err);
+    err = MatGetLocalSize(_offdiagMat, NULL, &numOffdiagCols);PYLITH_CHECK_ERROR(err);
+  } else {
+    _diagMat = _mat;
+    _offdiagMat = 0;
+  } // if/else
+
+  PetscInt rStart = 0, rEnd = 0, cStart = 0, cEnd = 0;
+  err = MatGetOwnershipRange(_mat, &rStart, &rEnd);PYLITH_CHECK_ERROR(err);
+  err = MatGetOwnershipRangeColumn(_mat, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscInt numRows = 0;
+  PetscBool done = PETSC_FALSE;
+  const PetscInt* iDiag = NULL;
+  const PetscInt* jDiag = NULL;
+  err = MatGetRowIJ(_diagMat, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iDiag, &jDiag, &done);PYLITH_CHECK_ERROR(err);
+  if (!done) {
+    _diagMat = 0;
+    _offdiagMat = 0;
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  const PetscInt* iOffdiag = NULL;
+  const PetscInt* jOffdiag = NULL;
+  if (_offdiagMat) {
+    err = MatGetRowIJ(_offdiagMat, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iOffdiag, &jOffdiag, &done);PYLITH_CHECK_ERROR(err);
+    if (!done) {
+      err = MatRestoreRowIJ(_diagMat, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iDiag, &jDiag, &done);PYLITH_CHECK_ERROR(err);
+      _diagMat = 0;
+      _offdiagMat = 0;
+      PYLITH_METHOD_RETURN(false);
+    } // if
+  } // if
+
+  const PetscInt numCells = _offsets.size() - 1;
+  _positionOffsets.resize(numCells+1);
+  _positionOffsets[0] = 0;
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt numIndices = _offsets[c+1] - _offsets[c];
+    _positionOffsets[c+1] = _positionOffsets[c] + numIndices*numIndices;
+  } // for
+  _positions.resize(_positionOffsets[numCells]);
+
+  // Columns in each row of the sequential AIJ matrices are sorted, as
+  // are the global indices of the off-process columns.
+  bool foundAll = true;
+  for (PetscInt c = 0; c < numCells && foundAll; ++c) {
+    const PetscInt numIndices = _offsets[c+1] - _offsets[c];
+    const PetscInt* indicesCell = &_indices[_offsets[c]];
+    PetscInt* positionsCell = &_positions[_positionOffsets[c]];
+    for (PetscInt i = 0; i < numIndices; ++i) {
+      const PetscInt row = indicesCell[i];
+      for (PetscInt j = 0; j < numIndices; ++j) {
+	const PetscInt col = indicesCell[j];
+	PetscInt& position = positionsCell[i*numIndices+j];
+	if (row < 0 || col < 0) {
+	  position = POSITION_SKIP;
+	} else if (row < rStart || row >= rEnd) {
+	  position = POSITION_REMOTE;
+	} else if (col >= cStart && col < cEnd) {
+	  const PetscInt* rowBegin = jDiag + iDiag[row-rStart];
+	  const PetscInt* rowEnd = jDiag + iDiag[row-rStart+1];
+	  const PetscInt* entry = std::lower_bound(rowBegin, rowEnd, col-cStart);
+	  if (entry == rowEnd || *entry != col-cStart) {
+	    foundAll = false;
+	    break;
+	  } // if
+	  position = entry - jDiag;
+	} else {
+	  const PetscInt* colmapEnd = colmap + numOffdiagCols;
+	  const PetscInt* colEntry = colmap ? std::lower_bound(colmap, colmapEnd, col) : colmapEnd;
+	  if (colEntry == colmapEnd || *colEntry != col) {
+	    foundAll = false;
+	    break;
+	  } // if
+	  const PetscInt colOffdiag = colEntry - colmap;
+	  const PetscInt* rowBegin = jOffdiag + iOffdiag[row-rStart];
+	  const PetscInt* rowEnd = jOffdiag + iOffdiag[row-rStart+1];
+	  const PetscInt* entry = std::lower_bound(rowBegin, rowEnd, colOffdiag);
+	  if (entry == rowEnd || *entry != colOffdiag) {
+	    foundAll = false;
+	    break;
+	  } // if
+	  position = POSITION_OFFDIAG - (entry - jOffdiag);
+	} // if/else
+      } // for
+      if (!foundAll) {
+	break;
+      } // if
+    } // for
+  } // for
+
+  err = MatRestoreRowIJ(_diagMat, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iDiag, &jDiag, &done);PYLITH_CHECK_ERROR(err);
+  if (_offdiagMat) {
+    err = MatRestoreRowIJ(_offdiagMat, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iOffdiag, &jOffdiag, &done);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  if (!foundAll) {
+    // Entry is missing from nonzero structure, so we let PETSc handle
+    // insertion.
+    _positionOffsets.resize(0);
+    _positions.resize(0);
+    _diagMat = 0;
+    _offdiagMat = 0;
+  } // if
+
+  PYLITH_METHOD_RETURN(foundAll);
+} // _setupPositions
+
+
+// End of file
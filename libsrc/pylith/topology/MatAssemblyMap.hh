@@ -0,0 +1,191 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/MatAssemblyMap.hh
+ *
+ * @brief Precomputed map from cell matrices to the storage of a PETSc
+ * sparse matrix.
+ *
+ * The global indices of the closure of each cell are computed once.
+ * For AIJ matrices (sequential or parallel), once the nonzero
+ * structure of the matrix has been assembled, we also compute the
+ * position of every entry of the cell matrix in the value arrays of
+ * the matrix, so that cell matrices are added directly into the
+ * matrix storage without translating indices or searching rows.
+ * Entries in rows owned by other processes and matrices of other
+ * types use MatSetValues() with the precomputed indices.
+ *
+ * The map is rebuilt whenever the matrix or its nonzero structure
+ * changes.
+ */
+
+#if !defined(pylith_topology_matassemblymap_hh)
+#define pylith_topology_matassemblymap_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HOLDSA PetscMat
+#include "pylith/utils/arrayfwd.hh" // HASA int_array
+
+// MatAssemblyMap -------------------------------------------------------
+/// Precomputed map from cell matrices to storage of PETSc sparse matrix.
+class pylith::topology::MatAssemblyMap
+{ // MatAssemblyMap
+  friend class TestMatAssemblyMap; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  MatAssemblyMap(void);
+
+  /// Default destructor.
+  ~MatAssemblyMap(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Check whether map is current for matrix.
+   *
+   * @param mat PETSc matrix.
+   * @returns True if map is current, false if it must be setup again.
+   */
+  bool isCurrent(const PetscMat mat) const;
+
+  /** Setup map for cells of a mesh.
+   *
+   * @param mat PETSc matrix.
+   * @param field Field associated with rows and columns of matrix.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void setup(const PetscMat mat,
+	     const Field& field,
+	     const PetscInt* cells,
+	     const PetscInt numCells);
+
+  /** Setup map for cells of a submesh.
+   *
+   * @param mat PETSc matrix.
+   * @param field Field associated with rows and columns of matrix.
+   * @param submeshIS Submesh index set.
+   * @param cStart First cell in submesh.
+   * @param cEnd One past last cell in submesh.
+   */
+  void setup(const PetscMat mat,
+	     const Field& field,
+	     const SubMeshIS& submeshIS,
+	     const PetscInt cStart,
+	     const PetscInt cEnd);
+
+  /** Setup map for blocks with precomputed global indices, such as
+   * constraints that are not associated with the closure of a cell.
+   *
+   * @param mat PETSc matrix.
+   * @param indices Global indices of blocks (negative if constrained).
+   * @param numBlocks Number of blocks.
+   * @param blockSize Number of indices in each block.
+   */
+  void setup(const PetscMat mat,
+	     const PetscInt* indices,
+	     const PetscInt numBlocks,
+	     const PetscInt blockSize);
+
+  /// Get access to storage of matrix before adding cell matrices.
+  void beginAssembly(void);
+
+  /** Add cell matrix to matrix.
+   *
+   * @param valuesCell Cell matrix (row major).
+   * @param valuesSize Size of cell matrix.
+   * @param index Index of cell in array (or range) of cells, or index
+   * of block, used in setup.
+   */
+  void addClosure(const PetscScalar* valuesCell,
+		  const PetscInt valuesSize,
+		  const PetscInt index);
+
+  /// Restore access to storage of matrix after adding cell matrices.
+  void endAssembly(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Setup map by computing global indices of the closure of the
+   * cells and, if possible, the positions of entries in the matrix
+   * storage.
+   *
+   * @param dm PETSc DM associated with cells.
+   * @param section Local section of field.
+   * @param globalSection Global section of field.
+   * @param cells Array of cells (NULL for range of cells).
+   * @param cStart First cell in range (if cells is NULL).
+   * @param numCells Number of cells.
+   */
+  void _setup(PetscDM dm,
+	      PetscSection section,
+	      PetscSection globalSection,
+	      const PetscInt* cells,
+	      const PetscInt cStart,
+	      const PetscInt numCells);
+
+  /** Record nonzero state and type of matrix and, if the matrix has
+   * been assembled, compute positions of entries in the matrix storage.
+   */
+  void _setupStorage(void);
+
+  /** Compute positions of entries of cell matrices in the storage of
+   * an assembled AIJ matrix.
+   *
+   * @returns True if all entries were found in the nonzero structure
+   * of the matrix, false otherwise.
+   */
+  bool _setupPositions(void);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  MatAssemblyMap(const MatAssemblyMap&); ///< Not implemented
+  const MatAssemblyMap& operator=(const MatAssemblyMap&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PetscMat _mat; ///< PETSc matrix associated with map.
+  PetscMat _diagMat; ///< Sequential matrix with local rows and columns.
+  PetscMat _offdiagMat; ///< Sequential matrix with local rows and off-process columns.
+  PetscScalar* _diagArray; ///< Storage of values of _diagMat during assembly.
+  PetscScalar* _offdiagArray; ///< Storage of values of _offdiagMat during assembly.
+  PetscObjectState _nonzeroState; ///< Nonzero state of matrix when map was setup.
+
+  int_array _offsets; ///< Offset of global indices of each cell.
+  int_array _indices; ///< Global indices of closure of cells (negative if constrained).
+  int_array _positionOffsets; ///< Offset of positions for each cell.
+  int_array _positions; ///< Position of each entry of cell matrices in matrix storage.
+
+  bool _canUsePositions; ///< True if matrix type supports direct access to storage.
+  bool _usePositions; ///< True if positions are current.
+
+}; // MatAssemblyMap
+
+#endif // pylith_topology_matassemblymap_hh
+
+
+// End of file
@@ -0,0 +1,287 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::sort()
+#include <utility> // USES std::pair
+#include <vector> // USES std::vector
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Reorder vertices and cells in mesh.
+void
+pylith::topology::SpaceFillingCurve::reorder(topology::Mesh* mesh,
+					     const CurveEnum curve)
+{ // reorder
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  PetscDM dmOrig = mesh->dmMesh();assert(dmOrig);
+  PetscErrorCode err;
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+  topology::Stratum cellsStratum(dmOrig, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  topology::Stratum verticesStratum(dmOrig, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Cohesive cells and vertices are not reordered, so the hybrid
+  // bounds of the original mesh remain valid.
+  PetscInt cMaxOrig = -1, fMaxOrig = -1, eMaxOrig = -1, vMaxOrig = -1;
+  err = DMPlexGetHybridBounds(dmOrig, &cMaxOrig, &fMaxOrig, &eMaxOrig, &vMaxOrig);PYLITH_CHECK_ERROR(err);
+  const PetscInt cMax = (cMaxOrig < 0) ? cEnd : cMaxOrig;
+  const PetscInt vMax = (vMaxOrig < 0) ? vEnd : vMaxOrig;
+  const PetscInt numCells = cMax - cStart;
+
+  PetscInt spaceDim = 0;
+  err = DMGetCoordinateDim(dmOrig, &spaceDim);PYLITH_CHECK_ERROR(err);
+  assert(spaceDim > 0 && spaceDim <= 3);
+
+  // Compute centroids of cells.
+  scalar_array centroids(numCells*spaceDim);
+  centroids = 0.0;
+  topology::CoordsVisitor coordsVisitor(dmOrig);
+  for (PetscInt c = cStart; c < cMax; ++c) {
+    PetscScalar* coordsCell = NULL;
+    PetscInt coordsSize = 0;
+    coordsVisitor.getClosure(&coordsCell, &coordsSize, c);
+    const int numCorners = coordsSize / spaceDim;assert(numCorners > 0);
+    for (int iCorner=0; iCorner < numCorners; ++iCorner) {
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	centroids[(c-cStart)*spaceDim+iDim] += coordsCell[iCorner*spaceDim+iDim] / numCorners;
+      } // for
+    } // for
+    coordsVisitor.restoreClosure(&coordsCell, &coordsSize, c);
+  } // for
+
+  // Bounding box of centroids for mapping coordinates to integers.
+  scalar_array centroidMin(spaceDim);
+  scalar_array centroidMax(spaceDim);
+  centroidMin = 0.0;
+  centroidMax = 0.0;
+  for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      const PylithScalar value = centroids[iCell*spaceDim+iDim];
+      if (0 == iCell || value < centroidMin[iDim]) {
+	centroidMin[iDim] = value;
+      } // if
+      if (0 == iCell || value > centroidMax[iDim]) {
+	centroidMax[iDim] = value;
+      } // if
+    } // for
+  } // for
+
+  // Index along curve fits in an unsigned int.
+  const int numBits = (3 == spaceDim) ? 10 : 16;
+  const PylithScalar maxCoord = PylithScalar((1U << numBits) - 1);
+  scalar_array coordScale(spaceDim);
+  for (int iDim=0; iDim < spaceDim; ++iDim) {
+    const PylithScalar range = centroidMax[iDim] - centroidMin[iDim];
+    coordScale[iDim] = (range > 0.0) ? maxCoord / range : 0.0;
+  } // for
+
+  // Sort cells by material id and then by index along curve. Ties
+  // retain the original order.
+  typedef std::pair<PetscInt, unsigned int> key_type;
+  typedef std::pair<key_type, PetscInt> keycell_type;
+  std::vector<keycell_type> sortedCells(numCells);
+  PetscDMLabel materialsLabel = NULL;
+  err = DMGetLabel(dmOrig, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);
+  unsigned int coordsInt[3];
+  for (PetscInt c = cStart; c < cMax; ++c) {
+    PetscInt materialId = -1;
+    if (materialsLabel) {
+      err = DMLabelGetValue(materialsLabel, c, &materialId);PYLITH_CHECK_ERROR(err);
+    } // if
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      coordsInt[iDim] = (unsigned int)((centroids[(c-cStart)*spaceDim+iDim] - centroidMin[iDim]) * coordScale[iDim] + 0.5);
+    } // for
+    const unsigned int index = _curveIndex(coordsInt, spaceDim, numBits, curve);
+    sortedCells[c-cStart] = keycell_type(key_type(materialId, index), c);
+  } // for
+  std::sort(sortedCells.begin(), sortedCells.end());
+
+  // Permutation gives new point number for each original point; points
+  // other than normal cells and vertices are not moved.
+  int_array permutation(pEnd-pStart);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    permutation[p-pStart] = p;
+  } // for
+  for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+    permutation[sortedCells[iCell].second-pStart] = cStart + iCell;
+  } // for
+
+  // Number vertices in the order they are first used by the reordered
+  // cells. Vertices not in the closure of a normal cell follow.
+  int_array newVertices(vMax-vStart);
+  newVertices = -1;
+  PetscInt vNext = vStart;
+  for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+    const PetscInt c = sortedCells[iCell].second;
+    PetscInt closureSize = 0, *closure = NULL;
+    err = DMPlexGetTransitiveClosure(dmOrig, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+      const PetscInt v = closure[cl];
+      if (v >= vStart && v < vMax && newVertices[v-vStart] < 0) {
+	newVertices[v-vStart] = vNext++;
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmOrig, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+  for (PetscInt v = vStart; v < vMax; ++v) {
+    if (newVertices[v-vStart] < 0) {
+      newVertices[v-vStart] = vNext++;
+    } // if
+    permutation[v-pStart] = newVertices[v-vStart];
+  } // for
+  assert(vMax == vNext);
+
+  PetscIS permutationIS = NULL;
+  PetscDM dmNew = NULL;
+  err = ISCreateGeneral(PETSC_COMM_SELF, permutation.size(), &permutation[0], PETSC_USE_POINTER, &permutationIS);PYLITH_CHECK_ERROR(err);
+  err = DMPlexPermute(dmOrig, permutationIS, &dmNew);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&permutationIS);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetHybridBounds(dmNew, cMaxOrig, fMaxOrig, eMaxOrig, vMaxOrig);PYLITH_CHECK_ERROR(err);
+  _permutePointSF(dmNew, dmOrig, &permutation[0]);
+
+  mesh->dmMesh(dmNew);
+
+  PYLITH_METHOD_END;
+} // reorder
+
+// ----------------------------------------------------------------------
+// Compute index of point along space-filling curve.
+unsigned int
+pylith::topology::SpaceFillingCurve::_curveIndex(unsigned int* coords,
+						 const int dim,
+						 const int numBits,
+						 const CurveEnum curve)
+{ // _curveIndex
+  assert(coords);
+  assert(dim > 0);
+  assert(numBits > 0);
+
+  if (HILBERT == curve) {
+    // Transform coordinates to the transposed Hilbert index (Skilling,
+    // Programming the Hilbert curve, AIP Conf. Proc. 707, 2004).
+    const unsigned int m = 1U << (numBits-1);
+    for (unsigned int q = m; q > 1; q >>= 1) {
+      const unsigned int p = q - 1;
+      for (int i=0; i < dim; ++i) {
+	if (coords[i] & q) {
+	  coords[0] ^= p;
+	} else {
+	  const unsigned int t = (coords[0] ^ coords[i]) & p;
+	  coords[0] ^= t;
+	  coords[i] ^= t;
+	} // if/else
+      } // for
+    } // for
+
+    // Gray encode.
+    for (int i=1; i < dim; ++i) {
+      coords[i] ^= coords[i-1];
+    } // for
+    unsigned int t = 0;
+    for (unsigned int q = m; q > 1; q >>= 1) {
+      if (coords[dim-1] & q) {
+	t ^= q - 1;
+      } // if
+    } // for
+    for (int i=0; i < dim; ++i) {
+      coords[i] ^= t;
+    } // for
+  } // if
+
+  // Interleave bits, most significant first.
+  unsigned int index = 0;
+  for (int iBit=numBits-1; iBit >= 0; --iBit) {
+    for (int i=0; i < dim; ++i) {
+      index = (index << 1) | ((coords[i] >> iBit) & 1U);
+    } // for
+  } // for
+
+  return index;
+} // _curveIndex
+
+// ----------------------------------------------------------------------
+// Update point SF of reordered DM.
+void
+pylith::topology::SpaceFillingCurve::_permutePointSF(PetscDM dmNew,
+						     PetscDM dmOrig,
+						     const PetscInt* permutation)
+{ // _permutePointSF
+  PYLITH_METHOD_BEGIN;
+
+  assert(dmNew);
+  assert(dmOrig);
+  assert(permutation);
+
+  PetscErrorCode err;
+  PetscSF sfOrig = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* localPoints = NULL;
+  const PetscSFNode* remotePoints = NULL;
+  err = DMGetPointSF(dmOrig, &sfOrig);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfOrig, &numRoots, &numLeaves, &localPoints, &remotePoints);PYLITH_CHECK_ERROR(err);
+  if (numRoots < 0) { // no point SF (serial mesh)
+    PYLITH_METHOD_END;
+  } // if
+
+  // New numbers of the remote points come from their owners.
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  int_array remoteNumbers(pEnd-pStart);
+  remoteNumbers = -1;
+  err = PetscSFBcastBegin(sfOrig, MPIU_INT, permutation, &remoteNumbers[0]);PYLITH_CHECK_ERROR(err);
+  err = PetscSFBcastEnd(sfOrig, MPIU_INT, permutation, &remoteNumbers[0]);PYLITH_CHECK_ERROR(err);
+
+  PetscInt* localPointsNew = NULL;
+  PetscSFNode* remotePointsNew = NULL;
+  err = PetscMalloc1(numLeaves, &localPointsNew);PYLITH_CHECK_ERROR(err);
+  err = PetscMalloc1(numLeaves, &remotePointsNew);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iLeaf=0; iLeaf < numLeaves; ++iLeaf) {
+    const PetscInt leaf = localPoints ? localPoints[iLeaf] : iLeaf;
+    localPointsNew[iLeaf] = permutation[leaf];
+    remotePointsNew[iLeaf].rank = remotePoints[iLeaf].rank;
+    remotePointsNew[iLeaf].index = remoteNumbers[leaf];
+  } // for
+
+  PetscSF sfNew = NULL;
+  err = DMGetPointSF(dmNew, &sfNew);PYLITH_CHECK_ERROR(err);
+  err = PetscSFSetGraph(sfNew, numRoots, numLeaves, localPointsNew, PETSC_OWN_POINTER, remotePointsNew, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _permutePointSF
+
+
+// End of file
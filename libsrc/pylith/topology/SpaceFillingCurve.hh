@@ -0,0 +1,102 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Reordering of cells and vertices along a space-filling curve.
+ *
+ * Cells are sorted by material id and then by the position of their
+ * centroid along a Hilbert or Morton curve, so the cells of each
+ * material form a contiguous range of points. Vertices are numbered
+ * in the order in which they are first touched by the reordered
+ * cells. Cohesive (hybrid) cells and vertices, as well as edges and
+ * faces, keep their numbering, so the reordering can be applied after
+ * the topology has been adjusted for faults, after distribution, and
+ * after refinement.
+ */
+
+#if !defined(pylith_topology_spacefillingcurve_hh)
+#define pylith_topology_spacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+// SpaceFillingCurve ----------------------------------------------------
+/// Reordering of cells and vertices along a space-filling curve.
+class pylith::topology::SpaceFillingCurve
+{ // SpaceFillingCurve
+  friend class TestSpaceFillingCurve; // unit testing
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum CurveEnum {
+    HILBERT=0, ///< Hilbert curve.
+    MORTON=1 ///< Morton (Z-order) curve.
+  }; // CurveEnum
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Reorder vertices and cells of mesh along a space-filling curve.
+   *
+   * @param mesh PyLith finite-element mesh.
+   * @param curve Type of space-filling curve.
+   */
+  static
+  void reorder(topology::Mesh* mesh,
+	       const CurveEnum curve =HILBERT);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /** Compute index of point along space-filling curve.
+   *
+   * @param coords Integer coordinates of point (modified).
+   * @param dim Number of coordinates.
+   * @param numBits Number of bits in each coordinate.
+   * @param curve Type of space-filling curve.
+   * @returns Index along curve.
+   */
+  static
+  unsigned int _curveIndex(unsigned int* coords,
+			   const int dim,
+			   const int numBits,
+			   const CurveEnum curve);
+
+  /** Update point SF of reordered DM.
+   *
+   * @param dmNew Reordered DM.
+   * @param dmOrig Original DM.
+   * @param permutation Permutation array (new point number for each
+   * original point).
+   */
+  static
+  void _permutePointSF(PetscDM dmNew,
+		       PetscDM dmOrig,
+		       const PetscInt* permutation);
+
+}; // SpaceFillingCurve
+
+#endif // pylith_topology_spacefillingcurve_hh
+
+
+// End of file
@@ -50,12 +50,14 @@ namespace pylith {
     class Jacobian;
     class MatVisitorMesh;
     class MatVisitorSubMesh;
+    class MatAssemblyMap;
 
     class Distributor;
 
     class RefineUniform;
 
     class ReverseCuthillMcKee;
+    class SpaceFillingCurve;
 
   } // topology
 } // pylith
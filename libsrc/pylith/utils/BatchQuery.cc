@@ -0,0 +1,218 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BatchQuery.hh" // Implementation of class methods
+
+#include "error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+
+#include <vector> // USES std::vector
+#include <utility> // USES std::pair
+#include <algorithm> // USES std::sort()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::utils::BatchQuery::BatchQuery(void) :
+  _spaceDim(0),
+  _sortPoints(true)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::utils::BatchQuery::~BatchQuery(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate data structures.
+void
+pylith::utils::BatchQuery::deallocate(void)
+{ // deallocate
+  _coords.resize(0);
+  _order.resize(0);
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Set flag for querying points in spatially sorted order.
+void
+pylith::utils::BatchQuery::sortPoints(const bool flag)
+{ // sortPoints
+  _sortPoints = flag;
+} // sortPoints
+
+// ----------------------------------------------------------------------
+// Set locations of points.
+void
+pylith::utils::BatchQuery::points(const scalar_array& coords,
+				  const int spaceDim,
+				  const PylithScalar lengthScale)
+{ // points
+  PYLITH_METHOD_BEGIN;
+
+  assert(spaceDim > 0);
+  assert(0 == coords.size() % spaceDim);
+
+  _spaceDim = spaceDim;
+  _coords.resize(coords.size());
+  _coords = coords * lengthScale;
+  _sortMorton();
+
+  PYLITH_METHOD_END;
+} // points
+
+// ----------------------------------------------------------------------
+// Get number of points.
+int
+pylith::utils::BatchQuery::numPoints(void) const
+{ // numPoints
+  return (_spaceDim > 0) ? _coords.size() / _spaceDim : 0;
+} // numPoints
+
+// ----------------------------------------------------------------------
+// Get spatial dimension of points.
+int
+pylith::utils::BatchQuery::spaceDim(void) const
+{ // spaceDim
+  return _spaceDim;
+} // spaceDim
+
+// ----------------------------------------------------------------------
+// Get dimensioned coordinates of point.
+const PylithScalar*
+pylith::utils::BatchQuery::point(const int index) const
+{ // point
+  assert(0 <= index && index < numPoints());
+  return &_coords[index*_spaceDim];
+} // point
+
+// ----------------------------------------------------------------------
+// Query database at all points.
+int
+pylith::utils::BatchQuery::query(scalar_array* values,
+				 const int numValues,
+				 spatialdata::spatialdb::SpatialDB* db,
+				 const spatialdata::geocoords::CoordSys* cs) const
+{ // query
+  PYLITH_METHOD_BEGIN;
+
+  assert(values);
+  assert(db);
+
+  const int numPoints = this->numPoints();
+  const int spaceDim = _spaceDim;
+  if (values->size() != size_t(numPoints*numValues)) {
+    values->resize(numPoints*numValues);
+  } // if
+  if (!numPoints || !numValues) {
+    PYLITH_METHOD_RETURN(-1);
+  } // if
+
+  // Values in a uniform database do not depend on location, so we
+  // query once and copy the values to the other points.
+  if (dynamic_cast<spatialdata::spatialdb::UniformDB*>(db)) {
+    const int err = db->query(&(*values)[0], numValues, &_coords[0], spaceDim, cs);
+    if (err) {
+      PYLITH_METHOD_RETURN(0);
+    } // if
+    for (int iPoint=1; iPoint < numPoints; ++iPoint) {
+      for (int i=0; i < numValues; ++i) {
+	(*values)[iPoint*numValues+i] = (*values)[i];
+      } // for
+    } // for
+    PYLITH_METHOD_RETURN(-1);
+  } // if
+
+  assert(_order.size() == size_t(numPoints));
+  for (int i=0; i < numPoints; ++i) {
+    const int iPoint = _order[i];
+    const int err = db->query(&(*values)[iPoint*numValues], numValues, &_coords[iPoint*spaceDim], spaceDim, cs);
+    if (err) {
+      PYLITH_METHOD_RETURN(iPoint);
+    } // if
+  } // for
+
+  PYLITH_METHOD_RETURN(-1);
+} // query
+
+// ----------------------------------------------------------------------
+// Compute order of points along Morton (Z-order) space-filling curve.
+void
+pylith::utils::BatchQuery::_sortMorton(void)
+{ // _sortMorton
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = this->numPoints();
+  const int spaceDim = _spaceDim;
+
+  _order.resize(numPoints);
+  for (int i=0; i < numPoints; ++i) {
+    _order[i] = i;
+  } // for
+  if (!_sortPoints || numPoints < 2) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Bounding box of points.
+  scalar_array xMin(spaceDim);
+  scalar_array xMax(spaceDim);
+  for (int d=0; d < spaceDim; ++d) {
+    xMin[d] = _coords[d];
+    xMax[d] = _coords[d];
+  } // for
+  for (int iPoint=1; iPoint < numPoints; ++iPoint) {
+    for (int d=0; d < spaceDim; ++d) {
+      const PylithScalar x = _coords[iPoint*spaceDim+d];
+      xMin[d] = std::min(xMin[d], x);
+      xMax[d] = std::max(xMax[d], x);
+    } // for
+  } // for
+
+  // Interleave bits of integer coordinates within bounding box.
+  typedef unsigned long long key_type;
+  const int numBits = 60 / spaceDim;
+  const PylithScalar maxCoord = PylithScalar((key_type(1) << numBits) - 1);
+  std::vector<std::pair<key_type, int> > keys(numPoints);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    key_type key = 0;
+    for (int d=0; d < spaceDim; ++d) {
+      const PylithScalar range = xMax[d] - xMin[d];
+      const key_type xInt = (range > 0.0) ? key_type((_coords[iPoint*spaceDim+d] - xMin[d]) / range * maxCoord) : 0;
+      for (int b=0; b < numBits; ++b) {
+	key |= ((xInt >> b) & key_type(1)) << (b*spaceDim + d);
+      } // for
+    } // for
+    keys[iPoint] = std::make_pair(key, iPoint);
+  } // for
+  std::sort(keys.begin(), keys.end());
+
+  for (int i=0; i < numPoints; ++i) {
+    _order[i] = keys[i].second;
+  } // for
+
+  PYLITH_METHOD_END;
+} // _sortMorton
+
+
+// End of file 
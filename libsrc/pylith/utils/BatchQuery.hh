@@ -0,0 +1,140 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/BatchQuery.hh
+ *
+ * @brief C++ object for querying a spatial database at a batch of
+ * points.
+ *
+ * All points are dimensionalized once and queried in an order that
+ * follows a space-filling curve, so that consecutive queries are
+ * close together in space. Queries of a UniformDB are done only once.
+ */
+
+#if !defined(pylith_utils_batchquery_hh)
+#define pylith_utils_batchquery_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "array.hh" // HASA scalar_array, int_array
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
+
+// BatchQuery -----------------------------------------------------------
+/** @brief C++ object for querying a spatial database at a batch of
+ * points.
+ */
+class pylith::utils::BatchQuery
+{ // BatchQuery
+  friend class TestBatchQuery; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  BatchQuery(void);
+
+  /// Destructor
+  ~BatchQuery(void);
+
+  /// Deallocate data structures.
+  void deallocate(void);
+
+  /** Set flag for querying points in spatially sorted order.
+   *
+   * @param flag True to sort points, false to query in given order.
+   */
+  void sortPoints(const bool flag);
+
+  /** Set locations of points.
+   *
+   * @param coords Nondimensional coordinates of points [numPoints*spaceDim].
+   * @param spaceDim Spatial dimension of coordinates.
+   * @param lengthScale Length scale used to dimensionalize coordinates.
+   */
+  void points(const scalar_array& coords,
+	      const int spaceDim,
+	      const PylithScalar lengthScale);
+
+  /** Get number of points.
+   *
+   * @returns Number of points.
+   */
+  int numPoints(void) const;
+
+  /** Get spatial dimension of points.
+   *
+   * @returns Spatial dimension.
+   */
+  int spaceDim(void) const;
+
+  /** Get dimensioned coordinates of point.
+   *
+   * @param index Index of point.
+   *
+   * @returns Coordinates of point.
+   */
+  const PylithScalar* point(const int index) const;
+
+  /** Query database at all points.
+   *
+   * @pre Database must be open and values to query must be set via
+   * SpatialDB::queryVals().
+   *
+   * @param values Array of values [numPoints*numValues].
+   * @param numValues Number of values per point.
+   * @param db Spatial database.
+   * @param cs Coordinate system of points.
+   *
+   * @returns Index of point where query failed, -1 if all queries
+   * were successful.
+   */
+  int query(scalar_array* values,
+	    const int numValues,
+	    spatialdata::spatialdb::SpatialDB* db,
+	    const spatialdata::geocoords::CoordSys* cs) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Compute order of points along Morton (Z-order) space-filling curve.
+  void _sortMorton(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  scalar_array _coords; ///< Dimensioned coordinates of points.
+  int_array _order; ///< Order in which points are queried.
+  int _spaceDim; ///< Spatial dimension of points.
+  bool _sortPoints; ///< True if points are queried in sorted order.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BatchQuery(const BatchQuery&); ///< Not implemented
+  const BatchQuery& operator=(const BatchQuery&); ///< Not implemented
+
+}; // BatchQuery
+
+#endif // pylith_utils_batchquery_hh
+
+
+// End of file 
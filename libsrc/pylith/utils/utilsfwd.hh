@@ -31,6 +31,7 @@ namespace pylith {
   namespace utils {
 
     class EventLogger;
+    class BatchQuery;
     class PylithVersion;
     class PetscVersion;
     class DependenciesVersion;
@@ -75,6 +75,13 @@ namespace pylith {
        */
       void openFreeSurf(const bool value);
 
+      /** Set flag for using a direct solver (LU) for the sensitivity
+       * problem.
+       *
+       * @param value True if using direct solver, false otherwise.
+       */
+      void sensitivityDirectSolve(const bool value);
+
       /** Initialize fault. Determine orientation and setup boundary
        * condition parameters.
        *
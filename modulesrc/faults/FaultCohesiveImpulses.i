@@ -103,6 +103,22 @@ namespace pylith {
 			     const PylithScalar t,
 			     pylith::topology::SolutionFields* const fields);
       
+      /** Compute sensitivities of an observation to the impulses from
+       * the solution of the adjoint problem.
+       *
+       * @param values Array of sensitivities for all impulses (output).
+       * @param numValues Size of array (total number of impulses).
+       * @param adjoint Solution of adjoint problem.
+       */
+      %apply(PylithScalar* INPLACE_ARRAY1, int DIM1) {
+	(PylithScalar* values,
+	 const int numValues)
+	  };
+      void adjointSensitivities(PylithScalar* values,
+				const int numValues,
+				const pylith::topology::Field& adjoint);
+      %clear(PylithScalar* values, const int numValues);
+
       /** Get vertex field associated with integrator.
        *
        * @param name Name of cell field.
@@ -53,6 +53,14 @@ namespace pylith {
       void initialize(const pylith::topology::Mesh& mesh,
 		      const PylithScalar upDir[3]);
       
+      /** Set approximation of [K]^(-1) used in the custom
+       * preconditioner for the Lagrange multipliers.
+       *
+       * @param value Name of approximation ('diagonal', 'vertex_block',
+       * or 'fault_diagonal').
+       */
+      void constraintPCType(const char* value);
+
       /** Setup DOF on solution field.
        *
        * @param field Solution field.
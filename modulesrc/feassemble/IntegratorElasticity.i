@@ -46,6 +46,13 @@ namespace pylith {
        * @param m Elastic material.
        */
       void material(pylith::materials::ElasticMaterial* m);
+
+      /** Set flag for caching strain and stress when updating state
+       * variables.
+       *
+       * @param value True if strain and stress should be cached, false otherwise.
+       */
+      void cacheStrainStress(const bool value);
       
       /** Determine whether we need to recompute the Jacobian.
        *
@@ -102,6 +102,33 @@ convert_scalararray(PyObject* input,
 }
 
 
+// Typemap suite for (PylithScalar* INPLACE_ARRAY1, int DIM1)
+%typecheck(SWIG_TYPECHECK_DOUBLE_ARRAY)
+  (PylithScalar* INPLACE_ARRAY1, int DIM1)
+{
+  $1 = is_array($input) && (sizeof(double) == sizeof(PylithScalar) ?
+			    PyArray_EquivTypenums(array_type($input), NPY_DOUBLE) :
+			    PyArray_EquivTypenums(array_type($input), NPY_FLOAT));
+}
+%typemap(in)
+  (PylithScalar* INPLACE_ARRAY1, int DIM1)
+  (PyArrayObject* array=NULL)
+{
+  if (sizeof(float) == sizeof(PylithScalar)) {
+    array = obj_to_array_no_conversion($input, NPY_FLOAT);
+  } else if (sizeof(double) == sizeof(PylithScalar)) {
+    array = obj_to_array_no_conversion($input, NPY_DOUBLE);
+  } else {
+    PyErr_Format(PyExc_TypeError, 
+		 "Unknown size for PyLithscalar.  '%ld' given.", 
+		 sizeof(PylithScalar));
+  } // if/else
+  if (!array || !require_dimensions(array, 1) || !require_contiguous(array) || !require_native(array)) SWIG_fail;
+  $1 = (PylithScalar*) array_data(array);
+  $2 = (int) array_size(array,0);
+}
+
+
 /* Typemap suite for (DATA_TYPE* IN_ARRAY2, int DIM1, int DIM2)
  */
 %typecheck(SWIG_TYPECHECK_DOUBLE_ARRAY)
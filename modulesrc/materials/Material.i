@@ -103,6 +103,33 @@ namespace pylith {
        */
       void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
       
+      /** Set flag for compact storage of physical properties.
+       *
+       * @param flag True to use compact storage, false to store values
+       * at every quadrature point.
+       */
+      void compactStorage(const bool flag);
+
+      /** Get flag for compact storage of physical properties.
+       *
+       * @returns True if using compact storage, false otherwise.
+       */
+      bool compactStorage(void) const;
+
+      /** Set flag for storing state variables in single precision.
+       *
+       * @param flag True to store state variables in single
+       * precision, false to store them in double precision.
+       */
+      void reducedPrecision(const bool flag);
+
+      /** Get flag for storing state variables in single precision.
+       *
+       * @returns True if storing state variables in single precision,
+       * false otherwise.
+       */
+      bool reducedPrecision(void) const;
+      
       /** Set scales used to nondimensionalize physical properties.
        *
        * @param dim Nondimensionalizer
@@ -0,0 +1,98 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/CellFilterTemporal.i
+ *
+ * @brief Python interface to C++ CellFilterTemporal object.
+ */
+
+namespace pylith {
+  namespace meshio {
+
+    class pylith::meshio::CellFilterTemporal : public CellFilter
+    { // CellFilterTemporal
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      CellFilterTemporal(void);
+
+      /// Destructor
+      ~CellFilterTemporal(void);
+
+      /** Create copy of filter.
+       *
+       * @returns Copy of filter.
+       */
+      CellFilter* clone(void) const;
+      
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+
+      /** Set type of reduction.
+       *
+       * @param value Name of reduction ('max', 'min', 'mean', 'rms', or
+       * 'threshold_time').
+       */
+      void reduction(const char* value);
+
+      /** Set threshold for 'threshold_time' reduction.
+       *
+       * @param value Threshold for magnitude of field (dimensional).
+       */
+      void threshold(const PylithScalar value);
+
+      /** Set time scale used to dimensionalize time for 'threshold_time'.
+       *
+       * @param value Time scale.
+       */
+      void timeScale(const PylithScalar value);
+
+      /** Update reduction with cell field at time t.
+       *
+       * @param t Time associated with field.
+       * @param fieldIn Field with current values.
+       * @param label Label identifying cells.
+       * @param labelId Value of label of cells to filter.
+       */
+      void update(const PylithScalar t,
+		  const pylith::topology::Field& fieldIn,
+		  const char* label =0,
+		  const int labelId =0);
+  
+      /** Filter field over cells.
+       *
+       * @param fieldIn Field to filter.
+       * @param label Label identifying cells.
+       * @param labelId Value of label of cells to filter.
+       *
+       * @returns Reduced field.
+       */
+      pylith::topology::Field& filter(const pylith::topology::Field& fieldIn,
+				      const char* label =0,
+				      const int labelId =0);
+
+    }; // CellFilterTemporal
+
+  } // meshio
+} // pylith
+
+
+// End of file 
@@ -52,6 +52,12 @@ namespace pylith {
        */
       void filename(const char* filename);
       
+      /** Set number of processes per I/O aggregator.
+       *
+       * @param value Number of processes per aggregator (0 for no aggregation).
+       */
+      void aggregatorStride(const int value);
+      
       /** Generate filename for HDF5 file.
        *
        * Appends _info if only writing parameters.
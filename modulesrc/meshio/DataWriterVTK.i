@@ -73,6 +73,13 @@ namespace pylith {
        */
       void precision(const int value);
 
+      /** Set flag for writing parallel XML files with binary data
+       * instead of legacy ASCII files.
+       *
+       * @param value True to write XML files, false for legacy files.
+       */
+      void xmlFormat(const bool value);
+
       /** Prepare for writing files.
        *
        * @param mesh Finite-element mesh. 
@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+/**
+ * @file modulesrc/meshio/MeshIOBox.i
+ *
+ * @brief Python interface to C++ MeshIOBox object.
+ */
+
+namespace pylith {
+  namespace meshio {
+
+    class MeshIOBox : public MeshIO
+    { // MeshIOBox
+
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum CellEnum {
+	TRI3=0,
+	QUAD4=1,
+	TET4=2,
+	HEX8=3,
+      }; // CellEnum
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      MeshIOBox(void);
+
+      /// Destructor
+      ~MeshIOBox(void);
+
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+
+      /** Set type of cells.
+       *
+       * @param value Type of cells.
+       */
+      void cellType(const CellEnum value);
+
+      /** Get type of cells.
+       *
+       * @returns Type of cells.
+       */
+      CellEnum cellType(void) const;
+
+      /** Set extent and number of cells along a coordinate direction.
+       *
+       * @param dir Coordinate direction (0=x, 1=y, 2=z).
+       * @param lower Minimum coordinate.
+       * @param upper Maximum coordinate.
+       * @param numCells Number of cells.
+       */
+      void axis(const int dir,
+		const PylithScalar lower,
+		const PylithScalar upper,
+		const int numCells);
+
+      /** Add planar fault surface normal to a coordinate direction.
+       *
+       * @param name Name of vertex group for fault.
+       * @param dir Coordinate direction normal to fault (0=x, 1=y, 2=z).
+       * @param coordinate Coordinate of fault along direction.
+       */
+      void addFault(const char* name,
+		    const int dir,
+		    const PylithScalar coordinate);
+
+      /** Set material id of cells not in any material block.
+       *
+       * @param value Material id.
+       */
+      void defaultMaterialId(const int value);
+
+      /** Add material block.
+       *
+       * @param id Material id.
+       * @param dir Coordinate direction (0=x, 1=y, 2=z).
+       * @param lower Minimum coordinate of block.
+       * @param upper Maximum coordinate of block.
+       */
+      void addMaterialBlock(const int id,
+			    const int dir,
+			    const PylithScalar lower,
+			    const PylithScalar upper);
+
+      /** Get number of vertices in mesh.
+       *
+       * @returns Number of vertices.
+       */
+      int numVertices(void) const;
+
+      /** Get number of cells in mesh.
+       *
+       * @returns Number of cells.
+       */
+      int numCells(void) const;
+
+      // PROTECTED METHODS //////////////////////////////////////////////
+    protected :
+
+      /// Write mesh
+      void _write(void) const;
+      
+      /// Read mesh
+      void _read(void);
+
+    }; // MeshIOBox
+
+  } // meshio
+} // pylith
+
+
+// End of file 
@@ -128,6 +128,42 @@ namespace pylith {
 			   const char* label =0,
 			   const int labelId =0);
 
+      /** Update temporal reduction of vertex field. Does nothing unless
+       * the vertex filter is a VertexFilterTemporal.
+       *
+       * @param t Time associated with field.
+       * @param field Vertex field.
+       */
+      void updateVertexField(const PylithScalar t,
+			     const pylith::topology::Field& field);
+
+      /** Update temporal reduction of cell field. Does nothing unless
+       * the cell filter is a CellFilterTemporal.
+       *
+       * @param t Time associated with field.
+       * @param field Cell field.
+       * @param label Name of label defining cells to include in output
+       *   (=0 means use all cells in mesh).
+       * @param labelId Value of label defining which cells to include.
+       */
+      void updateCellField(const PylithScalar t,
+			   const pylith::topology::Field& field,
+			   const char* label =0,
+			   const int labelId =0);
+
+      /** Write current temporal reductions of all fields as a time step.
+       *
+       * @param t Time associated with reductions.
+       * @param mesh Mesh for output.
+       * @param label Name of label defining cells to include in output
+       *   (=0 means use all cells in mesh).
+       * @param labelId Value of label defining which cells to include.
+       */
+      void writeReductions(const PylithScalar t,
+			   const pylith::topology::Mesh& mesh,
+			   const char* label =0,
+			   const int labelId =0);
+
     }; // OutputManager
 
   } // meshio
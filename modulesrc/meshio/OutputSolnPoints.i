@@ -128,6 +128,17 @@ public :
      */
     void writePointNames(void);
     
+    /** Set source term of adjoint problem for a component of the
+     * solution interpolated to a point.
+     *
+     * @param source Field for source term (layout of solution field).
+     * @param point Index of point in array of points used to setup interpolator.
+     * @param component Index of component.
+     */
+    void adjointSource(pylith::topology::Field* source,
+		       const int point,
+		       const int component);
+    
 }; // OutputSolnPoints
 
   } // meshio
@@ -0,0 +1,88 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/VertexFilterTemporal.i
+ *
+ * @brief Python interface to C++ VertexFilterTemporal object.
+ */
+
+namespace pylith {
+  namespace meshio {
+
+    class pylith::meshio::VertexFilterTemporal : public VertexFilter
+    { // VertexFilterTemporal
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      VertexFilterTemporal(void);
+
+      /// Destructor
+      ~VertexFilterTemporal(void);
+      
+      /** Create copy of filter.
+       *
+       * @returns Copy of filter.
+       */
+      VertexFilter* clone(void) const;
+      
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+
+      /** Set type of reduction.
+       *
+       * @param value Name of reduction ('max', 'min', 'mean', 'rms', or
+       * 'threshold_time').
+       */
+      void reduction(const char* value);
+
+      /** Set threshold for 'threshold_time' reduction.
+       *
+       * @param value Threshold for magnitude of field (dimensional).
+       */
+      void threshold(const PylithScalar value);
+
+      /** Set time scale used to dimensionalize time for 'threshold_time'.
+       *
+       * @param value Time scale.
+       */
+      void timeScale(const PylithScalar value);
+
+      /** Update reduction with vertex field at time t.
+       *
+       * @param t Time associated with field.
+       * @param fieldIn Field with current values.
+       */
+      void update(const PylithScalar t,
+		  const pylith::topology::Field& fieldIn);
+  
+      /** Filter vertex field.
+       *
+       * @param fieldIn Field to filter.
+       */
+      const pylith::topology::Field& filter(const pylith::topology::Field& fieldIn);
+      
+    }; // VertexFilterTemporal
+
+  } // meshio
+} // pylith
+
+
+// End of file 
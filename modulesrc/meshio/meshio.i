@@ -24,14 +24,17 @@
 #include "pylith/meshio/MeshIO.hh"
 #include "pylith/meshio/MeshIOAscii.hh"
 #include "pylith/meshio/MeshIOLagrit.hh"
+#include "pylith/meshio/MeshIOBox.hh"
 #if defined(ENABLE_CUBIT)
 #include "pylith/meshio/MeshIOCubit.hh"
 #endif
 
 #include "pylith/meshio/VertexFilter.hh"
 #include "pylith/meshio/VertexFilterVecNorm.hh"
+#include "pylith/meshio/VertexFilterTemporal.hh"
 #include "pylith/meshio/CellFilter.hh"
 #include "pylith/meshio/CellFilterAvg.hh"
+#include "pylith/meshio/CellFilterTemporal.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
 #include "pylith/meshio/OutputManager.hh"
@@ -40,6 +43,7 @@
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
+#include "pylith/meshio/MeshIOHDF5.hh"
 #endif
 
 #include "pylith/utils/arrayfwd.hh"
@@ -72,14 +76,17 @@ import_array();
 %include "MeshIOObj.i"
 %include "MeshIOAscii.i"
 %include "MeshIOLagrit.i"
+%include "MeshIOBox.i"
 #if defined(ENABLE_CUBIT)
 %include "MeshIOCubit.i"
 #endif
 
 %include "VertexFilter.i"
 %include "VertexFilterVecNorm.i"
+%include "VertexFilterTemporal.i"
 %include "CellFilter.i"
 %include "CellFilterAvg.i"
+%include "CellFilterTemporal.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
 %include "OutputManager.i"
@@ -88,6 +95,7 @@ import_array();
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
+%include "MeshIOHDF5.i"
 #endif
 
 // End of file
@@ -37,6 +37,23 @@ namespace pylith {
       /// Destructor
       ~Explicit(void);
 
+      /** Set maximum level for multi-rate time stepping.
+       *
+       * @param value Maximum level.
+       */
+      void maxRateLevel(const int value);
+
+      /** Get maximum level for multi-rate time stepping.
+       *
+       * @returns Maximum level.
+       */
+      int maxRateLevel(void) const;
+
+      /** Compute levels of vertices and cells for multi-rate time
+       * stepping from the stable time step of the cells.
+       */
+      void calcRateLevels(void);
+
       /// Compute rate fields (velocity and/or acceleration) at time t.
       void calcRateFields(void);
 
@@ -66,6 +66,22 @@ namespace pylith {
        */
       bool useCustomConstraintPC(void) const;
 
+      /** Set flag for overlapping assembly of residual across
+       * processes with integration of interior cells.
+       *
+       * @param flag True if overlapping assembly with computation,
+       * false otherwise.
+       */
+      void overlapAssembly(const bool flag);
+
+      /** Get flag for overlapping assembly of residual across
+       * processes with integration of interior cells.
+       *
+       * @returns True if overlapping assembly with computation, false
+       * otherwise.
+       */
+      bool overlapAssembly(void) const;
+
       /** Get solution fields.
        *
        * @returns solution fields.
@@ -40,6 +40,15 @@ namespace pylith {
       /// Deallocate PETSc and local data structures.
       void deallocate(void);
 
+      /** Set predictor used for initial guess of solution increment.
+       *
+       * @param value Name of predictor ('zero', 'linear', or 'quadratic').
+       */
+      void predictor(const char* value);
+
+      /// Discard history of solution increments used by predictor.
+      void resetPredictor(void);
+
       /** Initialize solver.
        *
        * @param fields Solution fields.
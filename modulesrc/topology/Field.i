@@ -198,6 +198,12 @@ namespace pylith {
       /// Complete section by assembling across processors.
       void complete(void);
 
+      /// Start assembling section across processors.
+      void completeBegin(void);
+
+      /// Finish assembling section across processors.
+      void completeEnd(void);
+
       /** Copy field values and metadata.
        *
        * @param field Field to copy.
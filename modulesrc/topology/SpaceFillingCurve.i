@@ -0,0 +1,58 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Python interface to C++ PyLith SpaceFillingCurve object.
+ */
+
+namespace pylith {
+  namespace topology {
+
+    // SpaceFillingCurve ------------------------------------------------
+    class SpaceFillingCurve
+    { // SpaceFillingCurve
+
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum CurveEnum {
+	HILBERT=0, ///< Hilbert curve.
+	MORTON=1 ///< Morton (Z-order) curve.
+      }; // CurveEnum
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /** Reorder vertices and cells of mesh along a space-filling curve.
+       *
+       * @param mesh PyLith finite-element mesh.
+       * @param curve Type of space-filling curve.
+       */
+      static
+      void reorder(topology::Mesh* mesh,
+		   const CurveEnum curve =HILBERT);
+
+    }; // SpaceFillingCurve
+
+  } // topology
+} // pylith
+
+
+// End of file
@@ -31,6 +31,7 @@
 #include "pylith/topology/Distributor.hh"
 #include "pylith/topology/RefineUniform.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
+#include "pylith/topology/SpaceFillingCurve.hh"
 %}
 
 %include "exception.i"
@@ -66,6 +67,7 @@ import_array();
 %include "Distributor.i"
 %include "RefineUniform.i"
 %include "ReverseCuthillMcKee.i"
+%include "SpaceFillingCurve.i"
 
 // End of file
 
@@ -41,6 +41,9 @@ class FaultCohesive(Fault, ModuleFaultCohesive):
   \b Properties
   @li \b use_fault_mesh If true, use fault mesh to define fault;
     otherwise, use group of vertices to define fault.
+  @li \b constraint_pc_type Approximation of stiffness inverse in custom
+    preconditioner for Lagrange multipliers ('diagonal', 'vertex_block',
+    or 'fault_diagonal').
   
   \b Facilities
   @li \b fault_mesh_importer Importer for fault mesh.
@@ -56,6 +59,11 @@ class FaultCohesive(Fault, ModuleFaultCohesive):
   useMesh.meta['tip'] = "If true, use fault mesh to define fault; " \
       "otherwise, use group of vertices to define fault."
 
+  constraintPCType = pyre.inventory.str("constraint_pc_type", default="diagonal",
+                                        validator=pyre.inventory.choice(["diagonal", "vertex_block", "fault_diagonal"]))
+  constraintPCType.meta['tip'] = "Approximation of stiffness inverse in " \
+      "custom preconditioner for Lagrange multipliers."
+
   # Future, improved implementation
   #from pylith.meshio.MeshIOAscii imoport MeshIOAscii
   #faultMeshImporter = pyre.inventory.facility("fault_mesh_importer",
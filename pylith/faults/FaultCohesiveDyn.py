@@ -47,6 +47,8 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
   @li \b open_free_surface If True, enforce traction free surface when
     the fault opens, otherwise use initial tractions even when the
     fault opens.
+  @li \b sensitivity_direct_solve If True, use a direct solver for the
+    sensitivity problem (efficient for small fault meshes).
   
   \b Facilities
   @li \b tract_perturbation Prescribed perturbation in fault tractions.
@@ -71,6 +73,10 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     "the fault opens, otherwise use initial tractions even when the " \
     "fault opens."
 
+  sensitivityDirectSolve = pyre.inventory.bool("sensitivity_direct_solve", default=False)
+  sensitivityDirectSolve.meta['tip'] = "If True, use a direct solver for " \
+    "the sensitivity problem (efficient for small fault meshes)."
+
   tract = pyre.inventory.facility("traction_perturbation", family="traction_perturbation", factory=NullComponent)
   tract.meta['tip'] = "Prescribed perturbation in fault tractions."
 
@@ -212,10 +218,12 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     FaultCohesive._configure(self)
     if not isinstance(self.inventory.tract, NullComponent):
       ModuleFaultCohesiveDyn.tractPerturbation(self, self.inventory.tract)
+    ModuleFaultCohesiveDyn.constraintPCType(self, self.inventory.constraintPCType)
     ModuleFaultCohesiveDyn.frictionModel(self, self.inventory.friction)
     ModuleFaultCohesiveDyn.zeroTolerance(self, self.inventory.zeroTolerance)
     ModuleFaultCohesiveDyn.zeroToleranceNormal(self, self.inventory.zeroToleranceNormal)
     ModuleFaultCohesiveDyn.openFreeSurf(self, self.inventory.openFreeSurf)
+    ModuleFaultCohesiveDyn.sensitivityDirectSolve(self, self.inventory.sensitivityDirectSolve)
     self.output = self.inventory.output
     return
 
@@ -210,6 +210,7 @@ class FaultCohesiveImpulses(FaultCohesive, Integrator, ModuleFaultCohesiveImpuls
     import numpy
     FaultCohesive._configure(self)
     self.output = self.inventory.output
+    ModuleFaultCohesiveImpulses.constraintPCType(self, self.inventory.constraintPCType)
 
     ModuleFaultCohesiveImpulses.threshold(self, self.inventory.threshold.value)
     impulseDOF = numpy.array(self.inventory.impulseDOF, dtype=numpy.int32)
@@ -212,6 +212,7 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
     """
     FaultCohesive._configure(self)
     self.eqsrcs = self.inventory.eqsrcs
+    ModuleFaultCohesiveKin.constraintPCType(self, self.inventory.constraintPCType)
     self.output = self.inventory.output
     return
 
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/feassemble/ElasticityExplicitHex8.py
+##
+## @brief Python object for explicit time integration of dynamic
+## elasticity equation using trilinear hexahedral finite-elements with
+## one-point integration and hourglass control.
+##
+## Factory: integrator
+
+from IntegratorElasticity import IntegratorElasticity
+from feassemble import ElasticityExplicitHex8 as ModuleElasticityExplicitHex8
+
+# ElasticityExplicitHex8 class
+class ElasticityExplicitHex8(IntegratorElasticity, ModuleElasticityExplicitHex8):
+  """
+  Python object for explicit time integration of dynamic elasticity
+  equation using trilinear hexahedral finite-elements with one-point
+  integration and hourglass control.
+  """
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="elasticityexplicithex8"):
+    """
+    Constructor.
+    """
+    IntegratorElasticity.__init__(self, name)
+    ModuleElasticityExplicitHex8.__init__(self)
+    self._loggingPrefix = "ElEx "
+    return
+
+
+  def initialize(self, totalTime, numTimeSteps, normalizer):
+    """
+    Do initialization.
+    """
+    logEvent = "%sinit" % self._loggingPrefix
+    self._eventLogger.eventBegin(logEvent)
+
+    IntegratorElasticity.initialize(self, totalTime, numTimeSteps, normalizer)
+    ModuleElasticityExplicitHex8.initialize(self, self.mesh())
+    self._initializeOutput(totalTime, numTimeSteps, normalizer)
+    
+    self._eventLogger.eventEnd(logEvent)
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _verifyConfiguration(self):
+    ModuleElasticityExplicitHex8.verifyConfiguration(self, self.mesh())
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def integrator():
+  """
+  Factory associated with ElasticityExplicitHex8.
+  """
+  return ElasticityExplicitHex8()
+
+
+# End of file 
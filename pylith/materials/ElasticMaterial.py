@@ -45,7 +45,8 @@ class ElasticMaterial(Material):
     ## Python object for managing FaultCohesiveKin facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b cache_strain_stress Reuse strain and stress from state
+    ##   variable update for output.
     ##
     ## \b Facilities
     ## @li \b output Output manager associated with material data.
@@ -54,6 +55,10 @@ class ElasticMaterial(Material):
 
     import pyre.inventory
 
+    cacheStrainStress = pyre.inventory.bool("cache_strain_stress", default=False)
+    cacheStrainStress.meta['tip'] = "Reuse strain and stress from state " \
+        "variable update for output instead of recomputing them."
+
     from pylith.meshio.OutputMatElastic import OutputMatElastic
     output = pyre.inventory.facility("output", family="output_manager",
                                      factory=OutputMatElastic)
@@ -89,6 +94,7 @@ class ElasticMaterial(Material):
     """
     Material._configure(self)
     self.output = self.inventory.output
+    self.cacheStrainStress = self.inventory.cacheStrainStress
     from pylith.utils.NullComponent import NullComponent
     if not isinstance(self.inventory.dbInitialStress, NullComponent):
       self.dbInitialStress(self.inventory.dbInitialStress)
@@ -67,6 +67,8 @@ class Material(PetscComponent):
     ## \b Properties
     ## @li \b id Material identifier (from mesh generator)
     ## @li \b label Descriptive label for material.
+    ## @li \b compact_storage Store uniform properties per cell or per material.
+    ## @li \b reduced_precision Store state variables in single precision.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -81,6 +83,13 @@ class Material(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    compactStorage = pyre.inventory.bool("compact_storage", default=False)
+    compactStorage.meta['tip'] = "Store properties uniform over a cell (or material) " \
+        "once per cell (or material) instead of at every quadrature point."
+
+    reducedPrecision = pyre.inventory.bool("reduced_precision", default=False)
+    reducedPrecision.meta['tip'] = "Store state variables in single precision."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -185,6 +194,8 @@ class Material(PetscComponent):
       PetscComponent._configure(self)
       self.id(self.inventory.id)
       self.label(self.inventory.label)
+      self.compactStorage(self.inventory.compactStorage)
+      self.reducedPrecision(self.inventory.reducedPrecision)
       self.dbProperties(self.inventory.dbProperties)
       from pylith.utils.NullComponent import NullComponent
       if not isinstance(self.inventory.dbInitialState, NullComponent):
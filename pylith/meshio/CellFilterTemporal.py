@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/CellFilterTemporal.py
+##
+## @brief Python class for reducing cell fields in time (max, min,
+## mean, RMS, or time threshold is first exceeded) when writing
+## finite-element data.
+##
+## Factory: output_cell_filter
+
+from CellFilter import CellFilter
+from meshio import CellFilterTemporal as ModuleCellFilterTemporal
+
+# CellFilterTemporal class
+class CellFilterTemporal(CellFilter, ModuleCellFilterTemporal):
+  """
+  Python class for reducing cell fields in time when writing
+  finite-element data. Values are averaged over each cell's
+  quadrature points before they are reduced. The reduction is updated
+  every time step and written at the output frequency of the output
+  manager and when output is closed.
+
+  \b Properties
+  @li \b reduction Type of reduction ('max', 'min', 'mean', 'rms',
+  or 'threshold_time').
+  @li \b threshold Threshold for magnitude of field (SI units) for
+  'threshold_time'.
+
+  Factory: output_cell_filter
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  reduction = pyre.inventory.str("reduction", default="max",
+                                 validator=pyre.inventory.choice(["max", "min", "mean", "rms", "threshold_time"]))
+  reduction.meta['tip'] = "Type of reduction over time steps."
+
+  threshold = pyre.inventory.float("threshold", default=0.0)
+  threshold.meta['tip'] = "Threshold for magnitude of field (SI units) for 'threshold_time' reduction."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="cellfiltertemporal"):
+    """
+    Constructor.
+    """
+    CellFilter.__init__(self, name)
+    ModuleCellFilterTemporal.__init__(self)
+    self.temporal = True
+    return
+
+
+  def initialize(self, quadrature):
+    """
+    Initialize output manager.
+    """
+    if not quadrature is None:
+      self.quadrature(quadrature)
+    return
+
+
+  # PRIVATE METHODS ///////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    CellFilter._configure(self)
+    ModuleCellFilterTemporal.reduction(self, self.inventory.reduction)
+    ModuleCellFilterTemporal.threshold(self, self.inventory.threshold)
+    return
+
+
+  def _modelMemoryUse(self):
+    """
+    Model memory allocation.
+    """
+    # Reduced fields are allocated on demand and are not tracked.
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def output_cell_filter():
+  """
+  Factory associated with CellFilter.
+  """
+  return CellFilterTemporal()
+
+
+# End of file 
@@ -34,6 +34,8 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
 
   \b Properties
   @li \b filename Name of HDF5 file.
+  @li \b aggregator_stride Number of processes per I/O aggregator
+    writing external data files (0 for no aggregation).
   
   \b Facilities
   @li None
@@ -46,6 +48,10 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
   filename = pyre.inventory.str("filename", default="output.h5")
   filename.meta['tip'] = "Name of HDF5 file."
 
+  aggregatorStride = pyre.inventory.int("aggregator_stride", default=0,
+                                        validator=pyre.inventory.greaterEqual(0))
+  aggregatorStride.meta['tip'] = "Number of processes per I/O aggregator writing external data files (0 for no aggregation)."
+
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
   def __init__(self, name="datawriterhdf5"):
@@ -66,6 +72,7 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
     timeScale = normalizer.timeScale()
 
     ModuleDataWriterHDF5Ext.filename(self, self.filename)
+    ModuleDataWriterHDF5Ext.aggregatorStride(self, self.aggregatorStride)
     ModuleDataWriterHDF5Ext.timeScale(self, timeScale.value)
     return
   
@@ -34,6 +34,8 @@ class DataWriterVTK(DataWriter, ModuleDataWriterVTK):
   @li \b filename Name of VTK file.
   @li \b time_format C style format string for time stamp in filename.
   @li \b time_constant Value used to normalize time stamp in filename.
+  @li \b float_precision Precision of floating point values in output.
+  @li \b xml_format Write parallel XML files with binary data.
   
   \b Facilities
   @li None
@@ -58,6 +60,9 @@ class DataWriterVTK(DataWriter, ModuleDataWriterVTK):
   precision = pyre.inventory.int("float_precision", default=6,
                                  validator=pyre.inventory.greater(0))
   precision.meta['tip'] = "Precision of floating point values in output."
+
+  xmlFormat = pyre.inventory.bool("xml_format", default=False)
+  xmlFormat.meta['tip'] = "Write parallel XML files (.pvtu/.vtu) with binary data instead of legacy ASCII files."
   
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
@@ -85,6 +90,7 @@ class DataWriterVTK(DataWriter, ModuleDataWriterVTK):
     ModuleDataWriterVTK.timeFormat(self, self.timeFormat)
     ModuleDataWriterVTK.timeConstant(self, timeConstantN)
     ModuleDataWriterVTK.precision(self, self.precision)
+    ModuleDataWriterVTK.xmlFormat(self, self.xmlFormat)
     return
   
 
@@ -0,0 +1,230 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+## @file pyre/meshio/MeshIOBox.py
+##
+## @brief Python object for generating a structured finite-element
+## mesh of a box.
+##
+## Factory: mesh_io
+
+from MeshIOObj import MeshIOObj
+from meshio import MeshIOBox as ModuleMeshIOBox
+
+# MeshIOBox class
+class MeshIOBox(MeshIOObj, ModuleMeshIOBox):
+  """
+  Python object for generating a structured finite-element mesh of a
+  box.
+
+  The mesh includes vertex groups 'face_xneg', 'face_xpos',
+  'face_yneg', 'face_ypos' (and 'face_zneg', 'face_zpos' in 3-D) for
+  the faces of the box and a vertex group for each fault.
+
+  Factory: mesh_io
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(MeshIOObj.Inventory):
+    """
+    Python object for managing MeshIOBox facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing MeshIOBox facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b cell_type Type of cells.
+    ## @li \b x_min Minimum x coordinate.
+    ## @li \b x_max Maximum x coordinate.
+    ## @li \b num_cells_x Number of cells along x direction.
+    ## @li \b y_min Minimum y coordinate.
+    ## @li \b y_max Maximum y coordinate.
+    ## @li \b num_cells_y Number of cells along y direction.
+    ## @li \b z_min Minimum z coordinate.
+    ## @li \b z_max Maximum z coordinate.
+    ## @li \b num_cells_z Number of cells along z direction.
+    ## @li \b faults Names of fault vertex groups.
+    ## @li \b fault_directions Directions normal to faults.
+    ## @li \b fault_coordinates Coordinates of faults along normal directions.
+    ## @li \b default_material_id Material id of cells not in any block.
+    ## @li \b material_ids Material ids of blocks.
+    ## @li \b material_directions Directions of material blocks.
+    ## @li \b material_min Minimum coordinates of material blocks.
+    ## @li \b material_max Maximum coordinates of material blocks.
+    ##
+    ## \b Facilities
+    ## @li coordsys Coordinate system associated with mesh.
+
+    import pyre.inventory
+
+    cellType = pyre.inventory.str("cell_type", default="hex8",
+                                  validator=pyre.inventory.choice(["tri3", "quad4", "tet4", "hex8"]))
+    cellType.meta['tip'] = "Type of cells."
+
+    xMin = pyre.inventory.float("x_min", default=-1.0)
+    xMin.meta['tip'] = "Minimum x coordinate."
+
+    xMax = pyre.inventory.float("x_max", default=+1.0)
+    xMax.meta['tip'] = "Maximum x coordinate."
+
+    numCellsX = pyre.inventory.int("num_cells_x", default=1,
+                                   validator=pyre.inventory.greater(0))
+    numCellsX.meta['tip'] = "Number of cells along x direction."
+
+    yMin = pyre.inventory.float("y_min", default=-1.0)
+    yMin.meta['tip'] = "Minimum y coordinate."
+
+    yMax = pyre.inventory.float("y_max", default=+1.0)
+    yMax.meta['tip'] = "Maximum y coordinate."
+
+    numCellsY = pyre.inventory.int("num_cells_y", default=1,
+                                   validator=pyre.inventory.greater(0))
+    numCellsY.meta['tip'] = "Number of cells along y direction."
+
+    zMin = pyre.inventory.float("z_min", default=-1.0)
+    zMin.meta['tip'] = "Minimum z coordinate."
+
+    zMax = pyre.inventory.float("z_max", default=+1.0)
+    zMax.meta['tip'] = "Maximum z coordinate."
+
+    numCellsZ = pyre.inventory.int("num_cells_z", default=1,
+                                   validator=pyre.inventory.greater(0))
+    numCellsZ.meta['tip'] = "Number of cells along z direction."
+
+    faults = pyre.inventory.list("faults", default=[])
+    faults.meta['tip'] = "Names of fault vertex groups."
+
+    faultDirections = pyre.inventory.list("fault_directions", default=[])
+    faultDirections.meta['tip'] = "Directions (x, y, z) normal to faults."
+
+    faultCoordinates = pyre.inventory.list("fault_coordinates", default=[])
+    faultCoordinates.meta['tip'] = "Coordinates of faults along normal directions."
+
+    defaultMaterialId = pyre.inventory.int("default_material_id", default=0)
+    defaultMaterialId.meta['tip'] = "Material id of cells not in any material block."
+
+    materialIds = pyre.inventory.list("material_ids", default=[])
+    materialIds.meta['tip'] = "Material ids of blocks (later blocks take precedence)."
+
+    materialDirections = pyre.inventory.list("material_directions", default=[])
+    materialDirections.meta['tip'] = "Directions (x, y, z) of material blocks."
+
+    materialMin = pyre.inventory.list("material_min", default=[])
+    materialMin.meta['tip'] = "Minimum coordinates of material blocks."
+
+    materialMax = pyre.inventory.list("material_max", default=[])
+    materialMax.meta['tip'] = "Maximum coordinates of material blocks."
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pyre.inventory.facility("coordsys", family="coordsys",
+                                       factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system associated with mesh."
+  
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="meshiobox"):
+    """
+    Constructor.
+    """
+    MeshIOObj.__init__(self, name)
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    MeshIOObj._configure(self)
+    self.coordsys = self.inventory.coordsys
+
+    cellTypes = {'tri3': ModuleMeshIOBox.TRI3,
+                 'quad4': ModuleMeshIOBox.QUAD4,
+                 'tet4': ModuleMeshIOBox.TET4,
+                 'hex8': ModuleMeshIOBox.HEX8,
+                 }
+    ModuleMeshIOBox.cellType(self, cellTypes[self.inventory.cellType])
+    ModuleMeshIOBox.axis(self, 0, self.inventory.xMin, self.inventory.xMax, self.inventory.numCellsX)
+    ModuleMeshIOBox.axis(self, 1, self.inventory.yMin, self.inventory.yMax, self.inventory.numCellsY)
+    ModuleMeshIOBox.axis(self, 2, self.inventory.zMin, self.inventory.zMax, self.inventory.numCellsZ)
+
+    numFaults = len(self.inventory.faults)
+    if len(self.inventory.faultDirections) != numFaults or \
+          len(self.inventory.faultCoordinates) != numFaults:
+      raise ValueError("Number of fault directions (%d) and fault coordinates (%d) "
+                       "must match number of faults (%d)." % \
+                         (len(self.inventory.faultDirections),
+                          len(self.inventory.faultCoordinates),
+                          numFaults))
+    for (name, direction, coordinate) in zip(self.inventory.faults,
+                                             self.inventory.faultDirections,
+                                             self.inventory.faultCoordinates):
+      ModuleMeshIOBox.addFault(self, name, self._direction(direction), float(coordinate))
+
+    ModuleMeshIOBox.defaultMaterialId(self, self.inventory.defaultMaterialId)
+    numBlocks = len(self.inventory.materialIds)
+    if len(self.inventory.materialDirections) != numBlocks or \
+          len(self.inventory.materialMin) != numBlocks or \
+          len(self.inventory.materialMax) != numBlocks:
+      raise ValueError("Number of material directions (%d), minimum coordinates (%d), and "
+                       "maximum coordinates (%d) must match number of material ids (%d)." % \
+                         (len(self.inventory.materialDirections),
+                          len(self.inventory.materialMin),
+                          len(self.inventory.materialMax),
+                          numBlocks))
+    for (materialId, direction, lower, upper) in zip(self.inventory.materialIds,
+                                                     self.inventory.materialDirections,
+                                                     self.inventory.materialMin,
+                                                     self.inventory.materialMax):
+      ModuleMeshIOBox.addMaterialBlock(self, int(materialId), self._direction(direction),
+                                       float(lower), float(upper))
+    return
+
+
+  def _direction(self, value):
+    """
+    Get index of coordinate direction.
+    """
+    directions = {'x': 0, 'y': 1, 'z': 2}
+    if not value.lower() in directions:
+      raise ValueError("Unknown coordinate direction '%s'. Direction must be "
+                       "'x', 'y', or 'z'." % value)
+    return directions[value.lower()]
+
+
+  def _createModuleObj(self):
+    """
+    Create C++ MeshIOBox object.
+    """
+    ModuleMeshIOBox.__init__(self)
+    return
+  
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def mesh_io():
+  """
+  Factory associated with MeshIOBox.
+  """
+  return MeshIOBox()
+
+
+# End of file 
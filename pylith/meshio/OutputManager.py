@@ -99,6 +99,9 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     self._stepCur = 0
     self._stepWrite = None
     self._tWrite = None
+    self._tReduced = None
+    self._reducedWritten = True
+    self.temporalFilter = False
     self.dataProvider = None
     self.vertexInfoFields = []
     self.vertexDataFields = []
@@ -160,6 +163,9 @@ class OutputManager(PetscComponent, ModuleOutputManager):
 
     if not isinstance(self.inventory.cellFilter, NullComponent):
       self.cellFilter.initialize(quadrature)
+    for filter in [self.inventory.vertexFilter, self.inventory.cellFilter]:
+      if getattr(filter, "temporal", False):
+        filter.timeScale(timeScale.value)
     self.writer.initialize(normalizer)
 
     self._eventLogger.eventEnd(logEvent)
@@ -199,6 +205,15 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     logEvent = "%sclose" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)    
 
+    # Write temporal reductions accumulated since the last output.
+    if self.temporalFilter and not self._reducedWritten:
+      (mesh, label, labelId) = self.dataProvider().getDataMesh()
+      if label != None and labelId != None:
+        ModuleOutputManager.writeReductions(self, self._tReduced, mesh, label, labelId)
+      else:
+        ModuleOutputManager.writeReductions(self, self._tReduced, mesh)
+      self._reducedWritten = True
+
     self._close()
 
     self._eventLogger.eventEnd(logEvent)    
@@ -240,20 +255,33 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     logEvent = "%swriteData" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)    
 
-    if self._checkWrite(t) and ( len(self.vertexDataFields) > 0 or len(self.cellDataFields) ) > 0:
+    write = self._checkWrite(t)
+    if (write or self.temporalFilter) and ( len(self.vertexDataFields) > 0 or len(self.cellDataFields) ) > 0:
 
       (mesh, label, labelId) = self.dataProvider().getDataMesh()
-      self._openTimeStep(t, mesh, label, labelId)
+      if write:
+        self._openTimeStep(t, mesh, label, labelId)
 
+      # Temporal reductions are updated every time step, independent
+      # of the output frequency.
       for name in self.vertexDataFields:
         field = self.dataProvider().getVertexField(name, fields)
-        self._appendVertexField(t, field, mesh)
+        if self.temporalFilter:
+          ModuleOutputManager.updateVertexField(self, t, field)
+        if write:
+          self._appendVertexField(t, field, mesh)
 
       for name in self.cellDataFields:
         field = self.dataProvider().getCellField(name, fields)
-        self._appendCellField(t, field, label, labelId)
+        if self.temporalFilter:
+          self._updateCellField(t, field, label, labelId)
+        if write:
+          self._appendCellField(t, field, label, labelId)
 
-      self._closeTimeStep()
+      if write:
+        self._closeTimeStep()
+      self._tReduced = t
+      self._reducedWritten = write
 
     self._eventLogger.eventEnd(logEvent)
     return
@@ -273,6 +301,8 @@ class OutputManager(PetscComponent, ModuleOutputManager):
       ModuleOutputManager.vertexFilter(self, self.inventory.vertexFilter)
     if not isinstance(self.inventory.cellFilter, NullComponent):
       ModuleOutputManager.cellFilter(self, self.inventory.cellFilter)
+    self.temporalFilter = getattr(self.inventory.vertexFilter, "temporal", False) or \
+        getattr(self.inventory.cellFilter, "temporal", False)
 
     self.perfLogger = self.inventory.perfLogger
     return
@@ -305,6 +335,9 @@ class OutputManager(PetscComponent, ModuleOutputManager):
       timeScale = self.normalizer.timeScale()
       totalTimeN = self.normalizer.nondimensionalize(totalTime, timeScale)
       nsteps = int(1 + totalTimeN / self.dtN)
+    if numTimeSteps > 0 and self.temporalFilter:
+      # Temporal reductions may be written once more when closing.
+      nsteps += 1
 
     return nsteps
 
@@ -449,6 +482,17 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     return
 
 
+  def _updateCellField(self, t, field, label, labelId):
+    """
+    Call C++ updateCellField();
+    """
+    if label != None and labelId != None:
+      ModuleOutputManager.updateCellField(self, t, field, label, labelId)
+    else:
+      ModuleOutputManager.updateCellField(self, t, field)
+    return
+
+
   def _closeTimeStep(self):
     """
     Call C++ closeTimeStep().
@@ -107,6 +107,7 @@ class OutputSolnPoints(OutputManager, ModuleOutputSolnPoints):
         convert(points, mesh.coordsys(), self.coordsys)
 
         ModuleOutputSolnPoints.setupInterpolator(self, mesh, points, stations, normalizer)
+        self.stations = stations
         self.mesh = ModuleOutputSolnPoints.pointsMesh(self)
 
         self._eventLogger.eventEnd(logEvent)
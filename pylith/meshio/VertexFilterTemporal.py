@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/VertexFilterTemporal.py
+##
+## @brief Python class for reducing fields over vertices in time
+## (max, min, mean, RMS, or time threshold is first exceeded) when
+## writing finite-element data.
+##
+## Factory: output_vertex_filter
+
+from VertexFilter import VertexFilter
+from meshio import VertexFilterTemporal as ModuleVertexFilterTemporal
+
+# VertexFilterTemporal class
+class VertexFilterTemporal(VertexFilter, ModuleVertexFilterTemporal):
+  """
+  Python class for reducing fields over vertices in time when writing
+  finite-element data. The reduction is updated every time step and
+  written at the output frequency of the output manager and when
+  output is closed.
+
+  \b Properties
+  @li \b reduction Type of reduction ('max', 'min', 'mean', 'rms',
+  or 'threshold_time').
+  @li \b threshold Threshold for magnitude of field (SI units) for
+  'threshold_time'.
+
+  Factory: output_vertex_filter
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  reduction = pyre.inventory.str("reduction", default="max",
+                                 validator=pyre.inventory.choice(["max", "min", "mean", "rms", "threshold_time"]))
+  reduction.meta['tip'] = "Type of reduction over time steps."
+
+  threshold = pyre.inventory.float("threshold", default=0.0)
+  threshold.meta['tip'] = "Threshold for magnitude of field (SI units) for 'threshold_time' reduction."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="vertexfiltertemporal"):
+    """
+    Constructor.
+    """
+    VertexFilter.__init__(self, name)
+    ModuleVertexFilterTemporal.__init__(self)
+    self.temporal = True
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    VertexFilter._configure(self)
+    ModuleVertexFilterTemporal.reduction(self, self.inventory.reduction)
+    ModuleVertexFilterTemporal.threshold(self, self.inventory.threshold)
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def output_vertex_filter():
+  """
+  Factory associated with VertexFilter.
+  """
+  return VertexFilterTemporal()
+
+
+# End of file 
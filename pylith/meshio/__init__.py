@@ -22,11 +22,13 @@
 
 __all__ = ['CellFilter',
            'CellFilterAvg',
+           'CellFilterTemporal',
            'DataWriter',
            'DataWriterVTK',
            'MeshIOObj',
            'MeshIOAscii',
            'MeshIOCubit',
+           'MeshIOHDF5',
            'MeshIOLagrit',
            'OutputDirichlet',
            'OutputFaultKin',
@@ -40,6 +42,7 @@ __all__ = ['CellFilter',
            'SingleOutput',
            'VertexFilter',
            'VertexFilterVecNorm',
+           'VertexFilterTemporal',
            ]
 
 
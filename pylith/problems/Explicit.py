@@ -59,6 +59,7 @@ class Explicit(Formulation, ModuleExplicit):
     ##
     ## \b Properties
     ## @li \b norm_viscosity Normalized viscosity for numerical damping.
+    ## @li \b max_rate_level Maximum level for multi-rate time stepping.
     ##
     ## \b Facilities
     ## @li \b solver Algebraic solver.
@@ -68,6 +69,11 @@ class Explicit(Formulation, ModuleExplicit):
     normViscosity = pyre.inventory.float("norm_viscosity", default=0.1)
     normViscosity.meta['tip'] = "Normalized viscosity for numerical damping."
 
+    maxRateLevel = pyre.inventory.int("max_rate_level", default=0,
+                                      validator=pyre.inventory.greaterEqual(0))
+    maxRateLevel.meta['tip'] = "Maximum level for multi-rate time stepping " \
+        "(vertices at level k use time step 2**k*dt, 0=disable)."
+
     from SolverLumped import SolverLumped
     solver = pyre.inventory.facility("solver", family="solver",
                                      factory=SolverLumped)
@@ -312,6 +318,7 @@ class Explicit(Formulation, ModuleExplicit):
 
     self.normViscosity = self.inventory.normViscosity
     self.solver = self.inventory.solver
+    ModuleExplicit.maxRateLevel(self, self.inventory.maxRateLevel)
     return
 
 
@@ -329,6 +336,7 @@ class Explicit(Formulation, ModuleExplicit):
 
     self.updateSettings(self.jacobian, self.fields, t, dt)
     ModuleExplicit.reformJacobianLumped(self)
+    ModuleExplicit.calcRateLevels(self)
 
     self._eventLogger.stagePop()
 
@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+## @file pylith/problems/ExplicitHex8.py
+##
+## @brief Python ExplicitHex8 object for solving equations using an
+## explicit formulation with a lumped Jacobian matrix that is stored
+## as a Field and one-point integration of hexahedral cells.
+##
+## Factory: pde_formulation
+
+from Explicit import Explicit
+
+# ExplicitHex8 class
+class ExplicitHex8(Explicit):
+  """
+  Python ExplicitHex8 object for solving equations using an explicit
+  formulation with one-point integration of trilinear hexahedral
+  cells and hourglass control.
+
+  The formulation has the general form, [A(t)] {u(t+dt)} = {b(t)},
+  where we want to solve for {u(t+dt)}, A(t) is usually constant
+  (i.e., independent of time), and {b(t)} usually depends on {u(t)}
+  and {u(t-dt)}.
+
+  Jacobian: A(t)
+  solution: u(t+dt)
+  residual: b(t) - A(t) \hat u(t+dt)
+  constant: b(t)
+
+  The quadrature for the materials must use a single quadrature point
+  (quad_order = 1).
+
+  Factory: pde_formulation.
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(Explicit.Inventory):
+    """
+    Python object for managing ExplicitHex8 facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing ExplicitHex8 facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b hourglass_stiffness Normalized hourglass stiffness.
+    ##
+    ## \b Facilities
+    ## @li None
+
+    import pyre.inventory
+
+    hourglassStiffness = pyre.inventory.float("hourglass_stiffness", default=0.1,
+                                              validator=pyre.inventory.greaterEqual(0.0))
+    hourglassStiffness.meta['tip'] = "Normalized hourglass stiffness for one-point integration."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="explicithex8"):
+    """
+    Constructor.
+    """
+    Explicit.__init__(self, name)
+    return
+
+
+  def elasticityIntegrator(self):
+    """
+    Get integrator for elastic material.
+    """
+    from pylith.feassemble.ElasticityExplicitHex8 import ElasticityExplicitHex8
+    integrator = ElasticityExplicitHex8()
+    integrator.normViscosity(self.normViscosity)
+    integrator.hourglassStiffness(self.hourglassStiffness)
+    return integrator
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    Explicit._configure(self)
+    self.hourglassStiffness = self.inventory.hourglassStiffness
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def pde_formulation():
+  """
+  Factory associated with ExplicitHex8.
+  """
+  return ExplicitHex8()
+
+
+# End of file 
@@ -65,6 +65,7 @@ class Formulation(PetscComponent, ModuleFormulation):
     ## @li \b matrix_type Type of PETSc sparse matrix.
     ## @li \b split_fields Split solution fields into displacements and Lagrange constraints.
     ## @li \b use_custom_constraint_pc Use custom preconditioner for Lagrange constraints.
+    ## @li \b overlap_assembly Overlap assembly of residual with integration of interior cells.
     ## @li \b view_jacobian Flag to output Jacobian matrix when it is reformed.
     ##
     ## \b Facilities
@@ -87,6 +88,10 @@ class Formulation(PetscComponent, ModuleFormulation):
     useCustomConstraintPC.meta['tip'] = "Use custom preconditioner for " \
                                         "Lagrange constraints."
 
+    overlapAssembly = pyre.inventory.bool("overlap_assembly", default=False)
+    overlapAssembly.meta['tip'] = "Overlap assembly of residual across " \
+        "processes with integration of interior cells."
+
     viewJacobian = pyre.inventory.bool("view_jacobian", default=False)
     viewJacobian.meta['tip'] = "Write Jacobian matrix to binary file."
     
@@ -314,6 +319,7 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     ModuleFormulation.splitFields(self, self.inventory.useSplitFields)
     ModuleFormulation.useCustomConstraintPC(self, self.inventory.useCustomConstraintPC)
+    ModuleFormulation.overlapAssembly(self, self.inventory.overlapAssembly)
 
     return
 
@@ -45,6 +45,10 @@ class GreensFns(Problem):
     ##
     ## \b Properties
     ## @li \b faultId Id of fault on which to impose impulses.
+    ## @li \b mode Compute Green's functions by solving one problem
+    ##   per impulse (forward) or one problem per observation (adjoint).
+    ## @li \b adjointFilename Name of HDF5 file for Green's functions
+    ##   computed in adjoint mode.
     ##
     ## \b Facilities
     ## @li \b formulation Formulation for solving PDE.
@@ -56,6 +60,13 @@ class GreensFns(Problem):
     faultId = pyre.inventory.int("fault_id", default=100)
     faultId.meta['tip'] = "Id of fault on which to impose impulses."
 
+    mode = pyre.inventory.str("mode", default="forward",
+                              validator=pyre.inventory.choice(["forward", "adjoint"]))
+    mode.meta['tip'] = "Solve one problem per impulse (forward) or one problem per observation (adjoint)."
+
+    adjointFilename = pyre.inventory.str("adjoint_filename", default="greensfns.h5")
+    adjointFilename.meta['tip'] = "Name of HDF5 file for Green's functions computed in adjoint mode."
+
     from Implicit import Implicit
     formulation = pyre.inventory.facility("formulation",
                                           family="pde_formulation",
@@ -123,6 +134,26 @@ class GreensFns(Problem):
       raise ValueError("Incompatible source for green's function impulses "
                        "with id '%d' and label '%s'." % \
                          (self.source.id(), self.source.label()))
+
+    if "adjoint" == self.mode:
+      from pylith.meshio.OutputSolnPoints import OutputSolnPoints
+      self.observations = None
+      for output in self.formulation.output.components():
+        if isinstance(output, OutputSolnPoints):
+          self.observations = output
+          break
+      if self.observations is None:
+        raise ValueError("Computing Green's functions in adjoint mode "
+                         "requires output of the solution at points "
+                         "(OutputSolnPoints) to define the observations.")
+
+      # SolverNonlinear::solve() ignores the residual argument and
+      # solves the forward problem, so the adjoint problem requires a
+      # linear solver.
+      from pylith.problems.SolverLinear import SolverLinear
+      if not isinstance(self.formulation.solver, SolverLinear):
+        raise ValueError("Computing Green's functions in adjoint mode "
+                         "requires a linear solver (SolverLinear).")
     return
   
 
@@ -156,6 +187,10 @@ class GreensFns(Problem):
     for material in self.materials.components():
       material.useElasticBehavior(True)
 
+    if "adjoint" == self.mode:
+      self._runAdjoint()
+      return
+
     nimpulses = self.source.numImpulses()
     if nimpulses > 0:
       self.progressMonitor.open()
@@ -227,6 +262,84 @@ class GreensFns(Problem):
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
+  def _runAdjoint(self):
+    """
+    Compute Green's functions by solving the adjoint problem for each
+    component of the displacement at each observation point.
+
+    The Green's function for an observation and impulse is the inner
+    product of the solution of the adjoint problem with the source
+    term of the impulse. The Jacobian is symmetric for linearly
+    elastic materials, Dirichlet boundary conditions, and faults with
+    prescribed slip, so the adjoint problem is solved with the same
+    Jacobian and solver as the forward problem.
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    import numpy
+
+    formulation = self.formulation
+    nimpulses = self.source.numImpulses()
+    npoints = len(self.observations.stations)
+    ncomps = self.dimension
+    nobs = npoints*ncomps
+
+    # Assemble Jacobian
+    dt = 1.0
+    t = -dt
+    self._eventLogger.stagePush("Prestep")
+    formulation.prestep(t, dt)
+    self._eventLogger.stagePop()
+
+    # Allocate fields for adjoint problem, reusing layout from dispIncr
+    fields = formulation.fields
+    dispIncr = fields.get("dispIncr(t->t+dt)")
+    fields.add("adjoint source", "adjoint_source")
+    source = fields.get("adjoint source")
+    source.cloneSection(dispIncr)
+    source.zeroAll()
+    source.createScatter(source.mesh())
+    fields.add("adjoint", "adjoint")
+    adjoint = fields.get("adjoint")
+    adjoint.cloneSection(dispIncr)
+    adjoint.zeroAll()
+    adjoint.createScatter(adjoint.mesh())
+
+    lengthScale = self.normalizer.lengthScale().value
+    values = numpy.zeros(nimpulses, dtype=numpy.float64)
+
+    h5 = None
+    if 0 == comm.rank:
+      import h5py
+      h5 = h5py.File(self.adjointFilename, "w")
+      h5.create_dataset("stations", data=numpy.array(self.observations.stations))
+      greensFns = h5.create_dataset("greens_functions", (nimpulses, nobs), dtype=numpy.float64)
+
+    if nobs > 0:
+      self.progressMonitor.open()
+    for iobs in xrange(nobs):
+      self.progressMonitor.update(iobs, 0, nobs)
+      ipoint = iobs / ncomps
+      icomp = iobs % ncomps
+      if 0 == comm.rank:
+        self._info.log("Solving adjoint problem %d of %d." % (iobs+1, nobs))
+
+      self._eventLogger.stagePush("Step")
+      self.observations.adjointSource(source, ipoint, icomp)
+      formulation.solver.solve(adjoint, formulation.jacobian, source)
+      self.source.adjointSensitivities(values, adjoint)
+      self._eventLogger.stagePop()
+
+      if 0 == comm.rank:
+        greensFns[:,iobs] = lengthScale*values
+
+    if 0 == comm.rank:
+      h5.close()
+    self.progressMonitor.close()
+    return
+
+
   def _configure(self):
     """
     Set members based using inventory.
@@ -234,6 +347,8 @@ class GreensFns(Problem):
     Problem._configure(self)
 
     self.faultId = self.inventory.faultId
+    self.mode = self.inventory.mode
+    self.adjointFilename = self.inventory.adjointFilename
     self.formulation = self.inventory.formulation
     self.progressMonitor = self.inventory.progressMonitor
     self.checkpointTimer = self.inventory.checkpointTimer
@@ -97,6 +97,7 @@ class Implicit(Formulation, ModuleImplicit):
     Formulation.__init__(self, name)
     ModuleImplicit.__init__(self)
     self._loggingPrefix = "TSIm "
+    self._resetPredictor = False
     return
 
 
@@ -182,6 +183,12 @@ class Implicit(Formulation, ModuleImplicit):
     for constraint in self.constraints:
       constraint.setFieldIncr(t, t+dt, dispIncr)
 
+    # Increment from elastic prestep is not a time increment, so do not
+    # use it to predict the solution.
+    if self._resetPredictor:
+      self.solver.resetPredictor()
+      self._resetPredictor = False
+
     needNewJacobian = False
     for integrator in self.integrators:
       integrator.timeStep(dt)
@@ -259,6 +266,7 @@ class Implicit(Formulation, ModuleImplicit):
     disp.zeroAll()
     for constraint in self.constraints:
       constraint.setField(t+dt, disp)
+    self._resetPredictor = True
 
     needNewJacobian = False
     for integrator in self.integrators:
@@ -87,6 +87,14 @@ class Solver(PetscComponent):
     return
 
 
+  def resetPredictor(self):
+    """
+    Discard history of solution increments used by predictor. Only
+    the nonlinear solver uses a predictor.
+    """
+    return
+
+
   # PRIVATE METHODS /////////////////////////////////////////////////////
 
   def _configure(self):
@@ -40,13 +40,18 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     ## Python object for managing SolverNonlinear facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b predictor Predictor for initial guess of solution increment.
     ##
     ## \b Facilities
     ## @li None
 
     import pyre.inventory
 
+    predictor = pyre.inventory.str("predictor", default="zero",
+                                   validator=pyre.inventory.choice(["zero", "linear", "quadratic"]))
+    predictor.meta['tip'] = "Predictor for initial guess of solution " \
+        "increment (extrapolation of increments from previous time steps)."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -59,6 +64,14 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     return
 
 
+  def resetPredictor(self):
+    """
+    Discard history of solution increments used by predictor.
+    """
+    ModuleSolverNonlinear.resetPredictor(self)
+    return
+
+
   # PRIVATE METHODS /////////////////////////////////////////////////////
 
   def _configure(self):
@@ -68,6 +81,7 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     Solver._configure(self)
 
     ModuleSolverNonlinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    ModuleSolverNonlinear.predictor(self, self.inventory.predictor)
     return
 
 
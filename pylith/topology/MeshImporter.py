@@ -44,6 +44,8 @@ class MeshImporter(MeshGenerator):
     ##
     ## \b Properties
     ## @li reorder_mesh Reorder mesh using reverse Cuthill-McKee if true.
+    ## @li reorder_curve Space-filling curve used to reorder the
+    ##   distributed and refined mesh ('none', 'hilbert', or 'morton').
     ##
     ## \b Facilities
     ## @li \b reader Mesh reader.
@@ -55,6 +57,10 @@ class MeshImporter(MeshGenerator):
     reorderMesh = pyre.inventory.bool("reorder_mesh", default=False)
     reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
 
+    reorderCurve = pyre.inventory.str("reorder_curve", default="none",
+                                      validator=pyre.inventory.choice(["none", "hilbert", "morton"]))
+    reorderCurve.meta['tip'] = "Space-filling curve used to reorder distributed and refined mesh."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pyre.inventory.facility("reader", family="mesh_io",
                                        factory=MeshIOAscii)
@@ -134,8 +140,18 @@ class MeshImporter(MeshGenerator):
       mesh.cleanup()
       newMesh.memLoggingStage = "RefinedMesh"
 
-    # Can't reorder mesh again, because we do not have routine to
-    # unmix normal and hybrid cells.
+    # Reorder distributed and refined mesh along space-filling curve
+    # (cohesive cells are not moved).
+    if self.reorderCurve != "none":
+      logEvent2 = "%sreorder" % self._loggingPrefix
+      self._eventLogger.eventBegin(logEvent2)
+      self._debug.log(resourceUsageString())
+      if 0 == comm.rank:
+        self._info.log("Reordering cells and vertices along %s curve." % self.reorderCurve)
+      from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+      ordering = SpaceFillingCurve(self.reorderCurve)
+      ordering.reorder(newMesh)
+      self._eventLogger.eventEnd(logEvent2)
 
     # Nondimensionalize mesh (coordinates of vertices).
     from pylith.topology.topology import MeshOps_nondimensionalize
@@ -156,6 +172,7 @@ class MeshImporter(MeshGenerator):
     self.distributor = self.inventory.distributor
     self.refiner = self.inventory.refiner
     self.reorderMesh = self.inventory.reorderMesh
+    self.reorderCurve = self.inventory.reorderCurve
     return
   
 
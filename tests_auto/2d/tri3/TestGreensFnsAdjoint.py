@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/tri3/TestGreensFnsAdjoint.py
+##
+## @brief Test suite for comparing Green's functions computed with
+## adjoint solves against those computed with forward solves.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class GreensFnsForwardApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfns_forward")
+    return
+
+
+class GreensFnsAdjointApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfns_adjoint")
+    return
+
+
+class TestGreensFnsAdjoint(unittest.TestCase):
+  """
+  Test suite for Green's functions at observation points computed in
+  adjoint mode.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    self.checkResults = has_h5py()
+
+    run_pylith(GreensFnsForwardApp)
+    run_pylith(GreensFnsAdjointApp)
+    return
+
+
+  def test_greens_fns(self):
+    """
+    Check Green's functions against displacements at points from
+    forward solves.
+    """
+    if not self.checkResults:
+      return
+
+    import h5py
+
+    # Forward mode: one time step per impulse.
+    h5 = h5py.File("greensfns_forward-points.h5", "r", driver="sec2")
+    stationsF = [str(name) for name in h5['stations'][:]]
+    disp = h5['vertex_fields/displacement'][:]
+    h5.close()
+    (nimpulses, npoints, ncomps) = disp.shape
+
+    # Adjoint mode: one column per observation (point and component).
+    h5 = h5py.File("greensfns_adjoint.h5", "r", driver="sec2")
+    stationsA = [str(name) for name in h5['stations'][:]]
+    greensFns = h5['greens_functions'][:]
+    h5.close()
+
+    self.assertEqual(npoints, len(stationsA))
+    self.assertEqual((nimpulses, npoints*ncomps), greensFns.shape)
+
+    scale = numpy.max(numpy.abs(disp))
+    self.assertTrue(scale > 0.0)
+    tolerance = 1.0e-6
+    for ipoint,station in enumerate(stationsA):
+      ipointF = stationsF.index(station)
+      for icomp in xrange(ncomps):
+        valuesE = disp[:,ipointF,icomp]
+        values = greensFns[:,ipoint*ncomps+icomp]
+        diff = numpy.abs(values - valuesE) / scale
+        if numpy.max(diff) > tolerance:
+          print "Error in component %d of Green's functions for station %s." % (icomp, station)
+          print "Expected values: ",valuesE
+          print "Output values: ",values
+        self.assertTrue(numpy.max(diff) < tolerance)
+
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestGreensFnsAdjoint import TestGreensFnsAdjoint as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
@@ -63,6 +63,9 @@ class TestApp(FullTestApp):
     from TestFaultsIntersect import TestFaultsIntersect
     suite.addTest(unittest.makeSuite(TestFaultsIntersect))
 
+    from TestGreensFnsAdjoint import TestGreensFnsAdjoint
+    suite.addTest(unittest.makeSuite(TestGreensFnsAdjoint))
+
     return suite
 
 
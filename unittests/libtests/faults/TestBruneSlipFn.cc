@@ -297,6 +297,79 @@ pylith::faults::TestBruneSlipFn::testSlipTH(void)
   PYLITH_METHOD_END;
 } // testSlipTH
 
+// ----------------------------------------------------------------------
+// Test slipActive().
+void
+pylith::faults::TestBruneSlipFn::testSlipActive(void)
+{ // testSlipActive
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar finalSlipE[] = { 2.3, 0.1, 
+				0.0, 0.0};
+  const PylithScalar originTime = 5.064;
+
+  topology::Mesh mesh;
+  topology::Mesh faultMesh;
+  BruneSlipFn slipfn;
+  _initialize(&mesh, &faultMesh, &slipfn, originTime);
+  
+  const spatialdata::geocoords::CoordSys* cs = faultMesh.coordsys();CPPUNIT_ASSERT(cs);
+  const int spaceDim = cs->spaceDim();
+
+  topology::Field slip(faultMesh);
+  slip.newSection(topology::FieldBase::VERTICES_FIELD, spaceDim);
+  slip.allocate();
+
+  topology::Field slipActive(faultMesh);
+  slipActive.cloneSection(slip);
+
+  topology::Field slipFinished(faultMesh);
+  slipFinished.cloneSection(slip);
+  slipFinished.zeroAll();
+
+  PetscDM dmMesh = faultMesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Before slip starts, during slip, and after slip is complete.
+  const PylithScalar times[] = { 0.5, 2.134, 30.0 };
+  const int numTimes = 3;
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iTime=0; iTime < numTimes; ++iTime) {
+    const PylithScalar t = originTime + times[iTime];
+    slip.zeroAll();
+    slipfn.slip(&slip, t);
+    slipActive.copy(slipFinished);
+    slipfn.slipActive(&slipActive, &slipFinished, t);
+
+    topology::VecVisitorMesh slipVisitor(slip);
+    const PetscScalar* slipArray = slipVisitor.localArray();CPPUNIT_ASSERT(slipArray);
+    topology::VecVisitorMesh slipActiveVisitor(slipActive);
+    const PetscScalar* slipActiveArray = slipActiveVisitor.localArray();CPPUNIT_ASSERT(slipActiveArray);
+
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt off = slipVisitor.sectionOffset(v);
+      const PetscInt aoff = slipActiveVisitor.sectionOffset(v);
+      for(PetscInt d = 0; d < spaceDim; ++d) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(slipArray[off+d], slipActiveArray[aoff+d], tolerance);
+      } // for
+    } // for
+  } // for
+
+  // Slip is complete at all vertices at the last time.
+  topology::VecVisitorMesh slipFinishedVisitor(slipFinished);
+  const PetscScalar* slipFinishedArray = slipFinishedVisitor.localArray();CPPUNIT_ASSERT(slipFinishedArray);
+  for(PetscInt v = vStart, iPoint=0; v < vEnd; ++v, ++iPoint) {
+    const PetscInt off = slipFinishedVisitor.sectionOffset(v);
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(finalSlipE[iPoint*spaceDim+d], slipFinishedArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testSlipActive
+
 // ----------------------------------------------------------------------
 // Initialize BruneSlipFn.
 void
@@ -58,6 +58,7 @@ class pylith::faults::TestBruneSlipFn : public CppUnit::TestFixture
   CPPUNIT_TEST( testInitialize3D );
   CPPUNIT_TEST( testSlip );
   CPPUNIT_TEST( testSlipTH );
+  CPPUNIT_TEST( testSlipActive );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -88,6 +89,9 @@ public :
   /// Test _slip().
   void testSlipTH(void);
 
+  /// Test slipActive().
+  void testSlipActive(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -150,6 +150,24 @@ pylith::faults::TestFaultCohesiveDyn::testOpenFreeSurf(void)
   CPPUNIT_ASSERT_EQUAL(value, fault._openFreeSurf);
  } // testOpenFreeSurf
 
+// ----------------------------------------------------------------------
+// Test sensitivityDirectSolve().
+void
+pylith::faults::TestFaultCohesiveDyn::testSensitivityDirectSolve(void)
+{ // testSensitivityDirectSolve
+  PYLITH_METHOD_BEGIN;
+
+  FaultCohesiveDyn fault;
+
+  CPPUNIT_ASSERT_EQUAL(false, fault._sensitivityDirectSolve); // default
+
+  const bool value = true;
+  fault.sensitivityDirectSolve(value);
+  CPPUNIT_ASSERT_EQUAL(value, fault._sensitivityDirectSolve);
+
+  PYLITH_METHOD_END;
+} // testSensitivityDirectSolve
+
 // ----------------------------------------------------------------------
 // Test initialize().
 void
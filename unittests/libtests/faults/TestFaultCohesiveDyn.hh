@@ -55,6 +55,7 @@ class pylith::faults::TestFaultCohesiveDyn: public CppUnit::TestFixture
   CPPUNIT_TEST( testTractPerturbation );
   CPPUNIT_TEST( testZeroTolerance );
   CPPUNIT_TEST( testOpenFreeSurf );
+  CPPUNIT_TEST( testSensitivityDirectSolve );
 
   // Tests in derived classes:
   // testInitialize()
@@ -97,6 +98,9 @@ public:
   /// Test openFreeSurf().
   void testOpenFreeSurf(void);
 
+  /// Test sensitivityDirectSolve().
+  void testSensitivityDirectSolve(void);
+
   /// Test initialize().
   void testInitialize(void);
 
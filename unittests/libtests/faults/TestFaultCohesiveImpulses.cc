@@ -31,6 +31,7 @@
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
@@ -306,6 +307,65 @@ pylith::faults::TestFaultCohesiveImpulses::testIntegrateResidual(void)
   PYLITH_METHOD_END;
 } // testIntegrateResidual
 
+// ----------------------------------------------------------------------
+// Test adjointSensitivities().
+void
+pylith::faults::TestFaultCohesiveImpulses::testAdjointSensitivities(void)
+{ // testAdjointSensitivities
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveImpulses fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  const int numImpulses = fault.numImpulses();
+  CPPUNIT_ASSERT_EQUAL(_data->numImpulses, numImpulses);
+
+  // Set adjoint solution to arbitrary values.
+  topology::Field& adjoint = fields.get("velocity(t)");
+  topology::VecVisitorMesh adjointVisitor(adjoint);
+  PetscScalar* adjointArray = adjointVisitor.localArray();CPPUNIT_ASSERT(adjointArray);
+  PetscInt numAdjoint = 0;
+  PetscErrorCode err = VecGetLocalSize(adjointVisitor.localVec(), &numAdjoint);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < numAdjoint; ++i) {
+    adjointArray[i] = 0.1*(1+i%7) - 0.3;
+  } // for
+
+  scalar_array values(numImpulses);
+  fault.adjointSensitivities(&values[0], numImpulses, adjoint);
+
+  // Sensitivity is inner product of adjoint solution with residual
+  // for impulse and zero displacement.
+  fields.get("disp(t)").zeroAll();
+  fields.get("dispIncr(t->t+dt)").zeroAll();
+  const PylithScalar dt = 1.0;
+  fault.timeStep(dt);
+
+  topology::Field& residual = fields.get("residual");
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (int impulse=0; impulse < numImpulses; ++impulse) {
+    residual.zeroAll();
+    fault.integrateResidual(residual, PylithScalar(impulse), &fields);
+
+    topology::VecVisitorMesh residualVisitor(residual);
+    const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+    PylithScalar valueE = 0.0;
+    for (PetscInt i=0; i < numAdjoint; ++i) {
+      valueE += residualArray[i] * adjointArray[i];
+    } // for
+
+    if (fabs(valueE) > tolerance)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, values[impulse]/valueE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, values[impulse], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testAdjointSensitivities
+
 // ----------------------------------------------------------------------
 // Initialize FaultCohesiveImpulses interface condition.
 void
@@ -60,6 +60,7 @@ class pylith::faults::TestFaultCohesiveImpulses: public CppUnit::TestFixture
   // testNumImpulses()
   // testInitialize()
   // testIntegrateResidual()
+  // testAdjointSensitivities()
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -100,6 +101,9 @@ public:
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test adjointSensitivities().
+  void testAdjointSensitivities(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private:
 
@@ -50,6 +50,7 @@ class pylith::faults::TestFaultCohesiveImpulsesTri3 : public TestFaultCohesiveIm
   CPPUNIT_TEST( testNumImpulses );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testAdjointSensitivities );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -73,6 +74,7 @@ class pylith::faults::TestFaultCohesiveImpulsesQuad4 : public TestFaultCohesiveI
   CPPUNIT_TEST( testNumImpulses );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testAdjointSensitivities );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -96,6 +98,7 @@ class pylith::faults::TestFaultCohesiveImpulsesTet4 : public TestFaultCohesiveIm
   CPPUNIT_TEST( testNumImpulses );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testAdjointSensitivities );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -119,6 +122,7 @@ class pylith::faults::TestFaultCohesiveImpulsesHex8 : public TestFaultCohesiveIm
   CPPUNIT_TEST( testNumImpulses );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testAdjointSensitivities );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -42,10 +42,76 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <stdexcept> // USES runtime_error
+#include <algorithm> // USES std::swap()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestFaultCohesiveKin );
 
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace faults {
+    namespace _TestFaultCohesiveKin {
+      /** Set symmetric, diagonally dominant vertex block of elastic
+       * stiffness matrix.
+       *
+       * @param block Vertex block.
+       * @param iVertex Index of vertex.
+       * @param spaceDim Dimension of block.
+       */
+      void vertexBlock(scalar_array* block,
+		       const int iVertex,
+		       const int spaceDim)
+      { // vertexBlock
+	for (int i=0; i < spaceDim; ++i)
+	  for (int j=0; j < spaceDim; ++j)
+	    (*block)[i*spaceDim+j] = (i == j) ? 3.0 + i + 0.25*(iVertex % 4) : 0.5 + 0.1*(i+j);
+      } // vertexBlock
+
+      /** Compute inverse of matrix using Gauss-Jordan elimination with
+       * partial pivoting.
+       *
+       * @param matrixInv Inverse of matrix.
+       * @param matrix Matrix.
+       * @param n Dimension of matrix.
+       */
+      void invertMatrix(scalar_array* matrixInv,
+			const scalar_array& matrix,
+			const int n)
+      { // invertMatrix
+	scalar_array a(matrix);
+	scalar_array& b = *matrixInv;
+	b = 0.0;
+	for (int i=0; i < n; ++i)
+	  b[i*n+i] = 1.0;
+	for (int k=0; k < n; ++k) {
+	  int pivot = k;
+	  for (int i=k+1; i < n; ++i)
+	    if (fabs(a[i*n+k]) > fabs(a[pivot*n+k]))
+	      pivot = i;
+	  for (int j=0; j < n; ++j) {
+	    std::swap(a[k*n+j], a[pivot*n+j]);
+	    std::swap(b[k*n+j], b[pivot*n+j]);
+	  } // for
+	  const PylithScalar scale = 1.0 / a[k*n+k];
+	  for (int j=0; j < n; ++j) {
+	    a[k*n+j] *= scale;
+	    b[k*n+j] *= scale;
+	  } // for
+	  for (int i=0; i < n; ++i) {
+	    if (i == k)
+	      continue;
+	    const PylithScalar factor = a[i*n+k];
+	    for (int j=0; j < n; ++j) {
+	      a[i*n+j] -= factor*a[k*n+j];
+	      b[i*n+j] -= factor*b[k*n+j];
+	    } // for
+	  } // for
+	} // for
+      } // invertMatrix
+    } // _TestFaultCohesiveKin
+  } // faults
+} // pylith
+
 // ----------------------------------------------------------------------
 // Setup testing data.
 void
@@ -147,6 +213,27 @@ pylith::faults::TestFaultCohesiveKin::testUseLagrangeConstraints(void)
   PYLITH_METHOD_END;
 } // testUseLagrangeConstraints
 
+// ----------------------------------------------------------------------
+// Test constraintPCType().
+void
+pylith::faults::TestFaultCohesiveKin::testConstraintPCType(void)
+{ // testConstraintPCType
+  PYLITH_METHOD_BEGIN;
+
+  FaultCohesiveKin fault;
+  CPPUNIT_ASSERT_EQUAL(FaultCohesiveLagrange::PC_DIAGONAL, fault.constraintPCType());
+
+  fault.constraintPCType("vertex_block");
+  CPPUNIT_ASSERT_EQUAL(FaultCohesiveLagrange::PC_VERTEX_BLOCK, fault.constraintPCType());
+
+  fault.constraintPCType("fault_diagonal");
+  CPPUNIT_ASSERT_EQUAL(FaultCohesiveLagrange::PC_FAULT_DIAGONAL, fault.constraintPCType());
+
+  CPPUNIT_ASSERT_THROW(fault.constraintPCType("abc"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testConstraintPCType
+
 // ----------------------------------------------------------------------
 // Test initialize().
 void
@@ -394,6 +481,217 @@ pylith::faults::TestFaultCohesiveKin::testIntegrateJacobian(void)
   PYLITH_METHOD_END;
 } // testIntegrateJacobian
 
+// ----------------------------------------------------------------------
+// Test reforming Jacobian with integrateJacobian().
+void
+pylith::faults::TestFaultCohesiveKin::testIntegrateJacobianReform(void)
+{ // testIntegrateJacobianReform
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  CPPUNIT_ASSERT(_data->fieldT);
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT);
+  
+  const PylithScalar t = 2.134;
+
+  // Jacobian from a single assembly.
+  topology::Jacobian jacobianE(fields.solution());
+  fault.integrateJacobian(&jacobianE, t, &fields);
+  jacobianE.assemble("final_assembly");
+
+  // Reform Jacobian several times. The first reform inserts values
+  // into the unassembled matrix; later reforms add the constraint
+  // block directly into the storage of the assembled matrix.
+  topology::Jacobian jacobian(fields.solution());
+  const int numReforms = 3;
+  for (int iReform=0; iReform < numReforms; ++iReform) {
+    jacobian.zero();
+    fault.integrateJacobian(&jacobian, t, &fields);
+    CPPUNIT_ASSERT_EQUAL(false, fault.needNewJacobian());
+    jacobian.assemble("final_assembly");
+  } // for
+
+  PetscErrorCode err = 0;
+  PetscReal norm = 0.0, normE = 0.0;
+  err = MatNorm(jacobianE.matrix(), NORM_FROBENIUS, &normE);CPPUNIT_ASSERT(!err);
+  err = MatAXPY(jacobian.matrix(), -1.0, jacobianE.matrix(), DIFFERENT_NONZERO_PATTERN);CPPUNIT_ASSERT(!err);
+  err = MatNorm(jacobian.matrix(), NORM_FROBENIUS, &norm);CPPUNIT_ASSERT(!err);
+
+  const PylithScalar tolerance = 1.0e-10;
+  CPPUNIT_ASSERT(normE > 0.0);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, norm/normE, tolerance);
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobianReform
+
+// ----------------------------------------------------------------------
+// Test calcPreconditioner().
+void
+pylith::faults::TestFaultCohesiveKin::testCalcPreconditioner(void)
+{ // testCalcPreconditioner
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  const int spaceDim = _data->spaceDim;
+  const PylithScalar t = 2.134;
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Jacobian with vertex blocks of elastic stiffness matrix and
+  // fault constraint block.
+  PetscErrorCode err = 0;
+  topology::Jacobian jacobian(fields.solution());
+  PetscMat jacobianMat = jacobian.matrix();CPPUNIT_ASSERT(jacobianMat);
+  PetscSection solnGlobalSection = fields.solution().globalSection();CPPUNIT_ASSERT(solnGlobalSection);
+  scalar_array blockVertex(spaceDim*spaceDim);
+  int_array indicesVertex(spaceDim);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    PetscInt goff = 0;
+    err = PetscSectionGetOffset(solnGlobalSection, v, &goff);PYLITH_CHECK_ERROR(err);
+    if (goff < 0)
+      continue;
+    for (int iDim=0; iDim < spaceDim; ++iDim)
+      indicesVertex[iDim] = goff + iDim;
+    _TestFaultCohesiveKin::vertexBlock(&blockVertex, v-vStart, spaceDim);
+    err = MatSetValues(jacobianMat, spaceDim, &indicesVertex[0], spaceDim, &indicesVertex[0], &blockVertex[0], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+  } // for
+  fault.integrateJacobian(&jacobian, t, &fields);
+  jacobian.assemble("final_assembly");
+
+  PetscDM lagrangeDM = fields.solution().subfieldInfo("lagrange_multiplier").dm;CPPUNIT_ASSERT(lagrangeDM);
+  PetscSection lagrangeGlobalSection = NULL;
+  err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection);PYLITH_CHECK_ERROR(err);
+  PetscInt nrows = 0;
+  err = PetscSectionGetStorageSize(lagrangeGlobalSection, &nrows);PYLITH_CHECK_ERROR(err);
+
+  topology::VecVisitorMesh areaVisitor(fault._fields->get("area"));
+  const PetscScalar* areaArray = areaVisitor.localArray();CPPUNIT_ASSERT(areaArray);
+  topology::VecVisitorMesh orientationVisitor(fault._fields->get("orientation"));
+  const PetscScalar* orientationArray = orientationVisitor.localArray();CPPUNIT_ASSERT(orientationArray);
+
+  scalar_array blockN(spaceDim*spaceDim);
+  scalar_array blockP(spaceDim*spaceDim);
+  scalar_array blockInvN(spaceDim*spaceDim);
+  scalar_array blockInvP(spaceDim*spaceDim);
+  scalar_array precondVertexE(spaceDim*spaceDim);
+  scalar_array precondVertex(spaceDim*spaceDim);
+  int_array indicesL(spaceDim);
+
+  const int numPCTypes = 3;
+  const char* pcTypes[numPCTypes] = { "diagonal", "vertex_block", "fault_diagonal" };
+  const FaultCohesiveLagrange::ConstraintPCEnum pcTypesE[numPCTypes] = {
+    FaultCohesiveLagrange::PC_DIAGONAL,
+    FaultCohesiveLagrange::PC_VERTEX_BLOCK,
+    FaultCohesiveLagrange::PC_FAULT_DIAGONAL,
+  };
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iPC=0; iPC < numPCTypes; ++iPC) {
+    fault.constraintPCType(pcTypes[iPC]);
+    CPPUNIT_ASSERT_EQUAL(pcTypesE[iPC], fault.constraintPCType());
+
+    // Preconditioning matrix for Lagrange multipliers, setup as in Solver.
+    PetscMat precondMatrix = NULL;
+    err = MatCreate(mesh.comm(), &precondMatrix);PYLITH_CHECK_ERROR(err);
+    err = MatSetSizes(precondMatrix, nrows, nrows, PETSC_DECIDE, PETSC_DECIDE);PYLITH_CHECK_ERROR(err);
+    err = MatSetType(precondMatrix, MATAIJ);PYLITH_CHECK_ERROR(err);
+    err = MatSeqAIJSetPreallocation(precondMatrix, spaceDim, NULL);PYLITH_CHECK_ERROR(err);
+    err = MatMPIAIJSetPreallocation(precondMatrix, spaceDim, NULL, 0, NULL);PYLITH_CHECK_ERROR(err);
+
+    fault.calcPreconditioner(&precondMatrix, &jacobian, &fields);
+    err = MatAssemblyBegin(precondMatrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(precondMatrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    int numChecked = 0;
+    const int numVertices = fault._cohesiveVertices.size();
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+      const int e_lagrange = fault._cohesiveVertices[iVertex].lagrange;
+      const int v_fault = fault._cohesiveVertices[iVertex].fault;
+      const int v_negative = fault._cohesiveVertices[iVertex].negative;
+      const int v_positive = fault._cohesiveVertices[iVertex].positive;
+      if (e_lagrange < 0)
+	continue;
+      PetscInt poff = 0;
+      err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &poff);PYLITH_CHECK_ERROR(err);
+      if (poff < 0)
+	continue;
+
+      _TestFaultCohesiveKin::vertexBlock(&blockN, v_negative-vStart, spaceDim);
+      _TestFaultCohesiveKin::vertexBlock(&blockP, v_positive-vStart, spaceDim);
+      blockInvN = 0.0;
+      blockInvP = 0.0;
+      switch (pcTypesE[iPC]) {
+      case FaultCohesiveLagrange::PC_DIAGONAL :
+	for (int iDim=0; iDim < spaceDim; ++iDim) {
+	  blockInvN[iDim*spaceDim+iDim] = 1.0 / blockN[iDim*spaceDim+iDim];
+	  blockInvP[iDim*spaceDim+iDim] = 1.0 / blockP[iDim*spaceDim+iDim];
+	} // for
+	break;
+      case FaultCohesiveLagrange::PC_VERTEX_BLOCK :
+	_TestFaultCohesiveKin::invertMatrix(&blockInvN, blockN, spaceDim);
+	_TestFaultCohesiveKin::invertMatrix(&blockInvP, blockP, spaceDim);
+	break;
+      case FaultCohesiveLagrange::PC_FAULT_DIAGONAL : {
+	// K' = R K R^T, K^(-1) ~ R^T diag(K')^(-1) R
+	const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+	CPPUNIT_ASSERT_EQUAL(spaceDim*spaceDim, orientationVisitor.sectionDof(v_fault));
+	const PetscScalar* R = &orientationArray[ooff];
+	for (int iDim=0; iDim < spaceDim; ++iDim) {
+	  PylithScalar diagN = 0.0;
+	  PylithScalar diagP = 0.0;
+	  for (int jDim=0; jDim < spaceDim; ++jDim)
+	    for (int kDim=0; kDim < spaceDim; ++kDim) {
+	      diagN += R[iDim*spaceDim+jDim] * blockN[jDim*spaceDim+kDim] * R[iDim*spaceDim+kDim];
+	      diagP += R[iDim*spaceDim+jDim] * blockP[jDim*spaceDim+kDim] * R[iDim*spaceDim+kDim];
+	    } // for
+	  for (int jDim=0; jDim < spaceDim; ++jDim)
+	    for (int kDim=0; kDim < spaceDim; ++kDim) {
+	      blockInvN[jDim*spaceDim+kDim] += R[iDim*spaceDim+jDim] * R[iDim*spaceDim+kDim] / diagN;
+	      blockInvP[jDim*spaceDim+kDim] += R[iDim*spaceDim+jDim] * R[iDim*spaceDim+kDim] / diagP;
+	    } // for
+	} // for
+	break;
+      } // PC_FAULT_DIAGONAL
+      default :
+	CPPUNIT_ASSERT(false);
+      } // switch
+
+      const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+      const PylithScalar areaVertex = areaArray[aoff];
+      precondVertexE = -areaVertex * areaVertex * (blockInvN + blockInvP);
+
+      for (int iDim=0; iDim < spaceDim; ++iDim)
+	indicesL[iDim] = poff + iDim;
+      err = MatGetValues(precondMatrix, spaceDim, &indicesL[0], spaceDim, &indicesL[0], &precondVertex[0]);PYLITH_CHECK_ERROR(err);
+
+      const PylithScalar valueScale = areaVertex * areaVertex;
+      for (int i=0; i < spaceDim*spaceDim; ++i) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(precondVertexE[i]/valueScale, precondVertex[i]/valueScale, tolerance);
+      } // for
+      ++numChecked;
+    } // for
+    CPPUNIT_ASSERT(numChecked > 0);
+
+    err = MatDestroy(&precondMatrix);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCalcPreconditioner
+
 // ----------------------------------------------------------------------
 // Test integrateJacobian() with lumped Jacobian.
 void
@@ -55,6 +55,7 @@ class pylith::faults::TestFaultCohesiveKin : public CppUnit::TestFixture
   CPPUNIT_TEST( testEqsrc );
   CPPUNIT_TEST( testNeedNewJacobian );
   CPPUNIT_TEST( testUseLagrangeConstraints );
+  CPPUNIT_TEST( testConstraintPCType );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -87,6 +88,9 @@ public :
   /// Test useLagrangeConstraints().
   void testUseLagrangeConstraints(void);
 
+  /// Test constraintPCType().
+  void testConstraintPCType(void);
+
   /// Test initialize().
   void testInitialize(void);
 
@@ -96,6 +100,12 @@ public :
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
+  /// Test reforming Jacobian with integrateJacobian().
+  void testIntegrateJacobianReform(void);
+
+  /// Test calcPreconditioner().
+  void testCalcPreconditioner(void);
+
   /// Test integrateJacobian() with lumped Jacobian.
   void testIntegrateJacobianLumped(void);
 
@@ -56,6 +56,7 @@ class pylith::faults::TestStepSlipFn : public CppUnit::TestFixture
   CPPUNIT_TEST( testInitialize2D );
   CPPUNIT_TEST( testInitialize3D );
   CPPUNIT_TEST( testSlip );
+  CPPUNIT_TEST( testSlipActive );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -80,6 +81,9 @@ public :
   /// Test slip().
   void testSlip(void);
 
+  /// Test slipActive().
+  void testSlipActive(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
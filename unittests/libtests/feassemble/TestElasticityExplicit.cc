@@ -40,6 +40,7 @@
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::min()
 #include <math.h> // USES fabs()
 
 #include <stdexcept> // USES std::exception
@@ -357,6 +358,63 @@ pylith::feassemble::TestElasticityExplicit::testStableTimeStep(void)
   PYLITH_METHOD_END;
 } // testStableTimeStep
 
+// ----------------------------------------------------------------------
+// Test stableRateLevels(), rateLevels(), and rateSubstep().
+void
+pylith::feassemble::TestElasticityExplicit::testRateLevels(void)
+{ // testRateLevels
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  ElasticityExplicit integrator;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  // Cells with smallest stable time step are at level 2 for a time
+  // step of 1/4 of the stable time step.
+  const PylithScalar dtStable = integrator.stableTimeStep(mesh);
+  const int maxLevel = 3;
+  topology::Stratum cellsStratum(mesh.dmMesh(), topology::Stratum::HEIGHT, 0);
+  const PetscInt numCells = cellsStratum.size();
+  int_array levels(numCells);
+  levels = -1;
+  integrator.stableRateLevels(&levels, mesh, 0.25*dtStable, maxLevel);
+  int minLevel = maxLevel;
+  for (PetscInt c = 0; c < numCells; ++c) {
+    CPPUNIT_ASSERT(levels[c] >= 2 && levels[c] <= maxLevel);
+    minLevel = std::min(minLevel, int(levels[c]));
+  } // for
+  CPPUNIT_ASSERT_EQUAL(2, minLevel);
+
+  // Cells at level 1 do not contribute to residual at odd substeps.
+  levels = 1;
+  integrator.rateLevels(levels, mesh);
+  integrator.rateSubstep(1);
+
+  topology::Field& residual = fields.get("residual");
+  residual.zeroAll();
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+
+  const PetscDM dmMesh = mesh.dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt off = residualVisitor.sectionOffset(v);
+    for (int d=0; d < _data->spaceDim; ++d) {
+      CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), PylithScalar(residualArray[off+d]));
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testRateLevels
+
 // Initialize elasticity integrator.
 void
 pylith::feassemble::TestElasticityExplicit::_initialize(topology::Mesh* mesh,
@@ -102,6 +102,9 @@ public :
   /// Test StableTimeStep().
   void testStableTimeStep(void);
 
+  /// Test stableRateLevels(), rateLevels(), and rateSubstep().
+  void testRateLevels(void);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -58,6 +58,7 @@ class pylith::feassemble::TestElasticityExplicit2DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -84,6 +85,7 @@ class pylith::feassemble::TestElasticityExplicit2DQuadratic :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -110,6 +112,7 @@ class pylith::feassemble::TestElasticityExplicit3DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -136,6 +139,7 @@ class pylith::feassemble::TestElasticityExplicit3DQuadratic :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -163,6 +167,7 @@ class pylith::feassemble::TestElasticityExplicitGrav2DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -189,6 +194,7 @@ class pylith::feassemble::TestElasticityExplicitGrav2DQuadratic :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -215,6 +221,7 @@ class pylith::feassemble::TestElasticityExplicitGrav3DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -241,6 +248,7 @@ class pylith::feassemble::TestElasticityExplicitGrav3DQuadratic :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testRateLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,743 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+#include <portinfo>
+
+#include "TestElasticityExplicitHex8.hh" // Implementation of class methods
+
+#include "pylith/feassemble/ElasticityExplicitHex8.hh" // USES ElasticityExplicitHex8
+#include "pylith/feassemble/ElasticityExplicit.hh" // USES ElasticityExplicit
+#include "data/ElasticityExplicitData3DLinear.hh" // USES ElasticityExplicitData3DLinear
+#include "pylith/feassemble/GeometryHex3D.hh" // USES GeometryHex3D
+
+#include "pylith/materials/ElasticIsotropic3D.hh" // USES ElasticIsotropic3D
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+
+#include "pylith/utils/array.hh" // USES scalar_array
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
+#include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <math.h> // USES fabs(), sqrt()
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestElasticityExplicitHex8 );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace feassemble {
+    namespace _TestElasticityExplicitHex8 {
+      // Vertices of reference cell (order of closure).
+      static const PylithScalar refVertices[8*3] = {
+	-1.0, -1.0, -1.0,
+	-1.0, +1.0, -1.0,
+	+1.0, +1.0, -1.0,
+	+1.0, -1.0, -1.0,
+	-1.0, -1.0, +1.0,
+	+1.0, -1.0, +1.0,
+	+1.0, +1.0, +1.0,
+	-1.0, +1.0, +1.0,
+      };
+
+      // Vertices of undistorted (parallelepiped) hexahedral cell,
+      // x = 2 + A*xi with A from testCalcGeometry() (order of closure).
+      static const PylithScalar coordinatesUndistorted[8*3] = {
+	+0.4, +0.9, +0.4,
+	+1.0, +2.7, +0.4,
+	+3.4, +2.7, +0.6,
+	+2.8, +0.9, +0.6,
+	+0.6, +1.3, +3.4,
+	+3.0, +1.3, +3.6,
+	+3.6, +3.1, +3.6,
+	+1.2, +3.1, +3.4,
+      };
+
+      // Vertices of distorted hexahedral cell (order of closure).
+      static const PylithScalar coordinates[8*3] = {
+	-1.0, -1.0, -1.0,
+	-1.1, +1.0, -0.9,
+	+1.2, +1.3, -1.0,
+	+1.0, -0.9, -1.1,
+	-0.8, -1.0, +1.0,
+	+1.0, -1.0, +1.2,
+	+1.1, +1.1, +1.0,
+	-1.0, +0.9, +0.9,
+      };
+    } // _TestElasticityExplicitHex8
+  } // feassemble
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::feassemble::TestElasticityExplicitHex8::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test timeStep().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testTimeStep(void)
+{ // testTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  const PylithScalar dt1 = 2.0;
+  integrator.timeStep(dt1);
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._dt);
+  integrator.timeStep(dt1);
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._dtm1);
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._dt);
+
+  PYLITH_METHOD_END;
+} // testTimeStep
+
+// ----------------------------------------------------------------------
+// Test hourglassStiffness().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testHourglassStiffness(void)
+{ // testHourglassStiffness
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  const PylithScalar value = 0.05;
+  integrator.hourglassStiffness(value);
+  CPPUNIT_ASSERT_EQUAL(value, integrator._hourglassStiffness);
+
+  CPPUNIT_ASSERT_THROW(integrator.hourglassStiffness(-0.1), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testHourglassStiffness
+
+// ----------------------------------------------------------------------
+// Test _calcGeometry().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testCalcGeometry(void)
+{ // testCalcGeometry
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  const PylithScalar tolerance = 1.0e-06;
+  PylithScalar basisDeriv[8*3];
+
+  // Parallelepiped: x = 2 + A*xi.
+  const PylithScalar* refVertices = _TestElasticityExplicitHex8::refVertices;
+  const PylithScalar A[3][3] = {
+    { 1.2, 0.3, 0.1 },
+    { 0.0, 0.9, 0.2 },
+    { 0.1, 0.0, 1.5 },
+  };
+  scalar_array coordsCell(8*3);
+  for (int iBasis=0; iBasis < 8; ++iBasis) {
+    for (int i=0; i < 3; ++i) {
+      coordsCell[iBasis*3+i] = 2.0;
+      for (int j=0; j < 3; ++j) {
+	coordsCell[iBasis*3+i] += A[i][j] * refVertices[iBasis*3+j];
+      } // for
+    } // for
+  } // for
+  const PylithScalar detA = 
+    A[0][0]*(A[1][1]*A[2][2] - A[1][2]*A[2][1]) -
+    A[0][1]*(A[1][0]*A[2][2] - A[1][2]*A[2][0]) +
+    A[0][2]*(A[1][0]*A[2][1] - A[1][1]*A[2][0]);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(8.0*detA, integrator._calcGeometry(basisDeriv, coordsCell), tolerance);
+
+  // Derivatives of basis functions must reproduce linear fields in
+  // distorted cell.
+  for (int i=0; i < 8*3; ++i) {
+    coordsCell[i] = _TestElasticityExplicitHex8::coordinates[i];
+  } // for
+  const PylithScalar volume = integrator._calcGeometry(basisDeriv, coordsCell);
+  CPPUNIT_ASSERT(volume > 0.0);
+  for (int i=0; i < 3; ++i) {
+    for (int j=0; j < 3; ++j) {
+      PylithScalar value = 0.0;
+      for (int iBasis=0; iBasis < 8; ++iBasis) {
+	value += basisDeriv[iBasis*3+i] * coordsCell[iBasis*3+j];
+      } // for
+      CPPUNIT_ASSERT_DOUBLES_EQUAL((i == j) ? 1.0 : 0.0, value, tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCalcGeometry
+
+// ----------------------------------------------------------------------
+// Test _calcHourglassVectors().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testCalcHourglassVectors(void)
+{ // testCalcHourglassVectors
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  const int numModes = 4;
+  const PylithScalar tolerance = 1.0e-06;
+  PylithScalar basisDeriv[8*3];
+  PylithScalar gamma[8*4];
+
+  scalar_array coordsCell(8*3);
+  for (int i=0; i < 8*3; ++i) {
+    coordsCell[i] = _TestElasticityExplicitHex8::coordinates[i];
+  } // for
+  integrator._calcGeometry(basisDeriv, coordsCell);
+  integrator._calcHourglassVectors(gamma, basisDeriv, coordsCell);
+
+  // Hourglass vectors must be orthogonal to constant and linear
+  // fields, so they do not affect rigid body motion or uniform
+  // strain.
+  for (int iMode=0; iMode < numModes; ++iMode) {
+    PylithScalar sum = 0.0;
+    for (int iBasis=0; iBasis < 8; ++iBasis) {
+      sum += gamma[iBasis*numModes+iMode];
+    } // for
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, sum, tolerance);
+
+    for (int i=0; i < 3; ++i) {
+      PylithScalar value = 0.0;
+      for (int iBasis=0; iBasis < 8; ++iBasis) {
+	value += gamma[iBasis*numModes+iMode] * coordsCell[iBasis*3+i];
+      } // for
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, value, tolerance);
+    } // for
+  } // for
+
+  // Hourglass vectors must be linearly independent, so the Gram
+  // matrix G_ij = gamma_ai gamma_aj must be positive definite. Check
+  // the pivots of Gaussian elimination.
+  PylithScalar gram[4][4];
+  for (int iMode=0; iMode < numModes; ++iMode) {
+    for (int jMode=0; jMode < numModes; ++jMode) {
+      gram[iMode][jMode] = 0.0;
+      for (int iBasis=0; iBasis < 8; ++iBasis) {
+	gram[iMode][jMode] += gamma[iBasis*numModes+iMode] * gamma[iBasis*numModes+jMode];
+      } // for
+    } // for
+  } // for
+  for (int k=0; k < numModes; ++k) {
+    CPPUNIT_ASSERT(gram[k][k] > 0.01);
+    for (int i=k+1; i < numModes; ++i) {
+      const PylithScalar factor = gram[i][k] / gram[k][k];
+      for (int j=k; j < numModes; ++j) {
+	gram[i][j] -= factor * gram[k][j];
+      } // for
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCalcHourglassVectors
+
+// ----------------------------------------------------------------------
+// Test integrateResidual() with a linear displacement field.
+void
+pylith::feassemble::TestElasticityExplicitHex8::testIntegrateResidualLinear(void)
+{ // testIntegrateResidualLinear
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticityExplicitHex8 integrator;
+  materials::ElasticIsotropic3D material;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &material, &fields, _TestElasticityExplicitHex8::coordinates, 1);
+
+  // Hourglass forces vanish for linear displacement and velocity
+  // fields, even in a distorted cell.
+  scalar_array disp(8*3);
+  scalar_array vel(8*3);
+  scalar_array acc(8*3);
+  _linearFields(&disp, &vel, &acc, _TestElasticityExplicitHex8::coordinates);
+  _setField(&fields.get("disp(t)"), disp);
+  _setField(&fields.get("velocity(t)"), vel);
+  _setField(&fields.get("acceleration(t)"), acc);
+
+  scalar_array residual(8*3);
+  integrator.hourglassStiffness(0.1);
+  _integrateResidual(&residual, &integrator, &fields);
+
+  scalar_array residualE(8*3);
+  integrator.hourglassStiffness(0.0);
+  _integrateResidual(&residualE, &integrator, &fields);
+
+  const PylithScalar residualNorm = _maxMagnitude(residualE);
+  CPPUNIT_ASSERT(residualNorm > 0.0);
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (int i=0; i < 8*3; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(residualE[i], residual[i], tolerance*residualNorm);
+  } // for
+
+  // Adding an hourglass mode to the displacement field must change
+  // the residual when hourglass control is used.
+  const PylithScalar hourglassAmp = 0.1 * _maxMagnitude(disp);
+  for (int iBasis=0; iBasis < 8; ++iBasis) {
+    const PylithScalar* ref = &_TestElasticityExplicitHex8::refVertices[iBasis*3];
+    disp[iBasis*3+0] += hourglassAmp * ref[0]*ref[1];
+  } // for
+  _setField(&fields.get("disp(t)"), disp);
+
+  integrator.hourglassStiffness(0.1);
+  _integrateResidual(&residual, &integrator, &fields);
+  integrator.hourglassStiffness(0.0);
+  _integrateResidual(&residualE, &integrator, &fields);
+
+  residualE -= residual;
+  CPPUNIT_ASSERT(_maxMagnitude(residualE) > tolerance*residualNorm);
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualLinear
+
+// ----------------------------------------------------------------------
+// Test integrateResidual() against ElasticityExplicit.
+void
+pylith::feassemble::TestElasticityExplicitHex8::testIntegrateResidual(void)
+{ // testIntegrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  // For linear fields in an undistorted cell, one-point integration
+  // with hourglass control and a lumped mass matrix matches 2x2x2
+  // integration with a row-sum lumped mass matrix.
+  const PylithScalar* coordinates = _TestElasticityExplicitHex8::coordinatesUndistorted;
+
+  scalar_array disp(8*3);
+  scalar_array vel(8*3);
+  scalar_array acc(8*3);
+  _linearFields(&disp, &vel, &acc, coordinates);
+
+  topology::Mesh mesh;
+  ElasticityExplicitHex8 integrator;
+  materials::ElasticIsotropic3D material;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &material, &fields, coordinates, 1);
+  _setField(&fields.get("disp(t)"), disp);
+  _setField(&fields.get("velocity(t)"), vel);
+  _setField(&fields.get("acceleration(t)"), acc);
+
+  topology::Mesh meshE;
+  ElasticityExplicit integratorE;
+  materials::ElasticIsotropic3D materialE;
+  topology::SolutionFields fieldsE(meshE);
+  _initialize(&meshE, &integratorE, &materialE, &fieldsE, coordinates, 8);
+  _setField(&fieldsE.get("disp(t)"), disp);
+  _setField(&fieldsE.get("velocity(t)"), vel);
+  _setField(&fieldsE.get("acceleration(t)"), acc);
+
+  scalar_array residual(8*3);
+  _integrateResidual(&residual, &integrator, &fields);
+  scalar_array residualE(8*3);
+  _integrateResidual(&residualE, &integratorE, &fieldsE);
+
+  const PylithScalar residualNorm = _maxMagnitude(residualE);
+  CPPUNIT_ASSERT(residualNorm > 0.0);
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (int i=0; i < 8*3; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(residualE[i], residual[i], tolerance*residualNorm);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidual
+
+// ----------------------------------------------------------------------
+// Test integrateJacobian() against ElasticityExplicit.
+void
+pylith::feassemble::TestElasticityExplicitHex8::testIntegrateJacobian(void)
+{ // testIntegrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar* coordinates = _TestElasticityExplicitHex8::coordinatesUndistorted;
+
+  topology::Mesh mesh;
+  ElasticityExplicitHex8 integrator;
+  materials::ElasticIsotropic3D material;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &material, &fields, coordinates, 1);
+
+  topology::Mesh meshE;
+  ElasticityExplicit integratorE;
+  materials::ElasticIsotropic3D materialE;
+  topology::SolutionFields fieldsE(meshE);
+  _initialize(&meshE, &integratorE, &materialE, &fieldsE, coordinates, 8);
+
+  scalar_array jacobian(8*3);
+  _integrateJacobian(&jacobian, &integrator, &fields);
+  CPPUNIT_ASSERT_EQUAL(false, integrator.needNewJacobian());
+  scalar_array jacobianE(8*3);
+  _integrateJacobian(&jacobianE, &integratorE, &fieldsE);
+
+  // Each vertex gets one eighth of the mass of the cell.
+  const PylithScalar jacobianNorm = _maxMagnitude(jacobianE);
+  CPPUNIT_ASSERT(jacobianNorm > 0.0);
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (int i=0; i < 8*3; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(jacobianE[i], jacobian[i], tolerance*jacobianNorm);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(jacobianE[0], jacobian[i], tolerance*jacobianNorm);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobian
+
+// ----------------------------------------------------------------------
+// Initialize elasticity integrator for mesh with a single hexahedral
+// cell.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_initialize(topology::Mesh* mesh,
+							    IntegratorElasticity* const integrator,
+							    materials::ElasticMaterial* const material,
+							    topology::SolutionFields* const fields,
+							    const PylithScalar* coordinates,
+							    const int numQuadPts)
+{ // _initialize
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(integrator);
+  CPPUNIT_ASSERT(material);
+  CPPUNIT_ASSERT(fields);
+  CPPUNIT_ASSERT(coordinates);
+
+  // Use material properties and scales of 3-D linear test data.
+  ElasticityExplicitData3DLinear data;
+
+  const int cellDim = 3;
+  const int spaceDim = 3;
+  const int numBasis = 8;
+  const int numCells = 1;
+  const int numVertices = 8;
+  const int cells[numBasis] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+  // Setup mesh
+  PetscDM dmMesh;
+  const PetscBool interpolate = PETSC_TRUE;
+  PetscErrorCode err;
+  err = DMPlexCreateFromCellList(PETSC_COMM_WORLD, cellDim, numCells, numVertices, numBasis, interpolate, cells, spaceDim, coordinates, &dmMesh);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(dmMesh, "domain");
+
+  // Material ids
+  PetscInt cStart, cEnd;
+  err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  for(PetscInt c = cStart; c < cEnd; ++c) {
+    err = DMSetLabelValue(dmMesh, "material-id", c, data.matId);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Setup quadrature with trilinear basis functions,
+  // N_a = 1/8 (1 + xi_a xi)(1 + eta_a eta)(1 + zeta_a zeta).
+  CPPUNIT_ASSERT(1 == numQuadPts || 8 == numQuadPts);
+  const PylithScalar* refVertices = _TestElasticityExplicitHex8::refVertices;
+  scalar_array quadPtsRef(numQuadPts*cellDim);
+  scalar_array quadWts(numQuadPts);
+  if (1 == numQuadPts) {
+    quadPtsRef = 0.0;
+    quadWts = 8.0;
+  } else {
+    const PylithScalar x = 1.0 / sqrt(3.0);
+    for (int i=0; i < numQuadPts*cellDim; ++i) {
+      quadPtsRef[i] = x * refVertices[i];
+    } // for
+    quadWts = 1.0;
+  } // if/else
+  scalar_array basis(numQuadPts*numBasis);
+  scalar_array basisDerivRef(numQuadPts*numBasis*cellDim);
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      PylithScalar f[3];
+      for (int i=0; i < cellDim; ++i) {
+	f[i] = 1.0 + refVertices[iBasis*cellDim+i] * quadPtsRef[iQuad*cellDim+i];
+      } // for
+      const int iB = iQuad*numBasis + iBasis;
+      basis[iB] = f[0]*f[1]*f[2] / 8.0;
+      basisDerivRef[iB*cellDim+0] = refVertices[iBasis*cellDim+0]*f[1]*f[2] / 8.0;
+      basisDerivRef[iB*cellDim+1] = f[0]*refVertices[iBasis*cellDim+1]*f[2] / 8.0;
+      basisDerivRef[iB*cellDim+2] = f[0]*f[1]*refVertices[iBasis*cellDim+2] / 8.0;
+    } // for
+  } // for
+  Quadrature quadrature;
+  GeometryHex3D geometry;
+  quadrature.refGeometry(&geometry);
+  quadrature.initialize(&basis[0], numQuadPts, numBasis,
+			&basisDerivRef[0], numQuadPts, numBasis, cellDim,
+			&quadPtsRef[0], numQuadPts, cellDim,
+			&quadWts[0], numQuadPts,
+			spaceDim);
+
+  // Setup coordinate system.
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  // Setup scales.
+  spatialdata::units::Nondimensional normalizer;
+  normalizer.lengthScale(data.lengthScale);
+  normalizer.pressureScale(data.pressureScale);
+  normalizer.densityScale(data.densityScale);
+  normalizer.timeScale(data.timeScale);
+  topology::MeshOps::nondimensionalize(mesh, normalizer);
+
+  // Setup material
+  spatialdata::spatialdb::SimpleIOAscii iohandler;
+  iohandler.filename(data.matDBFilename);
+  spatialdata::spatialdb::SimpleDB dbProperties;
+  dbProperties.ioHandler(&iohandler);
+  
+  material->id(data.matId);
+  material->label(data.matLabel);
+  material->dbProperties(&dbProperties);
+  material->normalizer(normalizer);
+
+  integrator->quadrature(&quadrature);
+  integrator->gravityField(0);
+  integrator->timeStep(data.dt / data.timeScale);
+  integrator->material(material);
+  integrator->initialize(*mesh);
+
+  // Setup fields
+  fields->add("residual", "residual");
+  fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  fields->add("disp(t)", "displacement");
+  fields->add("disp(t-dt)", "displacement");
+  fields->add("velocity(t)", "velocity");
+  fields->add("acceleration(t)", "acceleration");
+  fields->solutionName("dispIncr(t->t+dt)");
+  
+  topology::Field& residual = fields->get("residual");
+  residual.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR, data.lengthScale);
+  residual.subfieldAdd("lagrange_multiplier", spaceDim, topology::Field::VECTOR);
+
+  residual.subfieldsSetup();
+  residual.setupSolnChart();
+  residual.setupSolnDof(spaceDim);
+  residual.allocate();
+  residual.zeroAll();
+  fields->copyLayout("residual");
+
+  fields->get("dispIncr(t->t+dt)").zeroAll();
+  fields->get("disp(t)").zeroAll();
+  fields->get("disp(t-dt)").zeroAll();
+  fields->get("velocity(t)").zeroAll();
+  fields->get("acceleration(t)").zeroAll();
+
+  PYLITH_METHOD_END;
+} // _initialize
+
+// ----------------------------------------------------------------------
+// Compute nondimensional displacement, velocity, and acceleration
+// fields that are linear functions of the coordinates.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_linearFields(scalar_array* disp,
+							      scalar_array* vel,
+							      scalar_array* acc,
+							      const PylithScalar* coordinates)
+{ // _linearFields
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(disp);
+  CPPUNIT_ASSERT(vel);
+  CPPUNIT_ASSERT(acc);
+  CPPUNIT_ASSERT(coordinates);
+
+  ElasticityExplicitData3DLinear data;
+  const PylithScalar lengthScale = data.lengthScale;
+
+  // u_i = a_i + G_ij x_j for each field.
+  const PylithScalar dispA[3] = { 1.0e-3, -2.0e-3, 1.5e-3 };
+  const PylithScalar dispG[3][3] = {
+    { 1.0e-4, 2.5e-4, -1.5e-4 },
+    { 0.5e-4, -2.0e-4, 3.0e-4 },
+    { -1.0e-4, 1.5e-4, 2.0e-4 },
+  };
+  const PylithScalar velA[3] = { -2.0e-2, 1.0e-2, 3.0e-2 };
+  const PylithScalar velG[3][3] = {
+    { -3.0e-3, 1.0e-3, 2.0e-3 },
+    { 2.0e-3, 4.0e-3, -1.0e-3 },
+    { 1.0e-3, -2.0e-3, 3.0e-3 },
+  };
+  const PylithScalar accA[3] = { 0.4, -0.3, 0.2 };
+  const PylithScalar accG[3][3] = {
+    { 0.02, -0.01, 0.03 },
+    { -0.02, 0.05, 0.01 },
+    { 0.04, 0.01, -0.03 },
+  };
+
+  disp->resize(8*3);
+  vel->resize(8*3);
+  acc->resize(8*3);
+  for (int iBasis=0; iBasis < 8; ++iBasis) {
+    for (int i=0; i < 3; ++i) {
+      (*disp)[iBasis*3+i] = dispA[i];
+      (*vel)[iBasis*3+i] = velA[i];
+      (*acc)[iBasis*3+i] = accA[i];
+      for (int j=0; j < 3; ++j) {
+	const PylithScalar x = coordinates[iBasis*3+j];
+	(*disp)[iBasis*3+i] += dispG[i][j] * x;
+	(*vel)[iBasis*3+i] += velG[i][j] * x;
+	(*acc)[iBasis*3+i] += accG[i][j] * x;
+      } // for
+    } // for
+  } // for
+  *disp /= lengthScale;
+  *vel /= lengthScale / data.timeScale;
+  *acc /= lengthScale / (data.timeScale*data.timeScale);
+
+  PYLITH_METHOD_END;
+} // _linearFields
+
+// ----------------------------------------------------------------------
+// Set values of field at vertices.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_setField(topology::Field* field,
+							  const scalar_array& values)
+{ // _setField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = field->mesh().dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  CPPUNIT_ASSERT_EQUAL(size_t(verticesStratum.size()*3), values.size());
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(3, fieldVisitor.sectionDof(v));
+    for (int d=0; d < 3; ++d, ++index) {
+      fieldArray[off+d] = values[index];
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _setField
+
+// ----------------------------------------------------------------------
+// Get values of field at vertices.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_getField(scalar_array* values,
+							  const topology::Field& field)
+{ // _getField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(values);
+
+  const PetscDM dmMesh = field.mesh().dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  values->resize(verticesStratum.size()*3);
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(3, fieldVisitor.sectionDof(v));
+    for (int d=0; d < 3; ++d, ++index) {
+      (*values)[index] = fieldArray[off+d];
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _getField
+
+// ----------------------------------------------------------------------
+// Integrate residual and get values at vertices.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_integrateResidual(scalar_array* values,
+								   IntegratorElasticity* const integrator,
+								   topology::SolutionFields* const fields)
+{ // _integrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(integrator);
+  CPPUNIT_ASSERT(fields);
+
+  topology::Field& residual = fields->get("residual");
+  residual.zeroAll();
+  const PylithScalar t = 1.0;
+  integrator->integrateResidual(residual, t, fields);
+  _getField(values, residual);
+
+  PYLITH_METHOD_END;
+} // _integrateResidual
+
+// ----------------------------------------------------------------------
+// Integrate lumped Jacobian and get values at vertices.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_integrateJacobian(scalar_array* values,
+								   IntegratorElasticity* const integrator,
+								   topology::SolutionFields* const fields)
+{ // _integrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(integrator);
+  CPPUNIT_ASSERT(fields);
+
+  ElasticityExplicitData3DLinear data;
+  const int spaceDim = 3;
+
+  topology::Field jacobian(fields->mesh());
+  jacobian.label("Jacobian");
+  jacobian.vectorFieldType(topology::FieldBase::VECTOR);
+  jacobian.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR, data.lengthScale);
+  jacobian.subfieldAdd("lagrange_multiplier", spaceDim, topology::Field::VECTOR);
+
+  jacobian.subfieldsSetup();
+  jacobian.setupSolnChart();
+  jacobian.setupSolnDof(spaceDim);
+  jacobian.allocate();
+  jacobian.zeroAll();
+
+  const PylithScalar t = 1.0;
+  integrator->integrateJacobian(&jacobian, t, fields);
+  jacobian.complete();
+  _getField(values, jacobian);
+
+  PYLITH_METHOD_END;
+} // _integrateJacobian
+
+// ----------------------------------------------------------------------
+// Get largest magnitude of values.
+PylithScalar
+pylith::feassemble::TestElasticityExplicitHex8::_maxMagnitude(const scalar_array& values)
+{ // _maxMagnitude
+  PylithScalar value = 0.0;
+  for (size_t i=0; i < values.size(); ++i) {
+    if (fabs(values[i]) > value) {
+      value = fabs(values[i]);
+    } // if
+  } // for
+
+  return value;
+} // _maxMagnitude
+
+
+// End of file 
@@ -0,0 +1,175 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+/**
+ * @file unittests/libtests/feassemble/TestElasticityExplicitHex8.hh
+ *
+ * @brief C++ TestElasticityExplicitHex8 object
+ *
+ * C++ unit testing for ElasticityExplicitHex8.
+ */
+
+#if !defined(pylith_feassemble_testelasticityexplicithex8_hh)
+#define pylith_feassemble_testelasticityexplicithex8_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+#include "pylith/materials/materialsfwd.hh" // forward declarations
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace feassemble {
+    class TestElasticityExplicitHex8;
+  } // feassemble
+} // pylith
+
+/// C++ unit testing for ElasticityExplicitHex8
+class pylith::feassemble::TestElasticityExplicitHex8 : public CppUnit::TestFixture
+{ // class TestElasticityExplicitHex8
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestElasticityExplicitHex8 );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( testHourglassStiffness );
+  CPPUNIT_TEST( testCalcGeometry );
+  CPPUNIT_TEST( testCalcHourglassVectors );
+  CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualLinear );
+  CPPUNIT_TEST( testIntegrateJacobian );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test timeStep().
+  void testTimeStep(void);
+
+  /// Test hourglassStiffness().
+  void testHourglassStiffness(void);
+
+  /// Test _calcGeometry().
+  void testCalcGeometry(void);
+
+  /// Test _calcHourglassVectors().
+  void testCalcHourglassVectors(void);
+
+  /// Test integrateResidual() against ElasticityExplicit.
+  void testIntegrateResidual(void);
+
+  /// Test integrateResidual() with linear displacement field.
+  void testIntegrateResidualLinear(void);
+
+  /// Test integrateJacobian() against ElasticityExplicit.
+  void testIntegrateJacobian(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize elasticity integrator for mesh with one hexahedral cell.
+   *
+   * @param mesh Finite-element mesh to initialize.
+   * @param integrator ElasticityIntegrator to initialize.
+   * @param material Elastic material to initialize.
+   * @param fields Solution fields.
+   * @param coordinates Coordinates of vertices (order of closure).
+   * @param numQuadPts Number of quadrature points (1 or 8).
+   */
+  static
+  void _initialize(topology::Mesh* mesh,
+		   IntegratorElasticity* const integrator,
+		   materials::ElasticMaterial* const material,
+		   topology::SolutionFields* const fields,
+		   const PylithScalar* coordinates,
+		   const int numQuadPts);
+
+  /** Compute nondimensional displacement, velocity, and acceleration
+   * fields that are linear functions of the coordinates.
+   *
+   * @param disp Displacement field.
+   * @param vel Velocity field.
+   * @param acc Acceleration field.
+   * @param coordinates Coordinates of vertices.
+   */
+  static
+  void _linearFields(scalar_array* disp,
+		     scalar_array* vel,
+		     scalar_array* acc,
+		     const PylithScalar* coordinates);
+
+  /** Set values of field at vertices.
+   *
+   * @param field Field to set.
+   * @param values Values at vertices.
+   */
+  static
+  void _setField(topology::Field* field,
+		 const scalar_array& values);
+
+  /** Get values of field at vertices.
+   *
+   * @param values Values at vertices.
+   * @param field Field to get.
+   */
+  static
+  void _getField(scalar_array* values,
+		 const topology::Field& field);
+
+  /** Integrate residual and get values at vertices.
+   *
+   * @param values Values of residual at vertices.
+   * @param integrator Elasticity integrator.
+   * @param fields Solution fields.
+   */
+  static
+  void _integrateResidual(scalar_array* values,
+			  IntegratorElasticity* const integrator,
+			  topology::SolutionFields* const fields);
+
+  /** Integrate lumped Jacobian and get values at vertices.
+   *
+   * @param values Values of Jacobian at vertices.
+   * @param integrator Elasticity integrator.
+   * @param fields Solution fields.
+   */
+  static
+  void _integrateJacobian(scalar_array* values,
+			  IntegratorElasticity* const integrator,
+			  topology::SolutionFields* const fields);
+
+  /** Get largest magnitude of values.
+   *
+   * @param values Array of values.
+   * @returns Largest magnitude.
+   */
+  static
+  PylithScalar _maxMagnitude(const scalar_array& values);
+
+}; // class TestElasticityExplicitHex8
+
+#endif // pylith_feassemble_testelasticityexplicithex8_hh
+
+
+// End of file 
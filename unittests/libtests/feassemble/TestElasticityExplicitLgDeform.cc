@@ -120,39 +120,7 @@ pylith::feassemble::TestElasticityExplicitLgDeform::testIntegrateResidual(void)
   const PylithScalar t = 1.0;
   integrator.integrateResidual(residual, t, &fields);
 
-  const PylithScalar* valsE = _data->valsResidual;
-
-#if 0
-  residual.view("RESIDUAL");
-  std::cout << "EXPECTED RESIDUAL" << std::endl;
-  for (int i=0; i < size; ++i)
-    std::cout << "valE: " << valsE[i] << ", val: " << vals[i] << ", val/valE: " << vals[i]/valsE[i] << std::endl;
-#endif
-
-  const PetscDM dmMesh = mesh.dmMesh();
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-  CPPUNIT_ASSERT_EQUAL(_data->numVertices, verticesStratum.size());
-
-  topology::VecVisitorMesh residualVisitor(residual);
-  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
-
-  const PylithScalar accScale = _data->lengthScale / pow(_data->timeScale, 2);
-  const PylithScalar residualScale = _data->densityScale * accScale*pow(_data->lengthScale, _data->spaceDim);
-
-  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
-  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
-    const PetscInt off = residualVisitor.sectionOffset(v);
-    CPPUNIT_ASSERT_EQUAL(_data->spaceDim, residualVisitor.sectionDof(v));
-
-    for (int d=0; d < _data->spaceDim; ++d, ++index) {
-      if (fabs(valsE[index]) > 1.0)
-	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualArray[off+d]/valsE[index]*residualScale, tolerance);
-      else
-	CPPUNIT_ASSERT_DOUBLES_EQUAL(valsE[index], residualArray[off+d]*residualScale, tolerance);
-    } // for
-  } // for
+  _checkResidual(residual);
 
   PYLITH_METHOD_END;
 } // testIntegrateResidual
@@ -230,6 +198,155 @@ pylith::feassemble::TestElasticityExplicitLgDeform::testIntegrateJacobian(void)
   PYLITH_METHOD_END;
 } // testIntegrateJacobian
 
+// ----------------------------------------------------------------------
+// Test integrateResidual() reusing cached kinematics.
+void
+pylith::feassemble::TestElasticityExplicitLgDeform::testIntegrateResidualCached(void)
+{ // testIntegrateResidualCached
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+  CPPUNIT_ASSERT(_material);
+
+  topology::Mesh mesh;
+  ElasticityExplicitLgDeform integrator;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  topology::Field& residual = fields.get("residual");
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+  _checkResidual(residual);
+
+  // Kinematics are cached for every cell.
+  const int numCells = _data->numCells;
+  const int spaceDim = _data->spaceDim;
+  const int dispSize = _data->numBasis*spaceDim;
+  const int deformSize = _data->numQuadPts*spaceDim*spaceDim;
+  const int strainSize = _data->numQuadPts*_material->tensorSize();
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells), integrator._kinematicsCurrent.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*dispSize), integrator._kinematicsDisp.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*deformSize), integrator._kinematicsDeform.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*strainSize), integrator._kinematicsStrain.size());
+  for (int c=0; c < numCells; ++c) {
+    CPPUNIT_ASSERT_EQUAL(1, integrator._kinematicsCurrent[c]);
+  } // for
+  const scalar_array deformCached(integrator._kinematicsDeform);
+  const scalar_array strainCached(integrator._kinematicsStrain);
+
+  // Same displacements return the cached values, so replace them with
+  // values that would never be computed.
+  const PylithScalar deformMarker = -2.0;
+  const PylithScalar strainMarker = -3.0;
+  ElasticityExplicitLgDeform::totalStrain_fn_type calcTotalStrainFn = (2 == spaceDim) ?
+    &ElasticityExplicitLgDeform::_calcTotalStrain2D : &ElasticityExplicitLgDeform::_calcTotalStrain3D;
+  scalar_array deformCell(deformSize);
+  scalar_array strainCell(strainSize);
+  for (int c=0; c < numCells; ++c) {
+    const scalar_array dispCell = integrator._kinematicsDisp[std::slice(c*dispSize, dispSize, 1)];
+    integrator._kinematicsDeform[std::slice(c*deformSize, deformSize, 1)] = deformMarker;
+    integrator._kinematicsStrain[std::slice(c*strainSize, strainSize, 1)] = strainMarker;
+    integrator._calcKinematics(&deformCell, &strainCell, c, dispCell, calcTotalStrainFn);
+    for (int i=0; i < deformSize; ++i) {
+      CPPUNIT_ASSERT_EQUAL(deformMarker, deformCell[i]);
+    } // for
+    for (int i=0; i < strainSize; ++i) {
+      CPPUNIT_ASSERT_EQUAL(strainMarker, strainCell[i]);
+    } // for
+  } // for
+  integrator._kinematicsDeform = deformCached;
+  integrator._kinematicsStrain = strainCached;
+
+  // Second residual with the same displacements reuses the cache.
+  residual.zeroAll();
+  integrator.integrateResidual(residual, t, &fields);
+  _checkResidual(residual);
+  for (int i=0; i < numCells*deformSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(deformCached[i], integrator._kinematicsDeform[i]);
+  } // for
+  for (int i=0; i < numCells*strainSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(strainCached[i], integrator._kinematicsStrain[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualCached
+
+// ----------------------------------------------------------------------
+// Test integrateResidual() after displacements change.
+void
+pylith::feassemble::TestElasticityExplicitLgDeform::testIntegrateResidualPerturbed(void)
+{ // testIntegrateResidualPerturbed
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  ElasticityExplicitLgDeform integrator;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  topology::Field& residual = fields.get("residual");
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+  const scalar_array deformOrig(integrator._kinematicsDeform);
+
+  _perturbDisp(&fields);
+  residual.zeroAll();
+  integrator.integrateResidual(residual, t, &fields);
+
+  // Integrator without cached kinematics.
+  topology::Mesh meshFresh;
+  ElasticityExplicitLgDeform integratorFresh;
+  topology::SolutionFields fieldsFresh(meshFresh);
+  _initialize(&meshFresh, &integratorFresh, &fieldsFresh);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), integratorFresh._kinematicsCurrent.size());
+
+  _perturbDisp(&fieldsFresh);
+  topology::Field& residualFresh = fieldsFresh.get("residual");
+  integratorFresh.integrateResidual(residualFresh, t, &fieldsFresh);
+
+  // Perturbation changes the deformation.
+  const size_t deformSize = integratorFresh._kinematicsDeform.size();
+  CPPUNIT_ASSERT_EQUAL(deformSize, deformOrig.size());
+  bool deformChanged = false;
+  for (size_t i=0; i < deformSize; ++i) {
+    deformChanged = deformChanged || deformOrig[i] != integratorFresh._kinematicsDeform[i];
+  } // for
+  CPPUNIT_ASSERT(deformChanged);
+
+  // Recomputed kinematics and residual match those from the fresh integrator.
+  CPPUNIT_ASSERT_EQUAL(deformSize, integrator._kinematicsDeform.size());
+  for (size_t i=0; i < deformSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(integratorFresh._kinematicsDeform[i], integrator._kinematicsDeform[i]);
+  } // for
+  const size_t strainSize = integratorFresh._kinematicsStrain.size();
+  CPPUNIT_ASSERT_EQUAL(strainSize, integrator._kinematicsStrain.size());
+  for (size_t i=0; i < strainSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(integratorFresh._kinematicsStrain[i], integrator._kinematicsStrain[i]);
+  } // for
+
+  topology::Stratum verticesStratum(mesh.dmMesh(), topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+  topology::VecVisitorMesh residualFreshVisitor(residualFresh);
+  const PetscScalar* residualFreshArray = residualFreshVisitor.localArray();CPPUNIT_ASSERT(residualFreshArray);
+
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt off = residualVisitor.sectionOffset(v);
+    const PetscInt offFresh = residualFreshVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(_data->spaceDim, residualVisitor.sectionDof(v));
+    CPPUNIT_ASSERT_EQUAL(_data->spaceDim, residualFreshVisitor.sectionDof(v));
+    for (int d=0; d < _data->spaceDim; ++d) {
+      CPPUNIT_ASSERT_EQUAL(residualFreshArray[offFresh+d], residualArray[off+d]);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualPerturbed
+
 // ----------------------------------------------------------------------
 // Test updateStateVars().
 void 
@@ -399,5 +516,83 @@ pylith::feassemble::TestElasticityExplicitLgDeform::_initialize(topology::Mesh*
   PYLITH_METHOD_END;
 } // _initialize
 
+// ----------------------------------------------------------------------
+// Check residual against expected values.
+void
+pylith::feassemble::TestElasticityExplicitLgDeform::_checkResidual(const topology::Field& residual)
+{ // _checkResidual
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  const PylithScalar* valsE = _data->valsResidual;
+
+#if 0
+  residual.view("RESIDUAL");
+  std::cout << "EXPECTED RESIDUAL" << std::endl;
+  for (int i=0; i < size; ++i)
+    std::cout << "valE: " << valsE[i] << ", val: " << vals[i] << ", val/valE: " << vals[i]/valsE[i] << std::endl;
+#endif
+
+  const PetscDM dmMesh = residual.mesh().dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  CPPUNIT_ASSERT_EQUAL(_data->numVertices, verticesStratum.size());
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+
+  const PylithScalar accScale = _data->lengthScale / pow(_data->timeScale, 2);
+  const PylithScalar residualScale = _data->densityScale * accScale*pow(_data->lengthScale, _data->spaceDim);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = residualVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(_data->spaceDim, residualVisitor.sectionDof(v));
+
+    for (int d=0; d < _data->spaceDim; ++d, ++index) {
+      if (fabs(valsE[index]) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualArray[off+d]/valsE[index]*residualScale, tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valsE[index], residualArray[off+d]*residualScale, tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkResidual
+
+// ----------------------------------------------------------------------
+// Perturb displacements so the deformation changes in every cell.
+void
+pylith::feassemble::TestElasticityExplicitLgDeform::_perturbDisp(topology::SolutionFields* const fields)
+{ // _perturbDisp
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(fields);
+  CPPUNIT_ASSERT(_data);
+
+  const int spaceDim = _data->spaceDim;
+  const PylithScalar lengthScale = _data->lengthScale;
+
+  topology::Field& dispT = fields->get("disp(t)");
+  topology::VecVisitorMesh dispTVisitor(dispT);
+  PetscScalar* dispTArray = dispTVisitor.localArray();CPPUNIT_ASSERT(dispTArray);
+
+  topology::Stratum verticesStratum(dispT.mesh().dmMesh(), topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = dispTVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, dispTVisitor.sectionDof(v));
+    for (int iDim=0; iDim < spaceDim; ++iDim, ++index) {
+      dispTArray[off+iDim] += 0.01*(index+1) / lengthScale;
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _perturbDisp
+
 
 // End of file 
@@ -30,7 +30,7 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
-#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields, Field
 #include "pylith/materials/materialsfwd.hh" // USES ElasticMaterial
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES GravityField
@@ -76,6 +76,12 @@ public :
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test integrateResidual() reusing cached kinematics.
+  void testIntegrateResidualCached(void);
+
+  /// Test integrateResidual() after displacements change.
+  void testIntegrateResidualPerturbed(void);
+
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
@@ -103,6 +109,18 @@ private :
 		   ElasticityExplicitLgDeform* const integrator,
 		   topology::SolutionFields* const fields);
 
+  /** Check residual against expected values.
+   *
+   * @param residual Residual field.
+   */
+  void _checkResidual(const topology::Field& residual);
+
+  /** Perturb displacements so the deformation changes in every cell.
+   *
+   * @param fields Solution fields.
+   */
+  void _perturbDisp(topology::SolutionFields* const fields);
+
 }; // class TestElasticityExplicitLgDeform
 
 #endif // pylith_feassemble_testelasticityexplicitlgdeform_hh
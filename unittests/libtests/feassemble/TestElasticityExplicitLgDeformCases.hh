@@ -55,6 +55,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeform2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -80,6 +82,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeform2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -105,6 +109,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeform3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -130,6 +136,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeform3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -155,6 +163,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeformGrav2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -180,6 +190,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeformGrav2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -205,6 +217,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeformGrav3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -230,6 +244,8 @@ class pylith::feassemble::TestElasticityExplicitLgDeformGrav3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
 
@@ -303,6 +303,61 @@ pylith::feassemble::TestElasticityImplicit::testUpdateStateVars(void)
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
+// ----------------------------------------------------------------------
+// Test cacheStrainStress() with updateStateVars() and cellField().
+void 
+pylith::feassemble::TestElasticityImplicit::testCacheStrainStress(void)
+{ // testCacheStrainStress
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  ElasticityImplicit integrator;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  const PylithScalar t = 1.0;
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-04;
+  const char* names[2] = { "total_strain", "stress" };
+  for (int iName=0; iName < 2; ++iName) {
+    // Values from cache.
+    integrator.cacheStrainStress(true);
+    integrator.updateStateVars(t, &fields);
+    const topology::Field& fieldCached = integrator.cellField(names[iName], mesh, &fields);
+    PetscVec vecCached = fieldCached.localVector();CPPUNIT_ASSERT(vecCached);
+    PetscInt size = 0;
+    PetscErrorCode err = VecGetLocalSize(vecCached, &size);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(size > 0);
+    scalar_array valuesCached(size);
+    const PetscScalar* cachedArray = NULL;
+    err = VecGetArrayRead(vecCached, &cachedArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < size; ++i) {
+      valuesCached[i] = cachedArray[i];
+    } // for
+    err = VecRestoreArrayRead(vecCached, &cachedArray);PYLITH_CHECK_ERROR(err);
+
+    // Recomputed values.
+    integrator.cacheStrainStress(false);
+    const topology::Field& field = integrator.cellField(names[iName], mesh, &fields);
+    PetscVec vec = field.localVector();CPPUNIT_ASSERT(vec);
+    PetscInt checkSize = 0;
+    err = VecGetLocalSize(vec, &checkSize);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(size, checkSize);
+    const PetscScalar* array = NULL;
+    err = VecGetArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < size; ++i) {
+      if (fabs(array[i]) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, valuesCached[i]/array[i], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(array[i], valuesCached[i], tolerance);
+    } // for
+    err = VecRestoreArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCacheStrainStress
+
 // ----------------------------------------------------------------------
 // Test StableTimeStep().
 void
@@ -97,6 +97,9 @@ public :
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
+  /// Test cacheStrainStress() with updateStateVars() and cellField().
+  void testCacheStrainStress(void);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
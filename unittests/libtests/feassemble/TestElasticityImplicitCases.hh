@@ -58,6 +58,7 @@ class pylith::feassemble::TestElasticityImplicit2DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testCacheStrainStress );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -110,6 +111,7 @@ class pylith::feassemble::TestElasticityImplicit3DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testCacheStrainStress );
 
   CPPUNIT_TEST_SUITE_END();
 
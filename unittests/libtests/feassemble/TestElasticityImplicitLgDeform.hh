@@ -30,7 +30,7 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
-#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields, Field, Jacobian
 #include "pylith/materials/materialsfwd.hh" // USES ElasticMaterial
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES GravityField
@@ -76,9 +76,18 @@ public :
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test integrateResidual() reusing cached kinematics.
+  void testIntegrateResidualCached(void);
+
+  /// Test integrateResidual() after displacements change.
+  void testIntegrateResidualPerturbed(void);
+
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
+  /// Test integrateJacobian() reusing kinematics cached by integrateResidual().
+  void testIntegrateJacobianCached(void);
+
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
@@ -103,6 +112,24 @@ private :
 		   ElasticityImplicitLgDeform* const integrator,
 		   topology::SolutionFields* const fields);
 
+  /** Check residual against expected values.
+   *
+   * @param residual Residual field.
+   */
+  void _checkResidual(const topology::Field& residual);
+
+  /** Check Jacobian against expected values.
+   *
+   * @param jacobian Assembled Jacobian.
+   */
+  void _checkJacobian(const topology::Jacobian& jacobian);
+
+  /** Perturb displacements so the deformation changes in every cell.
+   *
+   * @param fields Solution fields.
+   */
+  void _perturbDisp(topology::SolutionFields* const fields);
+
 }; // class TestElasticityImplicitLgDeform
 
 #endif // pylith_feassemble_testelasticityimplicitlgdeform_hh
@@ -55,7 +55,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeform2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -80,7 +83,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeform2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -105,7 +111,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeform3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -130,7 +139,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeform3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -155,7 +167,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeformGrav2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -180,7 +195,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeformGrav2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -205,7 +223,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeformGrav3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
@@ -230,7 +251,10 @@ class pylith::feassemble::TestElasticityImplicitLgDeformGrav3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualCached );
+  CPPUNIT_TEST( testIntegrateResidualPerturbed );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianCached );
   CPPUNIT_TEST( testUpdateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
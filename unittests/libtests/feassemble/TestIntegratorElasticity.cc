@@ -21,7 +21,11 @@
 #include "TestIntegratorElasticity.hh" // Implementation of class methods
 
 #include "pylith/feassemble/IntegratorElasticity.hh" // USES IntegratorElasticity
+#include "pylith/feassemble/ElasticityExplicit.hh" // USES ElasticityExplicit
 
+#include "pylith/topology/Stratum.hh" // USES StratumIS
+
+#include "pylith/utils/array.hh" // USES int_array
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
 #include <math.h> // USES fabs()
@@ -30,6 +34,62 @@
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestIntegratorElasticity );
 
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace feassemble {
+    namespace _TestIntegratorElasticity {
+      // Mesh with 9 vertices and 8 cells.
+      //
+      //  6 --- 7 --- 8
+      //  | c5 /| c7 /|
+      //  |  /  |  /  |
+      //  | / c4| / c6|
+      //  3 --- 4 --- 5
+      //  | c1 /| c3 /|
+      //  |  /  |  /  |
+      //  | / c0| / c2|
+      //  0 --- 1 --- 2
+      const int numVertices = 9;
+      const int numCells = 8;
+      const int numCorners = 3;
+      const PylithScalar vertices[numVertices*2] = {
+	0.0, 0.0,
+	1.0, 0.0,
+	2.0, 0.0,
+	0.0, 1.0,
+	1.0, 1.0,
+	2.0, 1.0,
+	0.0, 2.0,
+	1.0, 2.0,
+	2.0, 2.0,
+      };
+      const int cells[numCells*numCorners] = {
+	0, 1, 4,
+	0, 4, 3,
+	1, 2, 5,
+	1, 5, 4,
+	3, 4, 7,
+	3, 7, 6,
+	4, 5, 8,
+	4, 8, 7,
+      };
+      const int materialIds[numCells] = {
+	0, 0, 0, 0, 0, 0, 1, 1,
+      };
+      const int materialId = 0;
+      const int numMaterialCells = 6;
+
+      // Vertices 2 and 6 are shared with other processes.
+      const int sharedLeaf = 2;
+      const int sharedRoot = 6;
+      const int numBoundaryCells = 2;
+      const int boundaryCells[numBoundaryCells] = { 2, 5 };
+      const int numInteriorCells = 4;
+      const int interiorCells[numInteriorCells] = { 0, 1, 3, 4 };
+    } // _TestIntegratorElasticity
+  } // feassemble
+} // pylith
+
 // ----------------------------------------------------------------------
 // Test calcTotalStrain2D().
 void
@@ -141,4 +201,183 @@ pylith::feassemble::TestIntegratorElasticity::testCalcTotalStrain3D(void)
 } // testCalcTotalStrain3D
 
 
+// ----------------------------------------------------------------------
+// Test _setupCellPartition().
+void
+pylith::feassemble::TestIntegratorElasticity::testSetupCellPartition(void)
+{ // testSetupCellPartition
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = NULL;
+  _createMesh(&dmMesh);
+
+  ElasticityExplicit integrator;
+  const bool includeOnlyCells = true;
+  integrator._materialIS = new topology::StratumIS(dmMesh, "material-id", _TestIntegratorElasticity::materialId, includeOnlyCells);
+  const int numCells = _TestIntegratorElasticity::numMaterialCells;
+  CPPUNIT_ASSERT_EQUAL(numCells, integrator._materialIS->size());
+
+  // No points are shared on a single process, so all cells are
+  // interior cells.
+  integrator._setupCellPartition(dmMesh);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), integrator._boundaryCells.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells), integrator._interiorCells.size());
+  for (int i=0; i < numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(i, integrator._interiorCells[i]);
+  } // for
+
+  // Cells with a shared vertex are boundary cells.
+  _setSharedVertices(dmMesh, _TestIntegratorElasticity::sharedLeaf, _TestIntegratorElasticity::sharedRoot);
+  integrator._setupCellPartition(dmMesh);
+
+  const int numBoundaryCells = _TestIntegratorElasticity::numBoundaryCells;
+  CPPUNIT_ASSERT_EQUAL(size_t(numBoundaryCells), integrator._boundaryCells.size());
+  for (int i=0; i < numBoundaryCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(_TestIntegratorElasticity::boundaryCells[i], integrator._boundaryCells[i]);
+  } // for
+  const int numInteriorCells = _TestIntegratorElasticity::numInteriorCells;
+  CPPUNIT_ASSERT_EQUAL(size_t(numInteriorCells), integrator._interiorCells.size());
+  for (int i=0; i < numInteriorCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(_TestIntegratorElasticity::interiorCells[i], integrator._interiorCells[i]);
+  } // for
+
+  // Subsets are disjoint and together cover the material cells.
+  int_array count(0, numCells);
+  for (int i=0; i < numBoundaryCells; ++i) {
+    CPPUNIT_ASSERT(integrator._boundaryCells[i] >= 0 && integrator._boundaryCells[i] < numCells);
+    ++count[integrator._boundaryCells[i]];
+  } // for
+  for (int i=0; i < numInteriorCells; ++i) {
+    CPPUNIT_ASSERT(integrator._interiorCells[i] >= 0 && integrator._interiorCells[i] < numCells);
+    ++count[integrator._interiorCells[i]];
+  } // for
+  for (int i=0; i < numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(1, count[i]);
+  } // for
+
+  PetscErrorCode err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // testSetupCellPartition
+
+// ----------------------------------------------------------------------
+// Test _residualCells().
+void
+pylith::feassemble::TestIntegratorElasticity::testResidualCells(void)
+{ // testResidualCells
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = NULL;
+  _createMesh(&dmMesh);
+
+  ElasticityExplicit integrator;
+  const bool includeOnlyCells = true;
+  integrator._materialIS = new topology::StratumIS(dmMesh, "material-id", _TestIntegratorElasticity::materialId, includeOnlyCells);
+
+  PetscInt numCells = 0;
+  const int* cells = 0;
+
+  // Empty subset of boundary cells when no points are shared.
+  integrator._setupCellPartition(dmMesh);
+  integrator.cellSubset(Integrator::BOUNDARY_CELLS);
+  cells = integrator._residualCells(&numCells);
+  CPPUNIT_ASSERT(!cells);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), numCells);
+  integrator.cellSubset(Integrator::ALL_CELLS);
+
+  _setSharedVertices(dmMesh, _TestIntegratorElasticity::sharedLeaf, _TestIntegratorElasticity::sharedRoot);
+  integrator._setupCellPartition(dmMesh);
+
+  // Default is all cells in index set order.
+  cells = integrator._residualCells(&numCells);
+  CPPUNIT_ASSERT(!cells);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(_TestIntegratorElasticity::numMaterialCells), numCells);
+
+  integrator.cellSubset(Integrator::BOUNDARY_CELLS);
+  cells = integrator._residualCells(&numCells);
+  CPPUNIT_ASSERT(cells);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(_TestIntegratorElasticity::numBoundaryCells), numCells);
+  for (int i=0; i < numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(_TestIntegratorElasticity::boundaryCells[i], cells[i]);
+  } // for
+
+  integrator.cellSubset(Integrator::INTERIOR_CELLS);
+  cells = integrator._residualCells(&numCells);
+  CPPUNIT_ASSERT(cells);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(_TestIntegratorElasticity::numInteriorCells), numCells);
+  for (int i=0; i < numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(_TestIntegratorElasticity::interiorCells[i], cells[i]);
+  } // for
+
+  integrator.cellSubset(Integrator::ALL_CELLS);
+  cells = integrator._residualCells(&numCells);
+  CPPUNIT_ASSERT(!cells);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(_TestIntegratorElasticity::numMaterialCells), numCells);
+
+  PetscErrorCode err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // testResidualCells
+
+// ----------------------------------------------------------------------
+// Create mesh with two materials for testing cell partition.
+void
+pylith::feassemble::TestIntegratorElasticity::_createMesh(PetscDM* dmMesh)
+{ // _createMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(dmMesh);
+
+  const int cellDim = 2;
+  const int spaceDim = 2;
+  const PetscBool interpolate = PETSC_TRUE;
+  PetscErrorCode err;
+  err = DMPlexCreateFromCellList(PETSC_COMM_WORLD, cellDim, _TestIntegratorElasticity::numCells, _TestIntegratorElasticity::numVertices, _TestIntegratorElasticity::numCorners, interpolate, _TestIntegratorElasticity::cells, spaceDim, _TestIntegratorElasticity::vertices, dmMesh);PYLITH_CHECK_ERROR(err);
+
+  PetscInt cStart, cEnd;
+  err = DMPlexGetHeightStratum(*dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(_TestIntegratorElasticity::numCells), cEnd-cStart);
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    err = DMSetLabelValue(*dmMesh, "material-id", c, _TestIntegratorElasticity::materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _createMesh
+
+// ----------------------------------------------------------------------
+// Mark points as shared with other processes.
+void
+pylith::feassemble::TestIntegratorElasticity::_setSharedVertices(PetscDM dmMesh,
+								 const int leaf,
+								 const int root)
+{ // _setSharedVertices
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(dmMesh);
+
+  PetscErrorCode err;
+  PetscInt pStart, pEnd, vStart, vEnd;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(leaf >= 0 && vStart+leaf < vEnd);
+  CPPUNIT_ASSERT(root >= 0 && vStart+root < vEnd);
+
+  // Point star forest with a single ghost vertex whose owner is
+  // another vertex on this process.
+  const PetscInt numLeaves = 1;
+  PetscInt localPoints[numLeaves] = { vStart+leaf };
+  PetscSFNode remotePoints[numLeaves];
+  remotePoints[0].rank = 0;
+  remotePoints[0].index = vStart+root;
+
+  PetscSF sf = NULL;
+  err = PetscSFCreate(PetscObjectComm((PetscObject) dmMesh), &sf);PYLITH_CHECK_ERROR(err);
+  err = PetscSFSetGraph(sf, pEnd-pStart, numLeaves, localPoints, PETSC_COPY_VALUES, remotePoints, PETSC_COPY_VALUES);PYLITH_CHECK_ERROR(err);
+  err = DMSetPointSF(dmMesh, sf);PYLITH_CHECK_ERROR(err);
+  err = PetscSFDestroy(&sf);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setSharedVertices
+
+
 // End of file 
@@ -29,6 +29,8 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
 /// Namespace for pylith package
 namespace pylith {
   namespace feassemble {
@@ -45,6 +47,8 @@ class pylith::feassemble::TestIntegratorElasticity : public CppUnit::TestFixture
 
   CPPUNIT_TEST( testCalcTotalStrain2D );
   CPPUNIT_TEST( testCalcTotalStrain3D );
+  CPPUNIT_TEST( testSetupCellPartition );
+  CPPUNIT_TEST( testResidualCells );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -57,6 +61,34 @@ public :
   /// Test calcTotalStrain3D().
   void testCalcTotalStrain3D(void);
 
+  /// Test _setupCellPartition().
+  void testSetupCellPartition(void);
+
+  /// Test _residualCells().
+  void testResidualCells(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create mesh with two materials for testing cell partition.
+   *
+   * @param dmMesh PETSc DM for mesh (output).
+   */
+  static
+  void _createMesh(PetscDM* dmMesh);
+
+  /** Mark points as shared with other processes by setting the point
+   * star forest of the mesh.
+   *
+   * @param dmMesh PETSc DM for mesh.
+   * @param leaf Vertex that is a ghost (leaf).
+   * @param root Vertex that owns the ghost (root).
+   */
+  static
+  void _setSharedVertices(PetscDM dmMesh,
+			  const int leaf,
+			  const int root);
+
 }; // class TestIntegratorElasticity
 
 #endif // pylith_feassemble_testintegratorelasticity_hh
@@ -800,6 +800,59 @@ pylith::friction::TestFrictionModel::test_calcFrictionDeriv(void)
   PYLITH_METHOD_END;
 } // _testCalcFrictionDeriv
 
+// ----------------------------------------------------------------------
+// Test _calcFrictionBatch() and _calcFrictionDerivBatch()
+void
+pylith::friction::TestFrictionModel::test_calcFrictionBatch(void)
+{ // test_calcFrictionBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+
+  // Transpose properties and state variables to structure-of-arrays.
+  scalar_array properties(numPropsVertex*numLocs);
+  scalar_array stateVars(numVarsVertex*numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      properties[i*numLocs+iLoc] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      stateVars[i*numLocs+iLoc] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+  const PylithScalar* propertiesPtr = (numPropsVertex > 0) ? &properties[0] : 0;
+  const PylithScalar* stateVarsPtr = (numVarsVertex > 0) ? &stateVars[0] : 0;
+
+  const PylithScalar t = 1.5;
+  scalar_array friction(numLocs);
+  scalar_array frictionDeriv(numLocs);
+  _friction->timeStep(_data->dt);
+  _friction->_calcFrictionBatch(&friction[0], t, _data->slip, _data->slipRate, _data->normalTraction, numLocs,
+				propertiesPtr, numPropsVertex, stateVarsPtr, numVarsVertex);
+  _friction->_calcFrictionDerivBatch(&frictionDeriv[0], t, _data->slip, _data->slipRate, _data->normalTraction, numLocs,
+				     propertiesPtr, numPropsVertex, stateVarsPtr, numVarsVertex);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar frictionE = _data->friction[iLoc];
+    if (0.0 != frictionE)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, friction[iLoc]/frictionE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE, friction[iLoc], tolerance);
+
+    const PylithScalar frictionDerivE = _data->frictionDeriv[iLoc];
+    if (0.0 != frictionDerivE)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionDeriv[iLoc]/frictionDerivE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionDerivE, frictionDeriv[iLoc], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_calcFrictionBatch
+
 // ----------------------------------------------------------------------
 // Test _updateStateVars()
 void
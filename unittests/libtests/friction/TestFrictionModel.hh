@@ -136,6 +136,9 @@ public :
   /// Test _calcFrictionDeriv().
   void test_calcFrictionDeriv(void);
 
+  /// Test _calcFrictionBatch() and _calcFrictionDerivBatch().
+  void test_calcFrictionBatch(void);
+
   /// Test _updateStateVars().
   void test_updateStateVars(void);
 
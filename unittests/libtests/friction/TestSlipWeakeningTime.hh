@@ -54,6 +54,7 @@ class pylith::friction::TestSlipWeakeningTime : public TestFrictionModel
   CPPUNIT_TEST( testHasPropStateVar );
   CPPUNIT_TEST( test_calcFriction );
   CPPUNIT_TEST( test_calcFrictionDeriv );
+  CPPUNIT_TEST( test_calcFrictionBatch );
   CPPUNIT_TEST( test_updateStateVars );
 
   CPPUNIT_TEST_SUITE_END();
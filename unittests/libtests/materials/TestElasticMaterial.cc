@@ -31,8 +31,13 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/materials/MaxwellPlaneStrain.hh" // USES MaxwellPlaneStrain
+#include "pylith/materials/MaxwellIsotropic3D.hh" // USES MaxwellIsotropic3D
+#include "pylith/materials/GenMaxwellPlaneStrain.hh" // USES GenMaxwellPlaneStrain
+#include "pylith/materials/GenMaxwellIsotropic3D.hh" // USES GenMaxwellIsotropic3D
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/GeometryTri2D.hh" // USES GeometryTri2D
+#include "pylith/feassemble/GeometryTet3D.hh" // USES GeometryTet3D
 
 #include "pylith/utils/array.hh" // USES scalar_array
 
@@ -42,6 +47,7 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <cstring> // USES memcpy()
+#include <cmath> // USES fabs()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestElasticMaterial );
@@ -250,6 +256,209 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
   PYLITH_METHOD_END;
 } // testRetrievePropsAndVars
 
+// ----------------------------------------------------------------------
+// Test retrievePropsAndVars() with compact storage.
+void
+pylith::materials::TestElasticMaterial::testRetrievePropsAndVarsCompact(void)
+{ // testRetrievePropsAndVarsCompact
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+
+  topology::Mesh meshCompact;
+  ElasticPlaneStrain materialCompact;
+  _initialize(&meshCompact, &materialCompact, &data, true);
+  CPPUNIT_ASSERT(materialCompact.compactStorage());
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  // Compact storage must not use more memory.
+  CPPUNIT_ASSERT(materialCompact._properties);
+  CPPUNIT_ASSERT(material._properties);
+  CPPUNIT_ASSERT(materialCompact._properties->sectionSize() + materialCompact._propertiesMaterial.size() <= size_t(material._properties->sectionSize()));
+
+  // Values retrieved from compact storage must match exactly.
+  material.createPropsAndVarsVisitors();
+  materialCompact.createPropsAndVarsVisitors();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    material.retrievePropsAndVars(cell);
+    materialCompact.retrievePropsAndVars(cell);
+
+    const scalar_array& properties = material._propertiesCell;
+    const scalar_array& propertiesCompact = materialCompact._propertiesCell;
+    CPPUNIT_ASSERT_EQUAL(properties.size(), propertiesCompact.size());
+    for (size_t i=0; i < properties.size(); ++i)
+      CPPUNIT_ASSERT_EQUAL(properties[i], propertiesCompact[i]);
+
+    const scalar_array& initialStress = material._initialStressCell;
+    const scalar_array& initialStressCompact = materialCompact._initialStressCell;
+    CPPUNIT_ASSERT_EQUAL(initialStress.size(), initialStressCompact.size());
+    for (size_t i=0; i < initialStress.size(); ++i)
+      CPPUNIT_ASSERT_EQUAL(initialStress[i], initialStressCompact[i]);
+
+    const scalar_array& initialStrain = material._initialStrainCell;
+    const scalar_array& initialStrainCompact = materialCompact._initialStrainCell;
+    CPPUNIT_ASSERT_EQUAL(initialStrain.size(), initialStrainCompact.size());
+    for (size_t i=0; i < initialStrain.size(); ++i)
+      CPPUNIT_ASSERT_EQUAL(initialStrain[i], initialStrainCompact[i]);
+  } // for
+  material.destroyPropsAndVarsVisitors();
+  materialCompact.destroyPropsAndVarsVisitors();
+
+  PYLITH_METHOD_END;
+} // testRetrievePropsAndVarsCompact
+
+// ----------------------------------------------------------------------
+// Test state variables stored in single precision.
+void
+pylith::materials::TestElasticMaterial::testReducedPrecision(void)
+{ // testReducedPrecision
+  PYLITH_METHOD_BEGIN;
+
+  ElasticPlaneStrainData data;
+  const char* dbFilename = "data/matinitialize_viscous.spatialdb";
+
+  topology::Mesh mesh;
+  MaxwellPlaneStrain material;
+  _initialize(&mesh, &material, &data, false, dbFilename);
+
+  topology::Mesh meshReduced;
+  MaxwellPlaneStrain materialReduced;
+  materialReduced.reducedPrecision(true);
+  _initialize(&meshReduced, &materialReduced, &data, false, dbFilename);
+  CPPUNIT_ASSERT(materialReduced.reducedPrecision());
+
+  // State variables are not held in double precision.
+  CPPUNIT_ASSERT(material._stateVars);
+  CPPUNIT_ASSERT(materialReduced._stateVars);
+  CPPUNIT_ASSERT(!materialReduced._stateVars->localVector());
+  PetscInt stateVarsSize = 0;
+  PetscErrorCode err = VecGetLocalSize(material._stateVars->localVector(), &stateVarsSize);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(size_t(stateVarsSize), materialReduced._stateVarsReduced.size());
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  const PylithScalar dt = 0.01;
+  material.timeStep(dt);
+  materialReduced.timeStep(dt);
+
+  // Update state variables with same strains.
+  const int numQuadPts = material._numQuadPts;
+  const int tensorSize = material._tensorSize;
+  scalar_array totalStrain(numQuadPts*tensorSize);
+  material.createPropsAndVarsVisitors();
+  materialReduced.createPropsAndVarsVisitors();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    for (int i=0; i < numQuadPts*tensorSize; ++i) {
+      totalStrain[i] = 1.0e-4 * (1.0 + 0.1*i + 0.01*c);
+    } // for
+    material.retrievePropsAndVars(cell);
+    material.updateStateVars(totalStrain, cell);
+    materialReduced.retrievePropsAndVars(cell);
+    materialReduced.updateStateVars(totalStrain, cell);
+  } // for
+
+  // Values must agree to single precision.
+  const PylithScalar tolerance = 1.0e-6;
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    material.retrievePropsAndVars(cell);
+    materialReduced.retrievePropsAndVars(cell);
+
+    const scalar_array& stateVars = material._stateVarsCell;
+    const scalar_array& stateVarsReduced = materialReduced._stateVarsCell;
+    CPPUNIT_ASSERT_EQUAL(stateVars.size(), stateVarsReduced.size());
+    for (size_t i=0; i < stateVars.size(); ++i) {
+      if (fabs(stateVars[i]) > 0.0) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVarsReduced[i]/stateVars[i], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVars[i], stateVarsReduced[i], tolerance);
+      } // if/else
+    } // for
+  } // for
+  material.destroyPropsAndVarsVisitors();
+  materialReduced.destroyPropsAndVarsVisitors();
+
+  // Output of state variables.
+  topology::Field field(mesh);
+  material.getField(&field, "viscous_strain");
+  topology::Field fieldReduced(meshReduced);
+  materialReduced.getField(&fieldReduced, "viscous_strain");
+  CPPUNIT_ASSERT(!materialReduced._stateVars->localVector());
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+  topology::VecVisitorMesh fieldReducedVisitor(fieldReduced);
+  const PetscScalar* fieldReducedArray = fieldReducedVisitor.localArray();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    const PetscInt off = fieldVisitor.sectionOffset(cell);
+    const PetscInt dof = fieldVisitor.sectionDof(cell);
+    const PetscInt offReduced = fieldReducedVisitor.sectionOffset(cell);
+    CPPUNIT_ASSERT_EQUAL(dof, fieldReducedVisitor.sectionDof(cell));
+    for (PetscInt d=0; d < dof; ++d) {
+      const PylithScalar valueE = fieldArray[off+d];
+      const PylithScalar value = fieldReducedArray[offReduced+d];
+      if (fabs(valueE) > 0.0) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+      } // if/else
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testReducedPrecision
+
+// ----------------------------------------------------------------------
+// Test caching of time step coefficients.
+void
+pylith::materials::TestElasticMaterial::testTimeStepCoefs(void)
+{ // testTimeStepCoefs
+  PYLITH_METHOD_BEGIN;
+
+  { // MaxwellPlaneStrain
+    MaxwellPlaneStrain material;
+    MaxwellPlaneStrain materialE;
+    _testTimeStepCoefs(&material, &materialE, "data/matinitialize_viscous.spatialdb");
+  } // MaxwellPlaneStrain
+
+  { // MaxwellIsotropic3D
+    MaxwellIsotropic3D material;
+    MaxwellIsotropic3D materialE;
+    _testTimeStepCoefs(&material, &materialE, "data/matinitialize_viscous3d.spatialdb");
+  } // MaxwellIsotropic3D
+
+  { // GenMaxwellPlaneStrain
+    GenMaxwellPlaneStrain material;
+    GenMaxwellPlaneStrain materialE;
+    _testTimeStepCoefs(&material, &materialE, "data/matinitialize_genmaxwell.spatialdb");
+  } // GenMaxwellPlaneStrain
+
+  { // GenMaxwellIsotropic3D
+    GenMaxwellIsotropic3D material;
+    GenMaxwellIsotropic3D materialE;
+    _testTimeStepCoefs(&material, &materialE, "data/matinitialize_genmaxwell3d.spatialdb");
+  } // GenMaxwellIsotropic3D
+
+  PYLITH_METHOD_END;
+} // testTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Test calcDensity()
 void
@@ -835,12 +1044,126 @@ pylith::materials::TestElasticMaterial::setupNormalizer(void)
   PYLITH_METHOD_END;
 } // setupNormalizer
 
+// ----------------------------------------------------------------------
+// Check cached time step coefficients against values computed at each
+// quadrature point.
+void
+pylith::materials::TestElasticMaterial::_testTimeStepCoefs(ElasticMaterial* material,
+							   ElasticMaterial* materialE,
+							   const char* dbFilename)
+{ // _testTimeStepCoefs
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(material);
+  CPPUNIT_ASSERT(materialE);
+
+  ElasticPlaneStrainData data;
+  topology::Mesh mesh;
+  _initialize(&mesh, material, &data, false, dbFilename);
+  topology::Mesh meshE;
+  _initialize(&meshE, materialE, &data, false, dbFilename);
+
+  const int numCoefsQuadPt = material->_numCoefsQuadPt;
+  CPPUNIT_ASSERT(numCoefsQuadPt > 0);
+  CPPUNIT_ASSERT(material->_numVarsQuadPt > 0);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  const int numQuadPts = material->_numQuadPts;
+  const int tensorSize = material->_tensorSize;
+  const int numPropsQuadPt = material->_numPropsQuadPt;
+  scalar_array totalStrain(numQuadPts*tensorSize);
+  scalar_array coefsE(numCoefsQuadPt);
+
+  // Change the time step between updates and return to the original
+  // time step. The reference material computes the coefficients at
+  // each quadrature point instead of using the cached values.
+  const PylithScalar timeSteps[] = { 1.0e+7, 2.5e+7, 1.0e+7 };
+  const int numTimeSteps = 3;
+  const PylithScalar tolerance = 1.0e-10;
+  for (int iStep=0; iStep < numTimeSteps; ++iStep) {
+    const PylithScalar dt = timeSteps[iStep];
+    material->timeStep(dt);
+    materialE->timeStep(dt);
+
+    material->createPropsAndVarsVisitors();
+    materialE->createPropsAndVarsVisitors();
+    CPPUNIT_ASSERT(material->_timeStepCoefs);
+    CPPUNIT_ASSERT_EQUAL(dt, material->_timeStepCoefsDt);
+
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
+      for (int i=0; i < numQuadPts*tensorSize; ++i) {
+	totalStrain[i] = 1.0e-4 * (1.0 + 0.1*i + 0.01*c + 0.5*iStep);
+      } // for
+
+      material->retrievePropsAndVars(cell);
+      CPPUNIT_ASSERT(material->_haveTimeStepCoefsCell);
+      materialE->retrievePropsAndVars(cell);
+      materialE->_haveTimeStepCoefsCell = false;
+
+      // Cached coefficients correspond to current time step.
+      const scalar_array& coefs = material->_timeStepCoefsCell;
+      CPPUNIT_ASSERT_EQUAL(size_t(numQuadPts*numCoefsQuadPt), coefs.size());
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+	materialE->_calcTimeStepCoefs(&coefsE[0], numCoefsQuadPt, &materialE->_propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt);
+	for (int i=0; i < numCoefsQuadPt; ++i) {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, coefs[iQuad*numCoefsQuadPt+i]/coefsE[i], tolerance);
+	} // for
+      } // for
+
+      const scalar_array& stress = material->calcStress(totalStrain, true);
+      const scalar_array& stressE = materialE->calcStress(totalStrain, true);
+      CPPUNIT_ASSERT_EQUAL(stressE.size(), stress.size());
+      for (size_t i=0; i < stressE.size(); ++i) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stressE[i], stress[i], tolerance*fabs(stressE[i]));
+      } // for
+
+      const scalar_array& elasticConsts = material->calcDerivElastic(totalStrain);
+      const scalar_array& elasticConstsE = materialE->calcDerivElastic(totalStrain);
+      CPPUNIT_ASSERT_EQUAL(elasticConstsE.size(), elasticConsts.size());
+      for (size_t i=0; i < elasticConstsE.size(); ++i) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(elasticConstsE[i], elasticConsts[i], tolerance*fabs(elasticConstsE[i]));
+      } // for
+
+      material->updateStateVars(totalStrain, cell);
+      materialE->updateStateVars(totalStrain, cell);
+    } // for
+
+    // State variables updated with cached coefficients must match.
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
+      material->retrievePropsAndVars(cell);
+      materialE->retrievePropsAndVars(cell);
+
+      const scalar_array& stateVars = material->_stateVarsCell;
+      const scalar_array& stateVarsE = materialE->_stateVarsCell;
+      CPPUNIT_ASSERT_EQUAL(stateVarsE.size(), stateVars.size());
+      for (size_t i=0; i < stateVarsE.size(); ++i) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsE[i], stateVars[i], tolerance*fabs(stateVarsE[i]));
+      } // for
+    } // for
+
+    material->destroyPropsAndVarsVisitors();
+    materialE->destroyPropsAndVarsVisitors();
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Setup mesh and material.
 void
 pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
-						    ElasticPlaneStrain* material,
-						    const ElasticPlaneStrainData* data)
+						    ElasticMaterial* material,
+						    const ElasticPlaneStrainData* data,
+						    const bool compactStorage,
+						    const char* dbFilename)
 { // _initialize
   PYLITH_METHOD_BEGIN;
 
@@ -848,8 +1171,11 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
   CPPUNIT_ASSERT(material);
   CPPUNIT_ASSERT(data);
 
+  const int dim = material->dimension();
+  CPPUNIT_ASSERT(2 == dim || 3 == dim);
+
   meshio::MeshIOAscii iohandler;
-  iohandler.filename("data/tri3.mesh");
+  iohandler.filename((3 == dim) ? "data/tet4.mesh" : "data/tri3.mesh");
   iohandler.read(mesh);
 
   // Setup coordinates.
@@ -868,36 +1194,65 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
 
   // Setup quadrature
   feassemble::Quadrature quadrature;
-  feassemble::GeometryTri2D geometry;
-  quadrature.refGeometry(&geometry);
-  const int cellDim = 2;
-  const int numCorners = 3;
-  const int numQuadPts = 2;
-  const int spaceDim = 2;
-  const PylithScalar basis[numQuadPts*numCorners] = {
-    1.0/6.0, 1.0/3.0, 1.0/2.0,
-    1.0/6.0, 1.0/2.0, 1.0/3.0,
-  };
-  const PylithScalar basisDeriv[numQuadPts*numCorners*cellDim] = { 
-    -0.5, 0.5,
-    -0.5, 0.0,
-     0.0, 0.5,
-    -0.5, 0.5,
-    -0.5, 0.0,
-     0.0, 0.5,
-  };
-  const PylithScalar quadPtsRef[numQuadPts*spaceDim] = { 
-    -1.0/3.0,        0,
-           0, -1.0/3.0,
-  };
-  const PylithScalar quadWts[numQuadPts] = {
-    1.0, 1.0,
-  };
-  quadrature.initialize(basis, numQuadPts, numCorners,
-			basisDeriv, numQuadPts, numCorners, cellDim,
-			quadPtsRef, numQuadPts, cellDim,
-			quadWts, numQuadPts,
-			spaceDim);
+  if (2 == dim) {
+    feassemble::GeometryTri2D geometry;
+    quadrature.refGeometry(&geometry);
+    const int cellDim = 2;
+    const int numCorners = 3;
+    const int numQuadPts = 2;
+    const int spaceDim = 2;
+    const PylithScalar basis[numQuadPts*numCorners] = {
+      1.0/6.0, 1.0/3.0, 1.0/2.0,
+      1.0/6.0, 1.0/2.0, 1.0/3.0,
+    };
+    const PylithScalar basisDeriv[numQuadPts*numCorners*cellDim] = { 
+      -0.5, 0.5,
+      -0.5, 0.0,
+       0.0, 0.5,
+      -0.5, 0.5,
+      -0.5, 0.0,
+       0.0, 0.5,
+    };
+    const PylithScalar quadPtsRef[numQuadPts*spaceDim] = { 
+      -1.0/3.0,        0,
+             0, -1.0/3.0,
+    };
+    const PylithScalar quadWts[numQuadPts] = {
+      1.0, 1.0,
+    };
+    quadrature.initialize(basis, numQuadPts, numCorners,
+			  basisDeriv, numQuadPts, numCorners, cellDim,
+			  quadPtsRef, numQuadPts, cellDim,
+			  quadWts, numQuadPts,
+			  spaceDim);
+  } else {
+    feassemble::GeometryTet3D geometry;
+    quadrature.refGeometry(&geometry);
+    const int cellDim = 3;
+    const int numCorners = 4;
+    const int numQuadPts = 1;
+    const int spaceDim = 3;
+    const PylithScalar basis[numQuadPts*numCorners] = {
+      0.25, 0.25, 0.25, 0.25,
+    };
+    const PylithScalar basisDeriv[numQuadPts*numCorners*cellDim] = { 
+      -0.5, -0.5, -0.5,
+       0.5,  0.0,  0.0,
+       0.0,  0.5,  0.0,
+       0.0,  0.0,  0.5,
+    };
+    const PylithScalar quadPtsRef[numQuadPts*spaceDim] = { 
+      -0.5, -0.5, -0.5,
+    };
+    const PylithScalar quadWts[numQuadPts] = {
+      4.0/3.0,
+    };
+    quadrature.initialize(basis, numQuadPts, numCorners,
+			  basisDeriv, numQuadPts, numCorners, cellDim,
+			  quadPtsRef, numQuadPts, cellDim,
+			  quadWts, numQuadPts,
+			  spaceDim);
+  } // if/else
 
   // Get cells associated with material
   const int materialId = 24;
@@ -919,7 +1274,7 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
 
   spatialdata::spatialdb::SimpleDB db;
   spatialdata::spatialdb::SimpleIOAscii dbIO;
-  dbIO.filename("data/matinitialize.spatialdb");
+  dbIO.filename(dbFilename);
   db.ioHandler(&dbIO);
   db.queryType(spatialdata::spatialdb::SimpleDB::NEAREST);
   
@@ -939,8 +1294,11 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
   material->id(materialId);
   material->label("my_material");
   material->normalizer(normalizer);
-  material->dbInitialStress(&dbStress);
-  material->dbInitialStrain(&dbStrain);
+  if (2 == dim) {
+    material->dbInitialStress(&dbStress);
+    material->dbInitialStrain(&dbStrain);
+  } // if
+  material->compactStorage(compactStorage);
   
   material->initialize(*mesh, &quadrature);
 
@@ -51,6 +51,9 @@ class pylith::materials::TestElasticMaterial : public TestMaterial
   CPPUNIT_TEST( testDBInitialStrain );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testRetrievePropsAndVars );
+  CPPUNIT_TEST( testRetrievePropsAndVarsCompact );
+  CPPUNIT_TEST( testReducedPrecision );
+  CPPUNIT_TEST( testTimeStepCoefs );
   CPPUNIT_TEST( testCalcDensity );
   CPPUNIT_TEST( testCalcStress );
   CPPUNIT_TEST( testCalcDerivElastic );
@@ -75,6 +78,16 @@ public :
   /// Test retrievePropsAndVars().
   void testRetrievePropsAndVars(void);
 
+  /// Test retrievePropsAndVars() with compact storage.
+  void testRetrievePropsAndVarsCompact(void);
+
+  /// Test retrievePropsAndVars(), updateStateVars(), and getField()
+  /// with state variables stored in single precision.
+  void testReducedPrecision(void);
+
+  /// Test caching of time step coefficients in viscoelastic materials.
+  void testTimeStepCoefs(void);
+
   /// Test calcDensity()
   void testCalcDensity(void);
 
@@ -139,15 +152,33 @@ protected :
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  /** Setup mesh and material.
+  /** Check time step coefficients cached for all material cells
+   * against values computed at each quadrature point when computing
+   * stresses, elastic constants, and state variables over several
+   * time steps.
+   *
+   * @param material Elastic material using cached coefficients.
+   * @param materialE Elastic material of same type for reference values.
+   * @param dbFilename Filename of spatial database for properties.
+   */
+  void _testTimeStepCoefs(ElasticMaterial* material,
+			  ElasticMaterial* materialE,
+			  const char* dbFilename);
+
+  /** Setup mesh and material. Materials with a spatial dimension of
+   * 3 use a tetrahedral mesh without initial stresses or strains.
    *
    * @param mesh Finite-element mesh.
    * @param material Elastic material.
    * @param data Data with properties for elastic material.
+   * @param compactStorage True to use compact storage of properties.
+   * @param dbFilename Filename of spatial database for properties.
    */
   void _initialize(topology::Mesh* mesh,
-		   ElasticPlaneStrain* material,
-		   const ElasticPlaneStrainData* data);
+		   ElasticMaterial* material,
+		   const ElasticPlaneStrainData* data,
+		   const bool compactStorage =false,
+		   const char* dbFilename ="data/matinitialize.spatialdb");
 
 }; // class TestElasticMaterial
 
@@ -0,0 +1,139 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestAsciiTokenizer.hh" // Implementation of class methods
+
+#include "pylith/meshio/AsciiTokenizer.hh" // USES AsciiTokenizer
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::runtime_error
+#include <cstdlib> // USES strtod()
+#include <cstring> // USES memcmp()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestAsciiTokenizer );
+
+// ----------------------------------------------------------------------
+// Test open() and close().
+void
+pylith::meshio::TestAsciiTokenizer::testOpenClose(void)
+{ // testOpenClose
+  PYLITH_METHOD_BEGIN;
+
+  AsciiTokenizer tokenizer;
+  CPPUNIT_ASSERT_EQUAL(size_t(0), tokenizer.size());
+
+  tokenizer.open("data/tokenizer.txt");
+  CPPUNIT_ASSERT(tokenizer.size() > 0);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), tokenizer.position());
+
+  tokenizer.close();
+  CPPUNIT_ASSERT_EQUAL(size_t(0), tokenizer.size());
+
+  CPPUNIT_ASSERT_THROW(tokenizer.open("data/nonexistent.txt"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testOpenClose
+
+// ----------------------------------------------------------------------
+// Test next(), expect(), restOfLine(), readInt(), and readScalar().
+void
+pylith::meshio::TestAsciiTokenizer::testRead(void)
+{ // testRead
+  PYLITH_METHOD_BEGIN;
+
+  AsciiTokenizer tokenizer;
+  tokenizer.open("data/tokenizer.txt");
+
+  std::string token;
+  CPPUNIT_ASSERT(tokenizer.next(&token));
+  CPPUNIT_ASSERT_EQUAL(std::string("settings"), token);
+  tokenizer.expect("=");
+  tokenizer.expect("{");
+
+  tokenizer.expect("name");
+  tokenizer.expect("=");
+  CPPUNIT_ASSERT_EQUAL(std::string("station A"), tokenizer.restOfLine());
+
+  tokenizer.expect("COUNT");
+  tokenizer.expect("=");
+  CPPUNIT_ASSERT_EQUAL(3, tokenizer.readInt());
+
+  tokenizer.expect("integers");
+  tokenizer.expect("=");
+  tokenizer.expect("{");
+  const int numIntegers = 4;
+  const int integersE[numIntegers] = { 0, -12, 345, 2147483647 };
+  for (int i=0; i < numIntegers; ++i) {
+    CPPUNIT_ASSERT_EQUAL(integersE[i], tokenizer.readInt());
+  } // for
+  tokenizer.expect("}");
+
+  tokenizer.expect("scalars");
+  tokenizer.expect("=");
+  tokenizer.expect("{");
+  // Values must match strtod() bit for bit. The last values exceed
+  // the mantissa or exponent ranges of the exact fast path and use
+  // the strtod() fallback.
+  const int numScalars = 16;
+  const char* scalarsE[numScalars] = {
+    "1.0", "-2.5e+3", "3.25E-02",
+    "0.1", ".5", "-7.", "1.2345678901234567890123e+10", "6.02214076e23", "-0.0",
+    "1.0e-30", "123456789012345678901234", "1e22", "1e23", "9007199254740993",
+    "2.2250738585072014e-308", "4.9e-324",
+  };
+  for (int i=0; i < numScalars; ++i) {
+    const PylithScalar value = tokenizer.readScalar();
+    const PylithScalar valueE = strtod(scalarsE[i], 0);
+    CPPUNIT_ASSERT_MESSAGE(scalarsE[i], 0 == memcmp(&valueE, &value, sizeof(value)));
+  } // for
+  tokenizer.expect("}");
+  tokenizer.expect("}");
+
+  CPPUNIT_ASSERT(!tokenizer.next(&token));
+  CPPUNIT_ASSERT(token.empty());
+  CPPUNIT_ASSERT_EQUAL(tokenizer.size(), tokenizer.position());
+
+  PYLITH_METHOD_END;
+} // testRead
+
+// ----------------------------------------------------------------------
+// Test errors for invalid tokens and numbers.
+void
+pylith::meshio::TestAsciiTokenizer::testErrors(void)
+{ // testErrors
+  PYLITH_METHOD_BEGIN;
+
+  AsciiTokenizer tokenizer;
+  tokenizer.open("data/tokenizer.txt");
+
+  // Token does not match.
+  CPPUNIT_ASSERT_THROW(tokenizer.expect("mesh"), std::runtime_error);
+
+  // Tokens are not numbers.
+  CPPUNIT_ASSERT_THROW(tokenizer.readInt(), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(tokenizer.readScalar(), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testErrors
+
+
+// End of file 
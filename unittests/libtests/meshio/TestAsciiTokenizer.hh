@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestAsciiTokenizer.hh
+ *
+ * @brief C++ TestAsciiTokenizer object
+ *
+ * C++ unit testing for AsciiTokenizer.
+ */
+
+#if !defined(pylith_meshio_testasciitokenizer_hh)
+#define pylith_meshio_testasciitokenizer_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestAsciiTokenizer;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for AsciiTokenizer
+class pylith::meshio::TestAsciiTokenizer : public CppUnit::TestFixture
+{ // class TestAsciiTokenizer
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestAsciiTokenizer );
+
+  CPPUNIT_TEST( testOpenClose );
+  CPPUNIT_TEST( testRead );
+  CPPUNIT_TEST( testErrors );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test open() and close().
+  void testOpenClose(void);
+
+  /// Test next(), expect(), restOfLine(), readInt(), and readScalar().
+  void testRead(void);
+
+  /// Test errors for invalid tokens and numbers.
+  void testErrors(void);
+
+}; // class TestAsciiTokenizer
+
+#endif // pylith_meshio_testasciitokenizer_hh
+
+
+// End of file 
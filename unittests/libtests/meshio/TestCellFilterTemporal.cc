@@ -0,0 +1,512 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestCellFilterTemporal.hh" // Implementation of class methods
+
+#include "pylith/meshio/CellFilterTemporal.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+
+#include <algorithm> // USES std::max(), std::min()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestCellFilterTemporal );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _TestCellFilterTemporal {
+      const char* filename = "data/quad4.mesh";
+      const int ncells = 2;
+      const char* label = "field data";
+      const PylithScalar fieldScale = 2.0;
+
+      // Quadrature with 2 points (values are averaged using weights).
+      const int cellDim = 2;
+      const int numBasis = 4;
+      const int numQuadPts = 2;
+      const int spaceDim = 2;
+      const PylithScalar basis[numQuadPts*numBasis] = {
+	1.0, 1.0, 1.0, 1.0,
+	1.0, 1.0, 1.0, 1.0,
+      };
+      const PylithScalar basisDerivRef[numQuadPts*numBasis*cellDim] = {
+	1.0, 1.0, 1.0, 1.0,
+	1.0, 1.0, 1.0, 1.0,
+	1.0, 1.0, 1.0, 1.0,
+	1.0, 1.0, 1.0, 1.0,
+      };
+      const PylithScalar quadPtsRef[numQuadPts*cellDim] = {
+	1.0, 0.0,
+	-1.0, 0.0,
+      };
+      const PylithScalar quadWts[numQuadPts] = { 1.5, 0.5 };
+
+      // Values at quadrature points in each cell for 3 time steps.
+      const int fiberDim = numQuadPts;
+      const PylithScalar fieldValuesA[ncells*fiberDim] = {
+	1.1, 1.2,
+	2.1, 2.2,
+      };
+      const PylithScalar fieldValuesB[ncells*fiberDim] = {
+	1.0, 3.0,
+	-0.5, 4.0,
+      };
+      const PylithScalar fieldValuesC[ncells*fiberDim] = {
+	2.0, 0.0,
+	0.3, -1.0,
+      };
+      const PylithScalar tA = 0.5;
+      const PylithScalar tB = 1.5;
+      const PylithScalar tC = 2.5;
+
+      // Values averaged over quadrature points.
+      const int fiberDimAvg = 1;
+      const PylithScalar avgValuesA[ncells] = {
+	(1.5*1.1 + 0.5*1.2) / 2.0,
+	(1.5*2.1 + 0.5*2.2) / 2.0,
+      };
+      const PylithScalar avgValuesB[ncells] = {
+	(1.5*1.0 + 0.5*3.0) / 2.0,
+	(1.5*-0.5 + 0.5*4.0) / 2.0,
+      };
+      const PylithScalar avgValuesC[ncells] = {
+	(1.5*2.0 + 0.5*0.0) / 2.0,
+	(1.5*0.3 + 0.5*-1.0) / 2.0,
+      };
+    } // _TestCellFilterTemporal
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestCellFilterTemporal::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  CellFilterTemporal filter;
+  CPPUNIT_ASSERT_EQUAL(0, filter.numReduced());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test reduction()
+void
+pylith::meshio::TestCellFilterTemporal::testReduction(void)
+{ // testReduction
+  PYLITH_METHOD_BEGIN;
+
+  CellFilterTemporal filter;
+  filter.reduction("min");
+  filter.reduction("RMS");
+  CPPUNIT_ASSERT_THROW(filter.reduction("sum"), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(filter.timeScale(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testReduction
+
+// ----------------------------------------------------------------------
+// Test filter() with maximum of values averaged over quadrature points.
+void
+pylith::meshio::TestCellFilterTemporal::testFilterMax(void)
+{ // testFilterMax
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestCellFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  _createField(&field);
+
+  feassemble::Quadrature quadrature;
+  _initQuadrature(&quadrature);
+
+  CellFilterTemporal filter;
+  filter.quadrature(&quadrature);
+  filter.reduction("max");
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesA);
+  filter.update(_TestCellFilterTemporal::tA, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesB);
+  filter.update(_TestCellFilterTemporal::tB, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesC);
+  filter.update(_TestCellFilterTemporal::tC, field);
+  CPPUNIT_ASSERT_EQUAL(1, filter.numReduced());
+
+  const topology::Field& fieldMax = filter.filter(field);
+  CPPUNIT_ASSERT_EQUAL(topology::FieldBase::SCALAR, fieldMax.vectorFieldType());
+  CPPUNIT_ASSERT_EQUAL(std::string(_TestCellFilterTemporal::label), std::string(fieldMax.label()));
+  CPPUNIT_ASSERT_EQUAL(_TestCellFilterTemporal::fieldScale, fieldMax.scale());
+
+  // Maximum of averages, which differs from the average of the
+  // maximum values at the quadrature points.
+  const int ncells = _TestCellFilterTemporal::ncells;
+  PylithScalar valuesE[ncells];
+  for (int i=0; i < ncells; ++i) {
+    valuesE[i] = std::max(std::max(_TestCellFilterTemporal::avgValuesA[i], _TestCellFilterTemporal::avgValuesB[i]), _TestCellFilterTemporal::avgValuesC[i]);
+  } // for
+  _checkField(fieldMax, _TestCellFilterTemporal::fiberDimAvg, valuesE);
+
+  // Reduced field is also available by index.
+  _checkField(filter.reduced(0), _TestCellFilterTemporal::fiberDimAvg, valuesE);
+
+  PYLITH_METHOD_END;
+} // testFilterMax
+
+// ----------------------------------------------------------------------
+// Test filter() with mean of values averaged over quadrature points.
+void
+pylith::meshio::TestCellFilterTemporal::testFilterMean(void)
+{ // testFilterMean
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestCellFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  _createField(&field);
+
+  feassemble::Quadrature quadrature;
+  _initQuadrature(&quadrature);
+
+  CellFilterTemporal filter;
+  filter.quadrature(&quadrature);
+  filter.reduction("mean");
+
+  const int ncells = _TestCellFilterTemporal::ncells;
+  PylithScalar valuesE[ncells];
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesA);
+  filter.update(_TestCellFilterTemporal::tA, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesB);
+  filter.update(_TestCellFilterTemporal::tB, field);
+
+  // Mean after two time steps.
+  for (int i=0; i < ncells; ++i) {
+    valuesE[i] = (_TestCellFilterTemporal::avgValuesA[i] + _TestCellFilterTemporal::avgValuesB[i]) / 2.0;
+  } // for
+  _checkField(filter.filter(field), _TestCellFilterTemporal::fiberDimAvg, valuesE);
+
+  // Mean after three time steps.
+  _setField(&field, _TestCellFilterTemporal::fieldValuesC);
+  filter.update(_TestCellFilterTemporal::tC, field);
+  for (int i=0; i < ncells; ++i) {
+    valuesE[i] = (_TestCellFilterTemporal::avgValuesA[i] + _TestCellFilterTemporal::avgValuesB[i] + _TestCellFilterTemporal::avgValuesC[i]) / 3.0;
+  } // for
+  const topology::Field& fieldMean = filter.filter(field);
+  CPPUNIT_ASSERT_EQUAL(topology::FieldBase::SCALAR, fieldMean.vectorFieldType());
+  CPPUNIT_ASSERT_EQUAL(_TestCellFilterTemporal::fieldScale, fieldMean.scale());
+  CPPUNIT_ASSERT(fieldMean.dimensionalizeOkay());
+  _checkField(fieldMean, _TestCellFilterTemporal::fiberDimAvg, valuesE);
+
+  PYLITH_METHOD_END;
+} // testFilterMean
+
+// ----------------------------------------------------------------------
+// Test filter() with threshold time of values averaged over quadrature
+// points.
+void
+pylith::meshio::TestCellFilterTemporal::testFilterThresholdTime(void)
+{ // testFilterThresholdTime
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestCellFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  _createField(&field);
+
+  feassemble::Quadrature quadrature;
+  _initQuadrature(&quadrature);
+
+  const PylithScalar timeScale = 4.0;
+  CellFilterTemporal filter;
+  filter.quadrature(&quadrature);
+  filter.reduction("threshold_time");
+  filter.threshold(2.0*_TestCellFilterTemporal::fieldScale);
+  filter.timeScale(timeScale);
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesA);
+  filter.update(_TestCellFilterTemporal::tA, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesB);
+  filter.update(_TestCellFilterTemporal::tB, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesC);
+  filter.update(_TestCellFilterTemporal::tC, field);
+
+  const topology::Field& fieldTime = filter.filter(field);
+  CPPUNIT_ASSERT_EQUAL(topology::FieldBase::SCALAR, fieldTime.vectorFieldType());
+  CPPUNIT_ASSERT_EQUAL(timeScale, fieldTime.scale());
+
+  // Averages: A = {1.125, 2.125}, B = {1.5, 0.625}, C = {1.5, -0.025}
+  // Cell 0 never exceeds the threshold even though values at its
+  // quadrature points do.
+  const PylithScalar notExceeded = -1.0 / timeScale;
+  const PylithScalar valuesE[_TestCellFilterTemporal::ncells] = {
+    notExceeded, _TestCellFilterTemporal::tA,
+  };
+  _checkField(fieldTime, 1, valuesE);
+
+  PYLITH_METHOD_END;
+} // testFilterThresholdTime
+
+// ----------------------------------------------------------------------
+// Test filter() without quadrature.
+void
+pylith::meshio::TestCellFilterTemporal::testFilterNoQuadrature(void)
+{ // testFilterNoQuadrature
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestCellFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  _createField(&field);
+
+  CellFilterTemporal filter;
+  filter.reduction("min");
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesA);
+  filter.update(_TestCellFilterTemporal::tA, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesB);
+  filter.update(_TestCellFilterTemporal::tB, field);
+
+  const topology::Field& fieldMin = filter.filter(field);
+  CPPUNIT_ASSERT_EQUAL(topology::FieldBase::MULTI_SCALAR, fieldMin.vectorFieldType());
+
+  // Reduction is over values at the quadrature points.
+  const int size = _TestCellFilterTemporal::ncells*_TestCellFilterTemporal::fiberDim;
+  PylithScalar valuesE[size];
+  for (int i=0; i < size; ++i) {
+    valuesE[i] = std::min(_TestCellFilterTemporal::fieldValuesA[i], _TestCellFilterTemporal::fieldValuesB[i]);
+  } // for
+  _checkField(fieldMin, _TestCellFilterTemporal::fiberDim, valuesE);
+
+  PYLITH_METHOD_END;
+} // testFilterNoQuadrature
+
+// ----------------------------------------------------------------------
+// Test starting a new reduction after deallocate().
+void
+pylith::meshio::TestCellFilterTemporal::testResetDeallocate(void)
+{ // testResetDeallocate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestCellFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  _createField(&field);
+
+  feassemble::Quadrature quadrature;
+  _initQuadrature(&quadrature);
+
+  CellFilterTemporal filter;
+  filter.quadrature(&quadrature);
+  filter.reduction("mean");
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesA);
+  filter.update(_TestCellFilterTemporal::tA, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesB);
+  filter.update(_TestCellFilterTemporal::tB, field);
+  CPPUNIT_ASSERT_EQUAL(1, filter.numReduced());
+
+  // Discard accumulated values (also discards quadrature).
+  filter.deallocate();
+  CPPUNIT_ASSERT_EQUAL(0, filter.numReduced());
+  filter.quadrature(&quadrature);
+
+  // Mean includes only values after reset.
+  _setField(&field, _TestCellFilterTemporal::fieldValuesC);
+  filter.update(_TestCellFilterTemporal::tC, field);
+  CPPUNIT_ASSERT_EQUAL(1, filter.numReduced());
+  _checkField(filter.filter(field), _TestCellFilterTemporal::fiberDimAvg, _TestCellFilterTemporal::avgValuesC);
+
+  PYLITH_METHOD_END;
+} // testResetDeallocate
+
+// ----------------------------------------------------------------------
+// Test starting a new reduction with clone().
+void
+pylith::meshio::TestCellFilterTemporal::testResetClone(void)
+{ // testResetClone
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestCellFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  _createField(&field);
+
+  feassemble::Quadrature quadrature;
+  _initQuadrature(&quadrature);
+
+  CellFilterTemporal filter;
+  filter.quadrature(&quadrature);
+  filter.reduction("max");
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesA);
+  filter.update(_TestCellFilterTemporal::tA, field);
+  _setField(&field, _TestCellFilterTemporal::fieldValuesB);
+  filter.update(_TestCellFilterTemporal::tB, field);
+
+  // Copy keeps settings (reduction and quadrature) but not the
+  // accumulated values.
+  CellFilterTemporal* filterCopy = dynamic_cast<CellFilterTemporal*>(filter.clone());CPPUNIT_ASSERT(filterCopy);
+  CPPUNIT_ASSERT_EQUAL(0, filterCopy->numReduced());
+
+  _setField(&field, _TestCellFilterTemporal::fieldValuesC);
+  filterCopy->update(_TestCellFilterTemporal::tC, field);
+  CPPUNIT_ASSERT_EQUAL(1, filterCopy->numReduced());
+  _checkField(filterCopy->filter(field), _TestCellFilterTemporal::fiberDimAvg, _TestCellFilterTemporal::avgValuesC);
+  delete filterCopy; filterCopy = 0;
+
+  // Original is unaffected by updates to copy.
+  const int ncells = _TestCellFilterTemporal::ncells;
+  PylithScalar valuesE[ncells];
+  for (int i=0; i < ncells; ++i) {
+    valuesE[i] = std::max(_TestCellFilterTemporal::avgValuesA[i], _TestCellFilterTemporal::avgValuesB[i]);
+  } // for
+  _checkField(filter.reduced(0), _TestCellFilterTemporal::fiberDimAvg, valuesE);
+
+  PYLITH_METHOD_END;
+} // testResetClone
+
+// ----------------------------------------------------------------------
+// Create cell field with values at quadrature points.
+void
+pylith::meshio::TestCellFilterTemporal::_createField(topology::Field* field)
+{ // _createField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+
+  field->newSection(topology::FieldBase::CELLS_FIELD, _TestCellFilterTemporal::fiberDim);
+  field->allocate();
+  field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
+  field->label(_TestCellFilterTemporal::label);
+  field->scale(_TestCellFilterTemporal::fieldScale);
+
+  PYLITH_METHOD_END;
+} // _createField
+
+// ----------------------------------------------------------------------
+// Set values of cell field.
+void
+pylith::meshio::TestCellFilterTemporal::_setField(topology::Field* field,
+						  const PylithScalar* values)
+{ // _setField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+  CPPUNIT_ASSERT(values);
+
+  PetscDM dmMesh = field->mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(_TestCellFilterTemporal::ncells), cEnd-cStart);
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  const int fiberDim = _TestCellFilterTemporal::fiberDim;
+  for(PetscInt c = cStart, index = 0; c < cEnd; ++c) {
+    const PetscInt off = fieldVisitor.sectionOffset(c);
+    CPPUNIT_ASSERT_EQUAL(fiberDim, fieldVisitor.sectionDof(c));
+    for(PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      fieldArray[off+d] = values[index];
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _setField
+
+// ----------------------------------------------------------------------
+// Initialize quadrature.
+void
+pylith::meshio::TestCellFilterTemporal::_initQuadrature(feassemble::Quadrature* quadrature)
+{ // _initQuadrature
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(quadrature);
+
+  quadrature->initialize(_TestCellFilterTemporal::basis, _TestCellFilterTemporal::numQuadPts, _TestCellFilterTemporal::numBasis,
+			 _TestCellFilterTemporal::basisDerivRef, _TestCellFilterTemporal::numQuadPts, _TestCellFilterTemporal::numBasis, _TestCellFilterTemporal::cellDim,
+			 _TestCellFilterTemporal::quadPtsRef, _TestCellFilterTemporal::numQuadPts, _TestCellFilterTemporal::cellDim,
+			 _TestCellFilterTemporal::quadWts, _TestCellFilterTemporal::numQuadPts,
+			 _TestCellFilterTemporal::spaceDim);
+
+  PYLITH_METHOD_END;
+} // _initQuadrature
+
+// ----------------------------------------------------------------------
+// Check values of filtered field.
+void
+pylith::meshio::TestCellFilterTemporal::_checkField(const topology::Field& field,
+						    const int fiberDim,
+						    const PylithScalar* valuesE)
+{ // _checkField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(valuesE);
+
+  PetscDM dmMesh = field.mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for(PetscInt c = cStart, index = 0; c < cEnd; ++c) {
+    const PetscInt off = fieldVisitor.sectionOffset(c);
+    CPPUNIT_ASSERT_EQUAL(fiberDim, fieldVisitor.sectionDof(c));
+    for(PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[index], fieldArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkField
+
+
+// End of file
@@ -0,0 +1,125 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestCellFilterTemporal.hh
+ *
+ * @brief C++ TestCellFilterTemporal object
+ *
+ * C++ unit testing for CellFilterTemporal.
+ */
+
+#if !defined(pylith_meshio_testcellfiltertemporal_hh)
+#define pylith_meshio_testcellfiltertemporal_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+#include "pylith/feassemble/feassemblefwd.hh" // USES Quadrature
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestCellFilterTemporal;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for CellFilterTemporal
+class pylith::meshio::TestCellFilterTemporal : public CppUnit::TestFixture
+{ // class TestCellFilterTemporal
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestCellFilterTemporal );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testReduction );
+  CPPUNIT_TEST( testFilterMax );
+  CPPUNIT_TEST( testFilterMean );
+  CPPUNIT_TEST( testFilterThresholdTime );
+  CPPUNIT_TEST( testFilterNoQuadrature );
+  CPPUNIT_TEST( testResetDeallocate );
+  CPPUNIT_TEST( testResetClone );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test reduction()
+  void testReduction(void);
+
+  /// Test filter() with maximum of values averaged over quadrature points.
+  void testFilterMax(void);
+
+  /// Test filter() with mean of values averaged over quadrature points.
+  void testFilterMean(void);
+
+  /// Test filter() with threshold time of values averaged over
+  /// quadrature points.
+  void testFilterThresholdTime(void);
+
+  /// Test filter() without quadrature.
+  void testFilterNoQuadrature(void);
+
+  /// Test starting a new reduction after deallocate().
+  void testResetDeallocate(void);
+
+  /// Test starting a new reduction with clone().
+  void testResetClone(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create cell field with values at quadrature points.
+   *
+   * @param field Cell field.
+   */
+  void _createField(topology::Field* field);
+
+  /** Set values of cell field.
+   *
+   * @param field Cell field.
+   * @param values Values at quadrature points in cells.
+   */
+  void _setField(topology::Field* field,
+		 const PylithScalar* values);
+
+  /** Initialize quadrature.
+   *
+   * @param quadrature Quadrature for cells.
+   */
+  void _initQuadrature(feassemble::Quadrature* quadrature);
+
+  /** Check values of filtered field.
+   *
+   * @param field Filtered field.
+   * @param fiberDim Fiber dimension of filtered field.
+   * @param valuesE Expected values.
+   */
+  void _checkField(const topology::Field& field,
+		   const int fiberDim,
+		   const PylithScalar* valuesE);
+
+}; // class TestCellFilterTemporal
+
+#endif // pylith_meshio_testcellfiltertemporal_hh
+
+// End of file
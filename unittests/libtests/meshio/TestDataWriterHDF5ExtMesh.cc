@@ -86,6 +86,23 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::testFilename(void)
   PYLITH_METHOD_END;
 } // testFilename
 
+// ----------------------------------------------------------------------
+// Test aggregatorStride()
+void
+pylith::meshio::TestDataWriterHDF5ExtMesh::testAggregatorStride(void)
+{ // testAggregatorStride
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterHDF5Ext writer;
+  CPPUNIT_ASSERT_EQUAL(0, writer._aggregatorStride);
+
+  const int stride = 4;
+  writer.aggregatorStride(stride);
+  CPPUNIT_ASSERT_EQUAL(stride, writer._aggregatorStride);
+
+  PYLITH_METHOD_END;
+} // testAggregatorStride
+
 // ----------------------------------------------------------------------
 // Test open() and close()
 void
@@ -161,6 +178,52 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::testWriteVertexField(void)
   PYLITH_METHOD_END;
 } // testWriteVertexField
 
+// ----------------------------------------------------------------------
+// Test writeVertexField with I/O aggregation.
+void
+pylith::meshio::TestDataWriterHDF5ExtMesh::testWriteVertexFieldAggregated(void)
+{ // testWriteVertexFieldAggregated
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterHDF5Ext writer;
+  writer.aggregatorStride(1);
+
+  topology::Fields vertexFields(*_mesh);
+  _createVertexFields(&vertexFields);
+
+  writer.filename(_data->vertexFilename);
+
+  const PylithScalar timeScale = 4.0;
+  writer.timeScale(timeScale);
+  const PylithScalar t = _data->time / timeScale;
+
+  const int nfields = _data->numVertexFields;
+  const int numTimeSteps = 1;
+  if (!_data->cellsLabel) {
+    writer.open(*_mesh, numTimeSteps);
+    writer.openTimeStep(t, *_mesh);
+  } else {
+    const char* label = _data->cellsLabel;
+    const int id = _data->labelId;
+    writer.open(*_mesh, numTimeSteps, label, id);
+    writer.openTimeStep(t, *_mesh, label, id);
+  } // else
+  for (int i=0; i < nfields; ++i) {
+    topology::Field& field = vertexFields.get(_data->vertexFieldsInfo[i].name);
+    writer.writeVertexField(t, field, *_mesh);
+  } // for
+  writer.closeTimeStep();
+  writer.close();
+  
+  // Layout of external datasets is independent of aggregation.
+  checkFile(_data->vertexFilename);
+
+  PYLITH_METHOD_END;
+} // testWriteVertexFieldAggregated
+
 // ----------------------------------------------------------------------
 // Test writeCellField.
 void
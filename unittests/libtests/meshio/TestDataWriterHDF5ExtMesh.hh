@@ -50,6 +50,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMesh : public TestDataWriterHDF5,
 
   CPPUNIT_TEST( testConstructor );
   CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testAggregatorStride );
   CPPUNIT_TEST( testHdf5Filename );
   CPPUNIT_TEST( testDatasetFilename );
 
@@ -70,12 +71,18 @@ public :
   /// Test filename()
   void testFilename(void);
 
+  /// Test aggregatorStride()
+  void testAggregatorStride(void);
+
   /// Test open() and close()
   void testOpenClose(void);
 
   /// Test writeVertexField.
   void testWriteVertexField(void);
 
+  /// Test writeVertexField with I/O aggregation.
+  void testWriteVertexFieldAggregated(void);
+
   /// Test writeCellField.
   void testWriteCellField(void);
 
@@ -49,6 +49,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMeshTri3 : public TestDataWriterHDF5E
 
   CPPUNIT_TEST( testOpenClose );
   CPPUNIT_TEST( testWriteVertexField );
+  CPPUNIT_TEST( testWriteVertexFieldAggregated );
   CPPUNIT_TEST( testWriteCellField );
 
   CPPUNIT_TEST_SUITE_END();
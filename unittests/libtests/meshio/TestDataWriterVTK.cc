@@ -24,11 +24,39 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
-#include <string.h> // USES strcmp()
+#include <string.h> // USES strcmp(), memcpy()
+#include <stdint.h> // USES uint64_t, int32_t, int64_t
+#include <cmath> // USES fabs()
+#include <vector> // USES std::vector
 #include <iostream> // USES std::cerr
-#include <sstream> // USES std::ostringstream
+#include <sstream> // USES std::ostringstream, std::istringstream
 #include <fstream> // USES std::ifstream
 
+// ----------------------------------------------------------------------
+namespace _TestDataWriterVTK {
+  /** Convert raw binary data to values.
+   *
+   * @param values Array of values.
+   * @param data Raw binary data.
+   * @param numBytes Number of bytes of raw binary data.
+   */
+  template<typename T>
+  void
+  rawValues(std::vector<double>* values,
+	    const char* data,
+	    const size_t numBytes) {
+    CPPUNIT_ASSERT(values);
+    CPPUNIT_ASSERT_EQUAL(size_t(0), numBytes % sizeof(T));
+    const size_t size = numBytes / sizeof(T);
+    values->resize(size);
+    for (size_t i=0; i < size; ++i) {
+      T value;
+      memcpy(&value, data+i*sizeof(T), sizeof(T));
+      (*values)[i] = double(value);
+    } // for
+  } // rawValues
+} // _TestDataWriterVTK
+
 // ----------------------------------------------------------------------
 // Check VTK file against archived file.
 void
@@ -51,7 +79,19 @@ pylith::meshio::TestDataWriterVTK::checkFile(const char* filenameRoot,
     timestamp.erase(pos, 1);
   buffer << std::string(fileroot, 0, indexExt) << "_t" << timestamp << ".vtk";
   
-  const std::string& filename = buffer.str();
+  checkFile(buffer.str().c_str());
+
+  PYLITH_METHOD_END;
+} // checkFile
+
+// ----------------------------------------------------------------------
+// Check text file against archived file.
+void
+pylith::meshio::TestDataWriterVTK::checkFile(const char* filenameIn)
+{ // checkFile
+  PYLITH_METHOD_BEGIN;
+
+  const std::string filename(filenameIn);
   const std::string filenameE = "data/" + filename;
 
   std::ifstream fileInE(filenameE.c_str());
@@ -88,5 +128,122 @@ pylith::meshio::TestDataWriterVTK::checkFile(const char* filenameRoot,
   PYLITH_METHOD_END;
 } // checkFile
 
+// ----------------------------------------------------------------------
+// Check XML piece file with appended raw data against archived file
+// with the same data in ASCII format.
+void
+pylith::meshio::TestDataWriterVTK::checkXMLPiece(const char* filenameIn)
+{ // checkXMLPiece
+  PYLITH_METHOD_BEGIN;
+
+  const std::string filename(filenameIn);
+  const std::string filenameE = "data/" + filename;
+
+  std::ifstream fileInE(filenameE.c_str());
+  if (!fileInE.is_open()) {
+    std::cerr << "Could not open file '" << filenameE << "'." << std::endl;
+  } // if
+  CPPUNIT_ASSERT(fileInE.is_open());
+
+  std::ifstream fileIn(filename.c_str(), std::ios::in | std::ios::binary);
+  if (!fileIn.is_open()) {
+    std::cerr << "Could not open file '" << filename << "'." << std::endl;
+  } // if
+  CPPUNIT_ASSERT(fileIn.is_open());
+  std::ostringstream contents;
+  contents << fileIn.rdbuf();
+  fileIn.close();
+  const std::string& buffer = contents.str();
+
+  // XML header is followed by raw data of all data arrays.
+  const std::string appendedBegin = "  <AppendedData encoding=\"raw\">\n   _";
+  const std::string appendedEnd = "\n  </AppendedData>\n</VTKFile>\n";
+  const size_t headerSize = buffer.find(appendedBegin);
+  CPPUNIT_ASSERT(headerSize != std::string::npos);
+  const size_t rawOffset = headerSize + appendedBegin.length();
+  CPPUNIT_ASSERT(buffer.length() >= rawOffset + appendedEnd.length());
+  const size_t rawSize = buffer.length() - rawOffset - appendedEnd.length();
+  CPPUNIT_ASSERT_EQUAL(appendedEnd, buffer.substr(rawOffset+rawSize));
+  const char* rawData = buffer.c_str() + rawOffset;
+
+  // Archived file has the same XML header with the data arrays in
+  // ASCII format and no appended data.
+  std::istringstream header(buffer.substr(0, headerSize) + "</VTKFile>\n");
+  const std::string appendedFormat = " format=\"appended\" offset=\"";
+  const double tolerance = 1.0e-6;
+  std::string line;
+  std::string lineE;
+  int i = 1;
+  while (std::getline(header, line)) {
+    std::getline(fileInE, lineE);
+    const size_t posFormat = line.find(appendedFormat);
+    if (std::string::npos == posFormat) {
+      if (line != lineE) {
+	std::cerr << "Line " << i << " of file '" << filename << "' is incorrect." << std::endl;
+	CPPUNIT_ASSERT(false);
+      } // if
+      ++i;
+      continue;
+    } // if
+
+    // Data array must have the same attributes as in the archived file.
+    if (line.substr(0, posFormat) + " format=\"ascii\">" != lineE) {
+      std::cerr << "Data array on line " << i << " of file '" << filename << "' is incorrect." << std::endl;
+      CPPUNIT_ASSERT(false);
+    } // if
+    const size_t posType = line.find("type=\"") + 6;
+    const std::string type = line.substr(posType, line.find('"', posType) - posType);
+    size_t offset = 0;
+    std::istringstream(line.substr(posFormat + appendedFormat.length())) >> offset;
+
+    // Raw data is preceded by its size in bytes.
+    uint64_t numBytes = 0;
+    CPPUNIT_ASSERT(offset + sizeof(uint64_t) <= rawSize);
+    memcpy(&numBytes, rawData+offset, sizeof(uint64_t));
+    CPPUNIT_ASSERT(offset + sizeof(uint64_t) + numBytes <= rawSize);
+    const char* data = rawData + offset + sizeof(uint64_t);
+    std::vector<double> values;
+    if (type == "Float64") {
+      _TestDataWriterVTK::rawValues<double>(&values, data, numBytes);
+    } else if (type == "Float32") {
+      _TestDataWriterVTK::rawValues<float>(&values, data, numBytes);
+    } else if (type == "Int64") {
+      _TestDataWriterVTK::rawValues<int64_t>(&values, data, numBytes);
+    } else if (type == "Int32") {
+      _TestDataWriterVTK::rawValues<int32_t>(&values, data, numBytes);
+    } else if (type == "UInt8") {
+      _TestDataWriterVTK::rawValues<unsigned char>(&values, data, numBytes);
+    } else {
+      std::cerr << "Unknown type '" << type << "' of data array on line " << i << " of file '" << filename << "'." << std::endl;
+      CPPUNIT_ASSERT(false);
+    } // if/else
+
+    std::vector<double> valuesE;
+    while (std::getline(fileInE, lineE) && std::string::npos == lineE.find("</DataArray>")) {
+      std::istringstream sin(lineE);
+      double value = 0.0;
+      while (sin >> value) {
+	valuesE.push_back(value);
+      } // while
+    } // while
+
+    const size_t size = valuesE.size();
+    CPPUNIT_ASSERT_EQUAL(size, values.size());
+    for (size_t iValue=0; iValue < size; ++iValue) {
+      if (fabs(valuesE[iValue]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, values[iValue]/valuesE[iValue], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[iValue], values[iValue], tolerance);
+      } // if/else
+    } // for
+    ++i;
+  } // while
+  CPPUNIT_ASSERT(!std::getline(fileInE, lineE));
+
+  fileInE.close();
+
+  PYLITH_METHOD_END;
+} // checkXMLPiece
+
 
 // End of file 
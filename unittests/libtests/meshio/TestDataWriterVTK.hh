@@ -54,6 +54,21 @@ public :
 		 const PylithScalar t,
 		 const char* timeFormat);
   
+  /** Check text file against archived file.
+   *
+   * @param filename Name of file to check.
+   */
+  static
+  void checkFile(const char* filename);
+  
+  /** Check XML piece file with appended raw data against archived
+   * file with the same data in ASCII format.
+   *
+   * @param filename Name of file to check.
+   */
+  static
+  void checkXMLPiece(const char* filename);
+  
 }; // class TestDataWriterVTK
 
 #endif // pylith_meshio_testdatawritervtk_hh
@@ -136,6 +136,22 @@ pylith::meshio::TestDataWriterVTKMesh::testPrecision(void)
   PYLITH_METHOD_END;
 } // testPrecision
 
+// ----------------------------------------------------------------------
+// Test xmlFormat()
+void
+pylith::meshio::TestDataWriterVTKMesh::testXMLFormat(void)
+{ // testXMLFormat
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTK writer;
+  CPPUNIT_ASSERT_EQUAL(false, writer._xmlFormat);
+
+  writer.xmlFormat(true);
+  CPPUNIT_ASSERT_EQUAL(true, writer._xmlFormat);
+
+  PYLITH_METHOD_END;
+} // testXMLFormat
+
 // ----------------------------------------------------------------------
 // Test openTimeStep() and closeTimeStep()
 void
@@ -289,6 +305,58 @@ pylith::meshio::TestDataWriterVTKMesh::testWriteCellField(void)
   PYLITH_METHOD_END;
 } // testWriteCellField
 
+// ----------------------------------------------------------------------
+// Test writing vertex and cell fields to XML files.
+void
+pylith::meshio::TestDataWriterVTKMesh::testWriteXML(void)
+{ // testWriteXML
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterVTK writer;
+
+  topology::Fields vertexFields(*_mesh);
+  _createVertexFields(&vertexFields);
+  topology::Fields cellFields(*_mesh);
+  _createCellFields(&cellFields);
+
+  const std::string timestepFilename(_data->timestepFilename);
+  const std::string filename = std::string(timestepFilename, 0, timestepFilename.find(".vtk")) + "_xml.vtk";
+  writer.filename(filename.c_str());
+  writer.timeFormat(_data->timeFormat);
+  writer.xmlFormat(true);
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  const char* label = _data->cellsLabel;
+  const int id = _data->labelId;
+  writer.open(*_mesh, numTimeSteps, label, id);
+  writer.openTimeStep(t, *_mesh, label, id);
+  for (int i=0; i < _data->numVertexFields; ++i) {
+    topology::Field& field = vertexFields.get(_data->vertexFieldsInfo[i].name);
+    writer.writeVertexField(t, field, *_mesh);
+  } // for
+  for (int i=0; i < _data->numCellFields; ++i) {
+    topology::Field& field = cellFields.get(_data->cellFieldsInfo[i].name);
+    writer.writeCellField(t, field, label, id);
+  } // for
+  CPPUNIT_ASSERT_EQUAL(size_t(_data->numVertexFields), writer._vertexFieldNames.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(_data->numCellFields), writer._cellFieldNames.size());
+  writer.closeTimeStep();
+  writer.close();
+
+  // Check the piece, index, and collection files.
+  const std::string& vtkFilename = writer._vtkFilename(t);
+  const std::string root(vtkFilename, 0, vtkFilename.find(".vtk"));
+  checkXMLPiece((root + "_p0.vtu").c_str());
+  checkFile((root + ".pvtu").c_str());
+  checkFile((std::string(filename, 0, filename.find(".vtk")) + ".pvd").c_str());
+
+  PYLITH_METHOD_END;
+} // testWriteXML
+
 // ----------------------------------------------------------------------
 // Test _vtkFilename.
 void pylith::meshio::TestDataWriterVTKMesh::testVtkFilename(void)
@@ -55,6 +55,7 @@ class pylith::meshio::TestDataWriterVTKMesh : public TestDataWriterVTK,
   CPPUNIT_TEST( testTimeFormat );
   CPPUNIT_TEST( testTimeConstant );
   CPPUNIT_TEST( testPrecision );
+  CPPUNIT_TEST( testXMLFormat );
   CPPUNIT_TEST( testVtkFilename );
 
   CPPUNIT_TEST_SUITE_END();
@@ -83,6 +84,9 @@ public :
   /// Test precision()
   void testPrecision(void);
 
+  /// Test xmlFormat()
+  void testXMLFormat(void);
+
   /// Test openTimeStep() and closeTimeStep()
   void testTimeStep(void);
 
@@ -92,6 +96,9 @@ public :
   /// Test writeCellField.
   void testWriteCellField(void);
 
+  /// Test writing vertex and cell fields to XML files.
+  void testWriteXML(void);
+
   /// Test vtkFilename.
   void testVtkFilename(void);
 
@@ -50,6 +50,7 @@ class pylith::meshio::TestDataWriterVTKMeshTri3 : public TestDataWriterVTKMesh
   CPPUNIT_TEST( testTimeStep );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
+  CPPUNIT_TEST( testWriteXML );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -73,6 +74,7 @@ class pylith::meshio::TestDataWriterVTKMeshQuad4 : public TestDataWriterVTKMesh
   CPPUNIT_TEST( testTimeStep );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
+  CPPUNIT_TEST( testWriteXML );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -96,6 +98,7 @@ class pylith::meshio::TestDataWriterVTKMeshTet4 : public TestDataWriterVTKMesh
   CPPUNIT_TEST( testTimeStep );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
+  CPPUNIT_TEST( testWriteXML );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -119,6 +122,7 @@ class pylith::meshio::TestDataWriterVTKMeshHex8 : public TestDataWriterVTKMesh
   CPPUNIT_TEST( testTimeStep );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
+  CPPUNIT_TEST( testWriteXML );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,325 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+#include <portinfo>
+
+#include "TestMeshIOBox.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOBox.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestMeshIOBox );
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOBox::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test debug()
+void
+pylith::meshio::TestMeshIOBox::testDebug(void)
+{ // testDebug
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  _testDebug(iohandler);
+
+  PYLITH_METHOD_END;
+} // testDebug
+
+// ----------------------------------------------------------------------
+// Test interpolate()
+void
+pylith::meshio::TestMeshIOBox::testInterpolate(void)
+{ // testInterpolate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  _testInterpolate(iohandler);
+
+  PYLITH_METHOD_END;
+} // testInterpolate
+
+// ----------------------------------------------------------------------
+// Test axis(), numVertices(), and numCells().
+void
+pylith::meshio::TestMeshIOBox::testAxis(void)
+{ // testAxis
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  CPPUNIT_ASSERT_EQUAL(MeshIOBox::HEX8, iohandler.cellType());
+
+  iohandler.axis(0, -2.0, 2.0, 4);
+  iohandler.axis(1, 0.0, 1.0, 3);
+  iohandler.axis(2, -1.0, 0.0, 2);
+  CPPUNIT_ASSERT_EQUAL(5*4*3, iohandler.numVertices());
+  CPPUNIT_ASSERT_EQUAL(4*3*2, iohandler.numCells());
+
+  iohandler.cellType(MeshIOBox::TET4);
+  CPPUNIT_ASSERT_EQUAL(MeshIOBox::TET4, iohandler.cellType());
+  CPPUNIT_ASSERT_EQUAL(5*4*3, iohandler.numVertices());
+  CPPUNIT_ASSERT_EQUAL(6*4*3*2, iohandler.numCells());
+
+  iohandler.cellType(MeshIOBox::TRI3);
+  CPPUNIT_ASSERT_EQUAL(5*4, iohandler.numVertices());
+  CPPUNIT_ASSERT_EQUAL(2*4*3, iohandler.numCells());
+
+  CPPUNIT_ASSERT_THROW(iohandler.axis(3, 0.0, 1.0, 1), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(iohandler.axis(0, 1.0, 0.0, 1), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(iohandler.axis(0, 0.0, 1.0, 0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testAxis
+
+// ----------------------------------------------------------------------
+// Test _createCells() for Tri3 cells.
+void
+pylith::meshio::TestMeshIOBox::testCreateCellsTri3(void)
+{ // testCreateCellsTri3
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  iohandler.cellType(MeshIOBox::TRI3);
+  iohandler.axis(0, -1.0, 1.0, 2);
+  iohandler.axis(1, 0.0, 2.0, 2);
+  iohandler.addMaterialBlock(2, 1, 1.0, 2.0);
+
+  scalar_array coordinates;
+  int_array cells;
+  int_array materialIds;
+  int numCorners = 0;
+  iohandler._createVertices(&coordinates);
+  iohandler._createCells(&cells, &materialIds, &numCorners);
+
+  const int numCells = 8;
+  const int numCornersE = 3;
+  const int cellsE[numCells*numCornersE] = {
+    0, 1, 4,
+    0, 4, 3,
+    1, 2, 5,
+    1, 5, 4,
+    3, 4, 7,
+    3, 7, 6,
+    4, 5, 8,
+    4, 8, 7,
+  };
+  const int materialIdsE[numCells] = {
+    0, 0, 0, 0, 2, 2, 2, 2,
+  };
+  CPPUNIT_ASSERT_EQUAL(numCornersE, numCorners);
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numCornersE), cells.size());
+  for (int i=0; i < numCells*numCornersE; ++i)
+    CPPUNIT_ASSERT_EQUAL(cellsE[i], cells[i]);
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells), materialIds.size());
+  for (int i=0; i < numCells; ++i)
+    CPPUNIT_ASSERT_EQUAL(materialIdsE[i], materialIds[i]);
+
+  const int spaceDim = 2;
+  CPPUNIT_ASSERT_EQUAL(size_t(9*spaceDim), coordinates.size());
+  const PylithScalar tolerance = 1.0e-06;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, coordinates[0], tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, coordinates[1], tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, coordinates[8*spaceDim+0], tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, coordinates[8*spaceDim+1], tolerance);
+
+  PYLITH_METHOD_END;
+} // testCreateCellsTri3
+
+// ----------------------------------------------------------------------
+// Test _createCells() for Tet4 cells.
+void
+pylith::meshio::TestMeshIOBox::testCreateCellsTet4(void)
+{ // testCreateCellsTet4
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  iohandler.cellType(MeshIOBox::TET4);
+  iohandler.axis(0, -1.0, 1.0, 2);
+  iohandler.axis(1, 0.0, 2.0, 2);
+  iohandler.axis(2, -3.0, 0.0, 2);
+
+  scalar_array coordinates;
+  int_array cells;
+  int_array materialIds;
+  int numCorners = 0;
+  iohandler._createVertices(&coordinates);
+  iohandler._createCells(&cells, &materialIds, &numCorners);
+
+  const int numCells = iohandler.numCells();
+  CPPUNIT_ASSERT_EQUAL(4, numCorners);
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numCorners), cells.size());
+
+  // All cells must have positive volume and fill the box.
+  const PylithScalar tolerance = 1.0e-06;
+  PylithScalar volume = 0.0;
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    const int* v = &cells[iCell*numCorners];
+    PylithScalar a[3][3];
+    for (int i=0; i < 3; ++i)
+      for (int j=0; j < 3; ++j)
+	a[i][j] = coordinates[v[i+1]*3+j] - coordinates[v[0]*3+j];
+    const PylithScalar det =
+      a[0][0]*(a[1][1]*a[2][2] - a[1][2]*a[2][1]) -
+      a[0][1]*(a[1][0]*a[2][2] - a[1][2]*a[2][0]) +
+      a[0][2]*(a[1][0]*a[2][1] - a[1][1]*a[2][0]);
+    CPPUNIT_ASSERT(det > 0.0);
+    volume += det / 6.0;
+  } // for
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(12.0, volume, tolerance);
+
+  PYLITH_METHOD_END;
+} // testCreateCellsTet4
+
+// ----------------------------------------------------------------------
+// Test read() for Quad4 cells.
+void
+pylith::meshio::TestMeshIOBox::testReadQuad4(void)
+{ // testReadQuad4
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  iohandler.cellType(MeshIOBox::QUAD4);
+  iohandler.axis(0, -4.0, 4.0, 4);
+  iohandler.axis(1, -2.0, 0.0, 2);
+  iohandler.addFault("fault", 0, 2.0);
+  iohandler.addMaterialBlock(3, 1, -1.0, 0.0);
+
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  CPPUNIT_ASSERT_EQUAL(2, _mesh->dimension());
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  CPPUNIT_ASSERT_EQUAL(5*3, verticesStratum.size());
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  CPPUNIT_ASSERT_EQUAL(4*2, cellsStratum.size());
+
+  // Bottom row of cells has default material id, top row is in block.
+  PetscErrorCode err = 0;
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    PetscInt matId = 0;
+    err = DMGetLabelValue(dmMesh, "material-id", c, &matId);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL((c-cStart < 4) ? 0 : 3, matId);
+  } // for
+
+  _checkGroupSize("face_xneg", 3);
+  _checkGroupSize("face_xpos", 3);
+  _checkGroupSize("face_yneg", 5);
+  _checkGroupSize("face_ypos", 5);
+  _checkGroupSize("fault", 3);
+
+  PYLITH_METHOD_END;
+} // testReadQuad4
+
+// ----------------------------------------------------------------------
+// Test read() for Hex8 cells.
+void
+pylith::meshio::TestMeshIOBox::testReadHex8(void)
+{ // testReadHex8
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  iohandler.cellType(MeshIOBox::HEX8);
+  iohandler.axis(0, 0.0, 3.0, 3);
+  iohandler.axis(1, 0.0, 2.0, 2);
+  iohandler.axis(2, -2.0, 0.0, 2);
+  iohandler.addFault("fault_x", 0, 1.0);
+  iohandler.addFault("fault_y", 1, 1.0);
+
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  CPPUNIT_ASSERT_EQUAL(3, _mesh->dimension());
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  CPPUNIT_ASSERT_EQUAL(4*3*3, verticesStratum.size());
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  CPPUNIT_ASSERT_EQUAL(3*2*2, cellsStratum.size());
+
+  _checkGroupSize("face_xneg", 3*3);
+  _checkGroupSize("face_xpos", 3*3);
+  _checkGroupSize("face_yneg", 4*3);
+  _checkGroupSize("face_ypos", 4*3);
+  _checkGroupSize("face_zneg", 4*3);
+  _checkGroupSize("face_zpos", 4*3);
+  _checkGroupSize("fault_x", 3*3);
+  _checkGroupSize("fault_y", 4*3);
+
+  PYLITH_METHOD_END;
+} // testReadHex8
+
+// ----------------------------------------------------------------------
+// Test read() with fault that does not coincide with grid plane.
+void
+pylith::meshio::TestMeshIOBox::testReadBadFault(void)
+{ // testReadBadFault
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBox iohandler;
+  iohandler.cellType(MeshIOBox::QUAD4);
+  iohandler.axis(0, 0.0, 3.0, 3);
+  iohandler.axis(1, 0.0, 1.0, 1);
+  iohandler.addFault("fault", 0, 1.5);
+
+  delete _mesh; _mesh = new topology::Mesh;
+  CPPUNIT_ASSERT_THROW(iohandler.read(_mesh), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testReadBadFault
+
+// ----------------------------------------------------------------------
+// Check number of points in vertex group.
+void
+pylith::meshio::TestMeshIOBox::_checkGroupSize(const char* name,
+					       const int numPointsE)
+{ // _checkGroupSize
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+  PetscErrorCode err = 0;
+  PetscBool hasLabel = PETSC_FALSE;
+  err = DMHasLabel(dmMesh, name, &hasLabel);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(hasLabel);
+
+  PetscInt numPoints = 0;
+  err = DMGetStratumSize(dmMesh, name, 1, &numPoints);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+
+  PYLITH_METHOD_END;
+} // _checkGroupSize
+
+
+// End of file 
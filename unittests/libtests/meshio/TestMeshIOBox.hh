@@ -0,0 +1,104 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+/**
+ * @file unittests/libtests/meshio/TestMeshIOBox.hh
+ *
+ * @brief C++ TestMeshIOBox object
+ *
+ * C++ unit testing for MeshIOBox.
+ */
+
+#if !defined(pylith_meshio_testmeshiobox_hh)
+#define pylith_meshio_testmeshiobox_hh
+
+// Include directives ---------------------------------------------------
+#include "TestMeshIO.hh"
+
+// Forward declarations -------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    class TestMeshIOBox;
+  } // meshio
+} // pylith
+
+// TestMeshIOBox --------------------------------------------------------
+class pylith::meshio::TestMeshIOBox : public TestMeshIO
+{ // class TestMeshIOBox
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMeshIOBox );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testDebug );
+  CPPUNIT_TEST( testInterpolate );
+  CPPUNIT_TEST( testAxis );
+  CPPUNIT_TEST( testCreateCellsTri3 );
+  CPPUNIT_TEST( testCreateCellsTet4 );
+  CPPUNIT_TEST( testReadQuad4 );
+  CPPUNIT_TEST( testReadHex8 );
+  CPPUNIT_TEST( testReadBadFault );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test debug()
+  void testDebug(void);
+
+  /// Test interpolate()
+  void testInterpolate(void);
+
+  /// Test axis(), numVertices(), and numCells().
+  void testAxis(void);
+
+  /// Test _createCells() for Tri3 cells.
+  void testCreateCellsTri3(void);
+
+  /// Test _createCells() for Tet4 cells.
+  void testCreateCellsTet4(void);
+
+  /// Test read() for Quad4 cells.
+  void testReadQuad4(void);
+
+  /// Test read() for Hex8 cells.
+  void testReadHex8(void);
+
+  /// Test read() with fault that does not coincide with grid plane.
+  void testReadBadFault(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Check number of points in vertex group.
+   *
+   * @param name Name of group.
+   * @param numPointsE Expected number of points.
+   */
+  void _checkGroupSize(const char* name,
+		       const int numPointsE);
+
+}; // class TestMeshIOBox
+
+#endif // pylith_meshio_testmeshiobox_hh
+
+
+// End of file 
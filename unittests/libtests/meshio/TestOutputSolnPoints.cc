@@ -37,7 +37,10 @@
 #include "data/OutputSolnPointsDataTet4.hh"
 #include "data/OutputSolnPointsDataHex8.hh"
 
+#include "pylith/utils/array.hh" // USES scalar_array
+
 #include <string.h> // USES strcmp()
+#include <math.h> // USES fabs()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestOutputSolnPoints );
@@ -87,6 +90,36 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateTri3(void)
 } // testInterpolateTri3
 
 
+// ----------------------------------------------------------------------
+// Test _setupInterpolationWeights() for tri3 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testInterpolationWeightsTri3(void)
+{ // testInterpolationWeightsTri3
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataTri3 data;
+
+    _testInterpolationWeights(data);
+
+    PYLITH_METHOD_END;
+} // testInterpolationWeightsTri3
+
+
+// ----------------------------------------------------------------------
+// Test adjointSource() for tri3 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAdjointSourceTri3(void)
+{ // testAdjointSourceTri3
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataTri3 data;
+
+    _testAdjointSource(data);
+
+    PYLITH_METHOD_END;
+} // testAdjointSourceTri3
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for quad4 mesh.
 void
@@ -119,6 +152,36 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateQuad4(void)
 } // testInterpolateQuad4
 
 
+// ----------------------------------------------------------------------
+// Test _setupInterpolationWeights() for quad4 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testInterpolationWeightsQuad4(void)
+{ // testInterpolationWeightsQuad4
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataQuad4 data;
+
+    _testInterpolationWeights(data);
+
+    PYLITH_METHOD_END;
+} // testInterpolationWeightsQuad4
+
+
+// ----------------------------------------------------------------------
+// Test adjointSource() for quad4 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAdjointSourceQuad4(void)
+{ // testAdjointSourceQuad4
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataQuad4 data;
+
+    _testAdjointSource(data);
+
+    PYLITH_METHOD_END;
+} // testAdjointSourceQuad4
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for tet4 mesh.
 void
@@ -151,6 +214,36 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateTet4(void)
 } // testInterpolateTet4
 
 
+// ----------------------------------------------------------------------
+// Test _setupInterpolationWeights() for tet4 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testInterpolationWeightsTet4(void)
+{ // testInterpolationWeightsTet4
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataTet4 data;
+
+    _testInterpolationWeights(data);
+
+    PYLITH_METHOD_END;
+} // testInterpolationWeightsTet4
+
+
+// ----------------------------------------------------------------------
+// Test adjointSource() for tet4 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAdjointSourceTet4(void)
+{ // testAdjointSourceTet4
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataTet4 data;
+
+    _testAdjointSource(data);
+
+    PYLITH_METHOD_END;
+} // testAdjointSourceTet4
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for hex8 mesh.
 void
@@ -183,6 +276,36 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateHex8(void)
 } // testInterpolateHex8
 
 
+// ----------------------------------------------------------------------
+// Test _setupInterpolationWeights() for hex8 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testInterpolationWeightsHex8(void)
+{ // testInterpolationWeightsHex8
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataHex8 data;
+
+    _testInterpolationWeights(data);
+
+    PYLITH_METHOD_END;
+} // testInterpolationWeightsHex8
+
+
+// ----------------------------------------------------------------------
+// Test adjointSource() for hex8 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAdjointSourceHex8(void)
+{ // testAdjointSourceHex8
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataHex8 data;
+
+    _testAdjointSource(data);
+
+    PYLITH_METHOD_END;
+} // testAdjointSourceHex8
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator().
 void
@@ -339,6 +462,189 @@ pylith::meshio::TestOutputSolnPoints::_testInterpolate(const OutputSolnPointsDat
 } // _testInterpolate
 
 
+// ----------------------------------------------------------------------
+// Test _setupInterpolationWeights().
+void
+pylith::meshio::TestOutputSolnPoints::_testInterpolationWeights(const OutputSolnPointsData& data)
+{ // _testInterpolationWeights
+    PYLITH_METHOD_BEGIN;
+
+    const int numPoints = data.numPoints;
+    const int spaceDim = data.spaceDim;
+
+    topology::Mesh mesh;
+    spatialdata::geocoords::CSCart cs;
+    spatialdata::units::Nondimensional normalizer;
+
+    cs.setSpaceDim(spaceDim);
+    cs.initialize();
+    mesh.coordsys(&cs);
+    MeshIOCubit iohandler;
+    iohandler.filename(data.meshFilename);
+    iohandler.read(&mesh);
+
+    OutputSolnPoints output;
+    CPPUNIT_ASSERT(data.points);
+    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
+
+    const int fiberDim = data.fiberDim;
+    pylith::topology::Field field(mesh);
+    field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
+    field.allocate();
+    field.label("data_field");
+    field.zeroAll();
+
+    output._setupInterpolationWeights(&field);
+
+    const int numPointsLocal = output._pointIndices.size();
+    CPPUNIT_ASSERT_EQUAL(numPoints, numPointsLocal);
+    CPPUNIT_ASSERT_EQUAL(size_t(numPointsLocal+1), output._weightsOffsets.size());
+    CPPUNIT_ASSERT_EQUAL(size_t(output._weightsOffsets[numPointsLocal]), output._weights.size());
+    CPPUNIT_ASSERT_EQUAL(size_t(output._weightsOffsets[numPointsLocal]), output._weightsVertices.size());
+
+    PetscDM dmMesh = mesh.dmMesh(); CPPUNIT_ASSERT(dmMesh);
+    pylith::topology::CoordsVisitor coordsVisitor(dmMesh);
+    PylithScalar* coordsArray = coordsVisitor.localArray();CPPUNIT_ASSERT(coordsArray);
+
+    PetscErrorCode err = 0;
+    const double tolerance = 1.0e-6;
+    for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+        const int iPoint = output._pointIndices[iLocal];
+        CPPUNIT_ASSERT(iPoint >= 0 && iPoint < numPoints);
+
+        // Weights are for the vertices of the cell containing the point.
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmMesh, output._interpolator->cells[iLocal], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        for (int iWeight=output._weightsOffsets[iLocal]; iWeight < output._weightsOffsets[iLocal+1]; ++iWeight) {
+            bool found = false;
+            for (PetscInt c=0; c < closureSize*2; c += 2) {
+                if (closure[c] == output._weightsVertices[iWeight]) {
+                    found = true;
+                    break;
+                } // if
+            } // for
+            CPPUNIT_ASSERT(found);
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, output._interpolator->cells[iLocal], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+
+        // Weights sum to one and reproduce the linear field at the point.
+        PylithScalar weightSum = 0.0;
+        scalar_array value(fiberDim);
+        value = 0.0;
+        for (int iWeight=output._weightsOffsets[iLocal]; iWeight < output._weightsOffsets[iLocal+1]; ++iWeight) {
+            const PylithScalar weight = output._weights[iWeight];
+            const PetscInt coff = coordsVisitor.sectionOffset(output._weightsVertices[iWeight]);
+            weightSum += weight;
+            for (int d=0; d < fiberDim; ++d) {
+                for (int iv=0; iv < spaceDim; ++iv) {
+                    value[d] += weight * data.coefs[d*spaceDim+iv]*coordsArray[coff+iv];
+                } // for
+            } // for
+        } // for
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, weightSum, tolerance);
+        for (int d=0; d < fiberDim; ++d) {
+            PylithScalar valueE = 0.0;
+            for (int iv=0; iv < spaceDim; ++iv) {
+                valueE += data.coefs[d*spaceDim+iv]*data.points[iPoint*spaceDim+iv];
+            } // for
+            if (fabs(valueE) > 1.0) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value[d] / valueE, tolerance);
+            } else {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value[d], tolerance);
+            } // if/else
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _testInterpolationWeights
+
+
+// ----------------------------------------------------------------------
+// Test adjointSource().
+void
+pylith::meshio::TestOutputSolnPoints::_testAdjointSource(const OutputSolnPointsData& data)
+{ // _testAdjointSource
+    PYLITH_METHOD_BEGIN;
+
+    const int numPoints = data.numPoints;
+    const int spaceDim = data.spaceDim;
+
+    topology::Mesh mesh;
+    spatialdata::geocoords::CSCart cs;
+    spatialdata::units::Nondimensional normalizer;
+
+    cs.setSpaceDim(spaceDim);
+    cs.initialize();
+    mesh.coordsys(&cs);
+    MeshIOCubit iohandler;
+    iohandler.filename(data.meshFilename);
+    iohandler.read(&mesh);
+
+    OutputSolnPoints output;
+    CPPUNIT_ASSERT(data.points);
+    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
+
+    // Create field with data.
+    const int fiberDim = data.fiberDim;
+    pylith::topology::Field field(mesh);
+    field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
+    field.allocate();
+    field.label("data_field");
+    field.zeroAll();
+    this->_calcField(&field, data);
+
+    pylith::topology::Field source(mesh);
+    source.cloneSection(field);
+    source.allocate();
+    source.label("adjoint_source");
+    source.zeroAll();
+
+    // The inner product of the source with a field is the value of
+    // the field component interpolated to the point.
+    topology::Stratum verticesStratum(mesh.dmMesh(), topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+
+    const double tolerance = 1.0e-6;
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+        for (int iComp=0; iComp < fiberDim; ++iComp) {
+            output.adjointSource(&source, iPoint, iComp);
+
+            topology::VecVisitorMesh fieldVisitor(field);
+            const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+            topology::VecVisitorMesh sourceVisitor(source);
+            const PetscScalar* sourceArray = sourceVisitor.localArray();CPPUNIT_ASSERT(sourceArray);
+
+            PylithScalar value = 0.0;
+            for (PetscInt v = vStart; v < vEnd; ++v) {
+                const PetscInt off = sourceVisitor.sectionOffset(v);
+                CPPUNIT_ASSERT_EQUAL(fiberDim, sourceVisitor.sectionDof(v));
+                const PetscInt foff = fieldVisitor.sectionOffset(v);
+                for (int d=0; d < fiberDim; ++d) {
+                    if (d != iComp) {
+                        CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), PylithScalar(sourceArray[off+d]));
+                    } // if
+                    value += sourceArray[off+d] * fieldArray[foff+d];
+                } // for
+            } // for
+
+            PylithScalar valueE = 0.0;
+            for (int iv=0; iv < spaceDim; ++iv) {
+                valueE += data.coefs[iComp*spaceDim+iv]*data.points[iPoint*spaceDim+iv];
+            } // for
+            if (fabs(valueE) > 1.0) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value / valueE, tolerance);
+            } else {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+            } // if/else
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _testAdjointSource
+
+
 // ----------------------------------------------------------------------
 void
 pylith::meshio::TestOutputSolnPoints::_calcField(pylith::topology::Field* field,
@@ -51,15 +51,23 @@ class pylith::meshio::TestOutputSolnPoints : public CppUnit::TestFixture
     
     CPPUNIT_TEST( testSetupInterpolatorTri3 );
     CPPUNIT_TEST( testInterpolateTri3 );
+    CPPUNIT_TEST( testInterpolationWeightsTri3 );
+    CPPUNIT_TEST( testAdjointSourceTri3 );
 
     CPPUNIT_TEST( testSetupInterpolatorQuad4 );
     CPPUNIT_TEST( testInterpolateQuad4 );
+    CPPUNIT_TEST( testInterpolationWeightsQuad4 );
+    CPPUNIT_TEST( testAdjointSourceQuad4 );
 
     CPPUNIT_TEST( testSetupInterpolatorTet4 );
     CPPUNIT_TEST( testInterpolateTet4 );
+    CPPUNIT_TEST( testInterpolationWeightsTet4 );
+    CPPUNIT_TEST( testAdjointSourceTet4 );
 
     CPPUNIT_TEST( testSetupInterpolatorHex8 );
     CPPUNIT_TEST( testInterpolateHex8 );
+    CPPUNIT_TEST( testInterpolationWeightsHex8 );
+    CPPUNIT_TEST( testAdjointSourceHex8 );
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -75,24 +83,48 @@ public :
   /// Test interpolation for tri3 mesh.
   void testInterpolateTri3(void);
 
+  /// Test _setupInterpolationWeights() for tri3 mesh.
+  void testInterpolationWeightsTri3(void);
+
+  /// Test adjointSource() for tri3 mesh.
+  void testAdjointSourceTri3(void);
+
   /// Test setupInterpolator for quad4 mesh.
   void testSetupInterpolatorQuad4(void);
 
   /// Test interpolation for quad4 mesh.
   void testInterpolateQuad4(void);
 
+  /// Test _setupInterpolationWeights() for quad4 mesh.
+  void testInterpolationWeightsQuad4(void);
+
+  /// Test adjointSource() for quad4 mesh.
+  void testAdjointSourceQuad4(void);
+
   /// Test setupInterpolator for tet4 mesh.
   void testSetupInterpolatorTet4(void);
 
   /// Test interpolation for tet4 mesh.
   void testInterpolateTet4(void);
 
+  /// Test _setupInterpolationWeights() for tet4 mesh.
+  void testInterpolationWeightsTet4(void);
+
+  /// Test adjointSource() for tet4 mesh.
+  void testAdjointSourceTet4(void);
+
   /// Test setupInterpolator for hex8 mesh.
   void testSetupInterpolatorHex8(void);
 
   /// Test interpolation for hex8 mesh.
   void testInterpolateHex8(void);
 
+  /// Test _setupInterpolationWeights() for hex8 mesh.
+  void testInterpolationWeightsHex8(void);
+
+  /// Test adjointSource() for hex8 mesh.
+  void testAdjointSourceHex8(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -108,6 +140,18 @@ private :
    */
   void _testInterpolate(const OutputSolnPointsData& data);
 
+  /** Test _setupInterpolationWeights().
+   *
+   * @param data Test data.
+   */
+  void _testInterpolationWeights(const OutputSolnPointsData& data);
+
+  /** Test adjointSource().
+   *
+   * @param data Test data.
+   */
+  void _testAdjointSource(const OutputSolnPointsData& data);
+
   /** Compute values of field at vertices in mesh.
    *
    * @param field Field to hold values.
@@ -0,0 +1,289 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestVertexFilterTemporal.hh" // Implementation of class methods
+
+#include "pylith/meshio/VertexFilterTemporal.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Field.hh" // USES Field
+
+#include <algorithm> // USES std::max()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestVertexFilterTemporal );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _TestVertexFilterTemporal {
+      const char* filename = "data/tri3.mesh";
+      const int fiberDim = 2;
+      const int nvertices = 4;
+      const char* label = "field data";
+      const PylithScalar fieldScale = 4.0;
+      const PylithScalar fieldValuesA[nvertices*fiberDim] = {
+	1.1, -1.2,
+	2.1, 2.2,
+	-3.1, 3.2,
+	0.1, 0.2,
+      };
+      const PylithScalar fieldValuesB[nvertices*fiberDim] = {
+	0.5, 1.4,
+	2.3, -2.0,
+	-3.3, 3.0,
+	2.1, 0.0,
+      };
+    } // _TestVertexFilterTemporal
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestVertexFilterTemporal::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  VertexFilterTemporal filter;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test reduction()
+void
+pylith::meshio::TestVertexFilterTemporal::testReduction(void)
+{ // testReduction
+  PYLITH_METHOD_BEGIN;
+
+  VertexFilterTemporal filter;
+  filter.reduction("mean");
+  filter.reduction("threshold_time");
+  CPPUNIT_ASSERT_THROW(filter.reduction("median"), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(filter.timeScale(0.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testReduction
+
+// ----------------------------------------------------------------------
+// Test filter() with maximum.
+void
+pylith::meshio::TestVertexFilterTemporal::testFilterMax(void)
+{ // testFilterMax
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestVertexFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  field.newSection(topology::FieldBase::VERTICES_FIELD, _TestVertexFilterTemporal::fiberDim);
+  field.allocate();
+  field.vectorFieldType(topology::FieldBase::VECTOR);
+  field.label(_TestVertexFilterTemporal::label);
+  field.scale(_TestVertexFilterTemporal::fieldScale);
+
+  VertexFilterTemporal filter;
+  filter.reduction("max");
+
+  _setField(&field, _TestVertexFilterTemporal::fieldValuesA);
+  filter.update(0.0, field);
+  _setField(&field, _TestVertexFilterTemporal::fieldValuesB);
+  filter.update(1.0, field);
+  CPPUNIT_ASSERT_EQUAL(1, filter.numReduced());
+
+  const topology::Field& fieldMax = filter.filter(field);
+  CPPUNIT_ASSERT_EQUAL(topology::FieldBase::VECTOR, fieldMax.vectorFieldType());
+  CPPUNIT_ASSERT_EQUAL(std::string(_TestVertexFilterTemporal::label), std::string(fieldMax.label()));
+  CPPUNIT_ASSERT_EQUAL(_TestVertexFilterTemporal::fieldScale, fieldMax.scale());
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh fieldVisitor(fieldMax);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  const int fiberDim = _TestVertexFilterTemporal::fiberDim;
+  const PylithScalar tolerance = 1.0e-06;
+  for(PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(fiberDim, fieldVisitor.sectionDof(v));
+    for(PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      const PylithScalar valueE = std::max(_TestVertexFilterTemporal::fieldValuesA[index], _TestVertexFilterTemporal::fieldValuesB[index]);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, fieldArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testFilterMax
+
+// ----------------------------------------------------------------------
+// Test filter() with root-mean-square.
+void
+pylith::meshio::TestVertexFilterTemporal::testFilterRMS(void)
+{ // testFilterRMS
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestVertexFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  field.newSection(topology::FieldBase::VERTICES_FIELD, _TestVertexFilterTemporal::fiberDim);
+  field.allocate();
+  field.vectorFieldType(topology::FieldBase::VECTOR);
+  field.label(_TestVertexFilterTemporal::label);
+  field.scale(_TestVertexFilterTemporal::fieldScale);
+
+  VertexFilterTemporal filter;
+  filter.reduction("rms");
+
+  _setField(&field, _TestVertexFilterTemporal::fieldValuesA);
+  filter.update(0.0, field);
+  _setField(&field, _TestVertexFilterTemporal::fieldValuesB);
+  filter.update(1.0, field);
+
+  const topology::Field& fieldRMS = filter.filter(field);
+  CPPUNIT_ASSERT(fieldRMS.dimensionalizeOkay());
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh fieldVisitor(fieldRMS);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  const int fiberDim = _TestVertexFilterTemporal::fiberDim;
+  const PylithScalar tolerance = 1.0e-06;
+  for(PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    for(PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      const PylithScalar valueA = _TestVertexFilterTemporal::fieldValuesA[index];
+      const PylithScalar valueB = _TestVertexFilterTemporal::fieldValuesB[index];
+      const PylithScalar valueE = sqrt(0.5*(valueA*valueA + valueB*valueB));
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, fieldArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testFilterRMS
+
+// ----------------------------------------------------------------------
+// Test filter() with threshold time.
+void
+pylith::meshio::TestVertexFilterTemporal::testFilterThresholdTime(void)
+{ // testFilterThresholdTime
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  topology::Mesh mesh;
+  iohandler.filename(_TestVertexFilterTemporal::filename);
+  iohandler.read(&mesh);
+
+  topology::Field field(mesh);
+  field.newSection(topology::FieldBase::VERTICES_FIELD, _TestVertexFilterTemporal::fiberDim);
+  field.allocate();
+  field.vectorFieldType(topology::FieldBase::VECTOR);
+  field.label(_TestVertexFilterTemporal::label);
+  field.scale(_TestVertexFilterTemporal::fieldScale);
+
+  const PylithScalar timeScale = 2.0;
+  VertexFilterTemporal filter;
+  filter.reduction("threshold_time");
+  filter.threshold(4.0*_TestVertexFilterTemporal::fieldScale);
+  filter.timeScale(timeScale);
+
+  _setField(&field, _TestVertexFilterTemporal::fieldValuesA);
+  filter.update(0.5, field);
+  _setField(&field, _TestVertexFilterTemporal::fieldValuesB);
+  filter.update(1.5, field);
+
+  const topology::Field& fieldTime = filter.filter(field);
+  CPPUNIT_ASSERT_EQUAL(topology::FieldBase::SCALAR, fieldTime.vectorFieldType());
+  CPPUNIT_ASSERT_EQUAL(timeScale, fieldTime.scale());
+
+  // Magnitudes: A = {1.63, 3.04, 4.46, 0.22}, B = {1.49, 3.05, 4.46, 2.10}
+  const PylithScalar notExceeded = -1.0 / timeScale;
+  const int nvertices = _TestVertexFilterTemporal::nvertices;
+  const PylithScalar fieldValuesE[nvertices] = {
+    notExceeded, notExceeded, 0.5, notExceeded,
+  };
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh fieldVisitor(fieldTime);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  const PylithScalar tolerance = 1.0e-06;
+  for(PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(1, fieldVisitor.sectionDof(v));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(fieldValuesE[index++], fieldArray[off], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testFilterThresholdTime
+
+// ----------------------------------------------------------------------
+// Set values of vertex field.
+void
+pylith::meshio::TestVertexFilterTemporal::_setField(topology::Field* field,
+						    const PylithScalar* values)
+{ // _setField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+  CPPUNIT_ASSERT(values);
+
+  PetscDM dmMesh = field->mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  const int fiberDim = _TestVertexFilterTemporal::fiberDim;
+  for(PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    for(PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      fieldArray[off+d] = values[index];
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _setField
+
+
+// End of file 
@@ -0,0 +1,89 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestVertexFilterTemporal.hh
+ *
+ * @brief C++ TestVertexFilterTemporal object
+ *
+ * C++ unit testing for VertexFilterTemporal.
+ */
+
+#if !defined(pylith_meshio_testvertexfiltertemporal_hh)
+#define pylith_meshio_testvertexfiltertemporal_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestVertexFilterTemporal;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for VertexFilterTemporal
+class pylith::meshio::TestVertexFilterTemporal : public CppUnit::TestFixture
+{ // class TestVertexFilterTemporal
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestVertexFilterTemporal );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testReduction );
+  CPPUNIT_TEST( testFilterMax );
+  CPPUNIT_TEST( testFilterRMS );
+  CPPUNIT_TEST( testFilterThresholdTime );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test reduction()
+  void testReduction(void);
+
+  /// Test filter() with maximum.
+  void testFilterMax(void);
+
+  /// Test filter() with root-mean-square.
+  void testFilterRMS(void);
+
+  /// Test filter() with threshold time.
+  void testFilterThresholdTime(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Set values of vertex field.
+   *
+   * @param field Vertex field.
+   * @param values Values at vertices.
+   */
+  void _setField(topology::Field* field,
+		 const PylithScalar* values);
+
+}; // class TestVertexFilterTemporal
+
+#endif // pylith_meshio_testvertexfiltertemporal_hh
+
+// End of file 
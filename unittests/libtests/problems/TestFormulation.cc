@@ -0,0 +1,366 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFormulation.hh" // Implementation of class methods
+
+#include "pylith/problems/Explicit.hh" // USES Explicit
+#include "pylith/feassemble/ElasticityExplicit.hh" // USES ElasticityExplicit
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/feassemble/GeometryTri2D.hh" // USES GeometryTri2D
+#include "pylith/feassemble/GeometryLine2D.hh" // USES GeometryLine2D
+#include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/faults/EqKinSrc.hh" // USES EqKinSrc
+#include "pylith/faults/StepSlipFn.hh" // USES StepSlipFn
+#include "pylith/bc/DirichletBC.hh" // USES DirichletBC
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestFormulation );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace problems {
+    namespace _TestFormulation {
+      const char* meshFilename = "data/tri3.mesh";
+      const int spaceDim = 2;
+
+      const PylithScalar lengthScale = 1.0e+3;
+      const PylithScalar pressureScale = 2.25e+10;
+      const PylithScalar timeScale = 2.0;
+
+      // Material
+      const int materialId = 0;
+      const char* materialLabel = "elastic";
+
+      // Quadrature for triangular cells.
+      const int cellDim = 2;
+      const int numBasis = 3;
+      const int numQuadPts = 1;
+      const PylithScalar basis[numQuadPts*numBasis] = {
+	1.0/3.0, 1.0/3.0, 1.0/3.0,
+      };
+      const PylithScalar basisDerivRef[numQuadPts*numBasis*cellDim] = {
+	-0.5, -0.5,
+	 0.5,  0.0,
+	 0.0,  0.5,
+      };
+      const PylithScalar quadPtsRef[numQuadPts*cellDim] = {
+	-1.0/3.0, -1.0/3.0,
+      };
+      const PylithScalar quadWts[numQuadPts] = { 2.0 };
+
+      // Fault
+      const int faultId = 100;
+      const char* faultLabel = "fault";
+
+      // Quadrature for fault cells.
+      const int faultCellDim = 1;
+      const int faultNumBasis = 2;
+      const int faultNumQuadPts = 2;
+      const PylithScalar faultBasis[faultNumQuadPts*faultNumBasis] = {
+	1.0, 0.0,
+	0.0, 1.0,
+      };
+      const PylithScalar faultBasisDerivRef[faultNumQuadPts*faultNumBasis*faultCellDim] = {
+	-0.5, 0.5,
+	-0.5, 0.5,
+      };
+      const PylithScalar faultQuadPtsRef[faultNumQuadPts*faultCellDim] = {
+	-1.0, 1.0,
+      };
+      const PylithScalar faultQuadWts[faultNumQuadPts] = { 1.0, 1.0 };
+
+      // Dirichlet boundary condition
+      const char* bcLabel = "boundary";
+      const int numFixedDOF = 2;
+      const int fixedDOF[numFixedDOF] = { 0, 1 };
+
+      // Time (nondimensional)
+      const PylithScalar t = 0.5;
+      const PylithScalar dt = 0.01;
+    } // _TestFormulation
+  } // problems
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test overlapAssembly().
+void
+pylith::problems::TestFormulation::testOverlapAssembly(void)
+{ // testOverlapAssembly
+  PYLITH_METHOD_BEGIN;
+
+  Explicit formulation;
+  CPPUNIT_ASSERT_EQUAL(false, formulation.overlapAssembly());
+
+  formulation.overlapAssembly(true);
+  CPPUNIT_ASSERT_EQUAL(true, formulation.overlapAssembly());
+
+  formulation.overlapAssembly(false);
+  CPPUNIT_ASSERT_EQUAL(false, formulation.overlapAssembly());
+
+  PYLITH_METHOD_END;
+} // testOverlapAssembly
+
+// ----------------------------------------------------------------------
+// Test reformResidual() with overlapping assembly.
+void
+pylith::problems::TestFormulation::testReformResidualOverlap(void)
+{ // testReformResidualOverlap
+  PYLITH_METHOD_BEGIN;
+
+  const int spaceDim = _TestFormulation::spaceDim;
+
+  // Mesh
+  topology::Mesh mesh;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(_TestFormulation::meshFilename);
+  iohandler.read(&mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+  mesh.coordsys(&cs);
+
+  spatialdata::units::Nondimensional normalizer;
+  normalizer.lengthScale(_TestFormulation::lengthScale);
+  normalizer.pressureScale(_TestFormulation::pressureScale);
+  normalizer.timeScale(_TestFormulation::timeScale);
+  const PylithScalar velScale = _TestFormulation::lengthScale / _TestFormulation::timeScale;
+  normalizer.densityScale(_TestFormulation::pressureScale / (velScale*velScale));
+  topology::MeshOps::nondimensionalize(&mesh, normalizer);
+
+  // Fault (insert cohesive cells before setting up anything else on
+  // the mesh).
+  spatialdata::spatialdb::UniformDB dbFinalSlip("final slip");
+  const int numSlipValues = 2;
+  const char* slipNames[numSlipValues] = { "left-lateral-slip", "fault-opening" };
+  const char* slipUnits[numSlipValues] = { "m", "m" };
+  const double slipValues[numSlipValues] = { 2.0, 0.5 };
+  dbFinalSlip.setData(slipNames, slipUnits, slipValues, numSlipValues);
+
+  spatialdata::spatialdb::UniformDB dbSlipTime("slip time");
+  const char* slipTimeNames[1] = { "slip-time" };
+  const char* slipTimeUnits[1] = { "s" };
+  const double slipTimeValues[1] = { 0.0 };
+  dbSlipTime.setData(slipTimeNames, slipTimeUnits, slipTimeValues, 1);
+
+  faults::StepSlipFn slipfn;
+  slipfn.dbFinalSlip(&dbFinalSlip);
+  slipfn.dbSlipTime(&dbSlipTime);
+  faults::EqKinSrc eqsrc;
+  eqsrc.slipfn(&slipfn);
+  const char* eqsrcNames[1] = { "rupture" };
+  faults::EqKinSrc* eqsrcs[1] = { &eqsrc };
+
+  feassemble::Quadrature faultQuadrature;
+  feassemble::GeometryLine2D faultGeometry;
+  faultQuadrature.refGeometry(&faultGeometry);
+  faultQuadrature.initialize(_TestFormulation::faultBasis, _TestFormulation::faultNumQuadPts, _TestFormulation::faultNumBasis,
+			     _TestFormulation::faultBasisDerivRef, _TestFormulation::faultNumQuadPts, _TestFormulation::faultNumBasis, _TestFormulation::faultCellDim,
+			     _TestFormulation::faultQuadPtsRef, _TestFormulation::faultNumQuadPts, _TestFormulation::faultCellDim,
+			     _TestFormulation::faultQuadWts, _TestFormulation::faultNumQuadPts,
+			     spaceDim);
+
+  faults::FaultCohesiveKin fault;
+  fault.id(_TestFormulation::faultId);
+  fault.label(_TestFormulation::faultLabel);
+  fault.quadrature(&faultQuadrature);
+  fault.eqsrcs(eqsrcNames, 1, eqsrcs, 1);
+
+  PetscInt firstFaultVertex = 0;
+  PetscInt firstLagrangeVertex = 0;
+  PetscErrorCode err = DMGetStratumSize(mesh.dmMesh(), _TestFormulation::faultLabel, 1, &firstLagrangeVertex);PYLITH_CHECK_ERROR(err);
+  PetscInt firstFaultCell = firstLagrangeVertex + firstLagrangeVertex;
+  fault.adjustTopology(&mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+
+  // Material
+  spatialdata::spatialdb::UniformDB dbProperties("elastic properties");
+  const int numPropValues = 3;
+  const char* propNames[numPropValues] = { "density", "vs", "vp" };
+  const char* propUnits[numPropValues] = { "kg/m**3", "m/s", "m/s" };
+  const double propValues[numPropValues] = { 2500.0, 3000.0, 5291.502622129181 };
+  dbProperties.setData(propNames, propUnits, propValues, numPropValues);
+
+  materials::ElasticPlaneStrain material;
+  material.id(_TestFormulation::materialId);
+  material.label(_TestFormulation::materialLabel);
+  material.dbProperties(&dbProperties);
+  material.normalizer(normalizer);
+
+  feassemble::Quadrature quadrature;
+  feassemble::GeometryTri2D geometry;
+  quadrature.refGeometry(&geometry);
+  quadrature.initialize(_TestFormulation::basis, _TestFormulation::numQuadPts, _TestFormulation::numBasis,
+			_TestFormulation::basisDerivRef, _TestFormulation::numQuadPts, _TestFormulation::numBasis, _TestFormulation::cellDim,
+			_TestFormulation::quadPtsRef, _TestFormulation::numQuadPts, _TestFormulation::cellDim,
+			_TestFormulation::quadWts, _TestFormulation::numQuadPts,
+			spaceDim);
+
+  feassemble::ElasticityExplicit integrator;
+  integrator.quadrature(&quadrature);
+  integrator.material(&material);
+  integrator.initialize(mesh);
+
+  // Dirichlet boundary condition
+  const PylithScalar upDir[3] = { 0.0, 0.0, 1.0 };
+  bc::DirichletBC bc;
+  bc.label(_TestFormulation::bcLabel);
+  bc.bcDOF(_TestFormulation::fixedDOF, _TestFormulation::numFixedDOF);
+  bc.normalizer(normalizer);
+  bc.initialize(mesh, upDir);
+
+  fault.normalizer(normalizer);
+  fault.initialize(mesh, upDir);
+
+  // Setup fields following Formulation and Explicit.
+  topology::SolutionFields fields(mesh);
+  fields.add("dispIncr(t->t+dt)", "displacement_increment");
+  fields.add("disp(t)", "displacement");
+  fields.add("residual", "residual");
+  fields.solutionName("dispIncr(t->t+dt)");
+
+  topology::Field& solution = fields.solution();
+  solution.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR, _TestFormulation::lengthScale);
+  solution.subfieldAdd("lagrange_multiplier", spaceDim, topology::Field::VECTOR, _TestFormulation::pressureScale);
+  solution.subfieldsSetup();
+  solution.setupSolnChart();
+  solution.setupSolnDof(spaceDim);
+  integrator.setupSolnDof(&solution);
+  fault.setupSolnDof(&solution);
+  bc.setConstraintSizes(solution);
+  solution.allocate();
+  solution.zeroAll();
+  bc.setConstraints(solution);
+  solution.createScatter(mesh);
+
+  fields.add("disp(t-dt)", "displacement");
+  fields.add("velocity(t)", "velocity");
+  fields.add("acceleration(t)", "acceleration");
+  fields.copyLayout("dispIncr(t->t+dt)");
+
+  topology::Field& residual = fields.get("residual");
+  residual.createScatter(mesh);
+
+  _setField(&solution, 1.0e-3);
+  _setField(&fields.get("disp(t)"), 2.0e-3);
+  _setField(&fields.get("disp(t-dt)"), 1.5e-3);
+
+  topology::Field jacobian(mesh);
+
+  // Materials before interfaces, as in the Python formulation.
+  feassemble::Integrator* integrators[2] = { &integrator, &fault };
+  Explicit formulation;
+  formulation.integrators(integrators, 2);
+  formulation.updateSettings(&jacobian, &fields, _TestFormulation::t, _TestFormulation::dt);
+
+  // Residual without overlapping assembly.
+  formulation.overlapAssembly(false);
+  formulation.reformResidual();
+
+  PetscInt residualSize = 0;
+  err = VecGetLocalSize(residual.localVector(), &residualSize);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(residualSize > 0);
+  scalar_array residualE(residualSize);
+  const PetscScalar* residualArray = NULL;
+  err = VecGetArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+  PylithScalar residualNorm = 0.0;
+  for (PetscInt i=0; i < residualSize; ++i) {
+    residualE[i] = residualArray[i];
+    residualNorm += residualArray[i]*residualArray[i];
+  } // for
+  err = VecRestoreArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(residualNorm > 0.0);
+  CPPUNIT_ASSERT(!fields.hasField("residual interior"));
+
+  // Residual with overlapping assembly. On a single process all cells
+  // are interior cells and the only contributions to points touched by
+  // the interior cells during the boundary pass come from the fault,
+  // so the sums are identical, not just equal within roundoff.
+  formulation.overlapAssembly(true);
+  formulation.reformResidual();
+  CPPUNIT_ASSERT(fields.hasField("residual interior"));
+
+  err = VecGetArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < residualSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(residualE[i], PylithScalar(residualArray[i]));
+  } // for
+  err = VecRestoreArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+
+  // Integrators are restored to integrate all cells, so switching back
+  // to assembly without overlap gives the same residual.
+  formulation.overlapAssembly(false);
+  formulation.reformResidual();
+  err = VecGetArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < residualSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(residualE[i], PylithScalar(residualArray[i]));
+  } // for
+  err = VecRestoreArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+
+  // Repeated assembly with overlap reuses the interior buffer.
+  formulation.overlapAssembly(true);
+  formulation.reformResidual();
+  err = VecGetArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < residualSize; ++i) {
+    CPPUNIT_ASSERT_EQUAL(residualE[i], PylithScalar(residualArray[i]));
+  } // for
+  err = VecRestoreArrayRead(residual.localVector(), &residualArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // testReformResidualOverlap
+
+// ----------------------------------------------------------------------
+// Set values of field.
+void
+pylith::problems::TestFormulation::_setField(topology::Field* field,
+					     const PylithScalar scale)
+{ // _setField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+
+  PetscVec fieldVec = field->localVector();CPPUNIT_ASSERT(fieldVec);
+  PetscInt size = 0;
+  PetscScalar* fieldArray = NULL;
+  PetscErrorCode err = VecGetLocalSize(fieldVec, &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(fieldVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < size; ++i) {
+    // Values without a pattern, so that contributions from different
+    // cells do not cancel.
+    fieldArray[i] = scale * (1.0 + 0.37*(i % 5) - 0.21*(i % 3) + 0.013*i);
+  } // for
+  err = VecRestoreArray(fieldVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setField
+
+
+// End of file
@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestFormulation.hh
+ *
+ * @brief C++ TestFormulation object
+ *
+ * C++ unit testing for Formulation.
+ */
+
+#if !defined(pylith_problems_testformulation_hh)
+#define pylith_problems_testformulation_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestFormulation;
+  } // problems
+} // pylith
+
+/// C++ unit testing for Formulation
+class pylith::problems::TestFormulation : public CppUnit::TestFixture
+{ // class TestFormulation
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestFormulation );
+
+  CPPUNIT_TEST( testOverlapAssembly );
+  CPPUNIT_TEST( testReformResidualOverlap );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test overlapAssembly().
+  void testOverlapAssembly(void);
+
+  /// Test reformResidual() with overlapping assembly.
+  void testReformResidualOverlap(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Set values of field.
+   *
+   * @param field Field to set.
+   * @param scale Scale of values.
+   */
+  static
+  void _setField(topology::Field* field,
+		 const PylithScalar scale);
+
+}; // class TestFormulation
+
+#endif // pylith_problems_testformulation_hh
+
+
+// End of file
@@ -0,0 +1,295 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSolverNonlinear.hh" // Implementation of class methods
+
+#include "pylith/problems/SolverNonlinear.hh" // USES SolverNonlinear
+#include "pylith/problems/Implicit.hh" // USES Implicit
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSolverNonlinear );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace problems {
+    namespace _TestSolverNonlinear {
+      const int size = 3;
+
+      // Converged increments of two previous time steps.
+      const PylithScalar dt1 = 1.0;
+      const PylithScalar incr1[size] = { 1.0, 2.0, 3.0 };
+      const PylithScalar dt2 = 0.5;
+      const PylithScalar incr2[size] = { 0.8, 1.0, 1.3 };
+
+      // Current time step.
+      const PylithScalar dt = 0.25;
+
+      // No history: du = 0
+      const PylithScalar incrZero[size] = { 0.0, 0.0, 0.0 };
+
+      // One increment in history: du = dt2/dt1 du1
+      const PylithScalar incrPredict1[size] = { 0.5, 1.0, 1.5 };
+
+      // Linear: du = dt/dt2 du2
+      const PylithScalar incrLinear[size] = { 0.4, 0.5, 0.65 };
+
+      // Quadratic:
+      //   v2 = du2/dt2 = [1.6, 2.0, 2.6], v1 = du1/dt1 = [1.0, 2.0, 3.0]
+      //   v = v2 + (v2 - v1) (dt + dt2) / (dt2 + dt1) = [1.9, 2.0, 2.4]
+      //   du = dt v
+      const PylithScalar incrQuadratic[size] = { 0.475, 0.5, 0.6 };
+    } // _TestSolverNonlinear
+  } // problems
+} // pylith
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::problems::TestSolverNonlinear::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  _mesh = new topology::Mesh;CPPUNIT_ASSERT(_mesh);
+  _fields = new topology::SolutionFields(*_mesh);CPPUNIT_ASSERT(_fields);
+  _jacobian = new topology::Field(*_mesh);CPPUNIT_ASSERT(_jacobian);
+  _formulation = new Implicit;CPPUNIT_ASSERT(_formulation);
+
+  _solver = new SolverNonlinear;CPPUNIT_ASSERT(_solver);
+  _solver->_formulation = _formulation;
+  PetscErrorCode err = SNESCreate(PETSC_COMM_SELF, &_solver->_snes);CPPUNIT_ASSERT(!err);
+
+  err = VecCreateSeq(PETSC_COMM_SELF, _TestSolverNonlinear::size, &_incrVec);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::problems::TestSolverNonlinear::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = VecDestroy(&_incrVec);CPPUNIT_ASSERT(!err);
+  delete _solver; _solver = 0;
+  delete _formulation; _formulation = 0;
+  delete _jacobian; _jacobian = 0;
+  delete _fields; _fields = 0;
+  delete _mesh; _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test predictor().
+void
+pylith::problems::TestSolverNonlinear::testPredictor(void)
+{ // testPredictor
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_solver);
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::PREDICTOR_ZERO, _solver->predictor());
+
+  _solver->predictor("linear");
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::PREDICTOR_LINEAR, _solver->predictor());
+
+  _solver->predictor("Quadratic");
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::PREDICTOR_QUADRATIC, _solver->predictor());
+
+  _solver->predictor("ZERO");
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::PREDICTOR_ZERO, _solver->predictor());
+
+  CPPUNIT_ASSERT_THROW(_solver->predictor("cubic"), std::runtime_error);
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::PREDICTOR_ZERO, _solver->predictor());
+
+  // Zero predictor keeps no history.
+  _addIncr(_TestSolverNonlinear::dt1, _TestSolverNonlinear::incr1);
+  CPPUNIT_ASSERT_EQUAL(0, _solver->_numIncr);
+  _setTimeStep(_TestSolverNonlinear::dt);
+  _checkPredictIncr(_TestSolverNonlinear::incrZero);
+
+  PYLITH_METHOD_END;
+} // testPredictor
+
+// ----------------------------------------------------------------------
+// Test _predictIncr() with linear predictor.
+void
+pylith::problems::TestSolverNonlinear::testPredictIncrLinear(void)
+{ // testPredictIncrLinear
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_solver);
+  _solver->predictor("linear");
+
+  _setTimeStep(_TestSolverNonlinear::dt1);
+  _checkPredictIncr(_TestSolverNonlinear::incrZero);
+
+  _addIncr(_TestSolverNonlinear::dt1, _TestSolverNonlinear::incr1);
+  CPPUNIT_ASSERT_EQUAL(1, _solver->_numIncr);
+  _setTimeStep(_TestSolverNonlinear::dt2);
+  _checkPredictIncr(_TestSolverNonlinear::incrPredict1);
+
+  // Only the last increment is kept.
+  _addIncr(_TestSolverNonlinear::dt2, _TestSolverNonlinear::incr2);
+  CPPUNIT_ASSERT_EQUAL(1, _solver->_numIncr);
+  _setTimeStep(_TestSolverNonlinear::dt);
+  _checkPredictIncr(_TestSolverNonlinear::incrLinear);
+
+  PYLITH_METHOD_END;
+} // testPredictIncrLinear
+
+// ----------------------------------------------------------------------
+// Test _predictIncr() with quadratic predictor.
+void
+pylith::problems::TestSolverNonlinear::testPredictIncrQuadratic(void)
+{ // testPredictIncrQuadratic
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_solver);
+  _solver->predictor("quadratic");
+
+  _setTimeStep(_TestSolverNonlinear::dt1);
+  _checkPredictIncr(_TestSolverNonlinear::incrZero);
+
+  // Fewer increments than order of predictor falls back to linear.
+  _addIncr(_TestSolverNonlinear::dt1, _TestSolverNonlinear::incr1);
+  CPPUNIT_ASSERT_EQUAL(1, _solver->_numIncr);
+  _setTimeStep(_TestSolverNonlinear::dt2);
+  _checkPredictIncr(_TestSolverNonlinear::incrPredict1);
+
+  _addIncr(_TestSolverNonlinear::dt2, _TestSolverNonlinear::incr2);
+  CPPUNIT_ASSERT_EQUAL(2, _solver->_numIncr);
+  _setTimeStep(_TestSolverNonlinear::dt);
+  _checkPredictIncr(_TestSolverNonlinear::incrQuadratic);
+
+  PYLITH_METHOD_END;
+} // testPredictIncrQuadratic
+
+// ----------------------------------------------------------------------
+// Test resetPredictor().
+void
+pylith::problems::TestSolverNonlinear::testResetPredictor(void)
+{ // testResetPredictor
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_solver);
+  _solver->predictor("quadratic");
+
+  _addIncr(_TestSolverNonlinear::dt1, _TestSolverNonlinear::incr1);
+  _setTimeStep(_TestSolverNonlinear::dt2);
+  _checkPredictIncr(_TestSolverNonlinear::incrPredict1);
+  _addIncr(_TestSolverNonlinear::dt2, _TestSolverNonlinear::incr2);
+  CPPUNIT_ASSERT_EQUAL(2, _solver->_numIncr);
+
+  _solver->resetPredictor();
+  CPPUNIT_ASSERT_EQUAL(0, _solver->_numIncr);
+  CPPUNIT_ASSERT(!_solver->_incrN);
+  CPPUNIT_ASSERT(!_solver->_incrNm1);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), _solver->_dtN);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), _solver->_dtNm1);
+  _setTimeStep(_TestSolverNonlinear::dt);
+  _checkPredictIncr(_TestSolverNonlinear::incrZero);
+
+  // History is rebuilt after reset.
+  _addIncr(_TestSolverNonlinear::dt1, _TestSolverNonlinear::incr1);
+  _setTimeStep(_TestSolverNonlinear::dt2);
+  _checkPredictIncr(_TestSolverNonlinear::incrPredict1);
+
+  // Setting the predictor also discards the history.
+  _solver->predictor("quadratic");
+  CPPUNIT_ASSERT_EQUAL(0, _solver->_numIncr);
+  _checkPredictIncr(_TestSolverNonlinear::incrZero);
+
+  PYLITH_METHOD_END;
+} // testResetPredictor
+
+// ----------------------------------------------------------------------
+// Set time step of formulation.
+void
+pylith::problems::TestSolverNonlinear::_setTimeStep(const PylithScalar dt)
+{ // _setTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_formulation);
+  const PylithScalar t = 0.0;
+  _formulation->updateSettings(_jacobian, _fields, t, dt);
+  CPPUNIT_ASSERT_EQUAL(dt, _formulation->timeStep());
+
+  PYLITH_METHOD_END;
+} // _setTimeStep
+
+// ----------------------------------------------------------------------
+// Add converged increment to history of predictor.
+void
+pylith::problems::TestSolverNonlinear::_addIncr(const PylithScalar dt,
+						const PylithScalar* values)
+{ // _addIncr
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_solver);
+  CPPUNIT_ASSERT(values);
+
+  _setTimeStep(dt);
+
+  PetscScalar* incrArray = NULL;
+  PetscErrorCode err = VecGetArray(_incrVec, &incrArray);CPPUNIT_ASSERT(!err);
+  for (int i=0; i < _TestSolverNonlinear::size; ++i) {
+    incrArray[i] = values[i];
+  } // for
+  err = VecRestoreArray(_incrVec, &incrArray);CPPUNIT_ASSERT(!err);
+
+  _solver->_updatePredictor(_incrVec);
+
+  PYLITH_METHOD_END;
+} // _addIncr
+
+// ----------------------------------------------------------------------
+// Check predicted increment.
+void
+pylith::problems::TestSolverNonlinear::_checkPredictIncr(const PylithScalar* valuesE)
+{ // _checkPredictIncr
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_solver);
+  CPPUNIT_ASSERT(valuesE);
+
+  PetscErrorCode err = VecSet(_incrVec, 99.0);CPPUNIT_ASSERT(!err);
+  _solver->_predictIncr(_incrVec);
+
+  const PylithScalar tolerance = 1.0e-12;
+  const PetscScalar* incrArray = NULL;
+  err = VecGetArrayRead(_incrVec, &incrArray);CPPUNIT_ASSERT(!err);
+  for (int i=0; i < _TestSolverNonlinear::size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[i], incrArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(_incrVec, &incrArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // _checkPredictIncr
+
+
+// End of file 
@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSolverNonlinear.hh
+ *
+ * @brief C++ TestSolverNonlinear object
+ *
+ * C++ unit testing for SolverNonlinear.
+ */
+
+#if !defined(pylith_problems_testsolvernonlinear_hh)
+#define pylith_problems_testsolvernonlinear_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // HOLDSA Implicit, SolverNonlinear
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field, SolutionFields
+#include "pylith/utils/petscfwd.h" // USES PetscVec
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSolverNonlinear;
+  } // problems
+} // pylith
+
+/// C++ unit testing for SolverNonlinear
+class pylith::problems::TestSolverNonlinear : public CppUnit::TestFixture
+{ // class TestSolverNonlinear
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSolverNonlinear );
+
+  CPPUNIT_TEST( testPredictor );
+  CPPUNIT_TEST( testPredictIncrLinear );
+  CPPUNIT_TEST( testPredictIncrQuadratic );
+  CPPUNIT_TEST( testResetPredictor );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test predictor().
+  void testPredictor(void);
+
+  /// Test _predictIncr() with linear predictor.
+  void testPredictIncrLinear(void);
+
+  /// Test _predictIncr() with quadratic predictor.
+  void testPredictIncrQuadratic(void);
+
+  /// Test resetPredictor().
+  void testResetPredictor(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Set time step of formulation.
+   *
+   * @param dt Time step.
+   */
+  void _setTimeStep(const PylithScalar dt);
+
+  /** Add converged increment to history of predictor.
+   *
+   * @param dt Time step of increment.
+   * @param values Values of increment.
+   */
+  void _addIncr(const PylithScalar dt,
+		const PylithScalar* values);
+
+  /** Check predicted increment.
+   *
+   * @param valuesE Expected values of predicted increment.
+   */
+  void _checkPredictIncr(const PylithScalar* valuesE);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  topology::Mesh* _mesh; ///< Empty mesh for handles in formulation.
+  topology::SolutionFields* _fields; ///< Solution fields.
+  topology::Field* _jacobian; ///< Lumped Jacobian.
+  Implicit* _formulation; ///< Formulation providing time step.
+  SolverNonlinear* _solver; ///< Solver under test.
+  PetscVec _incrVec; ///< Solution increment.
+
+}; // class TestSolverNonlinear
+
+#endif // pylith_problems_testsolvernonlinear_hh
+
+
+// End of file 
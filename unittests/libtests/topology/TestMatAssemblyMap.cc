@@ -0,0 +1,253 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMatAssemblyMap.hh" // Implementation of class methods
+
+#include "pylith/topology/MatAssemblyMap.hh" // USES MatAssemblyMap
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES MatVisitorMesh
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "pylith/utils/array.hh" // USES int_array, scalar_array
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestMatAssemblyMap );
+
+// ----------------------------------------------------------------------
+// Test isCurrent().
+void
+pylith::topology::TestMatAssemblyMap::testIsCurrent(void)
+{ // testIsCurrent
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+  Jacobian jacobian(field);
+  Jacobian jacobianB(field);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  int_array cells(numCells);
+  for (PetscInt c = 0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  MatAssemblyMap map;
+  CPPUNIT_ASSERT(!map.isCurrent(jacobian.matrix()));
+
+  jacobian.assemble("final_assembly");
+  map.setup(jacobian.matrix(), field, &cells[0], numCells);
+  CPPUNIT_ASSERT(map.isCurrent(jacobian.matrix()));
+  CPPUNIT_ASSERT(!map.isCurrent(jacobianB.matrix()));
+
+  map.deallocate();
+  CPPUNIT_ASSERT(!map.isCurrent(jacobian.matrix()));
+
+  PYLITH_METHOD_END;
+} // testIsCurrent
+
+// ----------------------------------------------------------------------
+// Test addClosure().
+void
+pylith::topology::TestMatAssemblyMap::testAddClosure(void)
+{ // testAddClosure
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+  Jacobian jacobianE(field);
+  Jacobian jacobian(field);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  int_array cells(numCells);
+  for (PetscInt c = 0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  const int numCorners = mesh.numCorners();
+  const int spaceDim = mesh.dimension();
+  const int size = numCorners*spaceDim*numCorners*spaceDim;
+  scalar_array valuesCell(size);
+
+  MatAssemblyMap map;
+  MatVisitorMesh visitorE(jacobianE.matrix(), field);
+
+  // First pass uses indices, second pass uses positions in storage
+  // of assembled matrix.
+  const PylithScalar tolerance = 1.0e-10;
+  for (int iPass = 0; iPass < 2; ++iPass) {
+    jacobianE.zero();
+    jacobian.zero();
+    if (!map.isCurrent(jacobian.matrix())) {
+      map.setup(jacobian.matrix(), field, &cells[0], numCells);
+    } // if
+
+    map.beginAssembly();
+    for (PetscInt c = 0; c < numCells; ++c) {
+      for (int i = 0; i < size; ++i) {
+	valuesCell[i] = 1.0 + 0.1*i + 2.0*c;
+      } // for
+      visitorE.setClosure(&valuesCell[0], size, cells[c], ADD_VALUES);
+      map.addClosure(&valuesCell[0], size, c);
+    } // for
+    map.endAssembly();
+
+    jacobianE.assemble("final_assembly");
+    jacobian.assemble("final_assembly");
+
+    PetscErrorCode err = 0;
+    PetscReal norm = 0.0, normE = 0.0;
+    err = MatNorm(jacobianE.matrix(), NORM_FROBENIUS, &normE);CPPUNIT_ASSERT(!err);
+    err = MatAXPY(jacobian.matrix(), -1.0, jacobianE.matrix(), SAME_NONZERO_PATTERN);CPPUNIT_ASSERT(!err);
+    err = MatNorm(jacobian.matrix(), NORM_FROBENIUS, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(normE > 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, norm/normE, tolerance);
+  } // for
+  CPPUNIT_ASSERT(map._usePositions);
+
+  PYLITH_METHOD_END;
+} // testAddClosure
+
+// ----------------------------------------------------------------------
+// Test addClosure() with blocks of precomputed indices.
+void
+pylith::topology::TestMatAssemblyMap::testAddBlock(void)
+{ // testAddBlock
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+  Jacobian jacobianE(field);
+  Jacobian jacobian(field);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  int_array cells(numCells);
+  for (PetscInt c = 0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  const int numCorners = mesh.numCorners();
+  const int spaceDim = mesh.dimension();
+  const int blockSize = numCorners*spaceDim;
+  const int size = blockSize*blockSize;
+  scalar_array valuesCell(size);
+
+  // Use global indices of the closure of each cell as blocks.
+  MatAssemblyMap mapE;
+  mapE.setup(jacobianE.matrix(), field, &cells[0], numCells);
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*blockSize), mapE._indices.size());
+  const int_array indices(mapE._indices);
+
+  MatAssemblyMap map;
+
+  // First pass uses indices, second pass uses positions in storage
+  // of assembled matrix.
+  const PylithScalar tolerance = 1.0e-10;
+  for (int iPass = 0; iPass < 2; ++iPass) {
+    jacobianE.zero();
+    jacobian.zero();
+    if (!mapE.isCurrent(jacobianE.matrix())) {
+      mapE.setup(jacobianE.matrix(), field, &cells[0], numCells);
+    } // if
+    if (!map.isCurrent(jacobian.matrix())) {
+      map.setup(jacobian.matrix(), &indices[0], numCells, blockSize);
+    } // if
+
+    mapE.beginAssembly();
+    map.beginAssembly();
+    for (PetscInt c = 0; c < numCells; ++c) {
+      for (int i = 0; i < size; ++i) {
+	valuesCell[i] = 1.0 + 0.1*i + 2.0*c;
+      } // for
+      mapE.addClosure(&valuesCell[0], size, c);
+      map.addClosure(&valuesCell[0], size, c);
+    } // for
+    map.endAssembly();
+    mapE.endAssembly();
+
+    jacobianE.assemble("final_assembly");
+    jacobian.assemble("final_assembly");
+
+    PetscErrorCode err = 0;
+    PetscReal norm = 0.0, normE = 0.0;
+    err = MatNorm(jacobianE.matrix(), NORM_FROBENIUS, &normE);CPPUNIT_ASSERT(!err);
+    err = MatAXPY(jacobian.matrix(), -1.0, jacobianE.matrix(), SAME_NONZERO_PATTERN);CPPUNIT_ASSERT(!err);
+    err = MatNorm(jacobian.matrix(), NORM_FROBENIUS, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(normE > 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, norm/normE, tolerance);
+  } // for
+  CPPUNIT_ASSERT(map._usePositions);
+
+  PYLITH_METHOD_END;
+} // testAddBlock
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestMatAssemblyMap::_initializeMesh(Mesh* mesh) const
+{ // _initializeMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(mesh);
+
+  PYLITH_METHOD_END;
+} // _initializeMesh
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestMatAssemblyMap::_initializeField(Mesh* mesh,
+						       Field* field) const
+{ // _initializeField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(field);
+
+  field->newSection(FieldBase::VERTICES_FIELD, mesh->dimension());
+  field->allocate();
+  field->zero();
+
+  PYLITH_METHOD_END;
+} // _initializeField
+
+
+// End of file 
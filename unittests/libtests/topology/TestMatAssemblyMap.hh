@@ -0,0 +1,88 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestMatAssemblyMap.hh
+ *
+ * @brief C++ TestMatAssemblyMap object.
+ * 
+ * C++ unit testing for MatAssemblyMap.
+ */
+
+#if !defined(pylith_topology_testmatassemblymap_hh)
+#define pylith_topology_testmatassemblymap_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh"
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestMatAssemblyMap;
+  } // topology
+} // pylith
+
+/// C++ unit testing for MatAssemblyMap.
+class pylith::topology::TestMatAssemblyMap : public CppUnit::TestFixture
+{ // class TestMatAssemblyMap
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMatAssemblyMap );
+
+  CPPUNIT_TEST( testIsCurrent );
+  CPPUNIT_TEST( testAddClosure );
+  CPPUNIT_TEST( testAddBlock );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test isCurrent().
+  void testIsCurrent(void);
+
+  /// Test addClosure().
+  void testAddClosure(void);
+
+  /// Test addClosure() with blocks of precomputed indices.
+  void testAddBlock(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize mesh.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _initializeMesh(Mesh* mesh) const;
+
+  /** Initialize field.
+   *
+   * @param mesh Finite-element mesh.
+   * @param field Solution field.
+   */
+  void _initializeField(Mesh* mesh,
+			Field* field) const;
+
+}; // class TestMatAssemblyMap
+
+#endif // pylith_topology_testmatassemblymap_hh
+
+
+// End of file 
@@ -0,0 +1,319 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum, StratumIS
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include <cstdlib> // USES abs()
+#include <algorithm> // USES std::min(), std::max()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestSpaceFillingCurve );
+
+// ----------------------------------------------------------------------
+// Test _curveIndex().
+void
+pylith::topology::TestSpaceFillingCurve::testCurveIndex(void)
+{ // testCurveIndex
+  PYLITH_METHOD_BEGIN;
+
+  // Consecutive points along the Hilbert curve on a 4x4 grid are
+  // nearest neighbors.
+  const int numBits = 2;
+  const int size = 4;
+  int pointsX[size*size];
+  int pointsY[size*size];
+  for (int i=0; i < size*size; ++i) {
+    pointsX[i] = -1;
+  } // for
+  for (int x=0; x < size; ++x) {
+    for (int y=0; y < size; ++y) {
+      unsigned int coords[2] = { x, y };
+      const unsigned int index = SpaceFillingCurve::_curveIndex(coords, 2, numBits, SpaceFillingCurve::HILBERT);
+      CPPUNIT_ASSERT(index < unsigned(size*size));
+      CPPUNIT_ASSERT_EQUAL(-1, pointsX[index]);
+      pointsX[index] = x;
+      pointsY[index] = y;
+    } // for
+  } // for
+  CPPUNIT_ASSERT_EQUAL(0, pointsX[0]);
+  CPPUNIT_ASSERT_EQUAL(0, pointsY[0]);
+  for (int i=1; i < size*size; ++i) {
+    const int distance = abs(pointsX[i]-pointsX[i-1]) + abs(pointsY[i]-pointsY[i-1]);
+    CPPUNIT_ASSERT_EQUAL(1, distance);
+  } // for
+
+  // Morton curve interleaves bits.
+  unsigned int coords[2] = { 3, 2 };
+  CPPUNIT_ASSERT_EQUAL(14U, SpaceFillingCurve::_curveIndex(coords, 2, numBits, SpaceFillingCurve::MORTON));
+
+  PYLITH_METHOD_END;
+} // testCurveIndex
+
+// ----------------------------------------------------------------------
+// Test reorder() with tri3 cells and no fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTri3(void)
+{ // testReorderTri3
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderTri3
+
+// ----------------------------------------------------------------------
+// Test reorder() with tri3 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTri3Fault(void)
+{ // testReorderTri3Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderTri3Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with quad4 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderQuad4Fault(void)
+{ // testReorderQuad4Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_quad4.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderQuad4Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with tet4 cells and no fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTet4(void)
+{ // testReorderTet4
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tet4.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderTet4
+
+// ----------------------------------------------------------------------
+// Test reorder() with tet4 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTet4Fault(void)
+{ // testReorderTet4Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tet4.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderTet4Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with hex8 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderHex8Fault(void)
+{ // testReorderHex8Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderHex8Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with Morton curve, hex8 cells, and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderMorton(void)
+{ // testReorderMorton
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh", "fault", SpaceFillingCurve::MORTON);
+
+  PYLITH_METHOD_END;
+} // testReorderMorton
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestSpaceFillingCurve::_setupMesh(Mesh* const mesh,
+						    const char* filename,
+						    const char* faultGroup)
+{ // _setupMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.interpolate(true);
+
+  iohandler.read(mesh);
+  CPPUNIT_ASSERT(mesh->numCells() > 0);
+  CPPUNIT_ASSERT(mesh->numVertices() > 0);
+
+  // Adjust topology if necessary.
+  if (faultGroup) {
+    int firstLagrangeVertex = 0;
+    int firstFaultCell = 0;
+
+    faults::FaultCohesiveKin fault;
+    fault.id(100);
+    fault.label(faultGroup);
+    const int nvertices = fault.numVerticesNoMesh(*mesh);
+    firstLagrangeVertex += nvertices;
+    firstFaultCell += 2*nvertices; // shadow + Lagrange vertices
+
+    int firstFaultVertex = 0;
+    fault.adjustTopology(mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+  } // if
+
+  PYLITH_METHOD_END;
+} // _setupMesh
+
+// ----------------------------------------------------------------------
+// Test reorder().
+void
+pylith::topology::TestSpaceFillingCurve::_testReorder(const char* filename,
+						      const char* faultGroup,
+						      const SpaceFillingCurve::CurveEnum curve)
+{ // _testReorder
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh, filename, faultGroup);
+
+  // Keep original DM.
+  const PetscDM dmOrig = mesh.dmMesh();
+  PetscErrorCode err = PetscObjectReference((PetscObject) dmOrig);PYLITH_CHECK_ERROR(err);
+  Mesh meshOrig;
+  meshOrig.dmMesh(dmOrig);
+
+  SpaceFillingCurve::reorder(&mesh, curve);
+
+  const PetscDM& dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+  // Check vertices and cells (size only)
+  topology::Stratum verticesStratumE(dmOrig, topology::Stratum::DEPTH, 0);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  CPPUNIT_ASSERT_EQUAL(verticesStratumE.size(), verticesStratum.size());
+
+  topology::Stratum cellsStratumE(dmOrig, topology::Stratum::HEIGHT, 0);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  CPPUNIT_ASSERT_EQUAL(cellsStratumE.size(), cellsStratum.size());
+
+  // Cohesive cells remain at end.
+  PetscInt cMaxE = -1, cMax = -1;
+  err = DMPlexGetHybridBounds(dmOrig, &cMaxE, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(cMaxE, cMax);
+
+  // Check groups
+  PetscInt numGroupsE, numGroups;
+  err = DMGetNumLabels(dmOrig, &numGroupsE);PYLITH_CHECK_ERROR(err);
+  err = DMGetNumLabels(dmMesh, &numGroups);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(numGroupsE, numGroups);
+
+  for (PetscInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+    const char *name = NULL;
+    err = DMGetLabelName(dmMesh, iGroup, &name);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numPointsE, numPoints;
+    err = DMGetStratumSize(dmOrig, name, 1, &numPointsE);PYLITH_CHECK_ERROR(err);
+    err = DMGetStratumSize(dmMesh, name, 1, &numPoints);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+  } // for
+
+  // Cells of each material form a contiguous range.
+  PetscIS materialIdsIS = NULL;
+  PetscInt numMaterials = 0;
+  const PetscInt* materialIds = NULL;
+  err = DMGetLabelIdIS(dmMesh, "material-id", &materialIdsIS);PYLITH_CHECK_ERROR(err);
+  err = ISGetLocalSize(materialIdsIS, &numMaterials);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(materialIdsIS, &materialIds);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iMaterial=0; iMaterial < numMaterials; ++iMaterial) {
+    const bool includeOnlyCells = true;
+    StratumIS materialIS(dmMesh, "material-id", materialIds[iMaterial], includeOnlyCells);
+    const PetscInt numCells = materialIS.size();
+    const PetscInt* cells = materialIS.points();
+    if (numCells > 0) {
+      PetscInt cMin = cells[0], cLast = cells[0];
+      for (PetscInt iCell=1; iCell < numCells; ++iCell) {
+	cMin = std::min(cMin, cells[iCell]);
+	cLast = std::max(cLast, cells[iCell]);
+      } // for
+      CPPUNIT_ASSERT_EQUAL(numCells, cLast-cMin+1);
+    } // if
+  } // for
+  err = ISRestoreIndices(materialIdsIS, &materialIds);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&materialIdsIS);PYLITH_CHECK_ERROR(err);
+
+  // Check element centroids
+  PylithScalar coordsCheckOrig = 0.0;
+  { // original
+    Stratum cellsStratum(dmOrig, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    topology::CoordsVisitor coordsVisitor(dmOrig);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+      PetscScalar* coordsCell = NULL;
+      PetscInt coordsSize = 0;
+      PylithScalar value = 0.0;
+      coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+      for (int i=0; i < coordsSize; ++i) {
+	value += coordsCell[i];
+      } // for
+      coordsCheckOrig += value*value;
+      coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+    } // for
+  } // original
+  PylithScalar coordsCheck = 0.0;
+  { // reordered
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+      PetscScalar* coordsCell = NULL;
+      PetscInt coordsSize = 0;
+      PylithScalar value = 0.0;
+      coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+      for (int i=0; i < coordsSize; ++i) {
+	value += coordsCell[i];
+      } // for
+      coordsCheck += value*value;
+      coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+    } // for
+  } // reordered
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(coordsCheckOrig, coordsCheck, tolerance*coordsCheckOrig);
+
+  PYLITH_METHOD_END;
+} // _testReorder
+
+
+// End of file
@@ -0,0 +1,171 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+
+#include <portinfo>
+
+#include "TestBatchQuery.hh" // Implementation of class methods
+
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestBatchQuery );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace utils {
+    namespace _TestBatchQuery {
+      const int spaceDim = 2;
+      const int numPoints = 5;
+      const PylithScalar coords[numPoints*spaceDim] = {
+	0.0, 0.0,
+	1.0, 1.0,
+	0.1, 0.0,
+	0.9, 1.0,
+	0.0, 0.1,
+      };
+      const PylithScalar lengthScale = 1000.0;
+      const int order[numPoints] = { 0, 2, 4, 3, 1 };
+    } // _TestBatchQuery
+  } // utils
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test points() and point().
+void
+pylith::utils::TestBatchQuery::testPoints(void)
+{ // testPoints
+  PYLITH_METHOD_BEGIN;
+
+  const int spaceDim = _TestBatchQuery::spaceDim;
+  const int numPoints = _TestBatchQuery::numPoints;
+  const PylithScalar lengthScale = _TestBatchQuery::lengthScale;
+
+  scalar_array coords(_TestBatchQuery::coords, numPoints*spaceDim);
+  BatchQuery query;
+  query.points(coords, spaceDim, lengthScale);
+
+  CPPUNIT_ASSERT_EQUAL(numPoints, query.numPoints());
+  CPPUNIT_ASSERT_EQUAL(spaceDim, query.spaceDim());
+
+  const PylithScalar tolerance = 1.0e-6;
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar* xyz = query.point(iPoint);
+    for (int d=0; d < spaceDim; ++d) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(coords[iPoint*spaceDim+d]*lengthScale, xyz[d], tolerance*lengthScale);
+    } // for
+  } // for
+
+  // Points are visited along the Morton curve.
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints), query._order.size());
+  for (int i=0; i < numPoints; ++i) {
+    CPPUNIT_ASSERT_EQUAL(_TestBatchQuery::order[i], int(query._order[i]));
+  } // for
+
+  // No sorting preserves original order.
+  query.sortPoints(false);
+  query.points(coords, spaceDim, lengthScale);
+  for (int i=0; i < numPoints; ++i) {
+    CPPUNIT_ASSERT_EQUAL(i, int(query._order[i]));
+  } // for
+
+  PYLITH_METHOD_END;
+} // testPoints
+
+// ----------------------------------------------------------------------
+// Test query().
+void
+pylith::utils::TestBatchQuery::testQuery(void)
+{ // testQuery
+  PYLITH_METHOD_BEGIN;
+
+  const int spaceDim = _TestBatchQuery::spaceDim;
+  const int numPoints = _TestBatchQuery::numPoints;
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+
+  const int numValues = 2;
+  const char* names[numValues] = { "a", "b" };
+  const char* units[numValues] = { "none", "none" };
+  const double values[numValues] = { 2.5, -1.5 };
+  spatialdata::spatialdb::UniformDB db("TestBatchQuery");
+  db.setData(names, units, values, numValues);
+
+  scalar_array coords(_TestBatchQuery::coords, numPoints*spaceDim);
+  BatchQuery query;
+  query.points(coords, spaceDim, _TestBatchQuery::lengthScale);
+
+  scalar_array valuesPoints;
+  db.open();
+  db.queryVals(names, numValues);
+  const int err = query.query(&valuesPoints, numValues, &db, &cs);
+  db.close();
+  CPPUNIT_ASSERT_EQUAL(-1, err);
+
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints*numValues), valuesPoints.size());
+  const PylithScalar tolerance = 1.0e-6;
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numValues; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(values[i], valuesPoints[iPoint*numValues+i], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testQuery
+
+// ----------------------------------------------------------------------
+// Test query() with no points.
+void
+pylith::utils::TestBatchQuery::testQueryEmpty(void)
+{ // testQueryEmpty
+  PYLITH_METHOD_BEGIN;
+
+  const int spaceDim = _TestBatchQuery::spaceDim;
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+
+  spatialdata::spatialdb::UniformDB db("TestBatchQuery");
+  const char* names[1] = { "a" };
+  const char* units[1] = { "none" };
+  const double values[1] = { 1.0 };
+  db.setData(names, units, values, 1);
+
+  BatchQuery query;
+  scalar_array coords;
+  query.points(coords, spaceDim, _TestBatchQuery::lengthScale);
+  CPPUNIT_ASSERT_EQUAL(0, query.numPoints());
+
+  scalar_array valuesPoints;
+  db.open();
+  db.queryVals(names, 1);
+  CPPUNIT_ASSERT_EQUAL(-1, query.query(&valuesPoints, 1, &db, &cs));
+  db.close();
+  CPPUNIT_ASSERT_EQUAL(size_t(0), valuesPoints.size());
+
+  PYLITH_METHOD_END;
+} // testQueryEmpty
+
+
+// End of file 
@@ -0,0 +1,68 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+
+/**
+ * @file unittests/libtests/utils/TestBatchQuery.hh
+ *
+ * @brief C++ TestBatchQuery object
+ *
+ * C++ unit testing for BatchQuery.
+ */
+
+#if !defined(pylith_utils_testbatchquery_hh)
+#define pylith_utils_testbatchquery_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestBatchQuery;
+  } // utils
+} // pylith
+
+/// C++ unit testing for BatchQuery
+class pylith::utils::TestBatchQuery : public CppUnit::TestFixture
+{ // class TestBatchQuery
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestBatchQuery );
+
+  CPPUNIT_TEST( testPoints );
+  CPPUNIT_TEST( testQuery );
+  CPPUNIT_TEST( testQueryEmpty );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test points() and point().
+  void testPoints(void);
+
+  /// Test query().
+  void testQuery(void);
+
+  /// Test query() with no points.
+  void testQueryEmpty(void);
+
+}; // class TestBatchQuery
+
+#endif // pylith_utils_testbatchquery_hh
+
+
+// End of file 
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+## @file unittests/pytests/meshio/TestMeshIOBox.py
+
+## @brief Unit testing of Python MeshIOBox object.
+
+import unittest
+
+from pylith.meshio.MeshIOBox import MeshIOBox
+
+# ----------------------------------------------------------------------
+class TestMeshIOBox(unittest.TestCase):
+  """
+  Unit testing of Python MeshIOBox object.
+  """
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    io = MeshIOBox()
+    return
+
+
+  def test_configure(self):
+    """
+    Test _configure().
+    """
+    io = MeshIOBox()
+    io.inventory.cellType = "quad4"
+    io.inventory.numCellsX = 4
+    io.inventory.numCellsY = 2
+    io.inventory.faults = ["fault"]
+    io.inventory.faultDirections = ["x"]
+    io.inventory.faultCoordinates = ["0.0"]
+    io.inventory.materialIds = ["2"]
+    io.inventory.materialDirections = ["y"]
+    io.inventory.materialMin = ["0.0"]
+    io.inventory.materialMax = ["1.0"]
+    io._configure()
+
+    self.assertEqual(MeshIOBox.QUAD4, io.cellType())
+    self.assertEqual(5*3, io.numVertices())
+    self.assertEqual(4*2, io.numCells())
+    return
+
+
+  def test_read(self):
+    """
+    Test read().
+    """
+    from spatialdata.geocoords.CSCart import CSCart
+    cs = CSCart()
+    cs.inventory.spaceDim = 3
+    cs._configure()
+
+    io = MeshIOBox()
+    io.inventory.cellType = "tet4"
+    io.inventory.numCellsX = 2
+    io.inventory.numCellsY = 2
+    io.inventory.numCellsZ = 2
+    io.inventory.faults = ["fault"]
+    io.inventory.faultDirections = ["x"]
+    io.inventory.faultCoordinates = ["0.0"]
+    io.inventory.coordsys = cs
+    io._configure()
+
+    mesh = io.read(debug=False, interpolate=True)
+    self.assertEqual(3, mesh.dimension())
+    return
+
+
+  def test_factory(self):
+    """
+    Test factory method.
+    """
+    from pylith.meshio.MeshIOBox import mesh_io
+    io = mesh_io()
+    return
+
+
+# End of file 
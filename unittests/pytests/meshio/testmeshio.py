@@ -47,6 +47,9 @@ class TestApp(UnitTestApp):
     from TestMeshIOAscii import TestMeshIOAscii
     suite.addTest(unittest.makeSuite(TestMeshIOAscii))
 
+    from TestMeshIOBox import TestMeshIOBox
+    suite.addTest(unittest.makeSuite(TestMeshIOBox))
+
     from TestMeshIOLagrit import TestMeshIOLagrit
     suite.addTest(unittest.makeSuite(TestMeshIOLagrit))
 